@@ -438,7 +438,7 @@ void AActor::CopyComponentData(AActor* TargetActor)
 		if (SourceMeshComp && TargetMeshComp && SourceMeshComp->GetStaticMesh())
 		{
 			// 메시 에셋 경로를 사용하여 대상 컴포넌트에 설정
-			FName AssetPath = SourceMeshComp->GetStaticMesh()->GetAssetPathFileName();
+			FName AssetPath = SourceMeshComp->GetStaticMeshAssetPath();
 			TargetMeshComp->SetStaticMesh(AssetPath);
 			
 			UE_LOG("AActor::CopyComponentData: Copied StaticMesh data: %s", 
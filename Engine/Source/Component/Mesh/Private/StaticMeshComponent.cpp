@@ -11,6 +11,7 @@
 #include "Utility/Public/JsonSerializer.h"
 #include "Texture/Public/Texture.h"
 #include "Manager/Level/Public/LevelManager.h"
+#include "Level/Public/Level.h"
 
 #include <json.hpp>
 
@@ -79,7 +80,7 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	{
 		if (StaticMesh)
 		{
-			InOutHandle["ObjStaticMeshAsset"] = StaticMesh->GetAssetPathFileName().ToString();
+			InOutHandle["ObjStaticMeshAsset"] = GetStaticMeshAssetPath().ToString();
 
 			if (0 < OverrideMaterials.size())
 			{
@@ -107,24 +108,48 @@ void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
 {
 	UAssetManager& AssetManager = UAssetManager::GetInstance();
 
-	UStaticMesh* NewStaticMesh = AssetManager.GetStaticMesh(InObjPath);
+	// 아직 로딩 중인 메시면 대체 메시를 연결해 두고, 로딩이 끝나면 AssetManager가 다시 호출한다
+	const bool bIsPending = !AssetManager.HasStaticMesh(InObjPath) && AssetManager.IsStaticMeshLoading(InObjPath);
+	const FName MeshPath = bIsPending ? UAssetManager::GetPlaceholderStaticMeshPath() : InObjPath;
+
+	UStaticMesh* NewStaticMesh = AssetManager.GetStaticMesh(MeshPath);
 
 	if (NewStaticMesh)
 	{
 		StaticMesh = NewStaticMesh;
-        VertexBuffers = AssetManager.GetVertexBuffers(InObjPath);
-        IndexBuffers = AssetManager.GetIndexBuffers(InObjPath);
+		PendingStaticMeshPath = bIsPending ? InObjPath : FName::GetNone();
+		bIsStaticMeshPending = bIsPending;
+        VertexBuffers = AssetManager.GetVertexBuffers(MeshPath);
+        IndexBuffers = AssetManager.GetIndexBuffers(MeshPath);
 
 		RenderState.CullMode = ECullMode::Back;
 		RenderState.FillMode = EFillMode::Solid;
-		BoundingBox = &AssetManager.GetStaticMeshAABB(InObjPath);
+		BoundingBox = &AssetManager.GetStaticMeshAABB(MeshPath);
 
 		MarkWorldAABBDirty();
 		if (UEditor* Editor = ULevelManager::GetInstance().GetEditor())
 		{
 			Editor->MarkPrimitiveDirty(this);
 		}
+
+		// 레벨 초기화 때 이전 메시(대체 큐브 등)의 바운드로 정적 옥트리에 들어갔으면 새 바운드로 다시 배치
+		for (TObjectIterator<ULevel> It; It; ++It)
+		{
+			if (ULevel* Level = *It)
+			{
+				Level->UpdateStaticPrimitiveBounds(this);
+			}
+		}
+	}
+}
+
+FName UStaticMeshComponent::GetStaticMeshAssetPath() const
+{
+	if (bIsStaticMeshPending)
+	{
+		return PendingStaticMeshPath;
 	}
+	return StaticMesh ? StaticMesh->GetAssetPathFileName() : FName::GetNone();
 }
 
 ID3D11Buffer* UStaticMeshComponent::GetVertexBuffer(int32 LODIndex) const
@@ -175,8 +200,8 @@ void UStaticMeshComponent::DuplicateSubObjects()
 	// VertexBuffers와 IndexBuffers는 AssetManager로부터 다시 가져와야 함
 	if (StaticMesh)
 	{
-		// 원본 메시의 에셋 경로를 사용하여 다시 로드
-		FName AssetPath = StaticMesh->GetAssetPathFileName();
+		// 원본 메시의 에셋 경로를 사용하여 다시 로드 (로딩 중이면 요청한 경로로 다시 대기)
+		FName AssetPath = GetStaticMeshAssetPath();
 		SetStaticMesh(AssetPath);
 		
 		UE_LOG("StaticMeshComponent::DuplicateSubObjects: StaticMesh data copied from %s", 
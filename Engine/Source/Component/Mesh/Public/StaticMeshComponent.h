@@ -26,6 +26,11 @@ public:
 	UStaticMesh* GetStaticMesh() { return StaticMesh; }
 	void SetStaticMesh(const FName& InObjPath);
 
+	// 요청한 메시가 아직 비동기 로딩 중이라 대체 메시를 그리는 중인지
+	bool IsStaticMeshPending() const { return bIsStaticMeshPending; }
+	// 저장/복제에 쓸 에셋 경로 (로딩 중이면 대체 메시가 아닌 요청한 경로)
+	FName GetStaticMeshAssetPath() const;
+
 	TObjectPtr<UClass> GetSpecificWidgetClass() const override;
 
 	UMaterial* GetMaterial(int32 Index) const;
@@ -49,6 +54,10 @@ public:
 private:
 	TObjectPtr<UStaticMesh> StaticMesh;
 
+	// 로딩이 끝나면 AssetManager가 이 경로로 다시 SetStaticMesh를 호출한다
+	FName PendingStaticMeshPath;
+	bool bIsStaticMeshPending = false;
+
     // Pointers to the buffers owned by the AssetManager
     const TArray<ID3D11Buffer*>* VertexBuffers = nullptr;
     const TArray<ID3D11Buffer*>* IndexBuffers = nullptr;
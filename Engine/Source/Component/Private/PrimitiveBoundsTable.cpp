@@ -0,0 +1,298 @@
+#include "pch.h"
+#include "Component/Public/PrimitiveBoundsTable.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/TransformHierarchy.h"
+#include "Utility/Public/TaskScheduler.h"
+
+#include <immintrin.h>
+
+namespace
+{
+	// 한 번에 계산하는 오브젝트 수 (SSE 레인 수)
+	constexpr int32 LaneCount = 4;
+
+	/**
+	 * @brief 오브젝트 4개의 월드 AABB를 레인마다 하나씩 계산
+	 * 행렬의 같은 행 4개를 전치해 같은 성분끼리 모으고, 로컬 중심/반경도 전치해 축별 레지스터로 만든다
+	 * 연산 순서는 FMatrix::TransformAABB(SSE)와 같아서 결과도 같다
+	 */
+	inline void TransformBounds4(const FMatrix* const InWorlds[LaneCount], const FVector4* const InCenters[LaneCount],
+		const FVector4* const InExtents[LaneCount], __m128 OutMin[3], __m128 OutMax[3])
+	{
+		const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+		__m128 Center[4] = { _mm_loadu_ps(&InCenters[0]->X), _mm_loadu_ps(&InCenters[1]->X), _mm_loadu_ps(&InCenters[2]->X), _mm_loadu_ps(&InCenters[3]->X) };
+		__m128 Extent[4] = { _mm_loadu_ps(&InExtents[0]->X), _mm_loadu_ps(&InExtents[1]->X), _mm_loadu_ps(&InExtents[2]->X), _mm_loadu_ps(&InExtents[3]->X) };
+		_MM_TRANSPOSE4_PS(Center[0], Center[1], Center[2], Center[3]);
+		_MM_TRANSPOSE4_PS(Extent[0], Extent[1], Extent[2], Extent[3]);
+
+		// 이동 행부터 시작해 중심의 X, Y, Z 성분을 차례로 누적
+		__m128 Row[4] = { _mm_loadu_ps(InWorlds[0]->Data[3]), _mm_loadu_ps(InWorlds[1]->Data[3]), _mm_loadu_ps(InWorlds[2]->Data[3]), _mm_loadu_ps(InWorlds[3]->Data[3]) };
+		_MM_TRANSPOSE4_PS(Row[0], Row[1], Row[2], Row[3]);
+		__m128 WorldCenter[3] = { Row[0], Row[1], Row[2] };
+		__m128 WorldExtent[3] = {};
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Row[0] = _mm_loadu_ps(InWorlds[0]->Data[Axis]);
+			Row[1] = _mm_loadu_ps(InWorlds[1]->Data[Axis]);
+			Row[2] = _mm_loadu_ps(InWorlds[2]->Data[Axis]);
+			Row[3] = _mm_loadu_ps(InWorlds[3]->Data[Axis]);
+			_MM_TRANSPOSE4_PS(Row[0], Row[1], Row[2], Row[3]);
+
+			for (int32 Out = 0; Out < 3; ++Out)
+			{
+				WorldCenter[Out] = _mm_add_ps(WorldCenter[Out], _mm_mul_ps(Center[Axis], Row[Out]));
+				const __m128 Term = _mm_mul_ps(Extent[Axis], _mm_and_ps(Row[Out], AbsMask));
+				WorldExtent[Out] = Axis == 0 ? Term : _mm_add_ps(WorldExtent[Out], Term);
+			}
+		}
+
+		for (int32 Out = 0; Out < 3; ++Out)
+		{
+			OutMin[Out] = _mm_sub_ps(WorldCenter[Out], WorldExtent[Out]);
+			OutMax[Out] = _mm_add_ps(WorldCenter[Out], WorldExtent[Out]);
+		}
+	}
+}
+
+FPrimitiveBoundsTable& FPrimitiveBoundsTable::Get()
+{
+	// 변환 계층과 같은 이유로 일부러 해제하지 않는다 (정적 소멸 단계의 컴포넌트도 Unregister할 수 있도록)
+	static FPrimitiveBoundsTable* Instance = new FPrimitiveBoundsTable(FTransformHierarchy::Get());
+	return *Instance;
+}
+
+int32 FPrimitiveBoundsTable::Register(const UPrimitiveComponent* InOwner, int32 InTransformHandle)
+{
+	int32 Handle;
+	if (!FreeHandles.empty())
+	{
+		Handle = FreeHandles.back();
+		FreeHandles.pop_back();
+	}
+	else
+	{
+		Handle = static_cast<int32>(Flags.size());
+		Owners.push_back(nullptr);
+		TransformHandles.push_back(InvalidHandle);
+		LocalCenters.emplace_back();
+		LocalExtents.emplace_back();
+		WorldVersions.push_back(0);
+		Flags.push_back(0);
+		WorldBounds.Add(FAABB());
+	}
+
+	Owners[Handle] = InOwner;
+	TransformHandles[Handle] = InTransformHandle;
+	LocalCenters[Handle] = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+	LocalExtents[Handle] = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+	WorldVersions[Handle] = 0;
+	Flags[Handle] = FlagAlive | FlagLocalDirty | FlagStale;
+	bHasPendingChanges = true;
+	++NumAlive;
+	return Handle;
+}
+
+void FPrimitiveBoundsTable::Unregister(int32 InHandle)
+{
+	if (InHandle == InvalidHandle || !(Flags[InHandle] & FlagAlive))
+	{
+		return;
+	}
+
+	Owners[InHandle] = nullptr;
+	TransformHandles[InHandle] = InvalidHandle;
+	Flags[InHandle] = 0;
+	FreeHandles.push_back(InHandle);
+	--NumAlive;
+}
+
+void FPrimitiveBoundsTable::SetLocalBounds(int32 InHandle, const FAABB& InLocalBounds)
+{
+	// TransformBounds4의 중심/반경이 FMatrix::TransformAABB와 같은 값이 되도록 같은 식으로 계산
+	const FVector Center = (InLocalBounds.Min + InLocalBounds.Max) * 0.5f;
+	const FVector Extent = (InLocalBounds.Max - InLocalBounds.Min) * 0.5f;
+	LocalCenters[InHandle] = FVector4(Center.X, Center.Y, Center.Z, 0.0f);
+	LocalExtents[InHandle] = FVector4(Extent.X, Extent.Y, Extent.Z, 0.0f);
+
+	Flags[InHandle] = static_cast<uint8>((Flags[InHandle] & ~FlagLocalDirty) | FlagHasBounds | FlagStale);
+	bHasPendingChanges = true;
+}
+
+void FPrimitiveBoundsTable::MarkLocalBoundsDirty(int32 InHandle)
+{
+	if (InHandle != InvalidHandle && Owners[InHandle])
+	{
+		Flags[InHandle] |= FlagLocalDirty | FlagStale;
+		bHasPendingChanges = true;
+	}
+}
+
+bool FPrimitiveBoundsTable::GetWorldBounds(int32 InHandle, FVector& OutMin, FVector& OutMax)
+{
+	if (InHandle == InvalidHandle)
+	{
+		return false;
+	}
+
+	// 월드 변환을 먼저 최신으로 만든 뒤 버전으로 판단
+	const FMatrix& World = Hierarchy.GetWorldTransform(TransformHandles[InHandle]);
+	if (PrepareSlot(InHandle))
+	{
+		const FMatrix* WorldPtr = &World;
+		ComputeBounds(&InHandle, &WorldPtr, 1);
+	}
+	if (!(Flags[InHandle] & FlagHasBounds))
+	{
+		return false;
+	}
+
+	OutMin = FVector(WorldBounds.MinX[InHandle], WorldBounds.MinY[InHandle], WorldBounds.MinZ[InHandle]);
+	OutMax = FVector(WorldBounds.MaxX[InHandle], WorldBounds.MaxY[InHandle], WorldBounds.MaxZ[InHandle]);
+	return true;
+}
+
+bool FPrimitiveBoundsTable::GetCachedWorldBounds(int32 InHandle, FAABB& OutBounds) const
+{
+	if (InHandle == InvalidHandle || !(Flags[InHandle] & FlagHasBounds))
+	{
+		return false;
+	}
+	OutBounds.Min = FVector(WorldBounds.MinX[InHandle], WorldBounds.MinY[InHandle], WorldBounds.MinZ[InHandle]);
+	OutBounds.Max = FVector(WorldBounds.MaxX[InHandle], WorldBounds.MaxY[InHandle], WorldBounds.MaxZ[InHandle]);
+	return true;
+}
+
+void FPrimitiveBoundsTable::UpdateBounds(FTaskScheduler* InScheduler)
+{
+	Hierarchy.UpdateTransforms(InScheduler);
+
+	const uint64 WorldUpdates = Hierarchy.GetNumWorldUpdates();
+	if (!bHasPendingChanges && WorldUpdates == LastWorldUpdates)
+	{
+		NumUpdatedLastPass = 0;
+		return;
+	}
+	LastWorldUpdates = WorldUpdates;
+	bHasPendingChanges = false;
+
+	// 바뀐 항목과 그 월드 행렬을 모은다 (계층 갱신이 끝났으므로 GetWorldTransform은 계산을 일으키지 않는다)
+	ScratchHandles.clear();
+	ScratchWorlds.clear();
+	const int32 NumHandles = static_cast<int32>(Flags.size());
+	for (int32 Handle = 0; Handle < NumHandles; ++Handle)
+	{
+		if ((Flags[Handle] & FlagAlive) && PrepareSlot(Handle))
+		{
+			ScratchHandles.push_back(Handle);
+			ScratchWorlds.push_back(&Hierarchy.GetWorldTransform(TransformHandles[Handle]));
+		}
+	}
+
+	const int32 NumStale = static_cast<int32>(ScratchHandles.size());
+	NumUpdatedLastPass = static_cast<uint32>(NumStale);
+	if (NumStale == 0)
+	{
+		return;
+	}
+
+	FTaskScheduler& Scheduler = InScheduler ? *InScheduler : FTaskScheduler::Get();
+	if (static_cast<uint32>(NumStale) < ParallelThreshold || Scheduler.GetNumWorkers() == 0)
+	{
+		ComputeBounds(ScratchHandles.data(), ScratchWorlds.data(), NumStale);
+	}
+	else
+	{
+		// 항목마다 쓰는 칸이 달라서 구간으로 나누기만 하면 된다 (구간 경계는 레인 수의 배수)
+		const int64 NumGroups = (NumStale + LaneCount - 1) / LaneCount;
+		Scheduler.ParallelFor(NumGroups, 256, [this, NumStale](int64 Begin, int64 End)
+			{
+				const int32 First = static_cast<int32>(Begin) * LaneCount;
+				const int32 Last = std::min(static_cast<int32>(End) * LaneCount, NumStale);
+				ComputeBounds(ScratchHandles.data() + First, ScratchWorlds.data() + First, Last - First);
+			});
+	}
+}
+
+bool FPrimitiveBoundsTable::PrepareSlot(int32 InHandle)
+{
+	uint8& SlotFlags = Flags[InHandle];
+	if (SlotFlags & FlagLocalDirty)
+	{
+		ReloadLocalBounds(InHandle);
+	}
+	if (!(SlotFlags & FlagHasBounds))
+	{
+		return false;
+	}
+
+	const uint32 Version = Hierarchy.GetWorldVersion(TransformHandles[InHandle]);
+	if (!(SlotFlags & FlagStale) && WorldVersions[InHandle] == Version)
+	{
+		return false;
+	}
+	WorldVersions[InHandle] = Version;
+	SlotFlags &= ~FlagStale;
+	return true;
+}
+
+void FPrimitiveBoundsTable::ReloadLocalBounds(int32 InHandle)
+{
+	Flags[InHandle] &= ~(FlagLocalDirty | FlagHasBounds);
+
+	const UPrimitiveComponent* Owner = Owners[InHandle];
+	const IBoundingVolume* BoundingVolume = Owner ? Owner->GetBoundingBox() : nullptr;
+	if (BoundingVolume && BoundingVolume->GetType() == EBoundingVolumeType::AABB)
+	{
+		SetLocalBounds(InHandle, *static_cast<const FAABB*>(BoundingVolume));
+	}
+}
+
+void FPrimitiveBoundsTable::ComputeBounds(const int32* InHandles, const FMatrix* const* InWorlds, int32 InCount)
+{
+	for (int32 Base = 0; Base < InCount; Base += LaneCount)
+	{
+		// 남는 레인은 마지막 항목을 반복해 채운다 (같은 칸에 같은 값을 한 번 더 쓸 뿐)
+		int32 Handles[LaneCount];
+		const FMatrix* Worlds[LaneCount];
+		const FVector4* Centers[LaneCount];
+		const FVector4* Extents[LaneCount];
+		for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+		{
+			const int32 Index = std::min(Base + Lane, InCount - 1);
+			Handles[Lane] = InHandles[Index];
+			Worlds[Lane] = InWorlds[Index];
+			Centers[Lane] = &LocalCenters[Handles[Lane]];
+			Extents[Lane] = &LocalExtents[Handles[Lane]];
+		}
+
+		__m128 Min[3], Max[3];
+		TransformBounds4(Worlds, Centers, Extents, Min, Max);
+
+		float* const Columns[6] = { WorldBounds.MinX.data(), WorldBounds.MinY.data(), WorldBounds.MinZ.data(),
+			WorldBounds.MaxX.data(), WorldBounds.MaxY.data(), WorldBounds.MaxZ.data() };
+		const __m128 Values[6] = { Min[0], Min[1], Min[2], Max[0], Max[1], Max[2] };
+
+		// 연속된 핸들이면 축마다 한 번에 저장, 아니면 레인별로 흩어 쓴다
+		if (Handles[3] == Handles[0] + 3 && Handles[1] == Handles[0] + 1 && Handles[2] == Handles[0] + 2)
+		{
+			for (int32 Column = 0; Column < 6; ++Column)
+			{
+				_mm_storeu_ps(Columns[Column] + Handles[0], Values[Column]);
+			}
+		}
+		else
+		{
+			for (int32 Column = 0; Column < 6; ++Column)
+			{
+				alignas(16) float Lanes[LaneCount];
+				_mm_store_ps(Lanes, Values[Column]);
+				for (int32 Lane = 0; Lane < LaneCount; ++Lane)
+				{
+					Columns[Column][Handles[Lane]] = Lanes[Lane];
+				}
+			}
+		}
+	}
+}
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/PrimitiveBoundsTable.h"
 
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
@@ -9,6 +10,14 @@ IMPLEMENT_CLASS(UPrimitiveComponent, USceneComponent)
 UPrimitiveComponent::UPrimitiveComponent()
 {
 	ComponentType = EComponentType::Primitive;
+
+	// 파생 클래스 생성자가 BoundingBox를 정하므로 로컬 AABB는 처음 조회/갱신할 때 읽는다
+	BoundsHandle = FPrimitiveBoundsTable::Get().Register(this, GetTransformHandle());
+}
+
+UPrimitiveComponent::~UPrimitiveComponent()
+{
+	FPrimitiveBoundsTable::Get().Unregister(BoundsHandle);
 }
 
 const TArray<FNormalVertex>* UPrimitiveComponent::GetVerticesData() const
@@ -53,43 +62,12 @@ D3D11_PRIMITIVE_TOPOLOGY UPrimitiveComponent::GetTopology() const
 
 void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax) const
 {
-	if (!bWorldAABBDirty)
-	{
-		OutMin = CachedWorldAABB.Min;
-		OutMax = CachedWorldAABB.Max;
-		return;
-	}
-	if (!BoundingBox) { return; }
+	FPrimitiveBoundsTable::Get().GetWorldBounds(BoundsHandle, OutMin, OutMax);
+}
 
-	if (BoundingBox->GetType() == EBoundingVolumeType::AABB)
-	{
-		const FAABB* LocalAABB = static_cast<const FAABB*>(BoundingBox);
-		FVector LocalCorners[8] =
-		{
-			FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Min.Z),
-			FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Min.Z),
-			FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Max.Z),
-			FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Max.Z)
-		};
-		const FMatrix& WorldTransform = GetWorldTransform();
-		FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
-		FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-		for (int i = 0; i < 8; i++)
-		{
-			FVector4 WorldCorner = FVector4(LocalCorners[i].X, LocalCorners[i].Y, LocalCorners[i].Z, 1.0f) * WorldTransform;
-			WorldMin.X = std::min(WorldMin.X, WorldCorner.X);
-			WorldMin.Y = std::min(WorldMin.Y, WorldCorner.Y);
-			WorldMin.Z = std::min(WorldMin.Z, WorldCorner.Z);
-			WorldMax.X = std::max(WorldMax.X, WorldCorner.X);
-			WorldMax.Y = std::max(WorldMax.Y, WorldCorner.Y);
-			WorldMax.Z = std::max(WorldMax.Z, WorldCorner.Z);
-		}
-		OutMin = WorldMin;
-		OutMax = WorldMax;
-		CachedWorldAABB = FAABB(WorldMin, WorldMax);
-		bWorldAABBDirty = false;
-	}
+void UPrimitiveComponent::MarkWorldAABBDirty()
+{
+	FPrimitiveBoundsTable::Get().MarkLocalBoundsDirty(BoundsHandle);
 }
 
 void UPrimitiveComponent::UpdateOcclusionState(bool bIsOccludedThisFrame) const
@@ -136,7 +114,7 @@ UObject* UPrimitiveComponent::Duplicate()
 	NewComponent->bVisible = bVisible;
 
 	// Reset cached data
-	NewComponent->bWorldAABBDirty = true;
+	NewComponent->MarkWorldAABBDirty();
 	NewComponent->ConsecutiveOccludedFrames = 0;
 	NewComponent->bShouldCullForOcclusion = false;
 
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Component/Public/SceneComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/TransformHierarchy.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Actor/Public/Actor.h"
 #include "Manager/Asset/Public/AssetManager.h"
@@ -19,11 +20,8 @@ USceneComponent::USceneComponent()
 {
 	ComponentType = EComponentType::Scene;
 
-	// Initialize with identity transform
-	WorldTransform = FMatrix::Identity();
-	WorldTransformInverse = FMatrix::Identity();
-	bIsTransformDirty = true;
-	bIsTransformDirtyInverse = true;
+	TransformHandle = FTransformHierarchy::Get().Register();
+	UpdateLocalTransform();
 }
 
 USceneComponent::~USceneComponent()
@@ -55,6 +53,10 @@ USceneComponent::~USceneComponent()
 		ParentAttachment = nullptr;
 	}
 	
+	// 계층에 남은 자식 노드는 루트가 된다
+	FTransformHierarchy::Get().Unregister(TransformHandle);
+	TransformHandle = FTransformHierarchy::InvalidHandle;
+
 	UE_LOG("USceneComponent::~USceneComponent(): Destruction completed for %s", 
 	       GetName().ToString().c_str());
 }
@@ -70,8 +72,7 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		FJsonSerializer::ReadVector(InOutHandle, "Rotation", RelativeRotation, FVector::ZeroVector());
 		FJsonSerializer::ReadVector(InOutHandle, "Scale", RelativeScale3D, FVector::OneVector());
 
-		// Mark as dirty and update transform after loading
-		MarkAsDirty();
+		UpdateLocalTransform();
 	}
 	// 저장
 	else
@@ -117,9 +118,9 @@ void USceneComponent::SetParentAttachment(USceneComponent* NewParent)
 		ParentAttachment->AddChild(this);
 	}
 
+	// 월드 변환은 다음 UpdateTransforms 또는 첫 조회 때 계산된다
+	FTransformHierarchy::Get().SetParent(TransformHandle, ParentAttachment ? ParentAttachment->TransformHandle : FTransformHierarchy::InvalidHandle);
 	MarkAsDirty();
-	// Immediately update transform after parent change
-	UpdateWorldTransform();
 }
 
 void USceneComponent::AddChild(USceneComponent* NewChild)
@@ -131,12 +132,8 @@ void USceneComponent::AddChild(USceneComponent* NewChild)
 
 	Children.push_back(NewChild);
 
-	// Immediately update child's world transform
 	if (NewChild)
 	{
-		NewChild->MarkAsDirty();
-		NewChild->UpdateWorldTransform();
-
 		// CRITICAL: Register child PrimitiveComponents with the Level for rendering
 		// BUT skip registration during PIE duplication to prevent editor contamination
 		if (UPrimitiveComponent* PrimitiveChild = Cast<UPrimitiveComponent>(NewChild))
@@ -188,39 +185,26 @@ void USceneComponent::RemoveChild(USceneComponent* ChildDeleted)
 
 void USceneComponent::MarkAsDirty()
 {
-	bIsTransformDirty = true;
-	bIsTransformDirtyInverse = true;
-
-	if (UPrimitiveComponent* PrimitiveComp = Cast<UPrimitiveComponent>(this))
-	{
-		PrimitiveComp->MarkWorldAABBDirty();
-	}
+	// 월드 AABB는 월드 변환 버전이 바뀌면 FPrimitiveBoundsTable에서 알아서 다시 계산된다
+	FTransformHierarchy::Get().MarkSubtreeDirty(TransformHandle);
+}
 
-	// SAFETY: Use copy to avoid iterator invalidation if Children is modified during iteration
-	TArray<USceneComponent*> ChildrenCopy = Children;
-	for (USceneComponent* Child : ChildrenCopy)
-	{
-		if (Child && !Child->IsPendingKill())
-		{
-			Child->MarkAsDirty();
-		}
-	}
+void USceneComponent::UpdateLocalTransform()
+{
+	const FMatrix LocalTransform = FMatrix::MakeTransform(RelativeLocation, FVector::GetDegreeToRadian(RelativeRotation), RelativeScale3D);
+	FTransformHierarchy::Get().SetLocalTransform(TransformHandle, LocalTransform);
 }
 
 void USceneComponent::SetRelativeLocation(const FVector& Location)
 {
 	RelativeLocation = Location;
-	MarkAsDirty();
-	// Immediately update world transform so changes are visible right away
-	UpdateWorldTransform();
+	UpdateLocalTransform();
 }
 
 void USceneComponent::SetRelativeRotation(const FVector& Rotation)
 {
 	RelativeRotation = Rotation;
-	MarkAsDirty();
-	// Immediately update world transform so changes are visible right away
-	UpdateWorldTransform();
+	UpdateLocalTransform();
 }
 
 void USceneComponent::SetRelativeScale3D(const FVector& Scale)
@@ -233,9 +217,7 @@ void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 	if (ActualScale.Z < MinScale)
 		ActualScale.Z = MinScale;
 	RelativeScale3D = ActualScale;
-	MarkAsDirty();
-	// Immediately update world transform so changes are visible right away
-	UpdateWorldTransform();
+	UpdateLocalTransform();
 }
 
 void USceneComponent::SetUniformScale(bool bIsUniform)
@@ -265,96 +247,44 @@ const FVector& USceneComponent::GetRelativeScale3D() const
 
 const FMatrix& USceneComponent::GetWorldTransform() const
 {
-	return WorldTransform;
+	return FTransformHierarchy::Get().GetWorldTransform(TransformHandle);
+}
+
+const FMatrix& USceneComponent::GetCachedWorldTransform() const
+{
+	return FTransformHierarchy::Get().GetCachedWorldTransform(TransformHandle);
 }
 
 const FMatrix& USceneComponent::GetWorldTransformInverse() const
 {
-	return WorldTransformInverse;
+	return FTransformHierarchy::Get().GetWorldTransformInverse(TransformHandle);
+}
+
+uint32 USceneComponent::GetWorldTransformVersion() const
+{
+	return FTransformHierarchy::Get().GetWorldVersion(TransformHandle);
 }
 
 FVector USceneComponent::GetWorldLocation() const
 {
-	return WorldTransform.GetLocation();
+	return GetWorldTransform().GetLocation();
 }
 
 FVector USceneComponent::GetWorldRotation() const
 {
 	// ToEuler() already returns degrees, no need to convert
-	return FQuaternion::FromMatrix(WorldTransform).ToEuler();
+	return FQuaternion::FromMatrix(GetWorldTransform()).ToEuler();
 }
 
 FVector USceneComponent::GetWorldScale3D() const
 {
-	return WorldTransform.GetScale();
+	return GetWorldTransform().GetScale();
 }
 
 void USceneComponent::UpdateWorldTransform()
 {
-	if (!bIsTransformDirty && !bIsTransformDirtyInverse)
-	{
-		return;
-	}
-
-	// Update WorldTransform if needed
-	if (bIsTransformDirty)
-	{
-		if (ParentAttachment)
-		{
-			// CRITICAL: Ensure parent is updated first
-			ParentAttachment->UpdateWorldTransform();
-
-			// For child components: build local transform same as root (without UEToDx)
-			FMatrix T = FMatrix::TranslationMatrix(RelativeLocation);
-			FMatrix R = FMatrix::RotationMatrix(FVector::GetDegreeToRadian(RelativeRotation));
-			FMatrix S = FMatrix::ScaleMatrix(RelativeScale3D);
-			FMatrix LocalTransform = S * R * T;
-
-			// Debug logging
-			FVector ParentWorldPos = ParentAttachment->GetWorldTransform().GetLocation();
-			FVector ChildRelativePos = RelativeLocation;
-			UE_LOG("Child Transform Debug: Parent World Pos=(%.2f, %.2f, %.2f), Child Relative=(%.2f, %.2f, %.2f), Child Scale=(%.2f, %.2f, %.2f)",
-				ParentWorldPos.X, ParentWorldPos.Y, ParentWorldPos.Z,
-				ChildRelativePos.X, ChildRelativePos.Y, ChildRelativePos.Z,
-				RelativeScale3D.X, RelativeScale3D.Y, RelativeScale3D.Z);
-
-			// Apply in parent's world space
-			WorldTransform = LocalTransform * ParentAttachment->GetWorldTransform();
-
-			FVector ChildWorldPos = WorldTransform.GetLocation();
-			UE_LOG("  -> Child World Pos=(%.2f, %.2f, %.2f)", ChildWorldPos.X, ChildWorldPos.Y, ChildWorldPos.Z);
-		}
-		else
-		{
-			// Root component: apply UEToDx coordinate conversion
-			WorldTransform = FMatrix::GetModelMatrix(RelativeLocation, FVector::GetDegreeToRadian(RelativeRotation), RelativeScale3D);
-		}
-
-		bIsTransformDirty = false;
-		// WorldTransform changed, so inverse must be updated too
-		bIsTransformDirtyInverse = true;
-	}
-
-	// IMPORTANT: Update inverse transform whenever WorldTransform changes
-	if (bIsTransformDirtyInverse)
-	{
-		// Directly invert the WorldTransform matrix
-		// This is mathematically correct for both root and child components
-		WorldTransformInverse = WorldTransform.Inverse();
-		bIsTransformDirtyInverse = false;
-	}
-
-	bIsTransformDirty = false;
-
-	// SAFETY: Use copy to avoid iterator invalidation if Children is modified during iteration
-	TArray<USceneComponent*> ChildrenCopy = Children;
-	for (USceneComponent* Child : ChildrenCopy)
-	{
-		if (Child && !Child->IsPendingKill())
-		{
-			Child->UpdateWorldTransform();
-		}
-	}
+	// 이 컴포넌트와 더티 조상만 계산 (자식들은 조회하거나 일괄 갱신할 때 계산된다)
+	FTransformHierarchy::Get().GetWorldTransform(TransformHandle);
 }
 
 void USceneComponent::DuplicateSubObjects()
@@ -393,8 +323,7 @@ UObject* USceneComponent::Duplicate()
 	NewComponent->bComponentTickEnabled = bComponentTickEnabled;
 	
 	// Transform 상태 초기화
-	NewComponent->bIsTransformDirty = true;
-	NewComponent->bIsTransformDirtyInverse = true;
+	NewComponent->UpdateLocalTransform();
 	
 	// IMPORTANT: 자식들은 복제하지 않음! Actor level에서 처리됨
 	// ParentAttachment도 복제하지 않음! Actor level에서 재설정됨
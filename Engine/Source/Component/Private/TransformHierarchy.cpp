@@ -0,0 +1,469 @@
+#include "pch.h"
+#include "Component/Public/TransformHierarchy.h"
+#include "Utility/Public/TaskScheduler.h"
+
+#include <bit>
+
+namespace
+{
+	// NewToOld 순서대로 원소를 다시 배치
+	template<typename T>
+	void PermuteArray(TArray<T>& InOutArray, const TArray<int32>& InNewToOld)
+	{
+		TArray<T> Permuted;
+		Permuted.reserve(InNewToOld.size());
+		for (const int32 OldSlot : InNewToOld)
+		{
+			Permuted.push_back(InOutArray[OldSlot]);
+		}
+		InOutArray.swap(Permuted);
+	}
+}
+
+FTransformHierarchy& FTransformHierarchy::Get()
+{
+	// 전역 UObject가 정적 소멸 단계에서 지워질 때도 Unregister할 수 있도록 일부러 해제하지 않는다
+	static FTransformHierarchy* Instance = new FTransformHierarchy();
+	return *Instance;
+}
+
+int32 FTransformHierarchy::Register()
+{
+	int32 Handle;
+	if (!FreeHandles.empty())
+	{
+		Handle = FreeHandles.back();
+		FreeHandles.pop_back();
+	}
+	else
+	{
+		Handle = static_cast<int32>(HandleToSlot.size());
+		HandleToSlot.push_back(InvalidHandle);
+	}
+
+	// 맨 뒤에 붙는 루트는 전위 순서를 깨지 않는다
+	const int32 Slot = static_cast<int32>(SlotToHandle.size());
+	HandleToSlot[Handle] = Slot;
+	SlotToHandle.push_back(Handle);
+	Parents.push_back(InvalidHandle);
+	FirstChildren.push_back(InvalidHandle);
+	NextSiblings.push_back(InvalidHandle);
+	PrevSiblings.push_back(InvalidHandle);
+	SubtreeSizes.push_back(1);
+	LocalTransforms.push_back(FMatrix::Identity());
+	WorldTransforms.push_back(FMatrix::Identity());
+	WorldInverses.push_back(FMatrix::Identity());
+	WorldVersions.push_back(0);
+	InverseVersions.push_back(0);
+
+	if (DirtyBits.size() * 64 < SlotToHandle.size())
+	{
+		DirtyBits.push_back(0);
+	}
+	SetDirty(Slot);
+
+	++NumAlive;
+	return Handle;
+}
+
+void FTransformHierarchy::Unregister(int32 InHandle)
+{
+	const int32 Slot = GetSlot(InHandle);
+
+	// 자식은 루트가 되므로 월드 변환이 바뀐다
+	while (FirstChildren[Slot] != InvalidHandle)
+	{
+		const int32 Child = FirstChildren[Slot];
+		UnlinkChild(Child);
+		MarkSubtreeDirtySlot(Child);
+	}
+	UnlinkChild(Slot);
+
+	SlotToHandle[Slot] = InvalidHandle;
+	HandleToSlot[InHandle] = InvalidHandle;
+	FreeHandles.push_back(InHandle);
+	ClearDirty(Slot);
+
+	bIsOrderValid = false;
+	--NumAlive;
+}
+
+void FTransformHierarchy::SetParent(int32 InHandle, int32 InParentHandle)
+{
+	const int32 Slot = GetSlot(InHandle);
+	const int32 ParentSlot = InParentHandle == InvalidHandle ? InvalidHandle : GetSlot(InParentHandle);
+	if (Parents[Slot] == ParentSlot)
+	{
+		return;
+	}
+
+	UnlinkChild(Slot);
+	if (ParentSlot != InvalidHandle)
+	{
+		LinkChild(ParentSlot, Slot);
+	}
+	bIsOrderValid = false;
+
+	// 새 부모가 더티일 수 있으므로 이미 더티여도 서브트리 전체를 다시 표시
+	ClearDirty(Slot);
+	MarkSubtreeDirtySlot(Slot);
+}
+
+void FTransformHierarchy::SetLocalTransform(int32 InHandle, const FMatrix& InLocalTransform)
+{
+	const int32 Slot = GetSlot(InHandle);
+	LocalTransforms[Slot] = InLocalTransform;
+	MarkSubtreeDirtySlot(Slot);
+}
+
+void FTransformHierarchy::MarkSubtreeDirty(int32 InHandle)
+{
+	MarkSubtreeDirtySlot(GetSlot(InHandle));
+}
+
+const FMatrix& FTransformHierarchy::GetWorldTransform(int32 InHandle)
+{
+	const int32 Slot = GetSlot(InHandle);
+	ResolveSlot(Slot);
+	return WorldTransforms[Slot];
+}
+
+const FMatrix& FTransformHierarchy::GetWorldTransformInverse(int32 InHandle)
+{
+	const int32 Slot = GetSlot(InHandle);
+	ResolveSlot(Slot);
+
+	// 역행렬은 피킹/기즈모처럼 필요한 곳에서만 계산 (월드 변환은 항상 아핀)
+	if (InverseVersions[Slot] != WorldVersions[Slot])
+	{
+		WorldInverses[Slot] = WorldTransforms[Slot].InverseAffine();
+		InverseVersions[Slot] = WorldVersions[Slot];
+	}
+	return WorldInverses[Slot];
+}
+
+const FMatrix& FTransformHierarchy::GetCachedWorldTransform(int32 InHandle) const
+{
+	const int32 Slot = GetSlot(InHandle);
+	assert("World transform read before UpdateTransforms" && !IsDirty(Slot));
+	return WorldTransforms[Slot];
+}
+
+bool FTransformHierarchy::IsClean() const
+{
+	for (const uint64 Word : DirtyBits)
+	{
+		if (Word != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32 FTransformHierarchy::GetWorldVersion(int32 InHandle) const
+{
+	return WorldVersions[GetSlot(InHandle)];
+}
+
+void FTransformHierarchy::UpdateTransforms(FTaskScheduler* InScheduler)
+{
+	if (!bIsOrderValid)
+	{
+		RebuildOrder();
+	}
+
+	uint32 NumDirty = 0;
+	for (const uint64 Word : DirtyBits)
+	{
+		NumDirty += static_cast<uint32>(std::popcount(Word));
+	}
+	NumUpdatedLastPass = NumDirty;
+	NumWorldUpdates += NumDirty;
+	if (NumDirty == 0)
+	{
+		return;
+	}
+
+	const int32 NumSlots = static_cast<int32>(SlotToHandle.size());
+	FTaskScheduler& Scheduler = InScheduler ? *InScheduler : FTaskScheduler::Get();
+	if (NumDirty < ParallelThreshold || Scheduler.GetNumWorkers() == 0)
+	{
+		UpdateRange(0, NumSlots);
+	}
+	else
+	{
+		// 루트 서브트리끼리는 서로 참조하지 않으므로 루트 단위로 나누어 갱신 (비트는 끝나고 한 번에 지운다)
+		TArray<int32>& RootStarts = ScratchStack;
+		RootStarts.clear();
+		for (int32 Slot = 0; Slot < NumSlots; Slot += SubtreeSizes[Slot])
+		{
+			RootStarts.push_back(Slot);
+		}
+		RootStarts.push_back(NumSlots);
+
+		const int64 NumRoots = static_cast<int64>(RootStarts.size()) - 1;
+		const int64 MinBatch = std::max<int64>(1, NumRoots / (static_cast<int64>(Scheduler.GetConcurrency()) * 4));
+		Scheduler.ParallelFor(NumRoots, MinBatch, [this, &RootStarts](int64 Begin, int64 End)
+			{
+				UpdateRange(RootStarts[Begin], RootStarts[End]);
+			});
+	}
+
+	std::fill(DirtyBits.begin(), DirtyBits.end(), 0ull);
+}
+
+void FTransformHierarchy::SetDirtyRange(int32 InBegin, int32 InEnd)
+{
+	if (InBegin >= InEnd)
+	{
+		return;
+	}
+
+	const int32 FirstWord = InBegin >> 6;
+	const int32 LastWord = (InEnd - 1) >> 6;
+	const uint64 FirstMask = ~0ull << (InBegin & 63);
+	const uint64 LastMask = ~0ull >> (63 - ((InEnd - 1) & 63));
+	if (FirstWord == LastWord)
+	{
+		DirtyBits[FirstWord] |= FirstMask & LastMask;
+		return;
+	}
+
+	DirtyBits[FirstWord] |= FirstMask;
+	for (int32 Word = FirstWord + 1; Word < LastWord; ++Word)
+	{
+		DirtyBits[Word] = ~0ull;
+	}
+	DirtyBits[LastWord] |= LastMask;
+}
+
+void FTransformHierarchy::MarkSubtreeDirtySlot(int32 InSlot)
+{
+	// 부모가 더티면 자식도 더티이므로 이미 더티인 노드는 서브트리도 이미 더티
+	if (IsDirty(InSlot))
+	{
+		return;
+	}
+
+	if (bIsOrderValid)
+	{
+		SetDirtyRange(InSlot, InSlot + SubtreeSizes[InSlot]);
+		return;
+	}
+
+	// 순서가 무효인 동안에는 자식 링크를 따라간다
+	TArray<int32>& Stack = ScratchStack;
+	Stack.clear();
+	Stack.push_back(InSlot);
+	while (!Stack.empty())
+	{
+		const int32 Slot = Stack.back();
+		Stack.pop_back();
+		SetDirty(Slot);
+		for (int32 Child = FirstChildren[Slot]; Child != InvalidHandle; Child = NextSiblings[Child])
+		{
+			if (!IsDirty(Child))
+			{
+				Stack.push_back(Child);
+			}
+		}
+	}
+}
+
+void FTransformHierarchy::LinkChild(int32 InParentSlot, int32 InChildSlot)
+{
+	Parents[InChildSlot] = InParentSlot;
+	PrevSiblings[InChildSlot] = InvalidHandle;
+	NextSiblings[InChildSlot] = FirstChildren[InParentSlot];
+	if (FirstChildren[InParentSlot] != InvalidHandle)
+	{
+		PrevSiblings[FirstChildren[InParentSlot]] = InChildSlot;
+	}
+	FirstChildren[InParentSlot] = InChildSlot;
+}
+
+void FTransformHierarchy::UnlinkChild(int32 InChildSlot)
+{
+	const int32 ParentSlot = Parents[InChildSlot];
+	if (ParentSlot == InvalidHandle)
+	{
+		return;
+	}
+
+	const int32 Prev = PrevSiblings[InChildSlot];
+	const int32 Next = NextSiblings[InChildSlot];
+	if (Prev != InvalidHandle)
+	{
+		NextSiblings[Prev] = Next;
+	}
+	else
+	{
+		FirstChildren[ParentSlot] = Next;
+	}
+	if (Next != InvalidHandle)
+	{
+		PrevSiblings[Next] = Prev;
+	}
+
+	Parents[InChildSlot] = InvalidHandle;
+	PrevSiblings[InChildSlot] = InvalidHandle;
+	NextSiblings[InChildSlot] = InvalidHandle;
+}
+
+void FTransformHierarchy::ResolveSlot(int32 InSlot)
+{
+	if (!IsDirty(InSlot))
+	{
+		return;
+	}
+
+	// 더티 조상을 모아 위에서부터 계산 (더티가 아닌 조상의 월드는 이미 최신)
+	TArray<int32>& Chain = ScratchStack;
+	Chain.clear();
+	for (int32 Slot = InSlot; Slot != InvalidHandle && IsDirty(Slot); Slot = Parents[Slot])
+	{
+		Chain.push_back(Slot);
+	}
+
+	for (auto It = Chain.rbegin(); It != Chain.rend(); ++It)
+	{
+		ComputeWorld(*It);
+		ClearDirty(*It);
+	}
+	NumWorldUpdates += Chain.size();
+}
+
+void FTransformHierarchy::ComputeWorld(int32 InSlot)
+{
+	const int32 ParentSlot = Parents[InSlot];
+	if (ParentSlot != InvalidHandle)
+	{
+		WorldTransforms[InSlot] = LocalTransforms[InSlot] * WorldTransforms[ParentSlot];
+	}
+	else
+	{
+		// 루트는 Dx y-up 정점을 UE z-up으로 바꾸는 변환을 앞에 붙인다 (FMatrix::GetModelMatrix와 동일)
+		WorldTransforms[InSlot] = FMatrix::UEToDx * LocalTransforms[InSlot];
+	}
+	++WorldVersions[InSlot];
+}
+
+void FTransformHierarchy::UpdateRange(int32 InBegin, int32 InEnd)
+{
+	// 비트가 선 슬롯만 앞에서부터 (부모가 같은 구간 앞쪽에 있거나 구간 밖에서 이미 최신)
+	const int32 FirstWord = InBegin >> 6;
+	const int32 LastWord = (InEnd + 63) >> 6;
+	for (int32 WordIndex = FirstWord; WordIndex < LastWord; ++WordIndex)
+	{
+		uint64 Word = DirtyBits[WordIndex];
+		if (WordIndex == FirstWord)
+		{
+			Word &= ~0ull << (InBegin & 63);
+		}
+		while (Word)
+		{
+			const int32 Slot = (WordIndex << 6) + std::countr_zero(Word);
+			if (Slot >= InEnd)
+			{
+				break;
+			}
+			ComputeWorld(Slot);
+			Word &= Word - 1;
+		}
+	}
+}
+
+void FTransformHierarchy::RebuildOrder()
+{
+	const int32 NumSlots = static_cast<int32>(SlotToHandle.size());
+
+	// 1. 살아 있는 루트마다 깊이 우선 전위 순서로 나열 (형제는 현재 링크 순서)
+	TArray<int32>& NewToOld = ScratchOrder;
+	TArray<int32>& OldToNew = ScratchRemap;
+	NewToOld.clear();
+	OldToNew.assign(NumSlots, InvalidHandle);
+
+	TArray<int32>& Stack = ScratchStack;
+	auto VisitSubtree = [&](int32 InRootSlot)
+		{
+			Stack.clear();
+			Stack.push_back(InRootSlot);
+			while (!Stack.empty())
+			{
+				const int32 Slot = Stack.back();
+				Stack.pop_back();
+				OldToNew[Slot] = static_cast<int32>(NewToOld.size());
+				NewToOld.push_back(Slot);
+
+				// 스택이므로 뒤 형제부터 넣어야 앞 형제가 먼저 나온다
+				int32 LastChild = InvalidHandle;
+				for (int32 Child = FirstChildren[Slot]; Child != InvalidHandle; Child = NextSiblings[Child])
+				{
+					LastChild = Child;
+				}
+				for (int32 Child = LastChild; Child != InvalidHandle; Child = PrevSiblings[Child])
+				{
+					Stack.push_back(Child);
+				}
+			}
+		};
+
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		if (SlotToHandle[Slot] != InvalidHandle && Parents[Slot] == InvalidHandle)
+		{
+			VisitSubtree(Slot);
+		}
+	}
+
+	// 순환으로 루트에 닿지 않는 노드가 남으면 끊어서 루트로 만든다
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		if (SlotToHandle[Slot] != InvalidHandle && OldToNew[Slot] == InvalidHandle)
+		{
+			UnlinkChild(Slot);
+			VisitSubtree(Slot);
+		}
+	}
+
+	// 2. 더티 비트를 옮긴 뒤 배열을 새 순서로 재배치 (해제된 슬롯은 여기서 빠진다)
+	TArray<uint64> NewDirtyBits((NewToOld.size() + 63) / 64, 0);
+	for (size_t NewSlot = 0; NewSlot < NewToOld.size(); ++NewSlot)
+	{
+		if (IsDirty(NewToOld[NewSlot]))
+		{
+			NewDirtyBits[NewSlot >> 6] |= 1ull << (NewSlot & 63);
+		}
+	}
+	DirtyBits.swap(NewDirtyBits);
+
+	PermuteArray(SlotToHandle, NewToOld);
+	PermuteArray(Parents, NewToOld);
+	PermuteArray(LocalTransforms, NewToOld);
+	PermuteArray(WorldTransforms, NewToOld);
+	PermuteArray(WorldInverses, NewToOld);
+	PermuteArray(WorldVersions, NewToOld);
+	PermuteArray(InverseVersions, NewToOld);
+
+	// 3. 부모 번호, 핸들 표, 자식 링크, 서브트리 크기를 새 슬롯 기준으로 다시 만든다
+	const int32 NumNewSlots = static_cast<int32>(NewToOld.size());
+	FirstChildren.assign(NumNewSlots, InvalidHandle);
+	NextSiblings.assign(NumNewSlots, InvalidHandle);
+	PrevSiblings.assign(NumNewSlots, InvalidHandle);
+	SubtreeSizes.assign(NumNewSlots, 1);
+
+	for (int32 Slot = NumNewSlots - 1; Slot >= 0; --Slot)
+	{
+		HandleToSlot[SlotToHandle[Slot]] = Slot;
+		if (Parents[Slot] != InvalidHandle)
+		{
+			const int32 ParentSlot = OldToNew[Parents[Slot]];
+			Parents[Slot] = InvalidHandle;
+			LinkChild(ParentSlot, Slot);
+			SubtreeSizes[ParentSlot] += SubtreeSizes[Slot];
+		}
+	}
+
+	bIsOrderValid = true;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+
+class FTaskScheduler;
+class FTransformHierarchy;
+class UPrimitiveComponent;
+
+/**
+ * @brief 프리미티브의 월드 AABB를 핸들 순서의 연속 SoA 표(FBoundsSoA)에 두고 프레임마다 한 번 바뀐 것만 일괄 갱신한다
+ *
+ * 월드 AABB는 로컬 AABB의 중심/반경을 월드 변환과 그 절댓값 행렬로 옮겨 구한다 (꼭짓점 8개를 변환한 결과와 같음)
+ * 변환 계층의 월드 버전이 바뀌었거나 로컬 AABB가 바뀐 항목만 모아 오브젝트 4개를 SIMD 레인 하나씩에 실어 계산한다
+ *
+ * 옥트리 삽입/갱신, BVH 빌드/리핏, 동적 프리미티브 스냅샷, 오클루전 단계는 모두 이 표를 읽는다
+ * UpdateBounds 전에 읽으면 그 항목만 즉시 계산하고 (메인 스레드 전용), 이후에는 워커 스레드에서 읽기만 하는 것이 안전하다
+ */
+class FPrimitiveBoundsTable
+{
+public:
+	static constexpr int32 InvalidHandle = -1;
+
+	// 갱신할 항목이 이보다 많으면 나누어 병렬 계산
+	static constexpr uint32 ParallelThreshold = 4096;
+
+	// 엔진 전역 표 (FTransformHierarchy::Get()의 월드 변환을 사용)
+	static FPrimitiveBoundsTable& Get();
+
+	explicit FPrimitiveBoundsTable(FTransformHierarchy& InHierarchy) : Hierarchy(InHierarchy) {}
+	FPrimitiveBoundsTable(const FPrimitiveBoundsTable&) = delete;
+	FPrimitiveBoundsTable& operator=(const FPrimitiveBoundsTable&) = delete;
+
+	/**
+	 * @brief InOwner가 있으면 로컬 AABB를 InOwner->GetBoundingBox()에서 읽는다 (AABB가 아니면 월드 AABB 없음)
+	 * InOwner 없이 등록한 항목은 SetLocalBounds로 로컬 AABB를 지정한다
+	 */
+	int32 Register(const UPrimitiveComponent* InOwner, int32 InTransformHandle);
+	void Unregister(int32 InHandle);
+
+	void SetLocalBounds(int32 InHandle, const FAABB& InLocalBounds);
+
+	// 소유 컴포넌트의 바운딩 볼륨이 바뀌었을 때 호출 (다음 조회/갱신 때 다시 읽음)
+	void MarkLocalBoundsDirty(int32 InHandle);
+
+	// 최신이 아니면 그 자리에서 계산한다. 월드 AABB가 없으면 false를 반환하고 출력은 건드리지 않는다
+	bool GetWorldBounds(int32 InHandle, FVector& OutMin, FVector& OutMax);
+
+	// 최신 여부를 확인하지 않고 표의 값을 읽는다 (UpdateBounds 이후 워커 스레드용)
+	bool GetCachedWorldBounds(int32 InHandle, FAABB& OutBounds) const;
+
+	/**
+	 * @brief 변환 계층을 갱신한 뒤 바뀐 항목의 월드 AABB를 한 번에 다시 계산한다
+	 * @param InScheduler nullptr이면 전역 스케줄러 사용
+	 */
+	void UpdateBounds(FTaskScheduler* InScheduler = nullptr);
+
+	// 핸들 순서의 월드 AABB (해제되었거나 AABB가 없는 칸의 값은 의미 없음)
+	const FBoundsSoA& GetBounds() const { return WorldBounds; }
+
+	uint32 GetNumBounds() const { return NumAlive; }
+	uint32 GetNumUpdatedLastPass() const { return NumUpdatedLastPass; }
+
+private:
+	enum : uint8
+	{
+		FlagAlive = 1 << 0,
+		FlagHasBounds = 1 << 1,
+		FlagLocalDirty = 1 << 2,		// 소유 컴포넌트에서 로컬 AABB를 다시 읽어야 함
+		FlagStale = 1 << 3,				// 월드 버전과 관계없이 다시 계산해야 함
+	};
+
+	// 로컬 AABB가 바뀌었으면 다시 읽고, 월드 AABB를 다시 계산해야 하면 true
+	bool PrepareSlot(int32 InHandle);
+	void ReloadLocalBounds(int32 InHandle);
+
+	// InHandles[0..InCount)의 월드 AABB를 InWorlds의 행렬로 계산해 표에 기록
+	void ComputeBounds(const int32* InHandles, const FMatrix* const* InWorlds, int32 InCount);
+
+	FTransformHierarchy& Hierarchy;
+
+	// 핸들 단위 배열 (핸들 = 표의 인덱스)
+	TArray<const UPrimitiveComponent*> Owners;
+	TArray<int32> TransformHandles;
+	TArray<FVector4> LocalCenters;		// W = 0
+	TArray<FVector4> LocalExtents;
+	TArray<uint32> WorldVersions;		// 마지막으로 계산할 때의 월드 변환 버전
+	TArray<uint8> Flags;
+	FBoundsSoA WorldBounds;
+	TArray<int32> FreeHandles;
+
+	uint32 NumAlive = 0;
+	uint32 NumUpdatedLastPass = 0;
+
+	// 지난 UpdateBounds 이후 월드 변환도 로컬 AABB도 바뀌지 않았으면 전체 검사를 건너뛴다
+	uint64 LastWorldUpdates = 0;
+	bool bHasPendingChanges = false;
+
+	// 재사용하는 임시 버퍼
+	TArray<int32> ScratchHandles;
+	TArray<const FMatrix*> ScratchWorlds;
+};
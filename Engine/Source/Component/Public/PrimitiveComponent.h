@@ -11,6 +11,7 @@ class UPrimitiveComponent : public USceneComponent
 
 public:
 	UPrimitiveComponent();
+	virtual ~UPrimitiveComponent() override;
 
 	const TArray<FNormalVertex>* GetVerticesData() const;
 	const TArray<uint32>* GetIndicesData() const;
@@ -32,8 +33,11 @@ public:
 	void SetColor(const FVector4& InColor) { Color = InColor; }
 
 	const IBoundingVolume* GetBoundingBox() const { return BoundingBox; }
+	// 월드 AABB는 FPrimitiveBoundsTable에 있다 (AABB가 없으면 출력을 건드리지 않음)
 	void GetWorldAABB(FVector& OutMin, FVector& OutMax) const;
-	void MarkWorldAABBDirty() { bWorldAABBDirty = true; }
+	// BoundingBox를 바꾼 뒤 호출 (변환이 바뀐 것은 월드 변환 버전으로 알아서 반영된다)
+	void MarkWorldAABBDirty();
+	int32 GetBoundsHandle() const { return BoundsHandle; }
 
 	EPrimitiveType GetPrimitiveType() const { return Type; }
 
@@ -64,10 +68,17 @@ protected:
 	bool bVisible = true;
 
 	const IBoundingVolume* BoundingBox = nullptr;
-	mutable FAABB CachedWorldAABB;
-	mutable bool bWorldAABBDirty = true;
 
 	// Occlusion Culling 상태 (3프레임 연속 시스템)
 	mutable int ConsecutiveOccludedFrames = 0;  // 연속으로 가려진 프레임 수
 	mutable bool bShouldCullForOcclusion = false;  // 실제 컬링 여부
+
+private:
+	// 옥트리 핸들: 이 컴포넌트가 저장된 노드 인덱스와 노드 내 슬롯 (FOctree만 갱신, 트리 밖이면 -1)
+	friend struct FOctree;
+	int32 OctreeNodeIndex = -1;
+	int32 OctreeSlot = -1;
+
+	// FPrimitiveBoundsTable 핸들
+	int32 BoundsHandle = -1;
 };
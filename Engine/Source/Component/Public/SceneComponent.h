@@ -40,19 +40,27 @@ public:
 	FVector GetWorldRotation() const;
 	FVector GetWorldScale3D() const;
 
+	// 더티면 이 컴포넌트와 더티 조상만 즉시 계산 (보통은 프레임마다 FTransformHierarchy::UpdateTransforms에서 일괄 갱신)
 	const FMatrix& GetWorldTransform() const;
 	const FMatrix& GetWorldTransformInverse() const;
+	// 계산 없이 마지막으로 갱신된 월드 변환을 읽는다 (워커 스레드용, UpdateTransforms 이후에만 호출)
+	const FMatrix& GetCachedWorldTransform() const;
 	void UpdateWorldTransform();
 
+	// 월드 변환이 다시 계산될 때마다 바뀌는 값 (파생 캐시 무효화용)
+	uint32 GetWorldTransformVersion() const;
+	int32 GetTransformHandle() const { return TransformHandle; }
+
 	// Duplication support
 	void DuplicateSubObjects() override;
 	UObject* Duplicate() override;
 
 private:
-	mutable bool bIsTransformDirty = true;
-	mutable bool bIsTransformDirtyInverse = true;
-	mutable FMatrix WorldTransform;
-	mutable FMatrix WorldTransformInverse;
+	// 상대 값으로 로컬 변환(S * R * T)을 만들어 계층에 넘기고 서브트리를 더티로 표시
+	void UpdateLocalTransform();
+
+	// FTransformHierarchy 핸들 (월드 변환은 계층의 연속 배열에 있다)
+	int32 TransformHandle = -1;
 
 	USceneComponent* ParentAttachment = nullptr;
 	TArray<USceneComponent*> Children;
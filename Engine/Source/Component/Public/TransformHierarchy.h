@@ -0,0 +1,118 @@
+#pragma once
+#include "Global/Matrix.h"
+
+class FTaskScheduler;
+
+/**
+ * @brief 씬 컴포넌트의 변환 계층을 연속 배열(SoA)에 두고 프레임마다 한 번 더티 노드만 일괄 갱신한다
+ *
+ * 슬롯은 부모가 자식보다 앞에 오는 깊이 우선 전위 순서로 정렬되어 있어서
+ * - 서브트리가 [슬롯, 슬롯 + 서브트리 크기) 연속 구간이 되므로 더티 표시는 비트 구간 채우기 한 번이고
+ * - 앞에서부터 한 번 훑으면 부모가 항상 자식보다 먼저 갱신된다
+ * 부모가 더티면 자식도 더티라는 불변식을 지키므로, 이미 더티인 노드를 다시 표시하는 세터는 바로 끝난다
+ *
+ * 계층이 바뀌면 순서만 무효로 표시하고 다음 UpdateTransforms에서 한 번에 다시 정렬한다 (그 사이에는 자식 링크로 표시)
+ * 컴포넌트는 정렬로 바뀌지 않는 핸들을 들고 있고 핸들 → 슬롯 표로 찾는다
+ *
+ * 갱신 전에 월드 변환을 읽으면 그 노드와 더티 조상만 즉시 계산한다 (메인 스레드 전용)
+ * UpdateTransforms 이후에는 더티 노드가 없으므로 워커 스레드에서 읽기만 하는 것은 안전하다
+ */
+class FTransformHierarchy
+{
+public:
+	static constexpr int32 InvalidHandle = -1;
+
+	// 더티 노드가 이보다 많으면 루트 서브트리 단위로 나누어 병렬 갱신
+	static constexpr uint32 ParallelThreshold = 4096;
+
+	// 엔진 전역 계층 (모든 월드의 씬 컴포넌트가 공유)
+	static FTransformHierarchy& Get();
+
+	FTransformHierarchy() = default;
+	FTransformHierarchy(const FTransformHierarchy&) = delete;
+	FTransformHierarchy& operator=(const FTransformHierarchy&) = delete;
+
+	// 로컬 변환이 항등인 루트로 등록하고 핸들 반환
+	int32 Register();
+
+	// 자식들은 루트가 된다
+	void Unregister(int32 InHandle);
+
+	// InParentHandle이 InvalidHandle이면 루트로 만든다 (순환 검사는 호출 측 책임)
+	void SetParent(int32 InHandle, int32 InParentHandle);
+	void SetLocalTransform(int32 InHandle, const FMatrix& InLocalTransform);
+	void MarkSubtreeDirty(int32 InHandle);
+
+	/**
+	 * @brief 루트의 월드 = UEToDx * 로컬, 자식의 월드 = 로컬 * 부모 월드
+	 * 더티면 그 자리에서 계산한다. 반환된 참조는 다음 Register/UpdateTransforms 전까지만 유효
+	 */
+	const FMatrix& GetWorldTransform(int32 InHandle);
+	const FMatrix& GetWorldTransformInverse(int32 InHandle);
+
+	// 계산을 일으키지 않고 저장된 월드 변환만 읽는다 (워커 스레드용, 더티 노드를 읽으면 assert)
+	const FMatrix& GetCachedWorldTransform(int32 InHandle) const;
+
+	// 더티 노드가 없으면 true (워커 스레드에서 GetCachedWorldTransform을 쓰기 전에 확인)
+	bool IsClean() const;
+
+	// 월드 변환이 다시 계산될 때마다 증가 (캐시 무효화용, 계산을 일으키지 않음)
+	uint32 GetWorldVersion(int32 InHandle) const;
+
+	/**
+	 * @brief 필요하면 순서를 다시 정렬한 뒤 더티 노드를 앞에서부터 한 번에 갱신한다
+	 * @param InScheduler nullptr이면 전역 스케줄러 사용
+	 */
+	void UpdateTransforms(FTaskScheduler* InScheduler = nullptr);
+
+	uint32 GetNumTransforms() const { return NumAlive; }
+	uint32 GetNumUpdatedLastPass() const { return NumUpdatedLastPass; }
+
+	// 지금까지 월드 변환을 계산한 누적 횟수 (일괄/즉시 모두 포함, 파생 캐시가 바뀐 것이 없을 때 전체 검사를 건너뛰는 데 사용)
+	uint64 GetNumWorldUpdates() const { return NumWorldUpdates; }
+
+private:
+	int32 GetSlot(int32 InHandle) const { return HandleToSlot[InHandle]; }
+
+	bool IsDirty(int32 InSlot) const { return (DirtyBits[InSlot >> 6] >> (InSlot & 63)) & 1; }
+	void SetDirty(int32 InSlot) { DirtyBits[InSlot >> 6] |= 1ull << (InSlot & 63); }
+	void ClearDirty(int32 InSlot) { DirtyBits[InSlot >> 6] &= ~(1ull << (InSlot & 63)); }
+	void SetDirtyRange(int32 InBegin, int32 InEnd);
+
+	void MarkSubtreeDirtySlot(int32 InSlot);
+	void LinkChild(int32 InParentSlot, int32 InChildSlot);
+	void UnlinkChild(int32 InChildSlot);
+
+	void ResolveSlot(int32 InSlot);
+	void ComputeWorld(int32 InSlot);
+	void UpdateRange(int32 InBegin, int32 InEnd);
+	void RebuildOrder();
+
+	// 핸들 → 슬롯 (해제된 핸들은 InvalidHandle)
+	TArray<int32> HandleToSlot;
+	TArray<int32> FreeHandles;
+
+	// 슬롯 단위 SoA (해제된 슬롯은 SlotToHandle이 InvalidHandle이고 다음 정렬에서 빠진다)
+	TArray<int32> SlotToHandle;
+	TArray<int32> Parents;
+	TArray<int32> FirstChildren;
+	TArray<int32> NextSiblings;
+	TArray<int32> PrevSiblings;
+	TArray<int32> SubtreeSizes;		// bIsOrderValid일 때만 의미 있음
+	TArray<FMatrix> LocalTransforms;
+	TArray<FMatrix> WorldTransforms;
+	TArray<FMatrix> WorldInverses;
+	TArray<uint32> WorldVersions;
+	TArray<uint32> InverseVersions;
+	TArray<uint64> DirtyBits;
+
+	bool bIsOrderValid = true;
+	uint32 NumAlive = 0;
+	uint32 NumUpdatedLastPass = 0;
+	uint64 NumWorldUpdates = 0;
+
+	// 재사용하는 임시 버퍼
+	TArray<int32> ScratchStack;
+	TArray<int32> ScratchOrder;
+	TArray<int32> ScratchRemap;
+};
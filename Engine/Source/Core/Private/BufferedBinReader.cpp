@@ -0,0 +1,73 @@
+#include "pch.h"
+
+#include "Core/Public/BufferedBinReader.h"
+
+FBufferedBinReader::FBufferedBinReader(const std::filesystem::path& FilePath, size_t InBufferSize)
+	: Stream(FilePath, std::ios::binary | std::ios::in)
+	, Buffer(std::max<size_t>(InBufferSize, 1))
+{
+	if (!Stream)
+	{
+		UE_LOG_ERROR("읽기용 파일을 여는데 실패했습니다: %s", FilePath.string().c_str());
+		SetError();
+		return;
+	}
+
+	std::error_code ErrorCode;
+	FileSize = static_cast<size_t>(std::filesystem::file_size(FilePath, ErrorCode));
+}
+
+void FBufferedBinReader::Serialize(void* V, size_t Length)
+{
+	char* Dest = static_cast<char*>(V);
+
+	if (IsError() || Length > GetRemainingSize())
+	{
+		memset(Dest, 0, Length);
+		SetError();
+		return;
+	}
+	Position += Length;
+
+	// 버퍼에 남은 만큼 먼저 복사
+	const size_t Buffered = std::min(Length, BufferEnd - BufferBegin);
+	memcpy(Dest, Buffer.data() + BufferBegin, Buffered);
+	BufferBegin += Buffered;
+	Dest += Buffered;
+	Length -= Buffered;
+
+	// 버퍼보다 큰 나머지는 파일에서 바로 읽는다 (배열 일괄 읽기)
+	if (Length >= Buffer.size())
+	{
+		Stream.read(Dest, static_cast<std::streamsize>(Length));
+		if (static_cast<size_t>(Stream.gcount()) != Length)
+		{
+			UE_LOG_ERROR("파일 읽기를 실패했습니다.");
+			SetError();
+		}
+		return;
+	}
+
+	if (Length > 0)
+	{
+		if (!Refill() || BufferEnd < Length)
+		{
+			UE_LOG_ERROR("파일 읽기를 실패했습니다.");
+			memset(Dest, 0, Length);
+			SetError();
+			return;
+		}
+		memcpy(Dest, Buffer.data(), Length);
+		BufferBegin = Length;
+	}
+}
+
+bool FBufferedBinReader::Refill()
+{
+	Stream.read(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+	BufferBegin = 0;
+	BufferEnd = static_cast<size_t>(Stream.gcount());
+	// 파일 끝에서 버퍼를 다 채우지 못한 것은 실패가 아니다
+	Stream.clear();
+	return BufferEnd > 0;
+}
@@ -0,0 +1,72 @@
+#include "pch.h"
+
+#include "Core/Public/BufferedBinWriter.h"
+
+FBufferedBinWriter::FBufferedBinWriter(const std::filesystem::path& FilePath, size_t InBufferSize)
+	: Stream(FilePath, std::ios::binary | std::ios::out | std::ios::trunc)
+	, Buffer(std::max<size_t>(InBufferSize, 1))
+{
+	if (!Stream)
+	{
+		UE_LOG_ERROR("쓰기용 파일을 여는데 실패했습니다: %s", FilePath.string().c_str());
+		SetError();
+	}
+}
+
+FBufferedBinWriter::~FBufferedBinWriter()
+{
+	Flush();
+}
+
+void FBufferedBinWriter::Serialize(void* V, size_t Length)
+{
+	if (IsError())
+	{
+		return;
+	}
+
+	const char* Source = static_cast<const char*>(V);
+	if (BufferUsed + Length <= Buffer.size())
+	{
+		memcpy(Buffer.data() + BufferUsed, Source, Length);
+		BufferUsed += Length;
+		return;
+	}
+
+	// 순서를 지키기 위해 모인 내용을 먼저 쓴다
+	Flush();
+	if (Length >= Buffer.size())
+	{
+		WriteToStream(Source, Length);
+	}
+	else
+	{
+		memcpy(Buffer.data(), Source, Length);
+		BufferUsed = Length;
+	}
+}
+
+bool FBufferedBinWriter::Flush()
+{
+	if (BufferUsed > 0 && !IsError())
+	{
+		WriteToStream(Buffer.data(), BufferUsed);
+	}
+	BufferUsed = 0;
+
+	if (!IsError())
+	{
+		Stream.flush();
+	}
+	return !IsError();
+}
+
+void FBufferedBinWriter::WriteToStream(const char* InData, size_t InLength)
+{
+	Stream.write(InData, static_cast<std::streamsize>(InLength));
+	if (!Stream)
+	{
+		UE_LOG_ERROR("파일 쓰기를 실패했습니다.");
+		SetError();
+	}
+}
@@ -137,7 +137,9 @@ void FClientApp::UpdateSystem() const
 	auto& LevelManager = ULevelManager::GetInstance();
 	auto& WorldManager = UWorldManager::GetInstance();
 	auto& PIEManager = UPIEManager::GetInstance(); // PIEManager 추가
+	auto& AssetManager = UAssetManager::GetInstance();
 
+	AssetManager.UpdateStaticMeshLoading(); // 로딩이 끝난 스태틱 메시 등록
 	LevelManager.Update();
 	WorldManager.Update(TimeManager.GetDeltaTime()); // World 기반 Tick
 	PIEManager.Update(TimeManager.GetDeltaTime()); // PIE World Tick
@@ -0,0 +1,28 @@
+#include "pch.h"
+
+#include "Core/Public/MappedBinReader.h"
+
+FMappedBinReader::FMappedBinReader(const std::filesystem::path& FilePath)
+{
+	if (!File.Open(FilePath))
+	{
+		UE_LOG_ERROR("읽기용 파일을 매핑하는데 실패했습니다: %s", FilePath.string().c_str());
+		SetError();
+	}
+}
+
+void FMappedBinReader::Serialize(void* V, size_t Length)
+{
+	if (IsError() || Length > GetRemainingSize())
+	{
+		memset(V, 0, Length);
+		SetError();
+		return;
+	}
+
+	if (Length > 0)
+	{
+		memcpy(V, File.GetData() + Position, Length);
+		Position += Length;
+	}
+}
@@ -0,0 +1,110 @@
+#include "pch.h"
+#include "Core/Public/MappedFile.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool FMappedFile::Open(const std::filesystem::path& InFilePath)
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE File = CreateFileW(InFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (File == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER FileSize;
+	if (!GetFileSizeEx(File, &FileSize))
+	{
+		CloseHandle(File);
+		return false;
+	}
+
+	FileHandle = File;
+	Size = static_cast<size_t>(FileSize.QuadPart);
+	if (Size > 0)
+	{
+		HANDLE Mapping = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!Mapping)
+		{
+			Close();
+			return false;
+		}
+		MappingHandle = Mapping;
+
+		Data = static_cast<const char*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!Data)
+		{
+			Close();
+			return false;
+		}
+	}
+#else
+	const int File = open(InFilePath.c_str(), O_RDONLY);
+	if (File < 0)
+	{
+		return false;
+	}
+
+	struct stat FileStat;
+	if (fstat(File, &FileStat) != 0)
+	{
+		close(File);
+		return false;
+	}
+
+	Size = static_cast<size_t>(FileStat.st_size);
+	if (Size > 0)
+	{
+		void* Mapped = mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, File, 0);
+		if (Mapped == MAP_FAILED)
+		{
+			close(File);
+			Size = 0;
+			return false;
+		}
+		madvise(Mapped, Size, MADV_SEQUENTIAL);
+		Data = static_cast<const char*>(Mapped);
+	}
+	close(File);
+#endif
+
+	bIsOpen = true;
+	return true;
+}
+
+void FMappedFile::Close()
+{
+#ifdef _WIN32
+	if (Data)
+	{
+		UnmapViewOfFile(Data);
+	}
+	if (MappingHandle)
+	{
+		CloseHandle(MappingHandle);
+		MappingHandle = nullptr;
+	}
+	if (FileHandle)
+	{
+		CloseHandle(FileHandle);
+		FileHandle = nullptr;
+	}
+#else
+	if (Data)
+	{
+		munmap(const_cast<char*>(Data), Size);
+	}
+#endif
+
+	Data = nullptr;
+	Size = 0;
+	bIsOpen = false;
+}
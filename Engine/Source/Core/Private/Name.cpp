@@ -1,33 +1,315 @@
 #include "pch.h"
 #include "Core/Public/Name.h"
-#include <algorithm> // for std::transform
-#include <cctype>    // for std::tolower
+#include <atomic>
+#include <cstring>
+#include <mutex>
 
-// '최초 사용 시 생성(Construct on First Use)' 기법을 적용하기 위한 헬퍼 함수들입니다.
+// 이름 표는 '최초 사용 시 생성(Construct on First Use)'되는 FNameTable 하나가 관리합니다.
 // 익명 네임스페이스를 사용하여 이 파일 외부에서는 접근할 수 없도록 합니다.
+//
+// - 표시 이름은 고정 크기 청크에 두고 인덱스로 찾습니다
+//   청크는 종료할 때까지 해제하지 않으므로 주소가 바뀌지 않아 ToString이 잠금 없이 참조를 반환할 수 있습니다
+// - 비교용 문자열(처음 등록한 표기)은 길이를 앞에 붙여 샤드별 문자 아레나 블록에 이어 붙입니다 (이름마다 힙 할당을 하지 않음)
+// - 해시 상위 비트로 고른 샤드마다 열린 주소법 슬롯 표가 있고, 슬롯에는 (해시 << 32) | (인덱스 + 1)과 아레나 문자열을 둡니다
+//   조회는 잠그지 않고 슬롯과 아레나만 읽으며 (표시 이름 청크는 건드리지 않음), 없을 때만 샤드 잠금을 잡고 다시 찾은 뒤 등록합니다
+// - 슬롯 표가 절반 넘게 차면 두 배 크기 표로 바꿔 끼우고, 이전 표는 잠그지 않고 읽는 중인 스레드를 위해 남겨 둡니다
 namespace
 {
-	// DisplayNames 배열에 대한 접근자
-	TArray<FString>& GetDisplayNames()
+	constexpr uint32 ShardBits = 6;
+	constexpr uint32 NumShards = 1u << ShardBits;
+	constexpr uint32 InitialSlotsPerShard = 256;
+
+	constexpr uint32 EntryChunkBits = 12;
+	constexpr uint32 EntriesPerChunk = 1u << EntryChunkBits;
+	constexpr uint32 MaxEntryChunks = 4096;		// 최대 이름 수 = 1600만 개
+
+	constexpr size_t ArenaBlockSize = 16 * 1024;
+
+	constexpr int32 INDEX_NONE = -1;
+
+	struct FSlot
 	{
-		// 이 함수가 최초로 호출될 때 단 한 번만 안전하게 초기화됩니다.
-		static TArray<FString> DisplayNames = { "None" };
-		return DisplayNames;
+		// 0이면 빈 슬롯. String은 HashAndIndex를 release로 쓰기 전에 채우므로 0이 아닌 값을 읽은 뒤에만 읽는다
+		std::atomic<uint64> HashAndIndex;
+		const char* String;		// 아레나의 [uint32 길이][문자들]['\0'] 레코드
+	};
+
+	struct FSlotTable
+	{
+		explicit FSlotTable(uint32 InNumSlots)
+			: Mask(InNumSlots - 1), Slots(new FSlot[InNumSlots]())
+		{
+		}
+
+		uint32 Mask;
+		TUniquePtr<FSlot[]> Slots;
+	};
+
+	struct FNameShard
+	{
+		std::atomic<FSlotTable*> Table{ nullptr };
+
+		// 아래는 Mutex를 잡고만 접근
+		std::mutex Mutex;
+		uint32 NumUsed = 0;
+		TArray<TUniquePtr<FSlotTable>> Tables;		// 현재 표와 이전 표들
+		TArray<TUniquePtr<char[]>> ArenaBlocks;
+		char* ArenaCursor = nullptr;
+		size_t ArenaRemaining = 0;
+	};
+
+	uint32 GetRecordLength(const char* InRecord)
+	{
+		uint32 Length;
+		memcpy(&Length, InRecord, sizeof(Length));
+		return Length;
 	}
 
-	// NameMap에 대한 접근자
-	TMap<FString, uint32>& GetNameMap()
+	const char* GetRecordString(const char* InRecord)
 	{
-		static TMap<FString, uint32> NameMap = { {"none", 0} };
-		return NameMap;
+		return InRecord + sizeof(uint32);
 	}
 
-	// NextIndex 카운터에 대한 접근자
-	uint32& GetNextIndex()
+	// FName::HashString과 같은 값을 8바이트 단위 메모리 읽기로 계산 (constexpr 버전은 바이트를 하나씩 조립하므로 느림)
+	uint32 HashStringRuntime(const char* InString, size_t InLength)
 	{
-		static uint32 NextIndex = 1;
-		return NextIndex;
+		uint64 Hash = 0x9E3779B97F4A7C15ull ^ InLength;
+		size_t Offset = 0;
+		for (; Offset + 8 <= InLength; Offset += 8)
+		{
+			uint64 Word;
+			memcpy(&Word, InString + Offset, 8);
+			Hash = FName::MixNameWord(Hash, FName::FoldNameWord(Word));
+		}
+		if (Offset < InLength)
+		{
+			// 남은 바이트는 끝에서 8바이트를 겹쳐 읽은 뒤 밀어내면 LoadNameWord와 같은 값이 된다
+			uint64 Word;
+			if (InLength >= 8)
+			{
+				memcpy(&Word, InString + InLength - 8, 8);
+				Word >>= (8 - (InLength - Offset)) * 8;
+			}
+			else
+			{
+				Word = FName::LoadNameWord(InString + Offset, InLength - Offset);
+			}
+			Hash = FName::MixNameWord(Hash, FName::FoldNameWord(Word));
+		}
+
+		Hash ^= Hash >> 33;
+		Hash *= 0xFF51AFD7ED558CCDull;
+		Hash ^= Hash >> 33;
+		return static_cast<uint32>(Hash);
 	}
+
+	// ASCII만 소문자로 접어서 8바이트씩 비교 (FName::HashString과 같은 규칙)
+	bool EqualsIgnoreCase(const char* InA, const char* InB, uint32 InLength)
+	{
+		uint32 Offset = 0;
+		for (; Offset + 8 <= InLength; Offset += 8)
+		{
+			uint64 A, B;
+			memcpy(&A, InA + Offset, 8);
+			memcpy(&B, InB + Offset, 8);
+			if (A != B && FName::FoldNameWord(A) != FName::FoldNameWord(B))
+			{
+				return false;
+			}
+		}
+		if (Offset < InLength)
+		{
+			const uint32 Count = InLength - Offset;
+			return FName::FoldNameWord(FName::LoadNameWord(InA + Offset, Count)) == FName::FoldNameWord(FName::LoadNameWord(InB + Offset, Count));
+		}
+		return true;
+	}
+
+	class FNameTable
+	{
+	public:
+		static FNameTable& Get()
+		{
+			// 이 함수가 최초로 호출될 때 단 한 번만 안전하게 초기화됩니다.
+			static FNameTable Instance;
+			return Instance;
+		}
+
+		FNameTable()
+		{
+			for (FNameShard& Shard : Shards)
+			{
+				Shard.Tables.push_back(std::make_unique<FSlotTable>(InitialSlotsPerShard));
+				Shard.Table.store(Shard.Tables.back().get(), std::memory_order_release);
+			}
+
+			// 인덱스 0은 'None'
+			FindOrAdd("None", 4, FName::HashString("None", 4));
+		}
+
+		~FNameTable()
+		{
+			for (std::atomic<FString*>& Chunk : DisplayChunks)
+			{
+				delete[] Chunk.load(std::memory_order_relaxed);
+			}
+		}
+
+		FNameTable(const FNameTable&) = delete;
+		FNameTable& operator=(const FNameTable&) = delete;
+
+		int32 FindOrAdd(const char* InString, uint32 InLength, uint32 InHash)
+		{
+			FNameShard& Shard = Shards[InHash >> (32 - ShardBits)];
+
+			// 대부분의 호출은 이미 있는 이름이므로 잠그지 않고 찾는다
+			int32 Index = Find(*Shard.Table.load(std::memory_order_acquire), InString, InLength, InHash);
+			if (Index != INDEX_NONE)
+			{
+				return Index;
+			}
+
+			// 잠금을 잡는 사이 다른 스레드가 먼저 등록했거나 표를 키웠을 수 있으므로 현재 표에서 다시 찾는다
+			std::lock_guard<std::mutex> Lock(Shard.Mutex);
+			FSlotTable* Table = Shard.Table.load(std::memory_order_relaxed);
+			Index = Find(*Table, InString, InLength, InHash);
+			if (Index != INDEX_NONE)
+			{
+				return Index;
+			}
+
+			if ((Shard.NumUsed + 1) * 2 > Table->Mask + 1)
+			{
+				Table = Grow(Shard, *Table);
+			}
+
+			Index = static_cast<int32>(NextIndex.fetch_add(1, std::memory_order_relaxed));
+			AllocateDisplayName(Index).assign(InString, InLength);
+			const char* Record = CopyToArena(Shard, InString, InLength);
+
+			// 표시 이름과 아레나 레코드를 다 쓴 뒤 슬롯을 공개한다 (잠그지 않고 읽는 쪽의 acquire와 짝)
+			InsertSlot(*Table, InHash, Index, Record, std::memory_order_release);
+			++Shard.NumUsed;
+			return Index;
+		}
+
+		FString& GetDisplayName(int32 InIndex) const
+		{
+			FString* Chunk = DisplayChunks[static_cast<uint32>(InIndex) >> EntryChunkBits].load(std::memory_order_acquire);
+			return Chunk[static_cast<uint32>(InIndex) & (EntriesPerChunk - 1)];
+		}
+
+	private:
+		int32 Find(const FSlotTable& InTable, const char* InString, uint32 InLength, uint32 InHash) const
+		{
+			// 표는 절반 넘게 차지 않으므로 빈 슬롯에서 반드시 끝난다
+			for (uint32 Slot = InHash & InTable.Mask;; Slot = (Slot + 1) & InTable.Mask)
+			{
+				const FSlot& Current = InTable.Slots[Slot];
+				const uint64 Value = Current.HashAndIndex.load(std::memory_order_acquire);
+				if (Value == 0)
+				{
+					return INDEX_NONE;
+				}
+				if (static_cast<uint32>(Value >> 32) == InHash && GetRecordLength(Current.String) == InLength &&
+					EqualsIgnoreCase(GetRecordString(Current.String), InString, InLength))
+				{
+					return static_cast<int32>(static_cast<uint32>(Value) - 1);
+				}
+			}
+		}
+
+		static void InsertSlot(FSlotTable& InTable, uint32 InHash, int32 InIndex, const char* InRecord, std::memory_order InOrder)
+		{
+			uint32 Slot = InHash & InTable.Mask;
+			while (InTable.Slots[Slot].HashAndIndex.load(std::memory_order_relaxed) != 0)
+			{
+				Slot = (Slot + 1) & InTable.Mask;
+			}
+			InTable.Slots[Slot].String = InRecord;
+			const uint64 Value = (static_cast<uint64>(InHash) << 32) | (static_cast<uint32>(InIndex) + 1);
+			InTable.Slots[Slot].HashAndIndex.store(Value, InOrder);
+		}
+
+		FSlotTable* Grow(FNameShard& InShard, const FSlotTable& InOldTable)
+		{
+			const uint32 OldNumSlots = InOldTable.Mask + 1;
+			TUniquePtr<FSlotTable> NewTable = std::make_unique<FSlotTable>(OldNumSlots * 2);
+			for (uint32 Slot = 0; Slot < OldNumSlots; ++Slot)
+			{
+				const FSlot& OldSlot = InOldTable.Slots[Slot];
+				const uint64 Value = OldSlot.HashAndIndex.load(std::memory_order_relaxed);
+				if (Value != 0)
+				{
+					InsertSlot(*NewTable, static_cast<uint32>(Value >> 32), static_cast<int32>(static_cast<uint32>(Value) - 1), OldSlot.String,
+						std::memory_order_relaxed);
+				}
+			}
+
+			// 이전 표를 읽던 스레드는 이후 등록된 이름을 못 찾고 잠금 경로로 넘어올 뿐이므로 해제만 하지 않으면 된다
+			FSlotTable* Result = NewTable.get();
+			InShard.Tables.push_back(std::move(NewTable));
+			InShard.Table.store(Result, std::memory_order_release);
+			return Result;
+		}
+
+		FString& AllocateDisplayName(int32 InIndex)
+		{
+			const uint32 ChunkIndex = static_cast<uint32>(InIndex) >> EntryChunkBits;
+			assert(ChunkIndex < MaxEntryChunks && "FName table is full");
+
+			// 다른 샤드에서 같은 청크의 첫 항목을 동시에 등록할 수 있으므로 먼저 끼운 쪽을 쓴다
+			FString* Chunk = DisplayChunks[ChunkIndex].load(std::memory_order_acquire);
+			if (!Chunk)
+			{
+				FString* NewChunk = new FString[EntriesPerChunk];
+				if (DisplayChunks[ChunkIndex].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel))
+				{
+					Chunk = NewChunk;
+				}
+				else
+				{
+					delete[] NewChunk;
+				}
+			}
+			return Chunk[static_cast<uint32>(InIndex) & (EntriesPerChunk - 1)];
+		}
+
+		// [uint32 길이][문자들]['\0'] 레코드를 아레나에 복사하고 레코드 주소를 반환
+		static const char* CopyToArena(FNameShard& InShard, const char* InString, uint32 InLength)
+		{
+			// 길이를 바로 읽을 수 있도록 레코드는 4바이트 경계에서 시작
+			const size_t Size = (sizeof(uint32) + InLength + 1 + 3) & ~static_cast<size_t>(3);
+			char* Record;
+			if (Size > ArenaBlockSize / 4)
+			{
+				// 긴 문자열은 따로 할당해 현재 블록의 남은 공간을 버리지 않는다
+				InShard.ArenaBlocks.push_back(TUniquePtr<char[]>(new char[Size]));
+				Record = InShard.ArenaBlocks.back().get();
+			}
+			else
+			{
+				if (Size > InShard.ArenaRemaining)
+				{
+					InShard.ArenaBlocks.push_back(TUniquePtr<char[]>(new char[ArenaBlockSize]));
+					InShard.ArenaCursor = InShard.ArenaBlocks.back().get();
+					InShard.ArenaRemaining = ArenaBlockSize;
+				}
+				Record = InShard.ArenaCursor;
+				InShard.ArenaCursor += Size;
+				InShard.ArenaRemaining -= Size;
+			}
+
+			memcpy(Record, &InLength, sizeof(InLength));
+			memcpy(Record + sizeof(uint32), InString, InLength);
+			Record[sizeof(uint32) + InLength] = '\0';
+			return Record;
+		}
+
+		FNameShard Shards[NumShards];
+		std::atomic<FString*> DisplayChunks[MaxEntryChunks] = {};
+		std::atomic<uint32> NextIndex{ 0 };
+	};
 }
 
 /**
@@ -39,43 +321,30 @@ const FName& FName::GetNone()
 	return NoneInstance;
 }
 
+/**
+ * @brief 문자열 조각으로 FName을 만드는 생성자 (다른 문자열 생성자는 모두 여기로 모임)
+ * @param InString 이름 문자열 (대소문자를 구분하지 않고 비교하며, 처음 등록한 표기를 표시 이름으로 사용)
+ */
+FName::FName(std::string_view InString)
+	: FName(InString.data(), static_cast<uint32>(InString.size()), HashStringRuntime(InString.data(), InString.size()))
+{
+}
+
 /**
  * @brief FName 생성자
  * @param InString FString 타입의 문자열
  */
 FName::FName(const FString& InString)
+	: FName(std::string_view(InString))
 {
-	// 비교는 Lower로 진행
-	FString LowerString = InString;
-	std::transform(LowerString.begin(), LowerString.end(), LowerString.begin(),
-		[](unsigned char InChar) { return std::tolower(InChar); });
-
-	// 헬퍼 함수를 통해 안전하게 NameMap에 접근합니다.
-	auto& NameMapRef = GetNameMap();
-	auto FindResult = NameMapRef.find(LowerString);
-
-	// 동일 이름이 존재하지 않는 경우
-	if (FindResult == NameMapRef.end())
-	{
-		// 헬퍼 함수를 통해 안전하게 정적 데이터들을 수정합니다.
-		auto& NextIndexRef = GetNextIndex();
-		NameMapRef.insert({ LowerString, NextIndexRef });
-		GetDisplayNames().push_back(InString);
-
-		// 인덱스 제공
-		ComparisonIndex = NextIndexRef++;
-		DisplayIndex = ComparisonIndex;
-	}
-	// 이미 존재하는 경우
-	else
-	{
-		ComparisonIndex = FindResult->second;
-		DisplayIndex = ComparisonIndex;
-	}
 }
 
-FName::FName() : FName(FString(""))
+FName::FName()
 {
+	// 빈 이름은 자주 만들어지므로 인덱스를 한 번만 찾는다
+	static const int32 EmptyIndex = FNameTable::Get().FindOrAdd("", 0, HashString("", 0));
+	ComparisonIndex = EmptyIndex;
+	DisplayIndex = ComparisonIndex;
 }
 
 /**
@@ -83,8 +352,24 @@ FName::FName() : FName(FString(""))
  * @param InStringPtr c-style 문자열
  */
 FName::FName(const char* InStringPtr)
-	: FName(FString(InStringPtr))
+	: FName(std::string_view(InStringPtr))
+{
+}
+
+/**
+ * @brief 미리 계산한 해시로 FName을 만드는 생성자 (해시 계산을 건너뜀)
+ * @param InStringPtr c-style 문자열
+ * @param InHash HashString(InStringPtr)
+ */
+FName::FName(const char* InStringPtr, uint32 InHash)
+	: FName(InStringPtr, static_cast<uint32>(strlen(InStringPtr)), InHash)
+{
+}
+
+FName::FName(const char* InString, uint32 InLength, uint32 InHash)
 {
+	ComparisonIndex = FNameTable::Get().FindOrAdd(InString, InLength, InHash);
+	DisplayIndex = ComparisonIndex;
 }
 
 /**
@@ -133,8 +418,8 @@ bool FName::operator!=(const FName& InOther) const
  */
 const FString& FName::ToString() const
 {
-	// 헬퍼 함수를 통해 안전하게 DisplayNames에 접근합니다.
-	return GetDisplayNames()[DisplayIndex];
+	// 표시 이름은 옮겨지지 않으므로 잠그지 않고 참조를 반환합니다.
+	return FNameTable::Get().GetDisplayName(DisplayIndex);
 }
 
 /**
@@ -143,5 +428,5 @@ const FString& FName::ToString() const
  */
 void FName::SetDisplayName(const FString& InDisplayName) const
 {
-	GetDisplayNames()[this->DisplayIndex] = InDisplayName;
+	FNameTable::Get().GetDisplayName(this->DisplayIndex) = InDisplayName;
 }
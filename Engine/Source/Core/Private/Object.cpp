@@ -1,29 +1,20 @@
 #include "pch.h"
 #include "Core/Public/Object.h"
+#include "Core/Public/ObjectArray.h"
 #include "Core/Public/EngineStatics.h"
 #include "Core/Public/Name.h"
 
+#include <charconv>
 #include <json.hpp>
 
 uint32 UEngineStatics::NextUUID = 0;
 
-TArray<TObjectPtr<UObject>>& GetUObjectArray()
-{
-	static TArray<TObjectPtr<UObject>> GUObjectArray;
-	return GUObjectArray;
-}
-
 IMPLEMENT_CLASS_BASE(UObject)
 
 UObject::~UObject()
 {
-	/** @todo: 이후에 리뷰 필요 */
-
-	// std::vector에 맞는 올바른 인덱스 유효성 검사
-	if (InternalIndex < GetUObjectArray().size())
-	{
-		GetUObjectArray()[InternalIndex] = nullptr;
-	}
+	// 클래스 리스트에서 빼고 슬롯을 프리 리스트로 돌려준다
+	FUObjectArray::Get().FreeIndex(InternalIndex);
 }
 
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -34,10 +25,13 @@ UObject::UObject()
 	: Name(FName::GetNone()), Outer(nullptr)
 {
 	UUID = UEngineStatics::GenUUID();
-	Name = FName("Object_" + to_string(UUID));
+	// "Object_<UUID>"를 임시 FString 없이 스택 버퍼에서 만들어 이름 표에 넘긴다
+	char NameBuffer[32] = "Object_";
+	constexpr size_t PrefixLength = sizeof("Object_") - 1;
+	const std::to_chars_result Result = std::to_chars(NameBuffer + PrefixLength, NameBuffer + sizeof(NameBuffer), UUID);
+	Name = FName(std::string_view(NameBuffer, Result.ptr - NameBuffer));
 
-	GetUObjectArray().emplace_back(this);
-	InternalIndex = static_cast<uint32>(GetUObjectArray().size()) - 1;
+	InternalIndex = FUObjectArray::Get().AllocateIndex(this);
 }
 
 UObject::UObject(const FName& InName)
@@ -46,8 +40,7 @@ UObject::UObject(const FName& InName)
 {
 	UUID = UEngineStatics::GenUUID();
 
-	GetUObjectArray().emplace_back(this);
-	InternalIndex = static_cast<uint32>(GetUObjectArray().size()) - 1;
+	InternalIndex = FUObjectArray::Get().AllocateIndex(this);
 }
 
 void UObject::SetOuter(UObject* InObject)
@@ -0,0 +1,283 @@
+#include "pch.h"
+#include "Core/Public/ObjectArray.h"
+#include "Core/Public/Object.h"
+
+namespace
+{
+	// 한 번도 조회하지 않는 동안 대기 목록이 파괴된 오브젝트로 계속 늘어나지 않도록 정리하는 최소 크기
+	constexpr size_t MinPendingToCompact = 1024;
+}
+
+FObjectHandle::FObjectHandle(const UObject* InObject)
+{
+	if (InObject)
+	{
+		Index = InObject->GetInternalIndex();
+		Generation = FUObjectArray::Get().GetGeneration(Index);
+	}
+}
+
+FUObjectArray& FUObjectArray::Get()
+{
+	static FUObjectArray GUObjectArray;
+	return GUObjectArray;
+}
+
+int32 FUObjectArray::AllocateIndex(UObject* InObject)
+{
+	int32 Index;
+	if (!FreeIndices.empty())
+	{
+		Index = FreeIndices.back();
+		FreeIndices.pop_back();
+	}
+	else
+	{
+		if (NumSlots == static_cast<int32>(Chunks.size()) * ChunkSize)
+		{
+			Chunks.emplace_back(std::make_unique<FUObjectItem[]>(ChunkSize));
+		}
+		Index = NumSlots++;
+	}
+
+	FUObjectItem& Item = GetItem(Index);
+	Item.Object = InObject;
+	Item.ClassList = nullptr;
+	Item.PrevInClass = -1;
+	Item.NextInClass = -1;
+	++NumObjects;
+
+	if (PendingObjects.size() >= MinPendingToCompact && PendingObjects.size() > 2 * static_cast<size_t>(NumObjects))
+	{
+		CompactPendingObjects();
+	}
+	PendingObjects.emplace_back(Index, Item.Generation);
+
+	return Index;
+}
+
+void FUObjectArray::FreeIndex(int32 InIndex)
+{
+	if (!IsValidIndex(InIndex))
+	{
+		return;
+	}
+
+	FUObjectItem& Item = GetItem(InIndex);
+	if (!Item.Object)
+	{
+		return;
+	}
+
+	if (Item.ClassList)
+	{
+		UnlinkFromClass(InIndex);
+	}
+
+	// 세대를 올려 이 슬롯을 가리키던 핸들과 대기 목록 항목을 무효화
+	Item.Object = nullptr;
+	++Item.Generation;
+	FreeIndices.push_back(InIndex);
+	--NumObjects;
+}
+
+void FUObjectArray::GetObjectsOfClass(UClass* InClass, TArray<FObjectHandle>& OutHandles)
+{
+	if (!InClass)
+	{
+		return;
+	}
+
+	BindPendingObjects();
+
+	const TArray<FClassObjectList*>& Lists = GetMatchingLists(InClass);
+
+	size_t NumMatches = 0;
+	for (const FClassObjectList* List : Lists)
+	{
+		NumMatches += List->Num;
+	}
+	OutHandles.reserve(OutHandles.size() + NumMatches + PendingObjects.size());
+
+	if (NumMatches * SequentialScanRatio > static_cast<size_t>(NumSlots))
+	{
+		// 대상 리스트에 표시한 뒤 슬롯 순서대로 훑는다 (표시 값이 한 바퀴 돌면 모두 지우고 다시 시작)
+		if (++NextQueryStamp == 0)
+		{
+			for (auto& [Class, List] : ClassLists)
+			{
+				List.QueryStamp = 0;
+			}
+			NextQueryStamp = 1;
+		}
+		for (FClassObjectList* List : Lists)
+		{
+			List->QueryStamp = NextQueryStamp;
+		}
+
+		for (int32 ChunkStart = 0; ChunkStart < NumSlots; ChunkStart += ChunkSize)
+		{
+			const FUObjectItem* Items = Chunks[ChunkStart >> ChunkShift].get();
+			const int32 Count = std::min(ChunkSize, NumSlots - ChunkStart);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				if (Items[i].ClassList && Items[i].ClassList->QueryStamp == NextQueryStamp)
+				{
+					OutHandles.emplace_back(ChunkStart + i, Items[i].Generation);
+				}
+			}
+		}
+	}
+	else
+	{
+		for (const FClassObjectList* List : Lists)
+		{
+			for (int32 Index = List->Head; Index != -1;)
+			{
+				const FUObjectItem& Item = GetItem(Index);
+				OutHandles.emplace_back(Index, Item.Generation);
+				Index = Item.NextInClass;
+			}
+		}
+	}
+
+	// NewObject 실행 중에 생긴 오브젝트는 리스트에 없으므로 기존처럼 클래스 체인으로 확인
+	for (const FObjectHandle& Pending : PendingObjects)
+	{
+		UObject* Object = Resolve(Pending);
+		if (Object && !GetItem(Pending.Index).ClassList && Object->IsA(TObjectPtr<UClass>(InClass)))
+		{
+			OutHandles.push_back(Pending);
+		}
+	}
+}
+
+uint32 FUObjectArray::GetNumObjectsOfExactClass(UClass* InClass) const
+{
+	auto Iter = ClassLists.find(InClass);
+	return Iter != ClassLists.end() ? Iter->second.Num : 0;
+}
+
+void FUObjectArray::BeginConstruction()
+{
+	if (ConstructionDepth++ == 0)
+	{
+		NumPendingBeforeConstruction = PendingObjects.size();
+	}
+}
+
+void FUObjectArray::EndConstruction()
+{
+	--ConstructionDepth;
+}
+
+void FUObjectArray::BindPendingObjects()
+{
+	// NewObject 실행 중이면 그 전에 생긴 (생성이 끝난) 오브젝트까지만 넣는다
+	const size_t NumToBind = ConstructionDepth > 0 ? NumPendingBeforeConstruction : PendingObjects.size();
+	if (NumToBind == 0)
+	{
+		return;
+	}
+
+	for (size_t i = 0; i < NumToBind; ++i)
+	{
+		const FObjectHandle& Pending = PendingObjects[i];
+		UObject* Object = Resolve(Pending);
+		if (Object && !GetItem(Pending.Index).ClassList)
+		{
+			LinkToClass(Pending.Index, Object->GetClass().Get());
+		}
+	}
+
+	PendingObjects.erase(PendingObjects.begin(), PendingObjects.begin() + NumToBind);
+	NumPendingBeforeConstruction = 0;
+}
+
+void FUObjectArray::CompactPendingObjects()
+{
+	size_t NumKept = 0;
+	size_t NumKeptBeforeConstruction = 0;
+	for (size_t i = 0; i < PendingObjects.size(); ++i)
+	{
+		if (Resolve(PendingObjects[i]))
+		{
+			if (i < NumPendingBeforeConstruction)
+			{
+				++NumKeptBeforeConstruction;
+			}
+			PendingObjects[NumKept++] = PendingObjects[i];
+		}
+	}
+
+	PendingObjects.resize(NumKept);
+	NumPendingBeforeConstruction = NumKeptBeforeConstruction;
+}
+
+void FUObjectArray::LinkToClass(int32 InIndex, UClass* InClass)
+{
+	FClassObjectList& List = ClassLists[InClass];
+	FUObjectItem& Item = GetItem(InIndex);
+
+	Item.ClassList = &List;
+	Item.PrevInClass = List.Tail;
+	Item.NextInClass = -1;
+	if (List.Tail != -1)
+	{
+		GetItem(List.Tail).NextInClass = InIndex;
+	}
+	else
+	{
+		List.Head = InIndex;
+	}
+	List.Tail = InIndex;
+	++List.Num;
+}
+
+void FUObjectArray::UnlinkFromClass(int32 InIndex)
+{
+	FUObjectItem& Item = GetItem(InIndex);
+	FClassObjectList& List = *Item.ClassList;
+
+	if (Item.PrevInClass != -1)
+	{
+		GetItem(Item.PrevInClass).NextInClass = Item.NextInClass;
+	}
+	else
+	{
+		List.Head = Item.NextInClass;
+	}
+
+	if (Item.NextInClass != -1)
+	{
+		GetItem(Item.NextInClass).PrevInClass = Item.PrevInClass;
+	}
+	else
+	{
+		List.Tail = Item.PrevInClass;
+	}
+
+	Item.ClassList = nullptr;
+	Item.PrevInClass = -1;
+	Item.NextInClass = -1;
+	--List.Num;
+}
+
+const TArray<FUObjectArray::FClassObjectList*>& FUObjectArray::GetMatchingLists(UClass* InClass)
+{
+	// 리스트는 지우지 않으므로 개수가 같으면 캐시가 유효하다
+	FClassMatch& Match = MatchCache[InClass];
+	if (Match.NumClassLists != ClassLists.size())
+	{
+		Match.Lists.clear();
+		for (auto& [Class, List] : ClassLists)
+		{
+			if (Class->IsChildOf(TObjectPtr<UClass>(InClass)))
+			{
+				Match.Lists.push_back(&List);
+			}
+		}
+		Match.NumClassLists = ClassLists.size();
+	}
+	return Match.Lists;
+}
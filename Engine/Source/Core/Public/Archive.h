@@ -5,6 +5,25 @@
 #include "Global/CoreTypes.h"
 #include "Global/Vector.h"
 
+/**
+ * @brief 배열 전체를 Serialize 한 번으로 읽고 쓸 수 있는 원소 타입
+ * 원소별 operator<<가 메모리 표현을 그대로 쓰는 타입만 해당한다 (패딩 없음, 필드 순서대로)
+ * 그래서 일괄 경로로 쓴 파일은 원소별로 쓴 파일과 바이트 단위로 같다
+ * 벡터 타입은 복사 생성자를 직접 정의해 trivially copyable이 아니므로 명시적으로 특수화한다
+ */
+template<typename T>
+struct TCanBulkSerialize : std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T>>
+{
+};
+
+template<> struct TCanBulkSerialize<FVector> : std::true_type {};
+template<> struct TCanBulkSerialize<FVector2> : std::true_type {};
+template<> struct TCanBulkSerialize<FVector4> : std::true_type {};
+
+static_assert(sizeof(FVector) == sizeof(float) * 3 && std::is_standard_layout_v<FVector>, "FVector is bulk serialized");
+static_assert(sizeof(FVector2) == sizeof(float) * 2 && std::is_standard_layout_v<FVector2>, "FVector2 is bulk serialized");
+static_assert(sizeof(FVector4) == sizeof(float) * 4 && std::is_standard_layout_v<FVector4>, "FVector4 is bulk serialized");
+
 struct FArchive
 {
 	virtual ~FArchive() = default;
@@ -13,6 +32,15 @@ struct FArchive
 	virtual bool IsLoading() const = 0;
 	virtual void Serialize(void* V, size_t Length) = 0;
 
+	/** 읽기/쓰기 중 실패가 있었으면 true (이후 읽은 값은 믿을 수 없다) */
+	bool IsError() const { return bIsError; }
+
+	/**
+	 * @brief 읽기 아카이브에서 남은 바이트 수 (알 수 없으면 SIZE_MAX)
+	 * 배열 길이가 남은 크기보다 크면 할당 전에 실패 처리하는 데 쓴다
+	 */
+	virtual size_t GetRemainingSize() const { return SIZE_MAX; }
+
 	template<typename T, typename = std::enable_if_t<std::is_trivially_copyable_v<T>>>
 	FArchive& operator<<(T& Value)
 	{
@@ -28,12 +56,33 @@ struct FArchive
 
 		if (IsLoading())
 		{
+			// 깨진 파일의 길이로 거대한 배열을 만들지 않도록 최소 크기(원소당 1바이트)로 먼저 검사
+			if (bIsError || Length > GetRemainingSize())
+			{
+				SetError();
+				Value.clear();
+				return *this;
+			}
 			Value.resize(Length);
 		}
 
-		for (T& Element : Value)
+		if constexpr (TCanBulkSerialize<T>::value)
+		{
+			if (Length > 0)
+			{
+				Serialize(Value.data(), Length * sizeof(T));
+			}
+		}
+		else
 		{
-			*this << Element;
+			for (T& Element : Value)
+			{
+				*this << Element;
+				if (bIsError)
+				{
+					break;
+				}
+			}
 		}
 
 		return *this;
@@ -50,10 +99,22 @@ struct FArchive
 		}
 		else
 		{
+			if (bIsError || Length > GetRemainingSize())
+			{
+				SetError();
+				Value.clear();
+				return *this;
+			}
 			Value.resize(Length);
 			Serialize(Value.data(), Length * sizeof(FString::value_type));
 		}
 
 		return *this;
 	}
+
+protected:
+	void SetError() { bIsError = true; }
+
+private:
+	bool bIsError = false;
 };
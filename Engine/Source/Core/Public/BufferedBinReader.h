@@ -0,0 +1,36 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+
+#include "Core/Public/Archive.h"
+
+/**
+ * @brief 큰 내부 버퍼로 파일을 읽는 읽기 아카이브
+ * 작은 Serialize 호출은 버퍼에서 복사하고, 버퍼보다 큰 요청은 파일에서 바로 읽는다
+ * 파일 끝을 넘는 읽기는 0으로 채우고 IsError()를 세운다
+ */
+struct FBufferedBinReader : public FArchive
+{
+	static constexpr size_t DefaultBufferSize = 1024 * 1024;
+
+	explicit FBufferedBinReader(const std::filesystem::path& FilePath, size_t InBufferSize = DefaultBufferSize);
+
+	bool IsOpen() const { return Stream.is_open(); }
+
+	bool IsLoading() const override { return true; }
+	void Serialize(void* V, size_t Length) override;
+	size_t GetRemainingSize() const override { return FileSize - Position; }
+
+private:
+	bool Refill();
+
+	std::ifstream Stream;
+	TArray<char> Buffer;
+	size_t BufferBegin = 0;
+	size_t BufferEnd = 0;
+
+	// 지금까지 Serialize로 넘겨준 바이트 수와 전체 파일 크기
+	size_t Position = 0;
+	size_t FileSize = 0;
+};
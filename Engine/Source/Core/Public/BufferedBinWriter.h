@@ -0,0 +1,33 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+
+#include "Core/Public/Archive.h"
+
+/**
+ * @brief 큰 내부 버퍼에 모았다가 한 번에 쓰는 쓰기 아카이브
+ * 버퍼보다 큰 요청은 모인 내용을 비운 뒤 파일에 바로 쓴다. 소멸 시 남은 내용을 비운다
+ */
+struct FBufferedBinWriter : public FArchive
+{
+	static constexpr size_t DefaultBufferSize = 1024 * 1024;
+
+	explicit FBufferedBinWriter(const std::filesystem::path& FilePath, size_t InBufferSize = DefaultBufferSize);
+	virtual ~FBufferedBinWriter();
+
+	bool IsOpen() const { return Stream.is_open(); }
+
+	bool IsLoading() const override { return false; }
+	void Serialize(void* V, size_t Length) override;
+
+	// 모인 내용을 파일에 쓴다 (실패하면 false, IsError()도 세워짐)
+	bool Flush();
+
+private:
+	void WriteToStream(const char* InData, size_t InLength);
+
+	std::ofstream Stream;
+	TArray<char> Buffer;
+	size_t BufferUsed = 0;
+};
@@ -78,7 +78,7 @@ private: \
         if (!ClassPrivate) \
         { \
             ClassPrivate = TObjectPtr<UClass>(new UClass( \
-                FName(#ClassName), \
+                NAME_LITERAL(#ClassName), \
                 SuperClassName::StaticClass(), \
                 sizeof(ClassName), \
                 &ClassName::CreateDefaultObject##ClassName \
@@ -132,7 +132,7 @@ private: \
         if (!ClassPrivate) \
         { \
             ClassPrivate = TObjectPtr<UClass>(new UClass( \
-                FName(#ClassName), \
+                NAME_LITERAL(#ClassName), \
                 SuperClassName::StaticClass(), \
                 sizeof(ClassName), \
                 nullptr /* 싱글톤은 동적 생성을 지원하지 않으므로 생성자 포인터를 null로 전달 */ \
@@ -165,7 +165,7 @@ private: \
         if (!ClassPrivate) \
         { \
             ClassPrivate = TObjectPtr<UClass>(new UClass( \
-                FName(#ClassName), \
+                NAME_LITERAL(#ClassName), \
                 nullptr, \
                 sizeof(ClassName), \
                 nullptr \
@@ -198,7 +198,7 @@ private: \
         if (!ClassPrivate) \
         { \
             ClassPrivate = TObjectPtr<UClass>(new UClass( \
-                FName(#ClassName), \
+                NAME_LITERAL(#ClassName), \
                 nullptr, \
                 sizeof(ClassName), \
                 &ClassName::CreateDefaultObject##ClassName \
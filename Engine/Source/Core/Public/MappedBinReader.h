@@ -0,0 +1,26 @@
+#pragma once
+
+#include <filesystem>
+
+#include "Core/Public/Archive.h"
+#include "Core/Public/MappedFile.h"
+
+/**
+ * @brief 메모리 매핑한 파일에서 읽는 읽기 아카이브
+ * Serialize는 커서 위치에서 memcpy 한 번이므로 배열 일괄 읽기가 파일 크기만큼의 복사로 끝난다
+ * 파일 끝을 넘는 읽기는 0으로 채우고 IsError()를 세운다
+ */
+struct FMappedBinReader : public FArchive
+{
+	explicit FMappedBinReader(const std::filesystem::path& FilePath);
+
+	bool IsOpen() const { return File.IsOpen(); }
+
+	bool IsLoading() const override { return true; }
+	void Serialize(void* V, size_t Length) override;
+	size_t GetRemainingSize() const override { return File.GetSize() - Position; }
+
+private:
+	FMappedFile File;
+	size_t Position = 0;
+};
@@ -0,0 +1,34 @@
+#pragma once
+#include <filesystem>
+
+/**
+ * @brief 읽기 전용 메모리 매핑 파일
+ * 파일 전체를 주소 공간에 매핑해 복사 없이 읽는다 (OS가 페이지 단위로 필요할 때 읽어 옴)
+ * 빈 파일은 매핑 없이 열린 상태가 되며 GetData()는 nullptr, GetSize()는 0이다
+ */
+class FMappedFile
+{
+public:
+	FMappedFile() = default;
+	~FMappedFile() { Close(); }
+
+	FMappedFile(const FMappedFile&) = delete;
+	FMappedFile& operator=(const FMappedFile&) = delete;
+
+	bool Open(const std::filesystem::path& InFilePath);
+	void Close();
+
+	bool IsOpen() const { return bIsOpen; }
+	const char* GetData() const { return Data; }
+	size_t GetSize() const { return Size; }
+
+private:
+	const char* Data = nullptr;
+	size_t Size = 0;
+	bool bIsOpen = false;
+
+#ifdef _WIN32
+	void* FileHandle = nullptr;
+	void* MappingHandle = nullptr;
+#endif
+};
@@ -1,8 +1,11 @@
 #pragma once
+#include <string_view>
+#include <type_traits>
 
 /**
  * @brief 오브젝트의 이름을 담당하는 구조체
  * 대소문자 관계 없는 비교 처리와 사용자가 직접 작성한 Display Name을 동시에 사용할 수 있음
+ * 이름 표는 어느 스레드에서나 쓸 수 있다 (이미 있는 이름의 조회는 잠그지 않고, 새 이름 등록만 해시 샤드 단위로 잠근다)
  * @param DisplayIndex 표시용 이름 배열에 접근하기 위한 인덱스
  * @param ComparisonIndex 이름 비교를 위한 인덱스
  */
@@ -15,9 +18,79 @@ public:
 	// 'None' 값에 접근하기 위한 정적 함수
 	static const FName& GetNone();
 
+	/**
+	 * @brief 대소문자를 구분하지 않는 이름 해시 (ASCII만 소문자로 접어서 계산하므로 복사본이 필요 없음)
+	 * constexpr이므로 문자열 리터럴의 해시는 컴파일 타임에 구할 수 있다 (NAME_LITERAL 참고)
+	 */
+	static constexpr uint32 HashString(const char* InString, size_t InLength)
+	{
+		// 8바이트씩 읽어 접은 뒤 곱셈으로 섞는다
+		uint64 Hash = 0x9E3779B97F4A7C15ull ^ InLength;
+		size_t Offset = 0;
+		for (; Offset + 8 <= InLength; Offset += 8)
+		{
+			Hash = MixNameWord(Hash, FoldNameWord(LoadNameWord(InString + Offset, 8)));
+		}
+		if (Offset < InLength)
+		{
+			Hash = MixNameWord(Hash, FoldNameWord(LoadNameWord(InString + Offset, InLength - Offset)));
+		}
+
+		// 하위 비트로 슬롯, 상위 비트로 샤드를 고르므로 마지막에 비트를 고루 섞는다
+		// (Name.cpp의 런타임 버전도 같은 값을 내야 함)
+		Hash ^= Hash >> 33;
+		Hash *= 0xFF51AFD7ED558CCDull;
+		Hash ^= Hash >> 33;
+		return static_cast<uint32>(Hash);
+	}
+
+	// 아래 셋은 HashString의 구성 요소 (Name.cpp의 런타임 해시와 대소문자 무시 비교도 같은 규칙을 쓴다)
+	// 리틀 엔디언 순서로 최대 8바이트를 읽는다 (남는 바이트는 0)
+	static constexpr uint64 LoadNameWord(const char* InString, size_t InCount)
+	{
+		uint64 Word = 0;
+		for (size_t i = 0; i < InCount; ++i)
+		{
+			Word |= static_cast<uint64>(static_cast<unsigned char>(InString[i])) << (i * 8);
+		}
+		return Word;
+	}
+
+	// 8바이트 중 'A'~'Z'인 바이트에만 0x20을 더한다 (0x80 이상인 바이트는 그대로)
+	static constexpr uint64 FoldNameWord(uint64 InWord)
+	{
+		constexpr uint64 Ones = 0x0101010101010101ull;
+		constexpr uint64 HighBits = Ones * 0x80;
+		const uint64 Low7 = InWord & ~HighBits;
+		const uint64 AtLeastA = Low7 + Ones * (0x80 - 'A');
+		const uint64 AboveZ = Low7 + Ones * (0x80 - 'Z' - 1);
+		const uint64 IsUpper = AtLeastA & ~AboveZ & ~InWord & HighBits;
+		return InWord | (IsUpper >> 2);
+	}
+
+	static constexpr uint64 MixNameWord(uint64 InHash, uint64 InWord)
+	{
+		const uint64 Hash = (InHash ^ InWord) * 0xBF58476D1CE4E5B9ull;
+		return Hash ^ (Hash >> 29);
+	}
+
+	static constexpr uint32 HashString(const char* InString)
+	{
+		size_t Length = 0;
+		while (InString[Length] != '\0')
+		{
+			++Length;
+		}
+		return HashString(InString, Length);
+	}
+
 	FName();
 	FName(const char* InStringPtr);
 	FName(const FString& InString);
+	FName(std::string_view InString);
+
+	// InHash는 HashString(InStringPtr)과 같아야 한다 (리터럴은 NAME_LITERAL로 컴파일 타임에 계산)
+	FName(const char* InStringPtr, uint32 InHash);
 
 	int32 Compare(const FName& InOther) const;
 	bool operator==(const FName& InOther) const;
@@ -31,7 +104,7 @@ public:
 		return std::hash<int32>{}(ComparisonIndex);
 	}
 
-	// Display 이름 변경 함수
+	// Display 이름 변경 함수 (ToString은 잠그지 않고 읽으므로 메인 스레드에서만 호출)
 	void SetDisplayName(const FString& InDisplayName) const;
 
 private:
@@ -39,8 +112,14 @@ private:
 
 	// 특정 인덱스로 FName을 생성하는 private 생성자
 	FName(int32 InComparisonIndex);
+
+	// 길이와 해시를 이미 아는 문자열로 이름 표를 찾는 private 생성자 (공개 생성자는 모두 여기로 모임)
+	FName(const char* InString, uint32 InLength, uint32 InHash);
 };
 
+// 문자열 리터럴의 해시를 컴파일 타임에 계산해 FName 생성
+#define NAME_LITERAL(Literal) FName(Literal, std::integral_constant<uint32, FName::HashString(Literal)>::value)
+
 // std::hash에 대한 FName 특수화
 namespace std
 {
@@ -43,6 +43,7 @@ public:
 	uint64 GetAllocatedBytes() const { return AllocatedBytes; }
 	uint32 GetAllocatedCount() const { return AllocatedCounts; }
 	uint32 GetUUID() const { return UUID; }
+	int32 GetInternalIndex() const { return InternalIndex; }
 	bool IsPendingKill() const { return bPendingKill; }
 
 	void SetName(const FName& InName) { Name = InName; }
@@ -57,7 +58,7 @@ private:
 private:
 	// 5. Private 멤버 변수
 	uint32 UUID;
-	uint32 InternalIndex;
+	int32 InternalIndex;		// FUObjectArray의 슬롯 (파괴되면 다른 오브젝트가 재사용)
 	FName Name;
 	TObjectPtr<UObject> Outer;
 	uint64 AllocatedBytes = 0;
@@ -239,5 +240,3 @@ bool IsValid(const TObjectPtr<U>& InObjectPtr)
 {
 	return InObjectPtr && IsA<T>(InObjectPtr);
 }
-
-TArray<TObjectPtr<UObject>>& GetUObjectArray();
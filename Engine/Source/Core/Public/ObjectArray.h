@@ -0,0 +1,158 @@
+#pragma once
+
+class UObject;
+class UClass;
+
+/**
+ * @brief 오브젝트 배열의 슬롯 인덱스와 세대 번호
+ * 오브젝트가 파괴되면 슬롯의 세대가 바뀌므로, 슬롯이 다른 오브젝트에 재사용되어도 Get()은 nullptr를 반환한다
+ */
+struct FObjectHandle
+{
+	int32 Index = -1;
+	uint32 Generation = 0;
+
+	FObjectHandle() = default;
+	FObjectHandle(int32 InIndex, uint32 InGeneration) : Index(InIndex), Generation(InGeneration) {}
+	explicit FObjectHandle(const UObject* InObject);
+
+	UObject* Get() const;
+	bool IsValid() const { return Get() != nullptr; }
+
+	bool operator==(const FObjectHandle& InOther) const { return Index == InOther.Index && Generation == InOther.Generation; }
+	bool operator!=(const FObjectHandle& InOther) const { return !(*this == InOther); }
+};
+
+/**
+ * @brief 살아 있는 모든 UObject를 담는 전역 오브젝트 배열 (메인 스레드 전용)
+ *
+ * 항목은 고정 크기 청크에 두므로 배열이 커져도 주소가 바뀌지 않고, 파괴된 오브젝트의 슬롯은 프리 리스트로 재사용한다
+ * 오브젝트는 클래스별 침입형 이중 연결 리스트로도 묶여 있어 특정 클래스와 그 하위 클래스의 오브젝트만 훑을 수 있다
+ *
+ * 생성자 안에서는 GetClass()가 아직 최종 클래스를 돌려주지 않으므로 새 오브젝트는 대기 목록에 두었다가 다음 조회 때 클래스 리스트에 넣는다
+ * NewObject가 생성자를 실행하는 동안(FObjectConstructionScope) 만들어진 오브젝트는 리스트에 넣지 않고 조회 때마다 따로 확인한다
+ * @note new로 직접 생성하는 오브젝트의 생성자 안에서 TObjectIterator를 쓰면 그 오브젝트가 부모 클래스 리스트에 들어갈 수 있다
+ */
+class FUObjectArray
+{
+public:
+	static constexpr int32 ChunkShift = 16;
+	static constexpr int32 ChunkSize = 1 << ChunkShift;
+
+	// 일치하는 오브젝트 수 x 이 값이 슬롯 수보다 많으면 슬롯 순서대로 훑는다
+	static constexpr uint32 SequentialScanRatio = 4;
+
+	static FUObjectArray& Get();
+
+	FUObjectArray() = default;
+	FUObjectArray(const FUObjectArray&) = delete;
+	FUObjectArray& operator=(const FUObjectArray&) = delete;
+
+	// UObject 생성자/소멸자에서 호출
+	int32 AllocateIndex(UObject* InObject);
+	void FreeIndex(int32 InIndex);
+
+	uint32 GetGeneration(int32 InIndex) const
+	{
+		return IsValidIndex(InIndex) ? GetItem(InIndex).Generation : 0;
+	}
+
+	// 세대가 다르면 (파괴되었거나 슬롯이 재사용되었으면) nullptr
+	UObject* Resolve(const FObjectHandle& InHandle) const
+	{
+		if (!IsValidIndex(InHandle.Index))
+		{
+			return nullptr;
+		}
+		const FUObjectItem& Item = GetItem(InHandle.Index);
+		return Item.Generation == InHandle.Generation ? Item.Object : nullptr;
+	}
+
+	/**
+	 * @brief InClass이거나 그 하위 클래스인 살아 있는 오브젝트의 핸들을 OutHandles 뒤에 붙인다
+	 * 해당 클래스들의 리스트만 훑으므로 비용은 일치하는 오브젝트 수에 비례한다
+	 * 일치하는 오브젝트가 슬롯의 상당 부분이면 리스트를 따라 흩어진 항목을 읽는 대신 슬롯 순서대로 훑는다 (순서는 보장하지 않음)
+	 */
+	void GetObjectsOfClass(UClass* InClass, TArray<FObjectHandle>& OutHandles);
+
+	// InClass 하나의 리스트에 들어 있는 오브젝트 수 (하위 클래스와 대기 중인 오브젝트는 제외)
+	uint32 GetNumObjectsOfExactClass(UClass* InClass) const;
+
+	void BeginConstruction();
+	void EndConstruction();
+
+	uint32 GetNumObjects() const { return NumObjects; }
+	// 한 번이라도 사용된 슬롯 수 (재사용되므로 동시에 살아 있던 오브젝트 수의 최댓값)
+	uint32 GetNumSlots() const { return static_cast<uint32>(NumSlots); }
+
+private:
+	struct FClassObjectList
+	{
+		int32 Head = -1;
+		int32 Tail = -1;
+		uint32 Num = 0;
+		uint32 QueryStamp = 0;		// 순차 조회 중 이 리스트가 대상인지 표시
+	};
+
+	struct FUObjectItem
+	{
+		UObject* Object = nullptr;
+		FClassObjectList* ClassList = nullptr;		// 들어 있는 클래스 리스트 (대기 중이면 nullptr)
+		int32 PrevInClass = -1;
+		int32 NextInClass = -1;
+		uint32 Generation = 0;
+	};
+
+	// 조회한 클래스별로 일치하는 리스트를 캐시 (리스트가 새로 생기면 다시 만듦)
+	struct FClassMatch
+	{
+		size_t NumClassLists = 0;
+		TArray<FClassObjectList*> Lists;
+	};
+
+	bool IsValidIndex(int32 InIndex) const { return 0 <= InIndex && InIndex < NumSlots; }
+
+	FUObjectItem& GetItem(int32 InIndex) { return Chunks[InIndex >> ChunkShift][InIndex & (ChunkSize - 1)]; }
+	const FUObjectItem& GetItem(int32 InIndex) const { return Chunks[InIndex >> ChunkShift][InIndex & (ChunkSize - 1)]; }
+
+	// 생성이 끝난 대기 오브젝트를 클래스 리스트에 넣는다
+	void BindPendingObjects();
+	// 파괴된 오브젝트의 대기 항목을 지운다 (순서 유지)
+	void CompactPendingObjects();
+	void LinkToClass(int32 InIndex, UClass* InClass);
+	void UnlinkFromClass(int32 InIndex);
+
+	const TArray<FClassObjectList*>& GetMatchingLists(UClass* InClass);
+
+	TArray<TUniquePtr<FUObjectItem[]>> Chunks;
+	int32 NumSlots = 0;
+	uint32 NumObjects = 0;
+	TArray<int32> FreeIndices;
+
+	TMap<UClass*, FClassObjectList> ClassLists;
+	TMap<UClass*, FClassMatch> MatchCache;
+	uint32 NextQueryStamp = 0;
+
+	// 생성 후 아직 클래스 리스트에 넣지 않은 오브젝트
+	TArray<FObjectHandle> PendingObjects;
+	// 가장 바깥 NewObject가 시작될 때의 PendingObjects 크기 (그 뒤의 오브젝트는 생성 중일 수 있음)
+	size_t NumPendingBeforeConstruction = 0;
+	int32 ConstructionDepth = 0;
+};
+
+inline UObject* FObjectHandle::Get() const
+{
+	return FUObjectArray::Get().Resolve(*this);
+}
+
+/**
+ * @brief NewObject가 생성자를 실행하는 동안 새 오브젝트가 생성 중인 클래스로 리스트에 들어가지 않도록 표시
+ */
+struct FObjectConstructionScope
+{
+	FObjectConstructionScope() { FUObjectArray::Get().BeginConstruction(); }
+	~FObjectConstructionScope() { FUObjectArray::Get().EndConstruction(); }
+
+	FObjectConstructionScope(const FObjectConstructionScope&) = delete;
+	FObjectConstructionScope& operator=(const FObjectConstructionScope&) = delete;
+};
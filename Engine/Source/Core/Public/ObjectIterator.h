@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Public/Object.h"
+#include "Core/Public/ObjectArray.h"
 
 template<typename TObject>
 struct TObjectRange;
@@ -64,15 +65,8 @@ protected:
 	{
 		ObjectArray.clear();
 
-		for (size_t i = 0; i < GetUObjectArray().size(); ++i)
-		{
-			UObject* Object = Cast<TObject>(GetUObjectArray()[i]);
-
-			if (Object)
-			{
-				ObjectArray.emplace_back(Object);
-			}
-		}
+		// TObject와 하위 클래스의 리스트만 훑으므로 전체 오브젝트 수와 관계없이 일치하는 수에 비례
+		FUObjectArray::Get().GetObjectsOfClass(TObject::StaticClass().Get(), ObjectArray);
 	}
 
 	UObject* GetObject() const
@@ -82,7 +76,7 @@ protected:
 		{
 			return nullptr;
 		}
-		return ObjectArray[Index];
+		return ObjectArray[Index].Get();
 	}
 
 	bool Advance()
@@ -98,14 +92,14 @@ protected:
 	}
 
 private:
-	TObjectIterator(const TArray<UObject*>& InObjectArray, int32 InIndex)
+	TObjectIterator(const TArray<FObjectHandle>& InObjectArray, int32 InIndex)
 		: ObjectArray(InObjectArray), Index(InIndex)
 	{
 	}
 
 protected:
-	/** @note: 언리얼 엔진은 TObjectPtr이 아닌 Raw 포인터 사용 */
-	TArray<UObject*> ObjectArray;
+	/** @note: 순회 도중 파괴된 오브젝트는 핸들의 세대가 달라져 nullptr이 되므로 Advance()에서 건너뜀 */
+	TArray<FObjectHandle> ObjectArray;
 
 	int32 Index;
 };
@@ -15,10 +15,12 @@
 #include "Manager/Time/Public/TimeManager.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Public/TextRenderComponent.h"
+#include "Component/Public/PrimitiveBoundsTable.h"
 #include "Level/Public/Level.h"
 #include "Global/Quaternion.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 #include "Utility/Public/SceneBVH.h"
+#include "Utility/Public/TaskScheduler.h"
 #include "Source/Core/Public/World.h"
 
 UEditor::UEditor()
@@ -101,18 +103,7 @@ void UEditor::Update()
 
 	// CRITICAL: Update all world transforms BEFORE any picking or BVH operations
 	// Level::Update() is called AFTER Editor::Update(), so we must update transforms here first
-	ULevel* CurrentLevel = ULevelManager::GetInstance().GetCurrentLevel();
-	if (CurrentLevel)
-	{
-		TArray<AActor*> Actors = CurrentLevel->GetActorsPtrs();
-		for (auto& Actor : Actors)
-		{
-			if (Actor && Actor->GetRootComponent())
-			{
-				Actor->GetRootComponent()->UpdateWorldTransform();
-			}
-		}
-	}
+	FPrimitiveBoundsTable::Get().UpdateBounds();
 
 	// 뷰포트 레이아웃은 PIE 모드와 관계없이 항상 업데이트
 	// (창 크기 변경, 스플리터 드래그, 뷰포트 전환 애니메이션 등)
@@ -775,31 +766,45 @@ void UEditor::EnsureBVHUpToDate(ULevel* InLevel)
 
 	const TArray<TObjectPtr<UPrimitiveComponent>>& LevelPrims = InLevel->GetLevelPrimitiveComponents();
 
-	// 1) 프리미티브 개수가 변했으면 즉시 재빌드
-	if (SceneBVHLastCount != LevelPrims.size())
+	// 1) 레벨의 추가/제거 기록을 증분 반영 (기록이 없거나 양이 많으면 전체 재빌드)
+	TArray<FLevelPrimitiveChange> PrimChanges;
+	const bool bChangesValid = InLevel->ConsumePrimitiveChanges(PrimChanges);
+	const bool bHasTree = SceneBVH.GetPrimitiveCount() > 0;
+	const bool bTooManyChanges = PrimChanges.size() > std::max<size_t>(64, SceneBVH.GetPrimitiveCount() / 4);
+
+	if (!bHasTree || !bChangesValid || bTooManyChanges)
 	{
-		TArray<UPrimitiveComponent*> RawPrims;
-		RawPrims.reserve(LevelPrims.size());
-		for (auto& Prim : LevelPrims)
+		if (bHasTree || SceneBVHLastCount != LevelPrims.size())
 		{
-			// Safety check: Only add valid primitives (not deleted or pending kill)
-			UPrimitiveComponent* PrimPtr = Prim.Get();
-			if (PrimPtr && !PrimPtr->IsPendingKill())
-			{
-				RawPrims.push_back(PrimPtr);
-			}
+			RebuildBVH(LevelPrims);
+			return;
 		}
-
-		SceneBVH.Build(RawPrims);
+	}
+	else if (!PrimChanges.empty())
+	{
+		ApplyPrimitiveChangesToBVH(PrimChanges);
 		SceneBVHLastCount = LevelPrims.size();
+	}
 
-		PendingDirtyPrims.clear();
-		SceneBVHRefitTick = 0;
-		bPickingWarmed = true;
-
+	// 기록되지 않은 경로로 목록이 바뀐 경우를 위한 안전장치
+	if (SceneBVHLastCount != LevelPrims.size())
+	{
+		RebuildBVH(LevelPrims);
 		return;
 	}
 
+	// 증분 갱신으로 품질이 떨어졌으면 백그라운드에서 재빌드 후 교체
+	SceneBVH.TryFinishAsyncRebuild();
+	if (!SceneBVH.IsRebuildPending() && SceneBVH.ShouldRebuild())
+	{
+		// 워커가 하나 이상이어야 Dispatch가 호출 스레드에서 바로 실행하지 않는다
+		if (!SceneBVHRebuildScheduler)
+		{
+			SceneBVHRebuildScheduler = std::make_unique<FTaskScheduler>(1);
+		}
+		SceneBVH.StartAsyncRebuild(*SceneBVHRebuildScheduler);
+	}
+
 	// 2) 더티가 있으면 부분 리핏
 	if (!PendingDirtyPrims.empty())
 	{
@@ -853,6 +858,7 @@ void UEditor::PrewarmPicking(ULevel* InLevel, UCamera* InCamera)
 			return PreciseTestForPick(InCamera, Ray, Prim, PrimIdx, PrimPTMin, InOutHitDist, RayO, RayD);
 		};
 
+	SceneBVH.UpdateWideLayout();
 	SceneBVH.TraverseFrontToBackFirstHit(Ray, BestDist, BestPrim, PreciseTest);
 
 	bPickingWarmed = true;
@@ -876,6 +882,8 @@ UPrimitiveComponent* UEditor::PickPrimitiveUsingBVH(UCamera* InCamera, const FRa
 			return PreciseTestForPick(InCamera, WorldRay, Prim, PrimIdx, PrimPTMin, InOutHitDist, RayO, RayD);
 		};
 
+	// 증분 삽입/제거 이후라면 wide 노드를 다시 접는다 (변경이 없으면 즉시 반환)
+	SceneBVH.UpdateWideLayout();
 	SceneBVH.TraverseFrontToBackFirstHit(WorldRay, BestDist, BestPrim, PreciseTest);
 
 	if (OutDistance)
@@ -1077,6 +1085,63 @@ FVector UEditor::GetGizmoDragScale(UCamera* InActiveCamera, FRay& WorldRay)
 	return Gizmo.GetActorScale();
 }
 
+void UEditor::RebuildBVH(const TArray<TObjectPtr<UPrimitiveComponent>>& InLevelPrims)
+{
+	TArray<UPrimitiveComponent*> RawPrims;
+	RawPrims.reserve(InLevelPrims.size());
+	for (auto& Prim : InLevelPrims)
+	{
+		// Safety check: Only add valid primitives (not deleted or pending kill)
+		UPrimitiveComponent* PrimPtr = Prim.Get();
+		if (PrimPtr && !PrimPtr->IsPendingKill())
+		{
+			RawPrims.push_back(PrimPtr);
+		}
+	}
+
+	SceneBVH.Build(RawPrims);
+	SceneBVHLastCount = InLevelPrims.size();
+
+	PendingDirtyPrims.clear();
+	SceneBVHRefitTick = 0;
+	bPickingWarmed = true;
+}
+
+void UEditor::ApplyPrimitiveChangesToBVH(const TArray<FLevelPrimitiveChange>& InChanges)
+{
+	// 같은 프레임에 추가 후 삭제된 컴포넌트는 이미 해제되었으므로 최종 상태만 반영한다
+	// 맵은 중복 확인에만 쓰고, 적용은 처음 기록된 순서대로 해서 실행마다 트리 모양이 같게 한다
+	TMap<UPrimitiveComponent*, int32> FinalIndices;
+	TArray<FLevelPrimitiveChange> FinalChanges;
+	FinalIndices.reserve(InChanges.size());
+	FinalChanges.reserve(InChanges.size());
+	for (const FLevelPrimitiveChange& Change : InChanges)
+	{
+		const auto InsertResult = FinalIndices.emplace(Change.Primitive, static_cast<int32>(FinalChanges.size()));
+		if (InsertResult.second)
+		{
+			FinalChanges.push_back(Change);
+		}
+		else
+		{
+			FinalChanges[InsertResult.first->second].bAdded = Change.bAdded;
+		}
+	}
+
+	for (const FLevelPrimitiveChange& Change : FinalChanges)
+	{
+		UPrimitiveComponent* Prim = Change.Primitive;
+		const bool bAdded = Change.bAdded;
+		// 제거: 포인터 비교만 하므로 해제된 컴포넌트여도 안전
+		// 추가: 해제 후 같은 주소에 새 컴포넌트가 생겼을 수 있으므로 기존 항목을 지우고 다시 삽입
+		SceneBVH.Remove(Prim);
+		if (bAdded && Prim && !Prim->IsPendingKill())
+		{
+			SceneBVH.Insert(Prim);
+		}
+	}
+}
+
 void UEditor::ResetBVH()
 {
 	SceneBVH.Clear();
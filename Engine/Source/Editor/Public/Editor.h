@@ -14,6 +14,7 @@ class UCamera;
 class ULevel;
 class USplitterWidget;
 struct FRay;
+struct FLevelPrimitiveChange;
 
 enum class EViewModeIndex : uint32
 {
@@ -57,8 +58,11 @@ private:
 	void ProcessMouseInput(ULevel* InLevel);
 	TArray<UPrimitiveComponent*> FindCandidatePrimitives(ULevel* InLevel);
 
-	// BVH 선행 갱신(씬 로딩/변경 시 Build, 드래그 종료 더티 전달 시 부분 Refit, 주기적 전체 Refit)
+	// BVH 선행 갱신(씬 로딩 시 Build, 프리미티브 추가/제거 시 증분 Insert/Remove, 드래그 종료 더티 전달 시 부분 Refit,
+	// 증분 갱신으로 SAH 품질이 떨어지면 백그라운드 재빌드)
 	void EnsureBVHUpToDate(ULevel* InLevel);
+	void RebuildBVH(const TArray<TObjectPtr<UPrimitiveComponent>>& InLevelPrims);
+	void ApplyPrimitiveChangesToBVH(const TArray<FLevelPrimitiveChange>& InChanges);
 	void PrewarmPicking(ULevel* InLevel, UCamera* InCamera);
 	// BVH를 사용해 피킹 후보를 모으고 최종 Primitive를 반환
 	UPrimitiveComponent* PickPrimitiveUsingBVH(UCamera* InCamera, const FRay& WorldRay, ULevel* InLevel, float* OutDistance);
@@ -111,6 +115,8 @@ private:
 
 	// Scene BVH 캐시
 	FSceneBVH SceneBVH{};
+	// 백그라운드 재빌드 전용 (메인 스레드는 Wait하지 않고 완료 여부만 확인)
+	TUniquePtr<FTaskScheduler> SceneBVHRebuildScheduler;
 	int64 SceneBVHLastCount = 0;
 	int64 SceneBVHRefitTick = 0;
 	bool bPickingWarmed = false;
@@ -2,6 +2,7 @@
 #include "Factory.h"
 #include "Factory/Actor/Public/ActorFactory.h"
 #include "Core/Public/ObjectPtr.h"
+#include "Core/Public/ObjectArray.h"
 
 using std::is_base_of_v;
 
@@ -36,6 +37,8 @@ TObjectPtr<T> NewObject(TObjectPtr<UObject> InOuter = nullptr, TObjectPtr<UClass
 	//}
 
 	// Factory가 없으면 기존 방식으로 폴백
+	// 생성자 안에서 TObjectIterator를 써도 아직 생성 중인 오브젝트가 부모 클래스 리스트에 들어가지 않도록 표시
+	FObjectConstructionScope ConstructionScope;
 	TObjectPtr<T> NewObject;
 	if (InClass && InClass->IsChildOf(T::StaticClass()))
 	{
@@ -3,6 +3,261 @@
 #include <xmmintrin.h>  // SSE
 #include <emmintrin.h>  // SSE2
 #include "Global/Quaternion.h"
+#include "Utility/Public/PlatformSIMD.h"
+
+namespace
+{
+	// (X, Y, Z, 0) - FVector 뒤의 메모리는 읽지 않는다
+	inline __m128 LoadVector3(const FVector& InVector)
+	{
+		const __m128 XY = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&InVector.X)));
+		return _mm_movelh_ps(XY, _mm_load_ss(&InVector.Z));
+	}
+
+	inline void StoreVector3(FVector& OutVector, __m128 InValue)
+	{
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(&OutVector.X), _mm_castps_si128(InValue));
+		_mm_store_ss(&OutVector.Z, _mm_movehl_ps(InValue, InValue));
+	}
+
+	// 행 벡터 * 행렬: 성분마다 브로드캐스트해 행렬의 행에 곱하고 누적 (hadd 없이 곱 4번, 덧셈 3번)
+	inline __m128 MultiplyRow(__m128 InRow, __m128 InM0, __m128 InM1, __m128 InM2, __m128 InM3)
+	{
+		__m128 Result = _mm_mul_ps(_mm_shuffle_ps(InRow, InRow, _MM_SHUFFLE(0, 0, 0, 0)), InM0);
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(InRow, InRow, _MM_SHUFFLE(1, 1, 1, 1)), InM1));
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(InRow, InRow, _MM_SHUFFLE(2, 2, 2, 2)), InM2));
+		return _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(InRow, InRow, _MM_SHUFFLE(3, 3, 3, 3)), InM3));
+	}
+
+	// 입력을 모두 읽은 뒤 쓰므로 OutResult가 InLeft나 InRight여도 된다
+	inline void MultiplyMatrixSSE(const FMatrix& InLeft, const FMatrix& InRight, FMatrix& OutResult)
+	{
+		const __m128 B0 = _mm_loadu_ps(InRight.Data[0]);
+		const __m128 B1 = _mm_loadu_ps(InRight.Data[1]);
+		const __m128 B2 = _mm_loadu_ps(InRight.Data[2]);
+		const __m128 B3 = _mm_loadu_ps(InRight.Data[3]);
+		const __m128 A0 = _mm_loadu_ps(InLeft.Data[0]);
+		const __m128 A1 = _mm_loadu_ps(InLeft.Data[1]);
+		const __m128 A2 = _mm_loadu_ps(InLeft.Data[2]);
+		const __m128 A3 = _mm_loadu_ps(InLeft.Data[3]);
+
+		_mm_storeu_ps(OutResult.Data[0], MultiplyRow(A0, B0, B1, B2, B3));
+		_mm_storeu_ps(OutResult.Data[1], MultiplyRow(A1, B0, B1, B2, B3));
+		_mm_storeu_ps(OutResult.Data[2], MultiplyRow(A2, B0, B1, B2, B3));
+		_mm_storeu_ps(OutResult.Data[3], MultiplyRow(A3, B0, B1, B2, B3));
+	}
+
+	inline void TransformAABBSSE(const FMatrix& InMatrix, const FVector& InMin, const FVector& InMax, FVector& OutMin, FVector& OutMax)
+	{
+		const __m128 Half = _mm_set1_ps(0.5f);
+		const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		const __m128 Min = LoadVector3(InMin);
+		const __m128 Max = LoadVector3(InMax);
+		const __m128 Center = _mm_mul_ps(_mm_add_ps(Min, Max), Half);
+		const __m128 Extent = _mm_mul_ps(_mm_sub_ps(Max, Min), Half);
+
+		const __m128 M0 = _mm_loadu_ps(InMatrix.Data[0]);
+		const __m128 M1 = _mm_loadu_ps(InMatrix.Data[1]);
+		const __m128 M2 = _mm_loadu_ps(InMatrix.Data[2]);
+		const __m128 M3 = _mm_loadu_ps(InMatrix.Data[3]);
+
+		// 중심은 점으로 변환, 반경은 |M|으로 변환
+		__m128 WorldCenter = _mm_add_ps(M3, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(0, 0, 0, 0)), M0));
+		WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(1, 1, 1, 1)), M1));
+		WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(2, 2, 2, 2)), M2));
+
+		__m128 WorldExtent = _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(0, 0, 0, 0)), _mm_and_ps(M0, AbsMask));
+		WorldExtent = _mm_add_ps(WorldExtent, _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(1, 1, 1, 1)), _mm_and_ps(M1, AbsMask)));
+		WorldExtent = _mm_add_ps(WorldExtent, _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(2, 2, 2, 2)), _mm_and_ps(M2, AbsMask)));
+
+		StoreVector3(OutMin, _mm_sub_ps(WorldCenter, WorldExtent));
+		StoreVector3(OutMax, _mm_add_ps(WorldCenter, WorldExtent));
+	}
+
+	// 점 4개(float 12개)를 X/Y/Z 레지스터로 풀고 되돌리는 셔플 (128비트 레인 안에서만 움직이므로 AVX 레인에도 그대로 쓴다)
+	// A = (x0 y0 z0 x1), B = (y1 z1 x2 y2), C = (z2 x3 y3 z3)
+	inline void DeinterleavePoints(__m128 A, __m128 B, __m128 C, __m128& OutX, __m128& OutY, __m128& OutZ)
+	{
+		const __m128 X23 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(0, 1, 0, 2));
+		OutX = _mm_shuffle_ps(A, X23, _MM_SHUFFLE(2, 0, 3, 0));
+		const __m128 Y01 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 0, 1));
+		const __m128 Y23 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3));
+		OutY = _mm_shuffle_ps(Y01, Y23, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 Z01 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2));
+		const __m128 Z23 = _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 3, 0, 0));
+		OutZ = _mm_shuffle_ps(Z01, Z23, _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	inline void InterleavePoints(__m128 X, __m128 Y, __m128 Z, __m128& OutA, __m128& OutB, __m128& OutC)
+	{
+		const __m128 XYLow = _mm_unpacklo_ps(X, Y);
+		const __m128 XYHigh = _mm_unpackhi_ps(X, Y);
+		OutA = _mm_shuffle_ps(XYLow, _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+		OutB = _mm_shuffle_ps(_mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)), XYHigh, _MM_SHUFFLE(1, 0, 2, 0));
+		OutC = _mm_shuffle_ps(_mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	void TransformPointsSSE(const FMatrix& InMatrix, const FVector* InPoints, FVector* OutPoints, size_t InCount)
+	{
+		const FMatrix& M = InMatrix;
+		size_t Index = 0;
+		for (; Index + 4 <= InCount; Index += 4)
+		{
+			const float* Source = &InPoints[Index].X;
+			__m128 X, Y, Z;
+			DeinterleavePoints(_mm_loadu_ps(Source), _mm_loadu_ps(Source + 4), _mm_loadu_ps(Source + 8), X, Y, Z);
+
+			__m128 Result[3];
+			for (int32 Col = 0; Col < 3; ++Col)
+			{
+				__m128 Value = _mm_add_ps(_mm_mul_ps(X, _mm_set1_ps(M.Data[0][Col])), _mm_mul_ps(Y, _mm_set1_ps(M.Data[1][Col])));
+				Value = _mm_add_ps(Value, _mm_mul_ps(Z, _mm_set1_ps(M.Data[2][Col])));
+				Result[Col] = _mm_add_ps(Value, _mm_set1_ps(M.Data[3][Col]));
+			}
+
+			__m128 A, B, C;
+			InterleavePoints(Result[0], Result[1], Result[2], A, B, C);
+			float* Dest = &OutPoints[Index].X;
+			_mm_storeu_ps(Dest, A);
+			_mm_storeu_ps(Dest + 4, B);
+			_mm_storeu_ps(Dest + 8, C);
+		}
+
+		const __m128 M0 = _mm_loadu_ps(M.Data[0]);
+		const __m128 M1 = _mm_loadu_ps(M.Data[1]);
+		const __m128 M2 = _mm_loadu_ps(M.Data[2]);
+		const __m128 M3 = _mm_loadu_ps(M.Data[3]);
+		for (; Index < InCount; ++Index)
+		{
+			const __m128 Point = LoadVector3(InPoints[Index]);
+			__m128 Result = _mm_add_ps(M3, _mm_mul_ps(_mm_shuffle_ps(Point, Point, _MM_SHUFFLE(0, 0, 0, 0)), M0));
+			Result = _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(Point, Point, _MM_SHUFFLE(1, 1, 1, 1)), M1));
+			Result = _mm_add_ps(Result, _mm_mul_ps(_mm_shuffle_ps(Point, Point, _MM_SHUFFLE(2, 2, 2, 2)), M2));
+			StoreVector3(OutPoints[Index], Result);
+		}
+	}
+
+	SIMD_TARGET_AVX2 inline __m256 LoadLanes(const float* InLow, const float* InHigh)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(InLow)), _mm_loadu_ps(InHigh), 1);
+	}
+
+	SIMD_TARGET_AVX2 inline void StoreLanes(float* OutLow, float* OutHigh, __m256 InValue)
+	{
+		_mm_storeu_ps(OutLow, _mm256_castps256_ps128(InValue));
+		_mm_storeu_ps(OutHigh, _mm256_extractf128_ps(InValue, 1));
+	}
+
+	// 점 8개: 아래 레인에 0~3번, 위 레인에 4~7번을 두고 SSE와 같은 레인 내 셔플로 풀고 되돌린다
+	SIMD_TARGET_AVX2 void TransformPointsAVX2(const FMatrix& InMatrix, const FVector* InPoints, FVector* OutPoints, size_t InCount)
+	{
+		const FMatrix& M = InMatrix;
+		size_t Index = 0;
+		for (; Index + 8 <= InCount; Index += 8)
+		{
+			const float* Source = &InPoints[Index].X;
+			const __m256 A = LoadLanes(Source, Source + 12);
+			const __m256 B = LoadLanes(Source + 4, Source + 16);
+			const __m256 C = LoadLanes(Source + 8, Source + 20);
+
+			const __m256 X23 = _mm256_shuffle_ps(B, C, _MM_SHUFFLE(0, 1, 0, 2));
+			const __m256 X = _mm256_shuffle_ps(A, X23, _MM_SHUFFLE(2, 0, 3, 0));
+			const __m256 Y = _mm256_shuffle_ps(_mm256_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 0, 1)), _mm256_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256 Z = _mm256_shuffle_ps(_mm256_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(C, C, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+			__m256 Result[3];
+			for (int32 Col = 0; Col < 3; ++Col)
+			{
+				__m256 Value = _mm256_fmadd_ps(X, _mm256_set1_ps(M.Data[0][Col]), _mm256_set1_ps(M.Data[3][Col]));
+				Value = _mm256_fmadd_ps(Y, _mm256_set1_ps(M.Data[1][Col]), Value);
+				Result[Col] = _mm256_fmadd_ps(Z, _mm256_set1_ps(M.Data[2][Col]), Value);
+			}
+
+			const __m256 XYLow = _mm256_unpacklo_ps(Result[0], Result[1]);
+			const __m256 XYHigh = _mm256_unpackhi_ps(Result[0], Result[1]);
+			const __m256 OutA = _mm256_shuffle_ps(XYLow, _mm256_shuffle_ps(Result[2], Result[0], _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+			const __m256 OutB = _mm256_shuffle_ps(_mm256_shuffle_ps(Result[1], Result[2], _MM_SHUFFLE(1, 1, 1, 1)), XYHigh, _MM_SHUFFLE(1, 0, 2, 0));
+			const __m256 OutC = _mm256_shuffle_ps(_mm256_shuffle_ps(Result[2], Result[0], _MM_SHUFFLE(3, 3, 2, 2)),
+				_mm256_shuffle_ps(Result[1], Result[2], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+			float* Dest = &OutPoints[Index].X;
+			StoreLanes(Dest, Dest + 12, OutA);
+			StoreLanes(Dest + 4, Dest + 16, OutB);
+			StoreLanes(Dest + 8, Dest + 20, OutC);
+		}
+
+		TransformPointsSSE(InMatrix, InPoints + Index, OutPoints + Index, InCount - Index);
+	}
+
+	// 상자 2개: 아래 레인에 짝수 번째, 위 레인에 홀수 번째 상자와 행렬
+	SIMD_TARGET_AVX2 void TransformAABBsAVX2(const FMatrix* InMatrices, const FVector* InMins, const FVector* InMaxs,
+		FVector* OutMins, FVector* OutMaxs, size_t InCount)
+	{
+		const __m256 Half = _mm256_set1_ps(0.5f);
+		const __m256 AbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+		size_t Index = 0;
+		for (; Index + 2 <= InCount; Index += 2)
+		{
+			const FMatrix& Low = InMatrices[Index];
+			const FMatrix& High = InMatrices[Index + 1];
+			const __m256 Min = _mm256_insertf128_ps(_mm256_castps128_ps256(LoadVector3(InMins[Index])), LoadVector3(InMins[Index + 1]), 1);
+			const __m256 Max = _mm256_insertf128_ps(_mm256_castps128_ps256(LoadVector3(InMaxs[Index])), LoadVector3(InMaxs[Index + 1]), 1);
+			const __m256 Center = _mm256_mul_ps(_mm256_add_ps(Min, Max), Half);
+			const __m256 Extent = _mm256_mul_ps(_mm256_sub_ps(Max, Min), Half);
+
+			const __m256 M0 = LoadLanes(Low.Data[0], High.Data[0]);
+			const __m256 M1 = LoadLanes(Low.Data[1], High.Data[1]);
+			const __m256 M2 = LoadLanes(Low.Data[2], High.Data[2]);
+			const __m256 M3 = LoadLanes(Low.Data[3], High.Data[3]);
+
+			__m256 WorldCenter = _mm256_fmadd_ps(_mm256_shuffle_ps(Center, Center, _MM_SHUFFLE(0, 0, 0, 0)), M0, M3);
+			WorldCenter = _mm256_fmadd_ps(_mm256_shuffle_ps(Center, Center, _MM_SHUFFLE(1, 1, 1, 1)), M1, WorldCenter);
+			WorldCenter = _mm256_fmadd_ps(_mm256_shuffle_ps(Center, Center, _MM_SHUFFLE(2, 2, 2, 2)), M2, WorldCenter);
+
+			__m256 WorldExtent = _mm256_mul_ps(_mm256_shuffle_ps(Extent, Extent, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_and_ps(M0, AbsMask));
+			WorldExtent = _mm256_fmadd_ps(_mm256_shuffle_ps(Extent, Extent, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_and_ps(M1, AbsMask), WorldExtent);
+			WorldExtent = _mm256_fmadd_ps(_mm256_shuffle_ps(Extent, Extent, _MM_SHUFFLE(2, 2, 2, 2)), _mm256_and_ps(M2, AbsMask), WorldExtent);
+
+			const __m256 WorldMin = _mm256_sub_ps(WorldCenter, WorldExtent);
+			const __m256 WorldMax = _mm256_add_ps(WorldCenter, WorldExtent);
+			StoreVector3(OutMins[Index], _mm256_castps256_ps128(WorldMin));
+			StoreVector3(OutMins[Index + 1], _mm256_extractf128_ps(WorldMin, 1));
+			StoreVector3(OutMaxs[Index], _mm256_castps256_ps128(WorldMax));
+			StoreVector3(OutMaxs[Index + 1], _mm256_extractf128_ps(WorldMax, 1));
+		}
+
+		for (; Index < InCount; ++Index)
+		{
+			TransformAABBSSE(InMatrices[Index], InMins[Index], InMaxs[Index], OutMins[Index], OutMaxs[Index]);
+		}
+	}
+
+	// 두 행씩: 같은 레인 안에서 왼쪽 행렬의 성분을 브로드캐스트하고, 오른쪽 행렬의 행은 두 레인에 복제
+	SIMD_TARGET_AVX2 inline __m256 MultiplyRowPair(__m256 InRows, __m256 InB0, __m256 InB1, __m256 InB2, __m256 InB3)
+	{
+		__m256 Result = _mm256_mul_ps(_mm256_shuffle_ps(InRows, InRows, _MM_SHUFFLE(0, 0, 0, 0)), InB0);
+		Result = _mm256_fmadd_ps(_mm256_shuffle_ps(InRows, InRows, _MM_SHUFFLE(1, 1, 1, 1)), InB1, Result);
+		Result = _mm256_fmadd_ps(_mm256_shuffle_ps(InRows, InRows, _MM_SHUFFLE(2, 2, 2, 2)), InB2, Result);
+		return _mm256_fmadd_ps(_mm256_shuffle_ps(InRows, InRows, _MM_SHUFFLE(3, 3, 3, 3)), InB3, Result);
+	}
+
+	SIMD_TARGET_AVX2 void MultiplyMatricesAVX2(const FMatrix* InLeft, const FMatrix* InRight, FMatrix* OutResults, size_t InCount)
+	{
+		for (size_t Index = 0; Index < InCount; ++Index)
+		{
+			const FMatrix& B = InRight[Index];
+			const __m256 B0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B.Data[0]));
+			const __m256 B1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B.Data[1]));
+			const __m256 B2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B.Data[2]));
+			const __m256 B3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B.Data[3]));
+			const __m256 A01 = _mm256_loadu_ps(InLeft[Index].Data[0]);
+			const __m256 A23 = _mm256_loadu_ps(InLeft[Index].Data[2]);
+
+			_mm256_storeu_ps(OutResults[Index].Data[0], MultiplyRowPair(A01, B0, B1, B2, B3));
+			_mm256_storeu_ps(OutResults[Index].Data[2], MultiplyRowPair(A23, B0, B1, B2, B3));
+		}
+	}
+}
 
 
 FMatrix FMatrix::UEToDx = FMatrix(
@@ -79,33 +334,9 @@ FMatrix FMatrix::Identity()
 */
 FMatrix FMatrix::operator*(const FMatrix& InOtherMatrix) const
 {
+	// 결과의 i행 = 이 행렬 i행의 성분들로 다른 행렬의 행을 가중합 (열을 모으는 셔플과 hadd가 필요 없음)
 	FMatrix Result;
-
-	// SIMD를 사용한 4x4 행렬 곱셈 최적화
-	for (int32 i = 0; i < 4; ++i)
-	{
-		// 각 행을 SIMD 레지스터에 로드
-		__m128 row = _mm_load_ps(&Data[i][0]);
-
-		for (int32 j = 0; j < 4; ++j)
-		{
-			// 다른 행렬의 열을 SIMD 레지스터에 로드
-			__m128 col = _mm_set_ps(
-				InOtherMatrix.Data[3][j],
-				InOtherMatrix.Data[2][j],
-				InOtherMatrix.Data[1][j],
-				InOtherMatrix.Data[0][j]
-			);
-
-			// 벡터 내적 계산
-			__m128 mul = _mm_mul_ps(row, col);
-			__m128 sum = _mm_hadd_ps(mul, mul);
-			sum = _mm_hadd_ps(sum, sum);
-
-			Result.Data[i][j] = _mm_cvtss_f32(sum);
-		}
-	}
-
+	MultiplyMatrixSSE(*this, InOtherMatrix, Result);
 	return Result;
 }
 
@@ -297,50 +528,52 @@ FMatrix FMatrix::RotationZ(float Radian)
 	return Result;
 }
 
+/**
+* @brief S * R * T를 행렬 곱 없이 바로 구성
+* R = RotationX(pitch) * RotationY(yaw) * RotationZ(roll)을 전개한 값에 행마다 스케일을 곱하고 마지막 행에 이동을 둔다
+*/
+FMatrix FMatrix::MakeTransform(const FVector& Location, const FVector& Rotation, const FVector& Scale)
+{
+	const float SX = std::sinf(Rotation.X), CX = std::cosf(Rotation.X);
+	const float SY = std::sinf(Rotation.Y), CY = std::cosf(Rotation.Y);
+	const float SZ = std::sinf(Rotation.Z), CZ = std::cosf(Rotation.Z);
+
+	return FMatrix(
+		Scale.X * (CY * CZ), Scale.X * (CY * SZ), Scale.X * -SY, 0.0f,
+		Scale.Y * (SX * SY * CZ - CX * SZ), Scale.Y * (SX * SY * SZ + CX * CZ), Scale.Y * (SX * CY), 0.0f,
+		Scale.Z * (CX * SY * CZ + SX * SZ), Scale.Z * (CX * SY * SZ - SX * CZ), Scale.Z * (CX * CY), 0.0f,
+		Location.X, Location.Y, Location.Z, 1.0f);
+}
+
 //
 FMatrix FMatrix::GetModelMatrix(const FVector& Location, const FVector& Rotation, const FVector& Scale)
 {
-	FMatrix T = TranslationMatrix(Location);
-	FMatrix R = RotationMatrix(Rotation);
-	FMatrix S = ScaleMatrix(Scale);
-	FMatrix modelMatrix = S * R * T;
-
 	// Dx11 y-up 왼손좌표계에서 정의된 물체의 정점을 UE z-up 왼손좌표계로 변환
-	return  FMatrix::UEToDx * modelMatrix;
+	return FMatrix::UEToDx * MakeTransform(Location, Rotation, Scale);
 }
 
 FMatrix FMatrix::GetModelMatrixInverse(const FVector& Location, const FVector& Rotation, const FVector& Scale)
 {
-	FMatrix T = TranslationMatrixInverse(Location);
-	FMatrix R = RotationMatrixInverse(Rotation);
-	FMatrix S = ScaleMatrixInverse(Scale);
-	FMatrix modelMatrixInverse = T * R * S;
-
 	// UE 좌표계로 변환된 물체의 정점을 원래의 Dx 11 왼손좌표계 정점으로 변환
-	return modelMatrixInverse * FMatrix::DxToUE;
+	return MakeTransform(Location, Rotation, Scale).InverseAffine() * FMatrix::DxToUE;
 }
 
 FVector4 FMatrix::VectorMultiply(const FVector4& v, const FMatrix& m)
 {
-	FVector4 result = {};
-	result.X = (v.X * m.Data[0][0]) + (v.Y * m.Data[1][0]) + (v.Z * m.Data[2][0]) + (v.W * m.Data[3][0]);
-	result.Y = (v.X * m.Data[0][1]) + (v.Y * m.Data[1][1]) + (v.Z * m.Data[2][1]) + (v.W * m.Data[3][1]);
-	result.Z = (v.X * m.Data[0][2]) + (v.Y * m.Data[1][2]) + (v.Z * m.Data[2][2]) + (v.W * m.Data[3][2]);
-	result.W = (v.X * m.Data[0][3]) + (v.Y * m.Data[1][3]) + (v.Z * m.Data[2][3]) + (v.W * m.Data[3][3]);
-
-
+	FVector4 result;
+	const __m128 Row = _mm_loadu_ps(&v.X);
+	_mm_storeu_ps(&result.X, MultiplyRow(Row, _mm_loadu_ps(m.Data[0]), _mm_loadu_ps(m.Data[1]), _mm_loadu_ps(m.Data[2]), _mm_loadu_ps(m.Data[3])));
 	return result;
 }
 
+// 방향 벡터용: 행렬의 3x3 부분만 적용
 FVector FMatrix::VectorMultiply(const FVector& v, const FMatrix& m)
 {
-	FVector result = {};
-	result.X = (v.X * m.Data[0][0]) + (v.Y * m.Data[1][0]) + (v.Z * m.Data[2][0]);
-	result.Y = (v.X * m.Data[0][1]) + (v.Y * m.Data[1][1]) + (v.Z * m.Data[2][1]);
-	result.Z = (v.X * m.Data[0][2]) + (v.Y * m.Data[1][2]) + (v.Z * m.Data[2][2]);
-	//result.W = (v.X * m.Data[0][3]) + (v.Y * m.Data[1][3]) + (v.Z * m.Data[2][3]) + (v.W * m.Data[3][3]);
-
-
+	FVector result;
+	__m128 Sum = _mm_mul_ps(_mm_set1_ps(v.X), _mm_loadu_ps(m.Data[0]));
+	Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(v.Y), _mm_loadu_ps(m.Data[1])));
+	Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(v.Z), _mm_loadu_ps(m.Data[2])));
+	StoreVector3(result, Sum);
 	return result;
 }
 
@@ -448,3 +681,91 @@ FMatrix FMatrix::Inverse() const
 
 	return result;
 }
+
+FMatrix FMatrix::InverseAffine() const
+{
+	// 행 벡터 규약의 아핀 행렬 [A 0; t 1]의 역행렬은 [A^-1 0; -t * A^-1 1]
+	// A^-1 = 여인수 행렬의 전치 / det이고, 여인수 행렬의 각 행은 나머지 두 행의 외적
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 R0 = _mm_blend_ps(_mm_loadu_ps(Data[0]), Zero, 0x8);
+	const __m128 R1 = _mm_blend_ps(_mm_loadu_ps(Data[1]), Zero, 0x8);
+	const __m128 R2 = _mm_blend_ps(_mm_loadu_ps(Data[2]), Zero, 0x8);
+
+	const auto Cross = [](__m128 A, __m128 B)
+		{
+			const __m128 AYZX = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 BYZX = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 Result = _mm_sub_ps(_mm_mul_ps(A, BYZX), _mm_mul_ps(AYZX, B));
+			return _mm_shuffle_ps(Result, Result, _MM_SHUFFLE(3, 0, 2, 1));
+		};
+	__m128 C0 = Cross(R1, R2);
+	__m128 C1 = Cross(R2, R0);
+	__m128 C2 = Cross(R0, R1);
+
+	const float Det = _mm_cvtss_f32(_mm_dp_ps(R0, C0, 0x71));
+	if (Det == 0.0f)
+	{
+		return FMatrix::Identity();
+	}
+
+	const __m128 InvDet = _mm_set1_ps(1.0f / Det);
+	__m128 C3 = Zero;
+	_MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+	C0 = _mm_mul_ps(C0, InvDet);
+	C1 = _mm_mul_ps(C1, InvDet);
+	C2 = _mm_mul_ps(C2, InvDet);
+
+	__m128 Translation = _mm_mul_ps(_mm_set1_ps(Data[3][0]), C0);
+	Translation = _mm_add_ps(Translation, _mm_mul_ps(_mm_set1_ps(Data[3][1]), C1));
+	Translation = _mm_add_ps(Translation, _mm_mul_ps(_mm_set1_ps(Data[3][2]), C2));
+	Translation = _mm_blend_ps(_mm_sub_ps(Zero, Translation), _mm_set1_ps(1.0f), 0x8);
+
+	FMatrix Result;
+	_mm_storeu_ps(Result.Data[0], C0);
+	_mm_storeu_ps(Result.Data[1], C1);
+	_mm_storeu_ps(Result.Data[2], C2);
+	_mm_storeu_ps(Result.Data[3], Translation);
+	return Result;
+}
+
+void FMatrix::TransformPoints(const FMatrix& InMatrix, const FVector* InPoints, FVector* OutPoints, size_t InCount)
+{
+	if (FPlatformSIMD::HasAVX2())
+	{
+		TransformPointsAVX2(InMatrix, InPoints, OutPoints, InCount);
+		return;
+	}
+	TransformPointsSSE(InMatrix, InPoints, OutPoints, InCount);
+}
+
+void FMatrix::TransformAABBs(const FMatrix* InMatrices, const FVector* InMins, const FVector* InMaxs,
+	FVector* OutMins, FVector* OutMaxs, size_t InCount)
+{
+	if (FPlatformSIMD::HasAVX2())
+	{
+		TransformAABBsAVX2(InMatrices, InMins, InMaxs, OutMins, OutMaxs, InCount);
+		return;
+	}
+	for (size_t Index = 0; Index < InCount; ++Index)
+	{
+		TransformAABBSSE(InMatrices[Index], InMins[Index], InMaxs[Index], OutMins[Index], OutMaxs[Index]);
+	}
+}
+
+void FMatrix::TransformAABB(const FMatrix& InMatrix, const FVector& InMin, const FVector& InMax, FVector& OutMin, FVector& OutMax)
+{
+	TransformAABBSSE(InMatrix, InMin, InMax, OutMin, OutMax);
+}
+
+void FMatrix::MultiplyMatrices(const FMatrix* InLeft, const FMatrix* InRight, FMatrix* OutResults, size_t InCount)
+{
+	if (FPlatformSIMD::HasAVX2())
+	{
+		MultiplyMatricesAVX2(InLeft, InRight, OutResults, InCount);
+		return;
+	}
+	for (size_t Index = 0; Index < InCount; ++Index)
+	{
+		MultiplyMatrixSSE(InLeft[Index], InRight[Index], OutResults[Index]);
+	}
+}
@@ -86,6 +86,11 @@ struct FMatrix
 	*/
 	static FMatrix RotationZ(float Radian);
 
+	/**
+	* @brief S * R * T를 행렬 곱 없이 바로 구성 (Rotation은 라디안, RotationMatrix와 같은 회전 순서)
+	*/
+	static FMatrix MakeTransform(const FVector& Location, const FVector& Rotation, const FVector& Scale);
+
 	static FMatrix GetModelMatrix(const FVector& Location, const FVector& Rotation, const FVector& Scale);
 
 	static FMatrix GetModelMatrixInverse(const FVector& Location, const FVector& Rotation, const FVector& Scale);
@@ -97,6 +102,26 @@ struct FMatrix
 	FMatrix Transpose() const;
 	FMatrix Inverse() const;
 
+	/**
+	* @brief 마지막 열이 (0, 0, 0, 1)인 아핀 행렬 전용 역행렬 (3x3 역행렬 + 이동, 특이 행렬이면 항등행렬)
+	*/
+	FMatrix InverseAffine() const;
+
+	/**
+	* @brief 배열 단위 변환 (SSE, AVX2 + FMA를 지원하는 CPU에서는 런타임 분기로 한 번에 두 배 처리)
+	* 입력과 출력이 같은 배열이어도 된다
+	*/
+	// 점 변환 (W = 1로 보고 아핀 행렬을 가정하므로 결과 W는 계산하지 않음)
+	static void TransformPoints(const FMatrix& InMatrix, const FVector* InPoints, FVector* OutPoints, size_t InCount);
+
+	// 로컬 AABB를 각자의 행렬로 변환한 월드 AABB (중심/반경 방식, 8 꼭짓점을 변환한 결과와 수학적으로 같음)
+	static void TransformAABBs(const FMatrix* InMatrices, const FVector* InMins, const FVector* InMaxs,
+		FVector* OutMins, FVector* OutMaxs, size_t InCount);
+	static void TransformAABB(const FMatrix& InMatrix, const FVector& InMin, const FVector& InMax, FVector& OutMin, FVector& OutMax);
+
+	// OutResults[i] = InLeft[i] * InRight[i]
+	static void MultiplyMatrices(const FMatrix* InLeft, const FMatrix* InRight, FMatrix* OutResults, size_t InCount);
+
 	FVector GetLocation() const;
 	FQuaternion GetRotation() const;
 	FVector GetScale() const;
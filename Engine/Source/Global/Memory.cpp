@@ -5,9 +5,8 @@
 
 using std::align_val_t;
 
-// XXX(KHJ): Atomic 처리할 필요가 있을까?
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
+std::atomic<uint32> TotalAllocationBytes{ 0 };
+std::atomic<uint32> TotalAllocationCount{ 0 };
 
 /**
  * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
@@ -16,12 +15,12 @@ uint32 TotalAllocationCount = 0;
  */
 void* operator new(size_t InSize)
 {
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	TotalAllocationBytes.fetch_add(static_cast<uint32>(InSize), std::memory_order_relaxed);
 
 	// Debug Print
 	// printf("New: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        InSize, TotalAllocationBytes, TotalAllocationCount);
+	//        InSize, TotalAllocationBytes.load(), TotalAllocationCount.load());
 
 	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(malloc(sizeof(AllocHeader) + InSize));
 	MemoryHeader->size = InSize;
@@ -46,23 +45,20 @@ void operator delete(void* InMemory) noexcept
 
 	// Debug Print
 	// printf("Delete: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        MemoryAllocSize, TotalAllocationBytes, TotalAllocationCount);
+	//        MemoryAllocSize, TotalAllocationBytes.load(), TotalAllocationCount.load());
 
-	if (TotalAllocationCount > 0)
-	{
-		--TotalAllocationCount;
-	}
-	else
+	// 다른 스레드와 겹쳐도 갱신이 사라지지 않도록 한 번의 원자 연산으로 빼고 이전 값으로 검사
+	const uint32 PrevCount = TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+	if (PrevCount == 0)
 	{
+		TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
 		assert(!u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
 	}
 
-	if (TotalAllocationBytes >= MemoryAllocSize)
-	{
-		TotalAllocationBytes -= static_cast<uint32>(MemoryAllocSize);
-	}
-	else
+	const uint32 PrevBytes = TotalAllocationBytes.fetch_sub(static_cast<uint32>(MemoryAllocSize), std::memory_order_relaxed);
+	if (PrevBytes < MemoryAllocSize)
 	{
+		TotalAllocationBytes.fetch_add(static_cast<uint32>(MemoryAllocSize), std::memory_order_relaxed);
 		assert(!u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
 	}
 
@@ -103,8 +99,8 @@ void* operator new(size_t InSize, align_val_t InAlignment)
 {
 	size_t Alignment = static_cast<size_t>(InAlignment);
 
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	TotalAllocationBytes.fetch_add(static_cast<uint32>(InSize), std::memory_order_relaxed);
 
 	// XXX(KHJ): 헤더 크기도 정렬에 맞춰 패딩을 고려해야 할 수 있음
 	size_t TotalSize = sizeof(AllocHeader) + InSize;
@@ -1,7 +1,9 @@
 #pragma once
+#include <atomic>
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
+// 워커 스레드에서도 할당하므로 원자적으로 갱신 (통계용이므로 relaxed)
+extern std::atomic<uint32> TotalAllocationBytes;
+extern std::atomic<uint32> TotalAllocationCount;
 
 struct AllocHeader
 {
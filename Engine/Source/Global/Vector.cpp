@@ -175,30 +175,8 @@ FVector4 FVector4::operator+(const FVector4& InOtherVector) const
 
 FVector4 FVector4::operator*(const FMatrix& InMatrix) const
 {
-	// SIMD로 최적화된 벡터-행렬 곱셈
-	__m128 vec = _mm_set_ps(W, Z, Y, X);
-	FVector4 Result;
-	
-	for (int i = 0; i < 4; ++i)
-	{
-		// 행렬의 각 열을 로드
-		__m128 col = _mm_set_ps(
-			InMatrix.Data[3][i],
-			InMatrix.Data[2][i],
-			InMatrix.Data[1][i],
-			InMatrix.Data[0][i]
-		);
-		
-		// 벡터 내적
-		__m128 mul = _mm_mul_ps(vec, col);
-		__m128 sum = _mm_hadd_ps(mul, mul);
-		sum = _mm_hadd_ps(sum, sum);
-		
-		// 결과 저장
-		reinterpret_cast<float*>(&Result)[i] = _mm_cvtss_f32(sum);
-	}
-	
-	return Result;
+	// 성분마다 브로드캐스트해 행렬의 행을 가중합
+	return FMatrix::VectorMultiply(*this, InMatrix);
 }
 /**
  * @brief 두 벡터를 뺀 새로운 벡터를 반환하는 함수
@@ -72,12 +72,9 @@ struct FVector
 	 */
 	float Length() const
 	{
-		// SIMD를 사용한 최적화
+		// SIMD를 사용한 최적화 (SSE4.1 내적 한 번)
 		__m128 vec = _mm_set_ps(0.0f, Z, Y, X);
-		__m128 squared = _mm_mul_ps(vec, vec);
-		__m128 sum = _mm_hadd_ps(squared, squared);
-		sum = _mm_hadd_ps(sum, sum);
-		return _mm_cvtss_f32(_mm_sqrt_ss(sum));
+		return _mm_cvtss_f32(_mm_sqrt_ss(_mm_dp_ps(vec, vec, 0x71)));
 	}
 
 	/**
@@ -85,12 +82,9 @@ struct FVector
 	 */
 	float LengthSquared() const
 	{
-		// SIMD를 사용한 최적화
+		// SIMD를 사용한 최적화 (SSE4.1 내적 한 번)
 		__m128 vec = _mm_set_ps(0.0f, Z, Y, X);
-		__m128 squared = _mm_mul_ps(vec, vec);
-		__m128 sum = _mm_hadd_ps(squared, squared);
-		sum = _mm_hadd_ps(sum, sum);
-		return _mm_cvtss_f32(sum);
+		return _mm_cvtss_f32(_mm_dp_ps(vec, vec, 0x71));
 	}
 
 	/**
@@ -98,13 +92,10 @@ struct FVector
 	 */
 	float Dot(const FVector& InOtherVector) const
 	{
-		// SIMD를 사용한 최적화
+		// SIMD를 사용한 최적화 (SSE4.1 내적 한 번)
 		__m128 vec1 = _mm_set_ps(0.0f, Z, Y, X);
 		__m128 vec2 = _mm_set_ps(0.0f, InOtherVector.Z, InOtherVector.Y, InOtherVector.X);
-		__m128 mul = _mm_mul_ps(vec1, vec2);
-		__m128 sum = _mm_hadd_ps(mul, mul);
-		sum = _mm_hadd_ps(sum, sum);
-		return _mm_cvtss_f32(sum);
+		return _mm_cvtss_f32(_mm_dp_ps(vec1, vec2, 0x71));
 	}
 
 	/**
@@ -126,9 +117,7 @@ struct FVector
 	{
 		// SIMD를 사용한 최적화
 		__m128 vec = _mm_set_ps(0.0f, Z, Y, X);
-		__m128 squared = _mm_mul_ps(vec, vec);
-		__m128 sum = _mm_hadd_ps(squared, squared);
-		sum = _mm_hadd_ps(sum, sum);
+		__m128 sum = _mm_dp_ps(vec, vec, 0x71);
 
 		// 길이가 0에 가까우면 정규화 방지
 		float lengthSq = _mm_cvtss_f32(sum);
@@ -140,7 +129,7 @@ struct FVector
 
 			// 결과를 다시 할당
 			float result[4];
-			_mm_store_ps(result, vec);
+			_mm_storeu_ps(result, vec);
 			X = result[0];
 			Y = result[1];
 			Z = result[2];
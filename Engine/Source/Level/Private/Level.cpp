@@ -3,6 +3,8 @@
 
 #include "Actor/Public/Actor.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/TransformHierarchy.h"
+#include "Component/Public/PrimitiveBoundsTable.h"
 #include "Manager/Level/Public/LevelManager.h"
 #include "Manager/UI/Public/UIManager.h"
 #include "Utility/Public/JsonSerializer.h"
@@ -130,14 +132,8 @@ void ULevel::Init()
 	UE_LOG("ULevel::Init: Processing %zu LevelActors", LevelActors.size());
 
 	// IMPORTANT: Initialize all world transforms FIRST before processing primitives
-	// 월드 변환을 먼저 업데이트해야 GetWorldAABB가 올바른 값을 반환함
-	for (auto& Actor : LevelActors)
-	{
-		if (Actor && Actor->GetRootComponent())
-		{
-			Actor->GetRootComponent()->UpdateWorldTransform();
-		}
-	}
+	// 월드 변환을 먼저 업데이트해야 GetWorldAABB가 올바른 값을 반환함 (월드 AABB도 함께 일괄 계산)
+	FPrimitiveBoundsTable::Get().UpdateBounds();
 
 	// 레벨 안의 모든 액터를 Octree에 삽입 및 LevelPrimitiveComponents에 추가
 	for (auto& Actor : LevelActors)
@@ -161,20 +157,16 @@ void ULevel::Update()
 	}
 	ProcessPendingDeletions();
 
-	// 최적화: Transform 업데이트를 루트 컴포넌트만 수행 (자식들은 재귀적으로 업데이트)
+	// 최적화: 이번 프레임에 바뀐 Transform만 계층 배열에서 한 번에 갱신
 	static int frameCount = 0;
-	int updateCount = 0;
+	FTransformHierarchy& TransformHierarchy = FTransformHierarchy::Get();
+	TransformHierarchy.UpdateTransforms();
+	const uint32 updateCount = TransformHierarchy.GetNumUpdatedLastPass();
+	FPrimitiveBoundsTable::Get().UpdateBounds();
 	int tickCount = 0;
 	
 	for (auto& Actor : LevelActors)
 	{
-		if (Actor && Actor->GetRootComponent())
-		{
-			// 루트 컴포넌트만 업데이트 (자식들은 재귀적으로 처리됨)
-			Actor->GetRootComponent()->UpdateWorldTransform();
-			updateCount++;
-		}
-		
 		// Tick 처리
 		if (Actor && Actor->IsActorTickEnabled())
 		{
@@ -186,7 +178,7 @@ void ULevel::Update()
 	// Log every 60 frames to check performance
 	if (++frameCount % 60 == 0)
 	{
-		UE_LOG("Level::Update: Updated %d transforms, Ticked %d actors", updateCount, tickCount);
+		UE_LOG("Level::Update: Updated %u transforms, Ticked %d actors", updateCount, tickCount);
 	}
 }
 
@@ -215,6 +207,7 @@ void ULevel::Cleanup()
 	ActorsToDelete.clear();
 	LevelPrimitiveComponents.clear();
 	DynamicPrimitives.clear();
+	InvalidatePrimitiveChanges();
 
 	// 5. 선택된 액터 참조를 안전하게 해제합니다.
 	SelectedActor = nullptr;
@@ -245,6 +238,7 @@ AActor* ULevel::SpawnActorToLevel(UClass* InActorClass, const FName& InName)
 			if (UPrimitiveComponent* PrimitiveComp = Cast<UPrimitiveComponent>(Comp))
 			{
 				LevelPrimitiveComponents.push_back(TObjectPtr(PrimitiveComp));
+				RecordPrimitiveChange(PrimitiveComp, true);
 
 				// 빌보드 컴포넌트가 아니면 DynamicPrimitives에도 추가 (렌더링용)
 				if (PrimitiveComp->GetPrimitiveType() != EPrimitiveType::Billboard)
@@ -298,7 +292,8 @@ void ULevel::AddLevelPrimitiveComponent(AActor* Actor)
 		// 빌보드는 무조건 피킹이 된 actor의 빌보드여야 렌더링 가능
 		if (PrimitiveComponent->IsVisible() && (ShowFlags & EEngineShowFlags::SF_Primitives))
 		{
-				LevelPrimitiveComponents.push_back(TObjectPtr(PrimitiveComponent));			
+				LevelPrimitiveComponents.push_back(TObjectPtr(PrimitiveComponent));
+				RecordPrimitiveChange(PrimitiveComponent, true);
 		}
 	}
 }
@@ -384,6 +379,7 @@ bool ULevel::DestroyActor(AActor* InActor)
 					}),
 				LevelPrimitiveComponents.end()
 			);
+			RecordPrimitiveChange(PrimComp, false);
 
 			// 3) Remove from dynamic primitives array using remove-erase idiom
 			DynamicPrimitives.erase(
@@ -527,6 +523,7 @@ void ULevel::ProcessActorForInit(AActor* Actor)
 			
 			// LevelPrimitiveComponents에 추가 (렌더링을 위해 필수!)
 			LevelPrimitiveComponents.push_back(TObjectPtr<UPrimitiveComponent>(PrimitiveComponent));
+			RecordPrimitiveChange(PrimitiveComponent, true);
 
 			// 빌보드 컴포넌트는 Octree에 삽입하지 않음
 			if (PrimitiveComponent->GetPrimitiveType() == EPrimitiveType::Billboard)
@@ -570,6 +567,31 @@ void ULevel::MoveToDynamic(UPrimitiveComponent* InPrim)
 	DynamicPrimitives.push_back(TObjectPtr(InPrim));
 }
 
+bool ULevel::UpdateStaticPrimitiveBounds(UPrimitiveComponent* InPrim)
+{
+	if (!InPrim || !StaticOctree.Contains(InPrim))
+	{
+		return false;
+	}
+
+	FVector Min(0.0f, 0.0f, 0.0f), Max(0.0f, 0.0f, 0.0f);
+	InPrim->GetWorldAABB(Min, Max);
+
+	// 바운딩 박스가 없으면 (ProcessActorForInit과 같은 기준) 기존 위치를 유지
+	if (Min.X == 0.0f && Min.Y == 0.0f && Min.Z == 0.0f &&
+	    Max.X == 0.0f && Max.Y == 0.0f && Max.Z == 0.0f)
+	{
+		return true;
+	}
+
+	if (!StaticOctree.Update(InPrim, FAABB(Min, Max)))
+	{
+		// 옥트리 범위를 벗어나 트리에서 빠졌으므로 동적 목록에서 계속 그린다
+		MoveToDynamic(InPrim);
+	}
+	return true;
+}
+
 void ULevel::DuplicateSubObjects()
 {
 	Super::DuplicateSubObjects();
@@ -587,6 +609,7 @@ void ULevel::DuplicateSubObjects()
 	
 	// LevelPrimitiveComponents 업데이트
 	LevelPrimitiveComponents.clear();
+	InvalidatePrimitiveChanges();
 	
 	// LevelActors 배열을 기준으로 LevelPrimitiveComponents 업데이트 (child component 포함)
 	for (const auto& Actor : LevelActors)
@@ -725,7 +748,40 @@ void ULevel::RegisterPrimitiveComponent(UPrimitiveComponent* NewPrimitive)
 
 	// CRITICAL: Also add to LevelPrimitiveComponents for BVH/picking
 	LevelPrimitiveComponents.push_back(TObjectPtr(NewPrimitive));
+	RecordPrimitiveChange(NewPrimitive, true);
 
 	UE_LOG("  -> Added to DynamicPrimitives and LevelPrimitiveComponents (Total: %d)",
 		   LevelPrimitiveComponents.size());
 }
+
+bool ULevel::ConsumePrimitiveChanges(TArray<FLevelPrimitiveChange>& OutChanges)
+{
+	OutChanges.clear();
+	OutChanges.swap(PendingPrimitiveChanges);
+
+	const bool bValid = bPrimitiveChangesValid;
+	bPrimitiveChangesValid = true;
+	return bValid;
+}
+
+void ULevel::RecordPrimitiveChange(UPrimitiveComponent* InPrimitive, bool bInAdded)
+{
+	if (!bPrimitiveChangesValid)
+	{
+		return;
+	}
+
+	if (PendingPrimitiveChanges.size() >= MaxPendingPrimitiveChanges)
+	{
+		InvalidatePrimitiveChanges();
+		return;
+	}
+
+	PendingPrimitiveChanges.push_back({ InPrimitive, bInAdded });
+}
+
+void ULevel::InvalidatePrimitiveChanges()
+{
+	PendingPrimitiveChanges.clear();
+	bPrimitiveChangesValid = false;
+}
@@ -34,6 +34,17 @@ inline uint64 operator&(uint64 lhs, EEngineShowFlags rhs)
 	return lhs & static_cast<uint64>(rhs);
 }
 
+/**
+ * @brief LevelPrimitiveComponents의 추가/제거 기록
+ * 에디터 BVH가 전체 재빌드 대신 증분 갱신을 하기 위해 사용한다
+ * 제거된 포인터는 이미 해제되었을 수 있으므로 비교 용도로만 써야 한다
+ */
+struct FLevelPrimitiveChange
+{
+	UPrimitiveComponent* Primitive = nullptr;
+	bool bAdded = false;
+};
+
 UCLASS()
 class ULevel :
 	public UObject
@@ -89,12 +100,24 @@ public:
 
 	void RegisterPrimitiveComponent(UPrimitiveComponent* NewPrimitive);
 
+	/**
+	 * @brief 마지막 호출 이후의 프리미티브 추가/제거 기록을 발생 순서대로 넘겨주고 비운다
+	 * @return 기록이 넘쳐 버려졌거나 목록이 통째로 교체된 경우 false (호출 측은 전체 재구성 필요)
+	 */
+	bool ConsumePrimitiveChanges(TArray<FLevelPrimitiveChange>& OutChanges);
+
 	// Spatial Index
 	FOctree& GetStaticOctree() { return StaticOctree; }
 	const FOctree& GetStaticOctree() const { return StaticOctree; }
 	const TArray<TObjectPtr<UPrimitiveComponent>>& GetDynamicPrimitives() const { return DynamicPrimitives; }
 	void MoveToDynamic(UPrimitiveComponent* InPrim);
 
+	/**
+	 * @brief 정적 옥트리에 든 프리미티브의 바운드가 바뀌었을 때 (예: 대체 메시를 실제 메시로 교체) 옥트리 위치를 다시 잡는다
+	 * 옥트리에 없으면 아무것도 하지 않고 false, 월드 범위를 벗어나면 동적 목록으로 옮긴다
+	 */
+	bool UpdateStaticPrimitiveBounds(UPrimitiveComponent* InPrim);
+
 private:
 	// 통합된 Actor 관리 배열
 	TArray<TObjectPtr<AActor>> LevelActors;
@@ -124,4 +147,11 @@ private:
 	// Spatial Index
 	FOctree StaticOctree;
 	TArray<TObjectPtr<UPrimitiveComponent>> DynamicPrimitives;
+
+	// LevelPrimitiveComponents 변경 기록 (소비하는 쪽이 없으면 상한에서 버리고 전체 재구성을 요구)
+	void RecordPrimitiveChange(UPrimitiveComponent* InPrimitive, bool bInAdded);
+	void InvalidatePrimitiveChanges();
+	static constexpr size_t MaxPendingPrimitiveChanges = 4096;
+	TArray<FLevelPrimitiveChange> PendingPrimitiveChanges;
+	bool bPrimitiveChangesValid = true;
 };
@@ -9,9 +9,289 @@
 #include "Texture/Public/TextureRenderProxy.h"
 #include "Texture/Public/Texture.h"
 #include "Manager/Asset/Public/ObjManager.h"
+#include "Utility/Public/CookedMesh.h"
+#include "Utility/Public/MeshOptimizer.h"
 #include "Utility/Public/MeshSimplifier.h"
+#include "Utility/Public/PackedVertex.h"
 #include "Utility/Public/ObjExporter.h"
 #include "Utility/Public/StaticMeshSerializer.h"
+#include "Utility/Public/ScopeCycleCounter.h"
+#include "Utility/Public/TaskScheduler.h"
+#include "Core/Public/ObjectIterator.h"
+#include "Manager/Config/Public/ConfigManager.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+
+// 원본 외에 생성하는 LOD 수 (비율과 캐시 파일 접미사는 ProcessStaticMeshLoadJob 쪽 표 참고)
+constexpr int32 NumGeneratedStaticMeshLODs = 2;
+
+/**
+ * @brief 스태틱 메시 하나의 비동기 로딩 작업
+ * 워커 스레드가 쿠킹된 컨테이너(.meshbin)를 읽거나, 없으면 임포트 → 최적화/(설정 시) 양자화 → (LOD 체인, BVH 병렬) → 쿠킹 순으로 채우고 bCompleted를 세운다
+ * UObject 생성, 머티리얼/텍스처, GPU 버퍼처럼 메인 스레드 전용인 일은 RegisterLoadedStaticMesh에서 처리
+ */
+struct FStaticMeshLoadJob
+{
+	FName ObjPath;
+	FString FilePath;
+	// 작업을 만들 때 읽은 정점 양자화 설정 (워커에서 설정을 읽지 않도록)
+	bool bQuantizeVertices = false;
+
+	// 워커 결과 (bCompleted 이후에는 메인 스레드만 접근, 등록되면 소유권이 UStaticMesh로 넘어감)
+	FStaticMesh* BaseMesh = nullptr;
+	FStaticMesh* LODs[NumGeneratedStaticMeshLODs] = {};
+	FStaticMeshBVH BVH;
+	FAABB Bounds;
+	bool bHasBounds = false;
+	bool bIsFromCookedMesh = false;
+	bool bIsCookedMeshSaved = true;
+	bool bIsBVHFromCache = false;
+	float CachedBVHBuildMs = 0.0f;
+
+	// 원본 메시의 최적화 전후 정점 캐시 효율 (쿠킹된 컨테이너에서 읽은 경우 측정하지 않음)
+	FVertexCacheStatistics CacheBefore;
+	FVertexCacheStatistics CacheAfter;
+
+	// 단계별 소요 시간 (ms)
+	double ImportMs = 0.0;
+	double OptimizeMs = 0.0;
+	double LODMs = 0.0;
+	double BVHMs = 0.0;
+	double UploadMs = 0.0;
+
+	std::atomic<bool> bCompleted{ false };
+	bool bFailed = false;
+	bool bFinalized = false;
+};
+
+namespace
+{
+	// 이보다 인덱스가 적은 메시는 LOD를 만들지 않는다
+	constexpr size_t MinIndicesForLOD = 200;
+
+	// 한 프레임에 GPU 업로드/등록에 쓰는 시간 (최소 한 개는 처리)
+	constexpr double StaticMeshRegisterBudgetMs = 4.0;
+
+	// 생성할 LOD의 원본 대비 삼각형 비율과 캐시 파일 이름 접미사
+	const float StaticMeshLODRatios[NumGeneratedStaticMeshLODs] = { 0.5f, 0.25f };
+	const char* const StaticMeshLODSuffixes[NumGeneratedStaticMeshLODs] = { "_lod_050", "_lod_025" };
+
+	std::filesystem::path GetCookedStaticMeshPath(const FString& InFilePath)
+	{
+		std::filesystem::path CookedPath(InFilePath);
+		CookedPath.replace_extension(".meshbin");
+		return CookedPath;
+	}
+
+	/**
+	 * @brief 양자화 설정이 켜져 있으면 정점을 쿠킹된 컨테이너에서 복원될 값으로 맞춘다
+	 * UV가 half 범위를 벗어나는 메시는 FCookedMeshFile::Save가 양자화하지 않고 저장하므로 여기서도 건드리지 않는다
+	 */
+	void QuantizeIfEnabled(const FStaticMeshLoadJob& InJob, TArray<FNormalVertex>& InOutVertices)
+	{
+		if (InJob.bQuantizeVertices && FPackedVertexStream::CanPackTexCoords(InOutVertices.data(), InOutVertices.size()))
+		{
+			FPackedVertexStream::Quantize(InOutVertices);
+		}
+	}
+
+	/**
+	 * @brief 원본과 수정 시각/크기가 같은 .meshbin이 있으면 원본, LOD, BVH, AABB를 모두 그 파일에서 가져온다
+	 * 정점은 매핑된 블롭에서 복사(양자화된 LOD는 복원)하고 인덱스는 LOD마다 memcpy 한 번으로 복사한다 (파싱이나 정점 용접은 하지 않음)
+	 * 양자화 설정이 쿠킹할 때와 다르면 다시 쿠킹한다
+	 */
+	bool LoadCookedStaticMesh(FStaticMeshLoadJob& InJob)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+
+		FCookedMeshFile CookedFile;
+		if (!CookedFile.Open(GetCookedStaticMeshPath(InJob.FilePath), InJob.FilePath) || !CookedFile.HasBVH() ||
+			CookedFile.WasQuantizationEnabled() != InJob.bQuantizeVertices)
+		{
+			return false;
+		}
+
+		// BVH 먼저 복원해 실패하면 아무것도 만들지 않고 원래 경로로 돌아간다
+		if (!CookedFile.LoadBVH(InJob.BVH, &InJob.CachedBVHBuildMs))
+		{
+			return false;
+		}
+		InJob.BVHMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		const uint64 ImportStart = FPlatformTime::Cycles64();
+		InJob.BaseMesh = CookedFile.CreateStaticMesh(0);
+		InJob.BaseMesh->PathFileName = InJob.ObjPath;
+		const int32 NumLODs = std::min(CookedFile.GetNumLODs() - 1, NumGeneratedStaticMeshLODs);
+		for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+		{
+			InJob.LODs[LODIndex] = CookedFile.CreateStaticMesh(LODIndex + 1);
+		}
+		InJob.ImportMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ImportStart);
+
+		InJob.Bounds = CookedFile.GetBounds();
+		InJob.bHasBounds = true;
+		InJob.bIsFromCookedMesh = true;
+		InJob.bIsBVHFromCache = true;
+		return true;
+	}
+
+	/**
+	 * @brief 원본, 생성된 LOD, BVH를 .meshbin 하나로 쿠킹 (다음 실행부터 LoadCookedStaticMesh로 읽힘)
+	 */
+	void SaveCookedStaticMesh(FStaticMeshLoadJob& InJob)
+	{
+		TArray<const FStaticMesh*> LODs;
+		LODs.push_back(InJob.BaseMesh);
+		for (const FStaticMesh* LODMesh : InJob.LODs)
+		{
+			// 중간 LOD가 빠지면 이후 LOD의 번호가 어긋나므로 거기서 끊는다
+			if (!LODMesh)
+			{
+				break;
+			}
+			LODs.push_back(LODMesh);
+		}
+
+		InJob.bIsCookedMeshSaved = FCookedMeshFile::Save(GetCookedStaticMeshPath(InJob.FilePath), LODs, &InJob.BVH,
+			InJob.FilePath, InJob.bQuantizeVertices, InJob.bIsBVHFromCache ? InJob.CachedBVHBuildMs : static_cast<float>(InJob.BVHMs));
+	}
+
+	/**
+	 * @brief 이전 형식의 LOD 캐시(.objbin)가 원본보다 새로우면 읽고, 없는 단계만 한 번의 단순화로 모아 만든 뒤 .obj로 내보낸다
+	 * 단계마다 처음부터 다시 단순화하지 않고 UMeshSimplifier::SimplifyChain 한 번에서 스냅샷을 뜬다
+	 * 결과는 .meshbin에 쿠킹되므로 LOD .objbin은 더 이상 쓰지 않는다 (기존 파일은 첫 쿠킹 때 한 번 읽힘)
+	 * 쿠킹 전에 모든 LOD를 FMeshOptimizer로 최적화하고 양자화 설정이 켜져 있으면 컨테이너에 저장될 정밀도로 양자화한다
+	 */
+	void LoadOrBuildStaticMeshLODs(FStaticMeshLoadJob& InJob)
+	{
+		const std::filesystem::path OriginalPath(InJob.FilePath);
+		const FString BaseName = OriginalPath.stem().string();
+		const std::filesystem::path ParentPath = OriginalPath.parent_path();
+
+		std::error_code ErrorCode;
+		const auto OriginalTime = std::filesystem::last_write_time(OriginalPath, ErrorCode);
+
+		TArray<int32> MissingLODs;
+		TArray<float> MissingRatios;
+		for (int32 LODIndex = 0; LODIndex < NumGeneratedStaticMeshLODs; ++LODIndex)
+		{
+			const std::filesystem::path LODBinPath = ParentPath / (BaseName + StaticMeshLODSuffixes[LODIndex] + ".objbin");
+			if (std::filesystem::exists(LODBinPath, ErrorCode) &&
+				std::filesystem::last_write_time(LODBinPath, ErrorCode) > OriginalTime)
+			{
+				InJob.LODs[LODIndex] = StaticMeshSerializer::LoadFStaticMeshFromBin(LODBinPath);
+				if (InJob.LODs[LODIndex])
+				{
+					FMeshOptimizer::OptimizeStaticMesh(*InJob.LODs[LODIndex]);
+					QuantizeIfEnabled(InJob, InJob.LODs[LODIndex]->Vertices);
+				}
+			}
+
+			if (!InJob.LODs[LODIndex])
+			{
+				MissingLODs.push_back(LODIndex);
+				MissingRatios.push_back(StaticMeshLODRatios[LODIndex]);
+			}
+		}
+
+		if (MissingLODs.empty())
+		{
+			return;
+		}
+
+		const TArray<FStaticMesh*> BuiltLODs = UMeshSimplifier::SimplifyChain(InJob.BaseMesh, MissingRatios);
+		const FString MtlName = BaseName + ".mtl";
+		for (size_t Index = 0; Index < MissingLODs.size(); ++Index)
+		{
+			FStaticMesh* LODMesh = BuiltLODs[Index];
+			if (!LODMesh)
+			{
+				continue;
+			}
+
+			FMeshOptimizer::OptimizeStaticMesh(*LODMesh);
+			QuantizeIfEnabled(InJob, LODMesh->Vertices);
+
+			const FString Suffix = StaticMeshLODSuffixes[MissingLODs[Index]];
+			UObjExporter::ExportMesh(LODMesh, (ParentPath / (BaseName + Suffix + ".obj")).string(), MtlName);
+			InJob.LODs[MissingLODs[Index]] = LODMesh;
+		}
+	}
+
+	/**
+	 * @brief 원본과 해시가 같은 이전 형식의 .bvhbin 캐시가 있으면 읽고, 없으면 빌드 (저장은 .meshbin 쿠킹에서)
+	 */
+	void LoadOrBuildStaticMeshBVH(FStaticMeshLoadJob& InJob)
+	{
+		const TArray<FNormalVertex>& BaseVertices = InJob.BaseMesh->Vertices;
+		const TArray<uint32>& BaseIndices = InJob.BaseMesh->Indices;
+
+		std::filesystem::path BVHCachePath(InJob.FilePath);
+		BVHCachePath.replace_extension(".bvhbin");
+		std::error_code TimeError;
+		const int64 SourceTime = static_cast<int64>(
+			std::filesystem::last_write_time(InJob.FilePath, TimeError).time_since_epoch().count());
+		const uint64 SourceHash = FStaticMeshBVH::ComputeSourceHash(BaseVertices, &BaseIndices);
+
+		const uint64 Start = FPlatformTime::Cycles64();
+		InJob.bIsBVHFromCache = InJob.BVH.LoadFromFile(BVHCachePath, SourceHash, SourceTime, &InJob.CachedBVHBuildMs);
+		if (!InJob.bIsBVHFromCache)
+		{
+			InJob.BVH.Build(BaseVertices, &BaseIndices);
+		}
+		InJob.BVHMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	/**
+	 * @brief 워커 스레드에서 실행되는 메시 하나의 로딩
+	 * 쿠킹된 컨테이너가 유효하면 그것만 읽고 끝낸다
+	 * 아니면 임포트가 끝난 뒤 LOD 체인을 하위 작업으로 띄우고 BVH는 이 스레드에서 직접 처리한 뒤 모두 기다렸다가 쿠킹한다
+	 */
+	void ProcessStaticMeshLoadJob(FStaticMeshLoadJob& InJob, const FObjImporter::Configuration& InConfig,
+		FTaskScheduler& InScheduler)
+	{
+		if (LoadCookedStaticMesh(InJob))
+		{
+			InJob.bCompleted.store(true, std::memory_order_release);
+			return;
+		}
+
+		const uint64 ImportStart = FPlatformTime::Cycles64();
+		InJob.BaseMesh = FObjManager::LoadObjStaticMeshAsset(InJob.ObjPath, InConfig);
+		InJob.ImportMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ImportStart);
+
+		if (!InJob.BaseMesh)
+		{
+			InJob.bFailed = true;
+			InJob.bCompleted.store(true, std::memory_order_release);
+			return;
+		}
+
+		// LOD와 BVH가 최적화된 순서를 물려받도록 먼저 재배치
+		// 양자화를 켰다면 여기서 해 두어야 BVH와 이번 실행의 정점이 다음 실행에 .meshbin에서 복원될 값과 같다
+		const uint64 OptimizeStart = FPlatformTime::Cycles64();
+		FMeshOptimizer::OptimizeStaticMesh(*InJob.BaseMesh, FMeshOptimizer::DefaultOverdrawThreshold, &InJob.CacheBefore, &InJob.CacheAfter);
+		QuantizeIfEnabled(InJob, InJob.BaseMesh->Vertices);
+		InJob.OptimizeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - OptimizeStart);
+
+		// LOD와 BVH는 원본 메시를 읽기만 하므로 동시에 실행해도 된다
+		FTaskGroup LODGroup;
+		if (InJob.BaseMesh->Indices.size() > MinIndicesForLOD)
+		{
+			InScheduler.Dispatch(LODGroup, [&InJob]()
+			{
+				const uint64 LODStart = FPlatformTime::Cycles64();
+				LoadOrBuildStaticMeshLODs(InJob);
+				InJob.LODMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LODStart);
+			});
+		}
+
+		LoadOrBuildStaticMeshBVH(InJob);
+		InScheduler.Wait(LODGroup);
+
+		SaveCookedStaticMesh(InJob);
+		InJob.bCompleted.store(true, std::memory_order_release);
+	}
+}
 
 IMPLEMENT_SINGLETON_CLASS_BASE(UAssetManager)
 
@@ -23,7 +303,8 @@ void UAssetManager::Initialize()
 {
 	URenderer& Renderer = URenderer::GetInstance();
 
-	// Data 폴더 속 모든 .obj 파일 로드 및 캐싱
+	// 로딩 중인 메시 대신 그릴 큐브를 먼저 등록한 뒤 Data 폴더 속 모든 .obj 파일을 비동기로 로드
+	CreatePlaceholderStaticMesh();
 	LoadAllObjStaticMesh();
 
 	// TMap.Add()
@@ -87,21 +368,6 @@ void UAssetManager::Initialize()
 		AABBs[Type] = CalculateAABB(*Vertices);
 	}
 
-	// Calculate AABB for each StaticMesh
-	for (const auto& MeshPair : StaticMeshCache)
-	{
-		const FName& ObjPath = MeshPair.first;
-		const auto& Mesh = MeshPair.second;
-		if (!Mesh || !Mesh->IsValid())
-			continue;
-
-		const auto& Vertices = Mesh->GetVertices();
-		if (Vertices.empty())
-			continue;
-
-		StaticMeshAABBs[ObjPath] = CalculateAABB(Vertices);
-	}
-
 	// Initialize Shaders
 	ID3D11VertexShader* vertexShader;
 	ID3D11InputLayout* inputLayout;
@@ -126,6 +392,9 @@ void UAssetManager::Initialize()
 
 void UAssetManager::Release()
 {
+	// 진행 중인 로딩 작업을 끝까지 기다린 뒤 등록되지 않은 결과를 버린다
+	ReleaseStaticMeshLoadJobs();
+
 	// Texture Resource 해제
 	ReleaseAllTextures();
 
@@ -165,13 +434,14 @@ void UAssetManager::Release()
 }
 
 /**
- * @brief Data/ 경로 하위에 모든 .obj 파일을 로드 후 캐싱한다
+ * @brief Data/ 경로 하위에 모든 .obj 파일의 로딩 작업을 워커 스레드에 띄운다
+ * 임포트, LOD 생성/캐시 로드, BVH 빌드/캐시 로드는 워커에서 메시마다 병렬로 진행하고,
+ * 끝난 메시는 UpdateStaticMeshLoading에서 GPU 버퍼를 만들어 캐시에 등록한다
+ * 전용 스케줄러를 쓰므로 메인 스레드가 컬링 등으로 전역 스케줄러를 기다릴 때 긴 로딩 작업을 대신 실행하지 않는다
  */
 void UAssetManager::LoadAllObjStaticMesh()
 {
-	URenderer& Renderer = URenderer::GetInstance();
-
-	TArray<FName> ObjList;
+	TArray<FString> ObjList;
 	const FString DataDirectory = "Data/"; // 검색할 기본 디렉토리
 	// 디렉토리가 실제로 존재하는지 먼저 확인합니다.
 	if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
@@ -184,111 +454,395 @@ void UAssetManager::LoadAllObjStaticMesh()
 			{
 				// .generic_string()을 사용하여 OS에 상관없이 '/' 구분자를 사용하는 경로를 바로 얻습니다.
 				FString PathString = Entry.path().generic_string();
-			
+
 				if (PathString.find("_lod_") != FString::npos)
 				{
 					continue;
 				}
-			
-				// 찾은 파일 경로를 FName으로 변환하여 ObjList에 추가합니다.
-				ObjList.push_back(FName(PathString));
+
+				ObjList.push_back(PathString);
 			}
 		}
 	}
 
+	if (ObjList.empty())
+	{
+		return;
+	}
+
 	// Enable winding order flip for this OBJ file
+	// 메시 단위로 이미 병렬이므로 파일 하나를 구간으로 나누는 파싱은 끈다 (전역 스케줄러를 쓰지 않도록)
 	FObjImporter::Configuration Config;
 	Config.bFlipWindingOrder = false;
 	Config.bIsBinaryEnabled = true;
 	Config.bUVToUEBasis = true;
 	Config.bPositionToUEBasis = true;
+	Config.bIsParallelEnabled = false;
+
+	const bool bQuantizeVertices = UConfigManager::GetInstance().GetConfigValueBool("QuantizeStaticMeshVertices", false);
 
-	for (const FName& ObjPath : ObjList)
+	// 작업 목록은 메인 스레드에서 모두 만든 뒤 띄운다 (이후 배열/맵은 메인 스레드만 수정)
+	const size_t FirstNewJob = StaticMeshLoadJobs.size();
+	for (const FString& PathString : ObjList)
 	{
-		//UE_LOG("Processing Mesh: %s", ObjPath.ToString().c_str());
-		UStaticMesh* LoadedMesh = FObjManager::LoadObjStaticMesh(ObjPath, Config);
+		FName ObjPath(PathString);
+		if (StaticMeshLoadJobMap.find(ObjPath) != StaticMeshLoadJobMap.end() || HasStaticMesh(ObjPath))
+		{
+			continue;
+		}
+
+		auto Job = std::make_unique<FStaticMeshLoadJob>();
+		Job->ObjPath = ObjPath;
+		Job->FilePath = PathString;
+		Job->bQuantizeVertices = bQuantizeVertices;
+		StaticMeshLoadJobMap.emplace(ObjPath, Job.get());
+		StaticMeshLoadJobs.push_back(std::move(Job));
+	}
+
+	if (FirstNewJob == StaticMeshLoadJobs.size())
+	{
+		return;
+	}
 
-		if (LoadedMesh && LoadedMesh->IsValid())
+	// 코어가 하나뿐이어도 워커 하나는 두어 메인 스레드가 로딩을 직접 실행하지 않게 한다
+	if (!StaticMeshLoadScheduler)
+	{
+		const uint32 HardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+		StaticMeshLoadScheduler = std::make_unique<FTaskScheduler>(HardwareThreads - 1);
+		StaticMeshLoadGroup = std::make_unique<FTaskGroup>();
+		StaticMeshLoadStartCycles = FPlatformTime::Cycles64();
+	}
+	bIsLoadingStaticMeshes = true;
+
+	FTaskScheduler* Scheduler = StaticMeshLoadScheduler.get();
+	for (size_t JobIndex = FirstNewJob; JobIndex < StaticMeshLoadJobs.size(); ++JobIndex)
+	{
+		FStaticMeshLoadJob* JobPtr = StaticMeshLoadJobs[JobIndex].get();
+		Scheduler->Dispatch(*StaticMeshLoadGroup, [JobPtr, Config, Scheduler]()
 		{
-			//UE_LOG("  -> Loaded UStaticMesh asset with path: %s (Addr: 0x%p)", LoadedMesh->GetAssetPathFileName().ToString().c_str(), (void*)LoadedMesh);
+			ProcessStaticMeshLoadJob(*JobPtr, Config, *Scheduler);
+		});
+	}
 
-			// 1. Try to load LODs from cache or generate them
-			FStaticMesh* BaseMesh = LoadedMesh->GetLOD(0);
-			if (BaseMesh && BaseMesh->Indices.size() > 200) // Don't simplify very small meshes
-			{
-				std::filesystem::path OriginalPath(ObjPath.ToString());
-				FString BaseName = OriginalPath.stem().string();
-				std::filesystem::path ParentPath = OriginalPath.parent_path();
-
-				// Handle LOD 1 (0.5f)
-				std::filesystem::path LOD1Path = ParentPath / (BaseName + "_lod_050.objbin");
-				FStaticMesh* LOD1 = nullptr;
-				if (std::filesystem::exists(LOD1Path) && std::filesystem::last_write_time(LOD1Path) > std::filesystem::last_write_time(OriginalPath))
-				{
-					LOD1 = StaticMeshSerializer::LoadFStaticMeshFromBin(LOD1Path);
-				}
-				else
-				{
-					LOD1 = UMeshSimplifier::Simplify(BaseMesh, 0.5f);
-					if (LOD1)
-					{
-						std::filesystem::path LOD1ObjPath = ParentPath / (BaseName + "_lod_050.obj");
-						FString MtlName = OriginalPath.stem().string() + ".mtl";
-						UObjExporter::ExportMesh(LOD1, LOD1ObjPath.string(), MtlName);
-						StaticMeshSerializer::SaveFStaticMeshToBin(LOD1, LOD1Path);
-					}
-				}
-				if (LOD1) LoadedMesh->AddLOD(LOD1);
+	UE_LOG("AssetManager: Loading %zu static meshes on %u worker threads",
+		StaticMeshLoadJobs.size() - FirstNewJob, Scheduler->GetNumWorkers());
+}
 
-				// Handle LOD 2 (0.25f)
-				std::filesystem::path LOD2Path = ParentPath / (BaseName + "_lod_025.objbin");
-				FStaticMesh* LOD2 = nullptr;
-				if (std::filesystem::exists(LOD2Path) && std::filesystem::last_write_time(LOD2Path) > std::filesystem::last_write_time(OriginalPath))
-				{
-					LOD2 = StaticMeshSerializer::LoadFStaticMeshFromBin(LOD2Path);
-				}
-				else
-				{
-					LOD2 = UMeshSimplifier::Simplify(BaseMesh, 0.25f);
-					if (LOD2)
-					{
-						std::filesystem::path LOD2ObjPath = ParentPath / (BaseName + "_lod_025.obj");
-						FString MtlName = OriginalPath.stem().string() + ".mtl";
-						UObjExporter::ExportMesh(LOD2, LOD2ObjPath.string(), MtlName);
-						StaticMeshSerializer::SaveFStaticMeshToBin(LOD2, LOD2Path);
-					}
-				}
-				if (LOD2) LoadedMesh->AddLOD(LOD2);
-			}
+/**
+ * @brief 워커에서 끝난 메시를 프레임당 시간 예산 안에서 등록하고, 대기 중인 컴포넌트에 실제 메시를 연결한다
+ * 매 프레임 메인 스레드에서 호출
+ */
+void UAssetManager::UpdateStaticMeshLoading()
+{
+	ProcessCompletedStaticMeshLoads(StaticMeshRegisterBudgetMs);
+}
 
-            // 2. Create GPU buffers for all generated LOD levels
-            TArray<ID3D11Buffer*> VBs;
-            TArray<ID3D11Buffer*> IBs;
-            for (int32 i = 0; i < LoadedMesh->GetNumLODs(); ++i)
-            {
-                FStaticMesh* LODData = LoadedMesh->GetLOD(i);
-                if (LODData)
-                {
-                    VBs.push_back(CreateVertexBuffer(LODData->Vertices));
-                    IBs.push_back(CreateIndexBuffer(LODData->Indices));
-                }
-            }
+/**
+ * @brief 남은 로딩 작업을 모두 기다린 뒤 한 번에 등록 (로드 직후 메시 목록이 필요한 경우용)
+ */
+void UAssetManager::FlushStaticMeshLoading()
+{
+	if (!bIsLoadingStaticMeshes)
+	{
+		return;
+	}
+
+	// Wait은 기다리는 동안 남은 작업을 직접 실행한다
+	StaticMeshLoadScheduler->Wait(*StaticMeshLoadGroup);
+	ProcessCompletedStaticMeshLoads(0.0);
+}
+
+/**
+ * @brief 완료된 작업을 순서대로 등록
+ * @param InBudgetMs 이 시간을 넘기면 다음 프레임으로 미룸 (0이면 제한 없음)
+ */
+void UAssetManager::ProcessCompletedStaticMeshLoads(double InBudgetMs)
+{
+	if (!bIsLoadingStaticMeshes)
+	{
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	TSet<FName> RegisteredPaths;
+	bool bHasPendingJobs = false;
+
+	for (const auto& Job : StaticMeshLoadJobs)
+	{
+		if (Job->bFinalized)
+		{
+			continue;
+		}
+
+		if (!Job->bCompleted.load(std::memory_order_acquire) ||
+			(InBudgetMs > 0.0 && FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) > InBudgetMs))
+		{
+			bHasPendingJobs = true;
+			continue;
+		}
+
+		RegisterLoadedStaticMesh(*Job);
+		if (!Job->bFailed)
+		{
+			RegisteredPaths.insert(Job->ObjPath);
+		}
+	}
+
+	if (!RegisteredPaths.empty())
+	{
+		RefreshPendingStaticMeshComponents(RegisteredPaths);
+	}
+
+	if (!bHasPendingJobs)
+	{
+		bIsLoadingStaticMeshes = false;
+		LogStaticMeshLoadSummary();
+
+		// 모든 작업이 끝났으므로 워커 스레드 정리
+		StaticMeshLoadScheduler->Wait(*StaticMeshLoadGroup);
+		StaticMeshLoadGroup.reset();
+		StaticMeshLoadScheduler.reset();
+	}
+}
+
+/**
+ * @brief 워커가 채운 결과로 UStaticMesh를 만들고 GPU 버퍼, AABB, BVH와 함께 캐시에 등록 (메인 스레드 전용)
+ */
+void UAssetManager::RegisterLoadedStaticMesh(FStaticMeshLoadJob& InJob)
+{
+	InJob.bFinalized = true;
+
+	if (InJob.bFailed || !InJob.BaseMesh)
+	{
+		UE_LOG_ERROR("AssetManager: Failed to load static mesh '%s'", InJob.ObjPath.ToString().c_str());
+		return;
+	}
+
+	const uint64 UploadStart = FPlatformTime::Cycles64();
+	const FName& ObjPath = InJob.ObjPath;
+
+	// 1. LOD 데이터의 소유권을 UStaticMesh로 넘기고 MTL 정보로 재질 생성 (텍스처 생성 포함)
+	UStaticMesh* LoadedMesh = new UStaticMesh();
+	LoadedMesh->AddLOD(InJob.BaseMesh);
+	for (FStaticMesh*& LODMesh : InJob.LODs)
+	{
+		if (LODMesh)
+		{
+			LoadedMesh->AddLOD(LODMesh);
+			LODMesh = nullptr;
+		}
+	}
+	FObjManager::CreateMaterialsFromMTL(LoadedMesh, InJob.BaseMesh, ObjPath);
+	InJob.BaseMesh = nullptr;
+
+	// 2. Create GPU buffers for all generated LOD levels
+	TArray<ID3D11Buffer*> VBs;
+	TArray<ID3D11Buffer*> IBs;
+	for (int32 i = 0; i < LoadedMesh->GetNumLODs(); ++i)
+	{
+		FStaticMesh* LODData = LoadedMesh->GetLOD(i);
+		if (LODData)
+		{
+			VBs.push_back(CreateVertexBuffer(LODData->Vertices));
+			IBs.push_back(CreateIndexBuffer(LODData->Indices));
+		}
+	}
+
+	// 3. Store the buffer arrays and bounds in the AssetManager's maps
+	StaticMeshVertexBuffers.emplace(ObjPath, VBs);
+	StaticMeshIndexBuffers.emplace(ObjPath, IBs);
+	if (InJob.bHasBounds)
+	{
+		StaticMeshAABBs[ObjPath] = InJob.Bounds;
+	}
+	else if (!LoadedMesh->GetVertices().empty())
+	{
+		StaticMeshAABBs[ObjPath] = CalculateAABB(LoadedMesh->GetVertices());
+	}
+
+	// 4. Cache the UStaticMesh asset itself
+	StaticMeshCache.emplace(ObjPath, LoadedMesh);
+	InJob.UploadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - UploadStart);
+	UE_LOG("  -> Cached asset 0x%p under key '%s'", (void*)LoadedMesh, ObjPath.ToString().c_str());
+
+	// 5. 워커에서 만든 BVH 등록
+	if (InJob.bIsFromCookedMesh)
+	{
+		UE_LOG("  -> Loaded from cooked mesh: %.3f ms, BVH %.3f ms (build took %.3f ms)",
+			InJob.ImportMs, InJob.BVHMs, InJob.CachedBVHBuildMs);
+	}
+	else
+	{
+		if (InJob.bIsBVHFromCache)
+		{
+			UE_LOG("  -> BVH loaded from legacy cache: %.3f ms (build took %.3f ms)", InJob.BVHMs, InJob.CachedBVHBuildMs);
+		}
+		else
+		{
+			UE_LOG("  -> BVH built: %.3f ms (%zu tris)", InJob.BVHMs, LoadedMesh->GetIndices(0).size() / 3);
+		}
+		UE_LOG("  -> Optimized in %.3f ms: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, overfetch %.2f -> %.2f", InJob.OptimizeMs,
+			InJob.CacheBefore.ACMR, InJob.CacheAfter.ACMR, InJob.CacheBefore.ATVR, InJob.CacheAfter.ATVR,
+			InJob.CacheBefore.Overfetch, InJob.CacheAfter.Overfetch);
+		if (!InJob.bIsCookedMeshSaved)
+		{
+			UE_LOG_WARNING("  -> Failed to write cooked mesh for '%s'", ObjPath.ToString().c_str());
+		}
+	}
+	StaticMeshBVHs.emplace(ObjPath, std::move(InJob.BVH));
+}
 
-            // 3. Store the buffer arrays in the AssetManager's maps
-            StaticMeshVertexBuffers.emplace(ObjPath, VBs);
-            StaticMeshIndexBuffers.emplace(ObjPath, IBs);
+/**
+ * @brief 대체 메시를 그리던 컴포넌트 중 방금 등록된 경로를 기다리던 것에 실제 메시를 연결
+ */
+void UAssetManager::RefreshPendingStaticMeshComponents(const TSet<FName>& InRegisteredPaths) const
+{
+	for (TObjectIterator<UStaticMeshComponent> It; It; ++It)
+	{
+		UStaticMeshComponent* MeshComponent = *It;
+		if (!MeshComponent || !MeshComponent->IsStaticMeshPending())
+		{
+			continue;
+		}
 
-			// 4. Cache the UStaticMesh asset itself
-            StaticMeshCache.emplace(ObjPath, LoadedMesh);
-			UE_LOG("  -> Cached asset 0x%p under key '%s'", (void*)LoadedMesh, ObjPath.ToString().c_str());
+		const FName AssetPath = MeshComponent->GetStaticMeshAssetPath();
+		if (InRegisteredPaths.find(AssetPath) != InRegisteredPaths.end())
+		{
+			MeshComponent->SetStaticMesh(AssetPath);
+		}
+	}
+}
 
-			// 5. Build BVH for the base mesh
-			FStaticMeshBVH StaticMeshBVH;
-			StaticMeshBVH.Build(LoadedMesh->GetVertices(0), &LoadedMesh->GetIndices(0));
-			StaticMeshBVHs.emplace(ObjPath, std::move(StaticMeshBVH));
+/**
+ * @brief 로딩이 모두 끝났을 때 전체 시간과 단계별 누적 시간 출력
+ * 단계별 시간은 여러 워커에서 동시에 흐른 시간의 합이라 전체 시간보다 클 수 있다
+ */
+void UAssetManager::LogStaticMeshLoadSummary()
+{
+	const double TotalMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StaticMeshLoadStartCycles);
+
+	double ImportMs = 0.0;
+	double OptimizeMs = 0.0;
+	double LODMs = 0.0;
+	double BVHMs = 0.0;
+	double UploadMs = 0.0;
+	uint32 NumFailed = 0;
+	uint32 NumCooked = 0;
+	const FStaticMeshLoadJob* SlowestJob = nullptr;
+	double SlowestMs = 0.0;
+
+	for (const auto& Job : StaticMeshLoadJobs)
+	{
+		const double JobMs = Job->ImportMs + Job->OptimizeMs + std::max(Job->LODMs, Job->BVHMs);
+
+		ImportMs += Job->ImportMs;
+		OptimizeMs += Job->OptimizeMs;
+		LODMs += Job->LODMs;
+		BVHMs += Job->BVHMs;
+		UploadMs += Job->UploadMs;
+		NumFailed += Job->bFailed ? 1 : 0;
+		NumCooked += Job->bIsFromCookedMesh ? 1 : 0;
+
+		if (JobMs > SlowestMs)
+		{
+			SlowestMs = JobMs;
+			SlowestJob = Job.get();
 		}
 	}
+
+	UE_LOG_SUCCESS("AssetManager: Loaded %zu static meshes (%u failed) in %.1f ms",
+		StaticMeshLoadJobs.size() - NumFailed, NumFailed, TotalMs);
+	UE_LOG("  -> Stage totals: import %.1f ms, optimize %.1f ms, LOD %.1f ms, BVH %.1f ms, upload %.1f ms (%u from cooked meshes)",
+		ImportMs, OptimizeMs, LODMs, BVHMs, UploadMs, NumCooked);
+	if (SlowestJob)
+	{
+		UE_LOG("  -> Slowest mesh: '%s' (%.1f ms on worker)", SlowestJob->ObjPath.ToString().c_str(), SlowestMs);
+	}
+}
+
+bool UAssetManager::IsStaticMeshLoading(const FName& InFilePath) const
+{
+	auto It = StaticMeshLoadJobMap.find(InFilePath);
+	return It != StaticMeshLoadJobMap.end() && !It->second->bFinalized;
 }
+
+FStaticMeshLoadProgress UAssetManager::GetStaticMeshLoadProgress() const
+{
+	FStaticMeshLoadProgress Progress;
+	Progress.NumTotal = static_cast<uint32>(StaticMeshLoadJobs.size());
+
+	for (const auto& Job : StaticMeshLoadJobs)
+	{
+		if (Job->bCompleted.load(std::memory_order_acquire))
+		{
+			++Progress.NumLoaded;
+		}
+		if (Job->bFinalized && Job->bFailed)
+		{
+			++Progress.NumFailed;
+		}
+		else if (Job->bFinalized)
+		{
+			++Progress.NumRegistered;
+		}
+	}
+
+	return Progress;
+}
+
+const FName& UAssetManager::GetPlaceholderStaticMeshPath()
+{
+	static const FName PlaceholderPath("Engine/Placeholder/StaticMesh");
+	return PlaceholderPath;
+}
+
+/**
+ * @brief 로딩 중인 메시 대신 그릴 큐브 메시를 다른 스태틱 메시와 같은 방식으로 캐시에 등록
+ */
+void UAssetManager::CreatePlaceholderStaticMesh()
+{
+	const FName& PlaceholderPath = GetPlaceholderStaticMeshPath();
+
+	FStaticMesh* PlaceholderData = new FStaticMesh();
+	PlaceholderData->PathFileName = PlaceholderPath;
+	PlaceholderData->Vertices = VerticesCube;
+	PlaceholderData->Indices = IndicesCube;
+
+	UStaticMesh* PlaceholderMesh = new UStaticMesh();
+	PlaceholderMesh->AddLOD(PlaceholderData);
+
+	StaticMeshVertexBuffers.emplace(PlaceholderPath, TArray<ID3D11Buffer*>{ CreateVertexBuffer(PlaceholderData->Vertices) });
+	StaticMeshIndexBuffers.emplace(PlaceholderPath, TArray<ID3D11Buffer*>{ CreateIndexBuffer(PlaceholderData->Indices) });
+	StaticMeshAABBs[PlaceholderPath] = CalculateAABB(PlaceholderData->Vertices);
+	StaticMeshCache.emplace(PlaceholderPath, PlaceholderMesh);
+}
+
+/**
+ * @brief 진행 중인 로딩 작업을 기다린 뒤 등록되지 않은 결과를 해제
+ */
+void UAssetManager::ReleaseStaticMeshLoadJobs()
+{
+	if (StaticMeshLoadScheduler && StaticMeshLoadGroup)
+	{
+		StaticMeshLoadScheduler->Wait(*StaticMeshLoadGroup);
+	}
+
+	for (const auto& Job : StaticMeshLoadJobs)
+	{
+		SafeDelete(Job->BaseMesh);
+		for (FStaticMesh*& LODMesh : Job->LODs)
+		{
+			SafeDelete(LODMesh);
+		}
+	}
+
+	StaticMeshLoadJobMap.clear();
+	StaticMeshLoadJobs.clear();
+	StaticMeshLoadGroup.reset();
+	StaticMeshLoadScheduler.reset();
+	bIsLoadingStaticMeshes = false;
+}
+
 bool UAssetManager::HasStaticMesh(const FName& InFilePath) const
 {
 	return StaticMeshCache.find(InFilePath) != StaticMeshCache.end();
@@ -339,12 +893,12 @@ const TArray<ID3D11Buffer*>* UAssetManager::GetIndexBuffers(FName InObjPath) con
     return nullptr;
 }
 
-ID3D11Buffer* UAssetManager::CreateVertexBuffer(TArray<FNormalVertex> InVertices)
+ID3D11Buffer* UAssetManager::CreateVertexBuffer(const TArray<FNormalVertex>& InVertices)
 {
 	return URenderer::GetInstance().CreateVertexBuffer(InVertices.data(), static_cast<int>(InVertices.size()) * sizeof(FNormalVertex));
 }
 
-ID3D11Buffer* UAssetManager::CreateIndexBuffer(TArray<uint32> InIndices)
+ID3D11Buffer* UAssetManager::CreateIndexBuffer(const TArray<uint32>& InIndices)
 {
 	return URenderer::GetInstance().CreateIndexBuffer(InIndices.data(), static_cast<int>(InIndices.size()) * sizeof(uint32));
 }
@@ -1,8 +1,192 @@
 #include "pch.h"
 
-#include "Core/Public/WindowsBinReader.h"
-#include "Core/Public/WindowsBinWriter.h"
+#include "Core/Public/BufferedBinWriter.h"
+#include "Core/Public/MappedBinReader.h"
+#include "Core/Public/MappedFile.h"
 #include "Manager/Asset/Public/ObjImporter.h"
+#include "Utility/Public/TaskScheduler.h"
+
+#include <charconv>
+#include <string_view>
+
+namespace
+{
+	// 병렬 파싱 시 구간 하나의 최소 크기와 스레드당 구간 수 (줄 길이 편차로 생기는 불균형을 훔쳐 가기로 메운다)
+	constexpr size_t ParallelChunkBytes = 4 * 1024 * 1024;
+	constexpr size_t ChunksPerThread = 4;
+
+	// istream이 공백으로 보는 문자 (줄바꿈은 줄 단위로 자를 때 이미 빠진다)
+	inline bool IsObjSpace(char C)
+	{
+		return C == ' ' || C == '\t' || C == '\r' || C == '\v' || C == '\f';
+	}
+
+	// operator>>(FString)처럼 공백을 건너뛰고 다음 토큰을 잘라낸다 (없으면 빈 view)
+	std::string_view NextToken(const char*& Cursor, const char* End)
+	{
+		while (Cursor < End && IsObjSpace(*Cursor))
+		{
+			++Cursor;
+		}
+		const char* Begin = Cursor;
+		while (Cursor < End && !IsObjSpace(*Cursor))
+		{
+			++Cursor;
+		}
+		return std::string_view(Begin, static_cast<size_t>(Cursor - Begin));
+	}
+
+	// operator>>(float)처럼 공백을 건너뛰고 숫자로 읽을 수 있는 앞부분만 소비한다
+	bool ParseFloat(const char*& Cursor, const char* End, float& OutValue)
+	{
+		while (Cursor < End && IsObjSpace(*Cursor))
+		{
+			++Cursor;
+		}
+		// from_chars는 '+' 부호를 받지 않는다
+		if (Cursor + 1 < End && *Cursor == '+' && Cursor[1] != '-')
+		{
+			++Cursor;
+		}
+
+		const std::from_chars_result Result = std::from_chars(Cursor, End, OutValue);
+		if (Result.ec != std::errc())
+		{
+			return false;
+		}
+		Cursor = Result.ptr;
+		return true;
+	}
+
+	// std::stoull(Text) - 1과 같은 결과 (부호 허용, 숫자 뒤 문자는 무시, 숫자가 없으면 실패)
+	bool ParseIndex(std::string_view Text, size_t& OutIndex)
+	{
+		size_t Position = 0;
+		bool bNegative = false;
+		if (!Text.empty() && (Text[0] == '+' || Text[0] == '-'))
+		{
+			bNegative = Text[0] == '-';
+			++Position;
+		}
+		if (Position >= Text.size() || Text[Position] < '0' || Text[Position] > '9')
+		{
+			return false;
+		}
+
+		uint64 Value = 0;
+		for (; Position < Text.size() && Text[Position] >= '0' && Text[Position] <= '9'; ++Position)
+		{
+			Value = Value * 10 + static_cast<uint64>(Text[Position] - '0');
+		}
+		if (bNegative)
+		{
+			Value = 0 - Value;
+		}
+		OutIndex = static_cast<size_t>(Value - 1);
+		return true;
+	}
+
+	struct FFaceCorner
+	{
+		size_t Vertex = 0;
+		size_t TexCoord = 0;
+		size_t Normal = 0;
+		bool bHasTexCoord = false;
+		bool bHasNormal = false;
+	};
+
+	// FObjImporter::ParseFaceBuffer와 같은 규칙으로 "v", "v/vt", "v//vn", "v/vt/vn" 해석
+	bool ParseFaceCorner(std::string_view Token, FFaceCorner& OutCorner)
+	{
+		// std::getline(..., '/')처럼 나눈다: 마지막 '/' 뒤의 빈 조각은 만들지 않는다
+		std::string_view Parts[3];
+		size_t NumParts = 0;
+		size_t Begin = 0;
+		while (Begin < Token.size())
+		{
+			const size_t Slash = Token.find('/', Begin);
+			const size_t PartEnd = Slash == std::string_view::npos ? Token.size() : Slash;
+			if (NumParts < 3)
+			{
+				Parts[NumParts] = Token.substr(Begin, PartEnd - Begin);
+			}
+			++NumParts;
+			Begin = Slash == std::string_view::npos ? Token.size() : Slash + 1;
+		}
+
+		if (NumParts == 0)
+		{
+			UE_LOG_ERROR("면 형식이 잘못되었습니다");
+			return false;
+		}
+
+		if (Parts[0].empty())
+		{
+			UE_LOG_ERROR("정점 위치 형식이 잘못되었습니다");
+			return false;
+		}
+
+		OutCorner = FFaceCorner();
+		if (!ParseIndex(Parts[0], OutCorner.Vertex))
+		{
+			UE_LOG_ERROR("정점 위치 인덱스 형식이 잘못되었습니다");
+			return false;
+		}
+
+		switch (NumParts)
+		{
+		case 1:
+			break;
+		case 2:
+			if (Parts[1].empty() || !ParseIndex(Parts[1], OutCorner.TexCoord))
+			{
+				UE_LOG_ERROR("정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다");
+				return false;
+			}
+			OutCorner.bHasTexCoord = true;
+			break;
+		case 3:
+			if (Parts[1].empty())
+			{
+				if (Parts[2].empty() || !ParseIndex(Parts[2], OutCorner.Normal))
+				{
+					UE_LOG_ERROR("정점 법선 인덱스 형식이 잘못되었습니다");
+					return false;
+				}
+				OutCorner.bHasNormal = true;
+			}
+			else
+			{
+				if (Parts[2].empty() || !ParseIndex(Parts[1], OutCorner.TexCoord) || !ParseIndex(Parts[2], OutCorner.Normal))
+				{
+					UE_LOG_ERROR("정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다");
+					return false;
+				}
+				OutCorner.bHasTexCoord = true;
+				OutCorner.bHasNormal = true;
+			}
+			break;
+		default:
+			// 조각이 4개 이상이면 기존 파서처럼 위치 인덱스만 사용
+			break;
+		}
+
+		return true;
+	}
+
+	void EmitFaceCorner(const FFaceCorner& Corner, FObjectInfo& OutObjectInfo)
+	{
+		OutObjectInfo.VertexIndexList.push_back(Corner.Vertex);
+		if (Corner.bHasTexCoord)
+		{
+			OutObjectInfo.TexCoordIndexList.push_back(Corner.TexCoord);
+		}
+		if (Corner.bHasNormal)
+		{
+			OutObjectInfo.NormalIndexList.push_back(Corner.Normal);
+		}
+	}
+}
 
 bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config)
 {
@@ -28,10 +212,17 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		if (BinTime >= ObjTime)
 		{
 			UE_LOG("바이너리 파일이 존재합니다: %s", BinFilePath.string().c_str());
-			FWindowsBinReader WindowsBinReader(BinFilePath);
-			WindowsBinReader << *OutObjInfo;
 
-			return true;
+			// 배열은 FArchive의 일괄 경로로 읽히므로 매핑된 파일에서 배열당 memcpy 한 번이다
+			FMappedBinReader BinReader(BinFilePath);
+			BinReader << *OutObjInfo;
+			if (!BinReader.IsError())
+			{
+				return true;
+			}
+
+			UE_LOG_WARNING("바이너리 파일이 손상되었습니다. 원본을 다시 파싱합니다: %s", BinFilePath.string().c_str());
+			*OutObjInfo = FObjInfo();
 		}
 		else
 		{
@@ -45,6 +236,26 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		return false;
 	}
 
+	const bool bParsed = Config.bUseMappedTokenizer
+		? ParseObjMapped(FilePath, OutObjInfo, Config)
+		: ParseObjStream(FilePath, OutObjInfo, Config);
+	if (!bParsed)
+	{
+		return false;
+	}
+
+	if (Config.bIsBinaryEnabled)
+	{
+		FBufferedBinWriter BinWriter(BinFilePath);
+		BinWriter << *OutObjInfo;
+		BinWriter.Flush();
+	}
+
+	return true;
+}
+
+bool FObjImporter::ParseObjStream(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config)
+{
 	std::ifstream File(FilePath);
 	if (!File)
 	{
@@ -278,12 +489,417 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
 	}
 
-	if (Config.bIsBinaryEnabled)
+	return true;
+}
+
+/**
+ * @brief 매핑된 파일의 한 구간(줄 경계로 자른 [Begin, End))을 파싱한 결과
+ * 구간끼리는 서로를 모르므로 오브젝트와 면 수는 구간 안 기준으로 기록하고, StitchObjChunks가 순서대로 이어 붙인다
+ * OBJ 인덱스는 파일 전체 기준 절대값이라 면 인덱스는 그대로 쓸 수 있다
+ */
+struct FObjImporter::FParseChunk
+{
+	// 'o'로 나뉘는 조각: 0번은 구간이 시작될 때의 오브젝트에 이어 붙고, 1번부터는 'o'가 새로 만든 오브젝트
+	struct FPiece
+	{
+		FObjectInfo Info;                   // 그룹/머티리얼 인덱스는 조각 안의 면 수 기준
+		size_t FaceCount = 0;
+		bool bNeedsObject = false;          // f/g/usemtl이 있어 (기본) 오브젝트가 필요함
+
+		// 이어 붙이기 결과: 현재 오브젝트에 이어 붙는 조각의 대상과 인덱스 목록 안의 시작 위치
+		bool bAppendsToObject = false;
+		size_t ObjectIndex = 0;
+		size_t VertexIndexOffset = 0;
+		size_t TexCoordIndexOffset = 0;
+		size_t NormalIndexOffset = 0;
+	};
+
+	const char* Begin = nullptr;
+	const char* End = nullptr;
+
+	TArray<FVector> VertexList;
+	TArray<FVector> NormalList;
+	TArray<FVector2> TexCoordList;
+	TArray<FPiece> Pieces;
+	TArray<std::string_view> MaterialLibraries;     // mtllib 파일 이름 (매핑된 버퍼를 가리킴)
+
+	// 이어 붙이기 결과: FObjInfo 정점 목록 안의 시작 위치
+	size_t VertexOffset = 0;
+	size_t NormalOffset = 0;
+	size_t TexCoordOffset = 0;
+
+	bool bParsed = false;
+};
+
+bool FObjImporter::ParseObjMapped(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config)
+{
+	FMappedFile File;
+	if (!File.Open(FilePath))
+	{
+		UE_LOG_ERROR("파일을 열지 못했습니다: %s", FilePath.string().c_str());
+		return false;
+	}
+
+	const char* FileBegin = File.GetData();
+	const char* FileEnd = FileBegin + File.GetSize();
+
+	// 작은 파일이나 워커가 없을 때는 구간 하나 (이어 붙이기에서 복사 없이 옮기기만 한다)
+	FTaskScheduler& Scheduler = FTaskScheduler::Get();
+	size_t NumChunks = 1;
+	if (Config.bIsParallelEnabled && Scheduler.GetConcurrency() > 1)
+	{
+		NumChunks = std::clamp<size_t>(File.GetSize() / ParallelChunkBytes, 1, Scheduler.GetConcurrency() * ChunksPerThread);
+	}
+
+	// 크기를 고르게 나눈 뒤 각 경계를 다음 줄 시작으로 민다 (줄이 긴 파일이면 빈 구간이 생길 수 있다)
+	TArray<FParseChunk> Chunks(NumChunks);
+	const char* ChunkBegin = FileBegin;
+	for (size_t i = 0; i < NumChunks; ++i)
+	{
+		const char* ChunkEnd = FileEnd;
+		if (i + 1 < NumChunks)
+		{
+			const char* Target = std::max(ChunkBegin, FileBegin + File.GetSize() * (i + 1) / NumChunks);
+			const char* LineEnd = Target < FileEnd ? static_cast<const char*>(memchr(Target, '\n', static_cast<size_t>(FileEnd - Target))) : nullptr;
+			ChunkEnd = LineEnd ? LineEnd + 1 : FileEnd;
+		}
+		Chunks[i].Begin = ChunkBegin;
+		Chunks[i].End = ChunkEnd;
+		ChunkBegin = ChunkEnd;
+	}
+
+	if (NumChunks == 1)
+	{
+		Chunks[0].bParsed = ParseObjChunk(Chunks[0], Config);
+	}
+	else
+	{
+		Scheduler.ParallelFor(static_cast<int64>(NumChunks), 1, [&Chunks, &Config](int64 Begin, int64 End)
+			{
+				for (int64 i = Begin; i < End; ++i)
+				{
+					Chunks[i].bParsed = ParseObjChunk(Chunks[i], Config);
+				}
+			});
+	}
+
+	for (const FParseChunk& Chunk : Chunks)
+	{
+		if (!Chunk.bParsed)
+		{
+			return false;
+		}
+	}
+
+	return StitchObjChunks(FilePath, Chunks, OutObjInfo, Config);
+}
+
+bool FObjImporter::ParseObjChunk(FParseChunk& Chunk, const Configuration& Config)
+{
+	Chunk.Pieces.emplace_back();
+
+	// 면 하나의 토큰/코너 (줄마다 비우고 할당은 재사용)
+	TArray<std::string_view> FaceTokens;
+	TArray<FFaceCorner> FaceCorners;
+
+	const char* Cursor = Chunk.Begin;
+	while (Cursor < Chunk.End)
+	{
+		const char* LineEnd = static_cast<const char*>(memchr(Cursor, '\n', static_cast<size_t>(Chunk.End - Cursor)));
+		if (!LineEnd)
+		{
+			LineEnd = Chunk.End;
+		}
+		const char* LineCursor = Cursor;
+		Cursor = LineEnd < Chunk.End ? LineEnd + 1 : Chunk.End;
+
+		const std::string_view Prefix = NextToken(LineCursor, LineEnd);
+		if (Prefix.empty())
+		{
+			continue;
+		}
+
+		// ========================== Vertex Information ============================ //
+
+		if (Prefix == "v")
+		{
+			FVector Position;
+			if (!ParseFloat(LineCursor, LineEnd, Position.X) || !ParseFloat(LineCursor, LineEnd, Position.Y) ||
+				!ParseFloat(LineCursor, LineEnd, Position.Z))
+			{
+				UE_LOG_ERROR("정점 위치 형식이 잘못되었습니다");
+				return false;
+			}
+			Chunk.VertexList.emplace_back(Config.bPositionToUEBasis ? PositionToUEBasis(Position) : Position);
+		}
+		else if (Prefix == "vn")
+		{
+			FVector Normal;
+			if (!ParseFloat(LineCursor, LineEnd, Normal.X) || !ParseFloat(LineCursor, LineEnd, Normal.Y) ||
+				!ParseFloat(LineCursor, LineEnd, Normal.Z))
+			{
+				UE_LOG_ERROR("정점 법선 형식이 잘못되었습니다");
+				return false;
+			}
+			Chunk.NormalList.emplace_back(Normal);
+		}
+		else if (Prefix == "vt")
+		{
+			/** @note: Ignore 3D Texture */
+			FVector2 TexCoord;
+			if (!ParseFloat(LineCursor, LineEnd, TexCoord.X) || !ParseFloat(LineCursor, LineEnd, TexCoord.Y))
+			{
+				UE_LOG_ERROR("정점 텍스쳐 좌표 형식이 잘못되었습니다");
+				return false;
+			}
+			Chunk.TexCoordList.emplace_back(Config.bUVToUEBasis ? UVToUEBasis(TexCoord) : TexCoord);
+		}
+
+		// ============================ Face Information ============================ //
+
+		else if (Prefix == "f")
+		{
+			FParseChunk::FPiece& Piece = Chunk.Pieces.back();
+			Piece.bNeedsObject = true;
+
+			FaceTokens.clear();
+			for (std::string_view Token = NextToken(LineCursor, LineEnd); !Token.empty(); Token = NextToken(LineCursor, LineEnd))
+			{
+				FaceTokens.push_back(Token);
+			}
+
+			if (FaceTokens.size() < 2)
+			{
+				UE_LOG_ERROR("면 형식이 잘못되었습니다");
+				return false;
+			}
+
+			// 삼각형이 하나도 없으면 기존 파서도 코너를 읽지 않는다
+			if (FaceTokens.size() < 3)
+			{
+				continue;
+			}
+
+			// 팬의 모든 삼각형이 코너를 공유하므로 코너마다 한 번만 해석
+			FaceCorners.resize(FaceTokens.size());
+			for (size_t i = 0; i < FaceTokens.size(); ++i)
+			{
+				if (!ParseFaceCorner(FaceTokens[i], FaceCorners[i]))
+				{
+					UE_LOG_ERROR("면 파싱에 실패했습니다");
+					return false;
+				}
+			}
+
+			/** @todo: 오목 다각형에 대한 지원 필요, 현재는 볼록 다각형만 지원 */
+			for (size_t i = 1; i + 1 < FaceCorners.size(); ++i)
+			{
+				EmitFaceCorner(FaceCorners[0], Piece.Info);
+				EmitFaceCorner(FaceCorners[Config.bFlipWindingOrder ? i + 1 : i], Piece.Info);
+				EmitFaceCorner(FaceCorners[Config.bFlipWindingOrder ? i : i + 1], Piece.Info);
+				++Piece.FaceCount;
+			}
+		}
+
+		// =========================== Group Information ============================ //
+
+		else if (Prefix == "o")
+		{
+			if (!Config.bIsObjectEnabled)
+			{
+				continue; // Ignore 'o' prefix
+			}
+
+			const std::string_view ObjectName = NextToken(LineCursor, LineEnd);
+			if (ObjectName.empty())
+			{
+				UE_LOG_ERROR("오브젝트 이름 형식이 잘못되었습니다");
+				return false;
+			}
+
+			FParseChunk::FPiece& Piece = Chunk.Pieces.emplace_back();
+			Piece.Info.Name = FString(ObjectName);
+		}
+		else if (Prefix == "g")
+		{
+			FParseChunk::FPiece& Piece = Chunk.Pieces.back();
+			Piece.bNeedsObject = true;
+
+			const std::string_view GroupName = NextToken(LineCursor, LineEnd);
+			if (GroupName.empty())
+			{
+				UE_LOG_ERROR("잘못된 그룹 이름 형식입니다");
+				return false;
+			}
+
+			Piece.Info.GroupNameList.emplace_back(GroupName);
+			Piece.Info.GroupIndexList.emplace_back(Piece.FaceCount);
+		}
+
+		// ============================ Material Information ============================ //
+
+		else if (Prefix == "mtllib")
+		{
+			// 머티리얼 파일은 이어 붙일 때 파일 순서대로 읽는다
+			Chunk.MaterialLibraries.push_back(NextToken(LineCursor, LineEnd));
+		}
+		else if (Prefix == "usemtl")
+		{
+			FParseChunk::FPiece& Piece = Chunk.Pieces.back();
+			Piece.bNeedsObject = true;
+
+			Piece.Info.MaterialNameList.emplace_back(NextToken(LineCursor, LineEnd));
+			Piece.Info.MaterialIndexList.emplace_back(Piece.FaceCount);
+		}
+	}
+
+	return true;
+}
+
+bool FObjImporter::StitchObjChunks(const std::filesystem::path& FilePath, TArray<FParseChunk>& Chunks, FObjInfo* OutObjInfo,
+	const Configuration& Config)
+{
+	// 머티리얼 라이브러리 (파일에 나온 순서대로)
+	for (const FParseChunk& Chunk : Chunks)
+	{
+		for (const std::string_view MaterialFileName : Chunk.MaterialLibraries)
+		{
+			std::filesystem::path MaterialFilePath = std::filesystem::weakly_canonical(FilePath.parent_path() / FString(MaterialFileName));
+			if (!LoadMaterial(MaterialFilePath, OutObjInfo))
+			{
+				UE_LOG_ERROR("머티리얼을 불러오는데 실패했습니다: %s", MaterialFilePath.string().c_str());
+				return false;
+			}
+		}
+	}
+
+	// 정점 목록: 구간별 시작 위치의 prefix sum
+	size_t NumVertices = OutObjInfo->VertexList.size();
+	size_t NumNormals = OutObjInfo->NormalList.size();
+	size_t NumTexCoords = OutObjInfo->TexCoordList.size();
+	for (FParseChunk& Chunk : Chunks)
 	{
-		FWindowsBinWriter WindowsBinWriter(BinFilePath);
-		WindowsBinWriter << *OutObjInfo;
+		Chunk.VertexOffset = NumVertices;
+		Chunk.NormalOffset = NumNormals;
+		Chunk.TexCoordOffset = NumTexCoords;
+		NumVertices += Chunk.VertexList.size();
+		NumNormals += Chunk.NormalList.size();
+		NumTexCoords += Chunk.TexCoordList.size();
 	}
 
+	// 오브젝트: 조각을 파일 순서대로 훑으며 직렬 파서의 현재 오브젝트와 면 수를 재현한다
+	// 오브젝트를 새로 시작하는 조각은 그대로 옮기고, 현재 오브젝트에 이어지는 조각은 인덱스 목록의 시작 위치만 정해 둔다
+	struct FIndexListSizes
+	{
+		size_t Vertex = 0;
+		size_t TexCoord = 0;
+		size_t Normal = 0;
+	};
+
+	TArray<FObjectInfo>& Objects = OutObjInfo->ObjectInfoList;
+	const size_t FirstObject = Objects.size();
+	TArray<FIndexListSizes> ObjectIndexListSizes;
+	bool bHasCurrentObject = false;
+	size_t CurrentFaceCount = 0;
+
+	for (FParseChunk& Chunk : Chunks)
+	{
+		for (size_t PieceIndex = 0; PieceIndex < Chunk.Pieces.size(); ++PieceIndex)
+		{
+			FParseChunk::FPiece& Piece = Chunk.Pieces[PieceIndex];
+			const bool bContinuesObject = PieceIndex == 0;
+			if (bContinuesObject && !Piece.bNeedsObject)
+			{
+				continue;
+			}
+
+			if (!bContinuesObject || !bHasCurrentObject)
+			{
+				if (bContinuesObject)
+				{
+					Piece.Info.Name = Config.DefaultName;
+				}
+				ObjectIndexListSizes.push_back({ Piece.Info.VertexIndexList.size(), Piece.Info.TexCoordIndexList.size(),
+					Piece.Info.NormalIndexList.size() });
+				Objects.emplace_back(std::move(Piece.Info));
+
+				bHasCurrentObject = true;
+				CurrentFaceCount = Piece.FaceCount;
+				continue;
+			}
+
+			FObjectInfo& Object = Objects.back();
+			FIndexListSizes& Sizes = ObjectIndexListSizes.back();
+
+			Piece.bAppendsToObject = true;
+			Piece.ObjectIndex = Objects.size() - 1;
+			Piece.VertexIndexOffset = Sizes.Vertex;
+			Piece.TexCoordIndexOffset = Sizes.TexCoord;
+			Piece.NormalIndexOffset = Sizes.Normal;
+			Sizes.Vertex += Piece.Info.VertexIndexList.size();
+			Sizes.TexCoord += Piece.Info.TexCoordIndexList.size();
+			Sizes.Normal += Piece.Info.NormalIndexList.size();
+
+			// 그룹/머티리얼 시작 면은 지금까지 오브젝트에 쌓인 면 수만큼 민다 (개수가 적어 직렬로 처리)
+			for (size_t i = 0; i < Piece.Info.GroupNameList.size(); ++i)
+			{
+				Object.GroupNameList.emplace_back(std::move(Piece.Info.GroupNameList[i]));
+				Object.GroupIndexList.emplace_back(Piece.Info.GroupIndexList[i] + CurrentFaceCount);
+			}
+			for (size_t i = 0; i < Piece.Info.MaterialNameList.size(); ++i)
+			{
+				Object.MaterialNameList.emplace_back(std::move(Piece.Info.MaterialNameList[i]));
+				Object.MaterialIndexList.emplace_back(Piece.Info.MaterialIndexList[i] + CurrentFaceCount);
+			}
+
+			CurrentFaceCount += Piece.FaceCount;
+		}
+	}
+
+	// 구간이 하나면 이어지는 조각이 없으므로 정점 목록만 옮기면 끝
+	if (Chunks.size() == 1 && OutObjInfo->VertexList.empty() && OutObjInfo->NormalList.empty() && OutObjInfo->TexCoordList.empty())
+	{
+		OutObjInfo->VertexList = std::move(Chunks[0].VertexList);
+		OutObjInfo->NormalList = std::move(Chunks[0].NormalList);
+		OutObjInfo->TexCoordList = std::move(Chunks[0].TexCoordList);
+		return true;
+	}
+
+	OutObjInfo->VertexList.resize(NumVertices);
+	OutObjInfo->NormalList.resize(NumNormals);
+	OutObjInfo->TexCoordList.resize(NumTexCoords);
+	for (size_t i = 0; i < ObjectIndexListSizes.size(); ++i)
+	{
+		FObjectInfo& Object = Objects[FirstObject + i];
+		Object.VertexIndexList.resize(ObjectIndexListSizes[i].Vertex);
+		Object.TexCoordIndexList.resize(ObjectIndexListSizes[i].TexCoord);
+		Object.NormalIndexList.resize(ObjectIndexListSizes[i].Normal);
+	}
+
+	// 정해진 위치로 구간마다 병렬 복사
+	FTaskScheduler::Get().ParallelFor(static_cast<int64>(Chunks.size()), 1, [&Chunks, OutObjInfo](int64 Begin, int64 End)
+		{
+			for (int64 ChunkIndex = Begin; ChunkIndex < End; ++ChunkIndex)
+			{
+				const FParseChunk& Chunk = Chunks[ChunkIndex];
+				std::copy(Chunk.VertexList.begin(), Chunk.VertexList.end(), OutObjInfo->VertexList.begin() + Chunk.VertexOffset);
+				std::copy(Chunk.NormalList.begin(), Chunk.NormalList.end(), OutObjInfo->NormalList.begin() + Chunk.NormalOffset);
+				std::copy(Chunk.TexCoordList.begin(), Chunk.TexCoordList.end(), OutObjInfo->TexCoordList.begin() + Chunk.TexCoordOffset);
+
+				const FParseChunk::FPiece& Piece = Chunk.Pieces[0];
+				if (Piece.bAppendsToObject)
+				{
+					FObjectInfo& Object = OutObjInfo->ObjectInfoList[Piece.ObjectIndex];
+					std::copy(Piece.Info.VertexIndexList.begin(), Piece.Info.VertexIndexList.end(),
+						Object.VertexIndexList.begin() + Piece.VertexIndexOffset);
+					std::copy(Piece.Info.TexCoordIndexList.begin(), Piece.Info.TexCoordIndexList.end(),
+						Object.TexCoordIndexList.begin() + Piece.TexCoordIndexOffset);
+					std::copy(Piece.Info.NormalIndexList.begin(), Piece.Info.NormalIndexList.end(),
+						Object.NormalIndexList.begin() + Piece.NormalIndexOffset);
+				}
+			}
+		});
+
 	return true;
 }
 
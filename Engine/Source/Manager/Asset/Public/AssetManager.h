@@ -5,6 +5,24 @@
 #include "Utility/Public/StaticMeshBVH.h"
 
 struct FAABB;
+class FTaskScheduler;
+class FTaskGroup;
+struct FStaticMeshLoadJob;
+
+/**
+ * @brief 시작 시 스태틱 메시 비동기 로딩 진행 상황
+ * 워커에서 임포트/LOD/BVH가 끝나면 Loaded, 메인 스레드에서 GPU 버퍼까지 만들어 사용 가능해지면 Registered
+ */
+struct FStaticMeshLoadProgress
+{
+	uint32 NumTotal = 0;
+	uint32 NumLoaded = 0;
+	uint32 NumRegistered = 0;
+	uint32 NumFailed = 0;
+
+	bool IsComplete() const { return NumRegistered + NumFailed >= NumTotal; }
+	float GetRatio() const { return NumTotal > 0 ? static_cast<float>(NumRegistered + NumFailed) / static_cast<float>(NumTotal) : 1.0f; }
+};
 
 /**
  * @brief 전역의 On-Memory Asset을 관리하는 매니저 클래스
@@ -49,8 +67,17 @@ public:
 	const FStaticMeshBVH* GetStaticMeshBVH(const FName& InFilePath) const;
 	const FStaticMeshBVH* GetStaticMeshBVH(const UStaticMesh* InStaticMesh) const;
 
-	ID3D11Buffer* CreateVertexBuffer(TArray<FNormalVertex> InVertices);
-	ID3D11Buffer* CreateIndexBuffer(TArray<uint32> InIndices);
+	// StaticMesh 비동기 로딩 (LoadAllObjStaticMesh는 작업만 띄우고 바로 반환)
+	void UpdateStaticMeshLoading();
+	void FlushStaticMeshLoading();
+	bool IsStaticMeshLoading(const FName& InFilePath) const;
+	FStaticMeshLoadProgress GetStaticMeshLoadProgress() const;
+
+	// 로딩이 끝나기 전까지 컴포넌트가 대신 그리는 큐브 메시의 키
+	static const FName& GetPlaceholderStaticMeshPath();
+
+	ID3D11Buffer* CreateVertexBuffer(const TArray<FNormalVertex>& InVertices);
+	ID3D11Buffer* CreateIndexBuffer(const TArray<uint32>& InIndices);
 	const TArray<ID3D11Buffer*>* GetVertexBuffers(FName InObjPath) const;
 	const TArray<ID3D11Buffer*>* GetIndexBuffers(FName InObjPath) const;
 
@@ -89,11 +116,25 @@ private:
 	TMap<FName, TArray<ID3D11Buffer*>> StaticMeshVertexBuffers;
 	TMap<FName, TArray<ID3D11Buffer*>> StaticMeshIndexBuffers;
 
+	// StaticMesh 비동기 로딩 상태 (작업 정의는 AssetManager.cpp)
+	TUniquePtr<FTaskScheduler> StaticMeshLoadScheduler;
+	TUniquePtr<FTaskGroup> StaticMeshLoadGroup;
+	TArray<TUniquePtr<FStaticMeshLoadJob>> StaticMeshLoadJobs;
+	TMap<FName, FStaticMeshLoadJob*> StaticMeshLoadJobMap;
+	uint64 StaticMeshLoadStartCycles = 0;
+	bool bIsLoadingStaticMeshes = false;
+
 	// Release Functions
 	void ReleaseAllTextures();
+	void ReleaseStaticMeshLoadJobs();
 
 	// Helper Functions
 	FAABB CalculateAABB(const TArray<FNormalVertex>& Vertices);
+	void CreatePlaceholderStaticMesh();
+	void ProcessCompletedStaticMeshLoads(double InBudgetMs);
+	void RegisterLoadedStaticMesh(FStaticMeshLoadJob& InJob);
+	void RefreshPendingStaticMeshComponents(const TSet<FName>& InRegisteredPaths) const;
+	void LogStaticMeshLoadSummary();
 
 	// AABB Resource
 	TMap<EPrimitiveType, FAABB> AABBs;		// 각 타입별 AABB 저장
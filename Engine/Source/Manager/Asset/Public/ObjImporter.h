@@ -157,6 +157,10 @@ struct FObjImporter
 		bool bFlipWindingOrder = false;
 		bool bPositionToUEBasis = false;
 		bool bUVToUEBasis = false;
+		/** 파일을 메모리 매핑하고 할당 없는 토크나이저로 파싱 (false면 getline + istringstream 경로, 결과는 같다) */
+		bool bUseMappedTokenizer = true;
+		/** 큰 파일을 줄 경계 구간으로 나눠 워커 스레드에서 파싱 후 이어 붙임 (매핑 경로 전용, 결과는 직렬과 같다) */
+		bool bIsParallelEnabled = true;
 		// ...
 	};
 
@@ -178,6 +182,29 @@ struct FObjImporter
 	static bool LoadMaterial(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo);
 
 private:
+	/** @brief Parses the .obj text line by line with std::getline and std::istringstream. */
+	static bool ParseObjStream(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config);
+
+	/**
+	 * @brief Parses a memory-mapped .obj file with a hand-written tokenizer and std::from_chars.
+	 * Produces exactly the same FObjInfo as ParseObjStream without per-line heap allocations.
+	 * Large files are split into newline-aligned chunks that are parsed in parallel when Config.bIsParallelEnabled is set.
+	 */
+	static bool ParseObjMapped(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config);
+
+	/** @brief Parse result of one newline-aligned range of the mapped file (defined in ObjImporter.cpp). */
+	struct FParseChunk;
+
+	/** @brief Parses [Chunk.Begin, Chunk.End) with object and face counts relative to the start of the range. */
+	static bool ParseObjChunk(FParseChunk& Chunk, const Configuration& Config);
+
+	/**
+	 * @brief Concatenates chunk results in file order into OutObjInfo.
+	 * Vertex and index list offsets are prefix sums over the chunks; group/material face indices are rebased on the running face count.
+	 */
+	static bool StitchObjChunks(const std::filesystem::path& FilePath, TArray<FParseChunk>& Chunks, FObjInfo* OutObjInfo,
+		const Configuration& Config);
+
 	/**
 	 * @brief Parses a single face component string (e.g., "v/vt/vn").
 	 * @param FaceBuffer The string chunk representing one vertex of a face.
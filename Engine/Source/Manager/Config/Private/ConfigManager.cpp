@@ -13,6 +13,7 @@ UConfigManager::UConfigManager()
 	, bLODEnabled(true)
 	, LODDistance0(10.0f)
 	, LODDistance1(80.0f)
+	, bQuantizeStaticMeshVertices(false)
 {
 	LoadEditorSetting();
 }
@@ -53,6 +54,7 @@ void UConfigManager::LoadEditorSetting()
 			else if (Key == "LODEnabled") bLODEnabled = (Value == "true" || Value == "1");
 			else if (Key == "LODDistance0") LODDistance0 = std::stof(Value);
 			else if (Key == "LODDistance1") LODDistance1 = std::stof(Value);
+			else if (Key == "QuantizeStaticMeshVertices") bQuantizeStaticMeshVertices = (Value == "true" || Value == "1");
 		}
 		catch (const std::exception&) {}
 	}
@@ -74,6 +76,7 @@ void UConfigManager::SaveEditorSetting()
 		Ofs << "LODEnabled=" << (bLODEnabled ? "true" : "false") << "\n";
 		Ofs << "LODDistance0=" << LODDistance0 << "\n";
 		Ofs << "LODDistance1=" << LODDistance1 << "\n";
+		Ofs << "QuantizeStaticMeshVertices=" << (bQuantizeStaticMeshVertices ? "true" : "false") << "\n";
 	}
 }
 
@@ -175,6 +178,8 @@ bool UConfigManager::GetConfigValueBool(const FString& Key, bool DefaultValue)
 {
 	if (Key == "LODEnabled")
 		return bLODEnabled;
+	else if (Key == "QuantizeStaticMeshVertices")
+		return bQuantizeStaticMeshVertices;
 
 	return DefaultValue;
 }
@@ -128,6 +128,9 @@ private:
 	float LODDistance0;
 	float LODDistance1;
 
+	// 스태틱 메시 정점을 16바이트 형식으로 양자화해 쿠킹할지 (정밀도가 떨어지므로 기본은 끔)
+	bool bQuantizeStaticMeshVertices;
+
 	// Json으로 Level에 같이 저장
 	FViewportCameraData ViewportCameraSettings[4];
 };
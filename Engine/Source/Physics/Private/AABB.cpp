@@ -19,3 +19,38 @@ bool FAABB::Intersects(const FAABB& Other) const
 		Min.Y <= Other.Max.Y && Max.Y >= Other.Min.Y &&
 		Min.Z <= Other.Max.Z && Max.Z >= Other.Min.Z;
 }
+
+void FBoundsSoA::Resize(size_t InSize)
+{
+	MinX.resize(InSize); MinY.resize(InSize); MinZ.resize(InSize);
+	MaxX.resize(InSize); MaxY.resize(InSize); MaxZ.resize(InSize);
+}
+
+void FBoundsSoA::Clear()
+{
+	MinX.clear(); MinY.clear(); MinZ.clear();
+	MaxX.clear(); MaxY.clear(); MaxZ.clear();
+}
+
+void FBoundsSoA::Add(const FAABB& Bounds)
+{
+	MinX.push_back(Bounds.Min.X); MinY.push_back(Bounds.Min.Y); MinZ.push_back(Bounds.Min.Z);
+	MaxX.push_back(Bounds.Max.X); MaxY.push_back(Bounds.Max.Y); MaxZ.push_back(Bounds.Max.Z);
+}
+
+void FBoundsSoA::Set(int32 Index, const FAABB& Bounds)
+{
+	MinX[Index] = Bounds.Min.X; MinY[Index] = Bounds.Min.Y; MinZ[Index] = Bounds.Min.Z;
+	MaxX[Index] = Bounds.Max.X; MaxY[Index] = Bounds.Max.Y; MaxZ[Index] = Bounds.Max.Z;
+}
+
+FAABB FBoundsSoA::Get(int32 Index) const
+{
+	return FAABB(FVector(MinX[Index], MinY[Index], MinZ[Index]), FVector(MaxX[Index], MaxY[Index], MaxZ[Index]));
+}
+
+void FBoundsSoA::Copy(int32 ToIndex, int32 FromIndex)
+{
+	MinX[ToIndex] = MinX[FromIndex]; MinY[ToIndex] = MinY[FromIndex]; MinZ[ToIndex] = MinZ[FromIndex];
+	MaxX[ToIndex] = MaxX[FromIndex]; MaxY[ToIndex] = MaxY[FromIndex]; MaxZ[ToIndex] = MaxZ[FromIndex];
+}
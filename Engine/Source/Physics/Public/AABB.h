@@ -16,3 +16,18 @@ struct FAABB : public IBoundingVolume
 	bool Contains(const FAABB& Other) const;
 	bool Intersects(const FAABB& Other) const;
 };
+
+// 축별 SoA AABB 배열 (SIMD로 4/8개씩 읽기 위한 레이아웃)
+struct FBoundsSoA
+{
+	TArray<float> MinX, MinY, MinZ;
+	TArray<float> MaxX, MaxY, MaxZ;
+
+	void Resize(size_t InSize);
+	void Clear();
+	void Add(const FAABB& Bounds);
+	void Set(int32 Index, const FAABB& Bounds);
+	FAABB Get(int32 Index) const;
+	void Copy(int32 ToIndex, int32 FromIndex);
+	size_t Num() const { return MinX.size(); }
+};
@@ -20,8 +20,9 @@ void UCullingManager::Initialize(UDeviceResources* InDeviceResources)
 	// Occlusion Culler 초기화 (Device Resources 필요)
 	OcclusionCuller->Initialize(InDeviceResources);
 
-	// LOD 설정 로드
+	// LOD / 오클루전 설정 로드
 	LODManager->LoadSettings();
+	OcclusionCuller->LoadSettings();
 
 }
 
@@ -50,4 +51,8 @@ void UCullingManager::LoadSettings()
 	{
 		LODManager->LoadSettings();
 	}
+	if (OcclusionCuller)
+	{
+		OcclusionCuller->LoadSettings();
+	}
 }
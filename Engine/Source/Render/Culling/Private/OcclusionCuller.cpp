@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "Render/Culling/Public/OcclusionCuller.h"
+#include "Render/Culling/Public/SoftwareOcclusion.h"
 #include "Render/Renderer/Public/DeviceResources.h"
 #include "Editor/Public/Camera.h"
+#include "Manager/Config/Public/ConfigManager.h"
 #include <d3dcompiler.h>
 #include <immintrin.h>
 
@@ -27,6 +29,12 @@ void UOcclusionCuller::Initialize(UDeviceResources* InDeviceResources)
 	OnResize();
 }
 
+void UOcclusionCuller::LoadSettings()
+{
+	UConfigManager& ConfigManager = UConfigManager::GetInstance();
+	OcclusionMode = ConfigManager.GetConfigValueBool("SoftwareOcclusion", false) ? EOcclusionMode::CPU : EOcclusionMode::GPU;
+}
+
 void UOcclusionCuller::Release()
 {
 	ReleaseResources();
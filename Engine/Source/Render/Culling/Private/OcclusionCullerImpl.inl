@@ -346,6 +346,58 @@ void UOcclusionCuller::CacheHZBForOcclusion() const
 	}
 }
 
+void UOcclusionCuller::CacheHZBFromSoftwareBuffer(const FSoftwareOcclusionBuffer& InBuffer) const
+{
+	constexpr int32 SourceLevel = 3;
+	const uint32 SourceWidth = InBuffer.GetLevelWidth(SourceLevel);
+	const uint32 SourceHeight = InBuffer.GetLevelHeight(SourceLevel);
+	if (SourceWidth == 0 || SourceHeight == 0)
+	{
+		bHZBCacheValid = false;
+		return;
+	}
+
+	// ProjectAABBToScreen이 뷰포트 픽셀 좌표를 쓰므로 캐시도 뷰포트의 1/8 크기로 맞춘다
+	float ViewportWidth = static_cast<float>(InBuffer.GetWidth());
+	float ViewportHeight = static_cast<float>(InBuffer.GetHeight());
+	if (DeviceResources)
+	{
+		const D3D11_VIEWPORT& viewport = DeviceResources->GetViewportInfo();
+		ViewportWidth = viewport.Width;
+		ViewportHeight = viewport.Height;
+	}
+	CachedHZBWidth = std::max(1u, static_cast<uint32>(ViewportWidth) / 8);
+	CachedHZBHeight = std::max(1u, static_cast<uint32>(ViewportHeight) / 8);
+	CachedHZBLevel3.resize(CachedHZBWidth * CachedHZBHeight);
+
+	// 캐시 텍셀 하나가 덮는 소스 텍셀 범위의 최대값
+	const TArray<float>& Source = InBuffer.GetLevel(SourceLevel);
+	const float ScaleX = static_cast<float>(SourceWidth) / static_cast<float>(CachedHZBWidth);
+	const float ScaleY = static_cast<float>(SourceHeight) / static_cast<float>(CachedHZBHeight);
+	for (uint32 y = 0; y < CachedHZBHeight; ++y)
+	{
+		const uint32 y0 = std::min(SourceHeight - 1, static_cast<uint32>(y * ScaleY));
+		const uint32 y1 = std::max(y0 + 1, std::min(SourceHeight, static_cast<uint32>(std::ceil((y + 1) * ScaleY))));
+		for (uint32 x = 0; x < CachedHZBWidth; ++x)
+		{
+			const uint32 x0 = std::min(SourceWidth - 1, static_cast<uint32>(x * ScaleX));
+			const uint32 x1 = std::max(x0 + 1, std::min(SourceWidth, static_cast<uint32>(std::ceil((x + 1) * ScaleX))));
+
+			float maxDepth = 0.0f;
+			for (uint32 sy = y0; sy < y1; ++sy)
+			{
+				for (uint32 sx = x0; sx < x1; ++sx)
+				{
+					maxDepth = std::max(maxDepth, Source[sy * SourceWidth + sx]);
+				}
+			}
+			CachedHZBLevel3[y * CachedHZBWidth + x] = maxDepth;
+		}
+	}
+
+	bHZBCacheValid = true;
+}
+
 void UOcclusionCuller::ReleaseCachedHZB() const
 {
 	CachedHZBLevel3.clear();
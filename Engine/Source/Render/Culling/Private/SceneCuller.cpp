@@ -0,0 +1,443 @@
+#include "pch.h"
+#include "Render/Culling/Public/SceneCuller.h"
+#include "Render/Culling/Public/SoftwareOcclusion.h"
+#include "Utility/Public/TaskScheduler.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/PrimitiveBoundsTable.h"
+#include "Component/Public/TransformHierarchy.h"
+#include "Component/Public/BillboardComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+
+#include <algorithm>
+
+namespace
+{
+	// 옥트리를 동시 실행 수의 몇 배로 나눌지 (서브트리 크기가 제각각이라 잘게 쪼개 work-stealing에 맡긴다)
+	constexpr int32 SubtreesPerThread = 4;
+
+	// 동적 프리미티브 작업 하나가 맡는 개수 (8의 배수)
+	constexpr int32 DynamicChunkSize = 2048;
+
+	// 오클루더 선택 기준: 화면의 이 비율 이상을 덮는 정적 메시 중 큰 것부터 최대 개수/삼각형 예산까지
+	constexpr float MinOccluderCoverage = 0.01f;
+	constexpr int32 MaxOccluders = 32;
+	constexpr uint32 MaxOccluderTriangles = 32 * 1024;
+
+	// 16바이트 정렬 아래 비트는 버리고 28비트만 키에 사용 (겹쳐도 묶음이 조금 나빠질 뿐 그려지는 결과는 같다)
+	uint64 PointerBits(const void* Pointer)
+	{
+		return (reinterpret_cast<uintptr_t>(Pointer) >> 4) & ((1ull << 28) - 1);
+	}
+
+	// 오클루더로 쓸 가장 낮은 LOD (메시 데이터가 없으면 nullptr)
+	const FStaticMesh* GetOccluderMesh(UPrimitiveComponent* Primitive)
+	{
+		if (Primitive->GetPrimitiveType() != EPrimitiveType::StaticMesh)
+		{
+			return nullptr;
+		}
+
+		UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive);
+		UStaticMesh* StaticMesh = MeshComponent ? MeshComponent->GetStaticMesh() : nullptr;
+		if (!StaticMesh || StaticMesh->GetNumLODs() == 0)
+		{
+			return nullptr;
+		}
+
+		const FStaticMesh* LOD = StaticMesh->GetLOD(StaticMesh->GetNumLODs() - 1);
+		return (LOD && !LOD->Vertices.empty() && LOD->Indices.size() >= 3) ? LOD : nullptr;
+	}
+
+	void AddVisible(TArray<FVisiblePrimitive>& OutPrimitives, UPrimitiveComponent* Primitive)
+	{
+		OutPrimitives.push_back({ FSceneCuller::MakeSortKey(Primitive), Primitive });
+	}
+
+	void CullDynamicRange(const FFrustum& Frustum, const FDynamicPrimitiveSet& Dynamics, int32 Begin, int32 End,
+		TArray<FVisiblePrimitive>& OutPrimitives)
+	{
+		const FBoundsSoA& Bounds = Dynamics.Bounds;
+		for (int32 i = Begin; i < End; i += 8)
+		{
+			uint32 Mask = Frustum.AreBoxesInFrustum8(&Bounds.MinX[i], &Bounds.MinY[i], &Bounds.MinZ[i],
+				&Bounds.MaxX[i], &Bounds.MaxY[i], &Bounds.MaxZ[i]);
+			const int32 Remaining = End - i;
+			if (Remaining < 8)
+			{
+				Mask &= (1u << Remaining) - 1u;
+			}
+
+			while (Mask)
+			{
+				const int32 Lane = std::countr_zero(Mask);
+				Mask &= Mask - 1;
+				OutPrimitives.push_back({ Dynamics.SortKeys[i + Lane], Dynamics.Primitives[i + Lane] });
+			}
+		}
+	}
+
+	/**
+	 * @brief 정렬된 구간들([Runs[k], Runs[k + 1]))을 두 개씩 병렬로 병합해 하나가 될 때까지 반복
+	 * 결과는 InOutData에 남고 InOutScratch는 같은 크기의 임시 배열로 쓰인다
+	 */
+	void MergeSortedRuns(TArray<FVisiblePrimitive>& InOutData, TArray<FVisiblePrimitive>& InOutScratch, TArray<size_t>& Runs,
+		FTaskScheduler& Scheduler)
+	{
+		// 구간 경계마다 순서가 맞으면 이어 붙인 것만으로 이미 정렬된 상태 (키 종류가 적은 씬에서 흔함)
+		bool bAlreadySorted = true;
+		for (size_t i = 1; i + 1 < Runs.size() && bAlreadySorted; ++i)
+		{
+			bAlreadySorted = !(InOutData[Runs[i]] < InOutData[Runs[i] - 1]);
+		}
+		if (bAlreadySorted)
+		{
+			return;
+		}
+
+		InOutScratch.resize(InOutData.size());
+		while (Runs.size() > 2)
+		{
+			const int64 NumRuns = static_cast<int64>(Runs.size()) - 1;
+			const int64 NumPairs = (NumRuns + 1) / 2;
+			Scheduler.ParallelFor(NumPairs, 1, [&](int64 Begin, int64 End)
+				{
+					for (int64 Pair = Begin; Pair < End; ++Pair)
+					{
+						const size_t Lo = Runs[Pair * 2];
+						const size_t Mid = Runs[std::min(Pair * 2 + 1, NumRuns)];
+						const size_t Hi = Runs[std::min(Pair * 2 + 2, NumRuns)];
+						std::merge(InOutData.begin() + Lo, InOutData.begin() + Mid, InOutData.begin() + Mid, InOutData.begin() + Hi,
+							InOutScratch.begin() + Lo);
+					}
+				});
+			InOutData.swap(InOutScratch);
+
+			// 짝수 번째 경계만 남긴다
+			size_t NumBounds = 0;
+			for (size_t i = 0; i < Runs.size(); i += 2)
+			{
+				Runs[NumBounds++] = Runs[i];
+			}
+			if (Runs[NumBounds - 1] != Runs.back())
+			{
+				Runs[NumBounds++] = Runs.back();
+			}
+			Runs.resize(NumBounds);
+		}
+	}
+}
+
+void FVisibleList::Reset()
+{
+	Primitives.clear();
+	NumStatic = 0;
+	NumDynamic = 0;
+	NumOccluded = 0;
+}
+
+void FDynamicPrimitiveSet::Reset()
+{
+	Primitives.clear();
+	SortKeys.clear();
+	Bounds.Clear();
+}
+
+void FDynamicPrimitiveSet::Build(const TArray<UPrimitiveComponent*>& InPrimitives)
+{
+	Reset();
+	Primitives.reserve(InPrimitives.size());
+	SortKeys.reserve(InPrimitives.size());
+
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		// 삭제 중이거나 숨겨진 컴포넌트는 컬링 대상에서 제외
+		if (!Primitive || Primitive->IsPendingKill() || !Primitive->IsVisible())
+		{
+			continue;
+		}
+
+		FVector WorldMin, WorldMax;
+		Primitive->GetWorldAABB(WorldMin, WorldMax);
+		Add(Primitive, FAABB(WorldMin, WorldMax));
+	}
+}
+
+void FDynamicPrimitiveSet::Add(UPrimitiveComponent* Primitive, const FAABB& WorldBounds)
+{
+	const int32 Index = Num();
+	Primitives.push_back(Primitive);
+	SortKeys.push_back(FSceneCuller::MakeSortKey(Primitive));
+	if (Bounds.Num() < Primitives.size())
+	{
+		Bounds.Resize(Bounds.Num() + 8);
+	}
+	Bounds.Set(Index, WorldBounds);
+}
+
+uint64 FSceneCuller::MakeSortKey(UPrimitiveComponent* Primitive)
+{
+	const void* Mesh = Primitive->GetVertexBuffer();
+	const void* Material = nullptr;
+
+	switch (Primitive->GetPrimitiveType())
+	{
+	case EPrimitiveType::StaticMesh:
+		if (UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive))
+		{
+			Mesh = MeshComponent->GetStaticMesh();
+			Material = MeshComponent->GetMaterial(0);
+		}
+		break;
+	case EPrimitiveType::Billboard:
+		if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(Primitive))
+		{
+			Material = BillboardComponent->GetSprite();
+		}
+		break;
+	default:
+		break;
+	}
+
+	return (static_cast<uint64>(Primitive->GetPrimitiveType()) << 56) | (PointerBits(Mesh) << 28) | PointerBits(Material);
+}
+
+void FSceneCuller::CullView(const FViewCullRequest& Request, FTaskScheduler* InScheduler)
+{
+	FTaskScheduler& Scheduler = InScheduler ? *InScheduler : FTaskScheduler::Get();
+	FVisibleList& OutList = *Request.OutList;
+	OutList.Reset();
+
+	// 1. 옥트리 상단을 펼쳐 서브트리 작업 목록을 만든다 (펼친 노드의 오브젝트는 이 스레드에서 바로 모음)
+	TArray<FOctree::FFrustumSubtree> Subtrees;
+	TArray<UPrimitiveComponent*> TopObjects;
+	if (Request.StaticOctree)
+	{
+		const int32 MinSubtrees = static_cast<int32>(Scheduler.GetConcurrency()) * SubtreesPerThread;
+		Request.StaticOctree->SplitFrustumQuery(Request.Frustum, MinSubtrees, Subtrees, TopObjects);
+	}
+
+	// 작업 배치: [0] 펼친 노드의 오브젝트, [1, 1 + 서브트리 수) 옥트리 서브트리, 나머지는 동적 프리미티브 구간
+	const int32 NumDynamics = Request.DynamicPrimitives ? Request.DynamicPrimitives->Num() : 0;
+	const int32 NumSubtrees = static_cast<int32>(Subtrees.size());
+	const int32 FirstDynamicTask = 1 + NumSubtrees;
+	const int32 NumTasks = FirstDynamicTask + (NumDynamics + DynamicChunkSize - 1) / DynamicChunkSize;
+
+	if (OutList.TaskResults.size() < static_cast<size_t>(NumTasks))
+	{
+		OutList.TaskResults.resize(NumTasks);
+	}
+
+	// 2. 작업마다 자기 버퍼에 보이는 프리미티브를 모으고 정렬까지 끝낸다
+	Scheduler.ParallelFor(NumTasks, 1, [&](int64 Begin, int64 End)
+		{
+			for (int64 Task = Begin; Task < End; ++Task)
+			{
+				TArray<FVisiblePrimitive>& Result = OutList.TaskResults[Task];
+				Result.clear();
+
+				if (Task == 0)
+				{
+					for (UPrimitiveComponent* Primitive : TopObjects)
+					{
+						if (Primitive && Primitive->IsVisible())
+						{
+							AddVisible(Result, Primitive);
+						}
+					}
+				}
+				else if (Task < FirstDynamicTask)
+				{
+					Request.StaticOctree->ForEachInFrustumSubtree(Request.Frustum, Subtrees[Task - 1], [&](UPrimitiveComponent* Primitive)
+						{
+							if (Primitive && Primitive->IsVisible())
+							{
+								AddVisible(Result, Primitive);
+							}
+						});
+				}
+				else
+				{
+					const int32 ChunkBegin = static_cast<int32>(Task - FirstDynamicTask) * DynamicChunkSize;
+					const int32 ChunkEnd = std::min(ChunkBegin + DynamicChunkSize, NumDynamics);
+					CullDynamicRange(Request.Frustum, *Request.DynamicPrimitives, ChunkBegin, ChunkEnd, Result);
+				}
+
+				// 한 종류의 메시만 있는 등 이미 정렬된 경우가 흔하므로 먼저 확인
+				if (!std::is_sorted(Result.begin(), Result.end()))
+				{
+					std::sort(Result.begin(), Result.end());
+				}
+			}
+		});
+
+	// 3. 작업 결과를 이어 붙이고 정렬된 구간끼리 병합
+	TArray<size_t> Runs;
+	Runs.push_back(0);
+	size_t Total = 0;
+	for (int32 Task = 0; Task < NumTasks; ++Task)
+	{
+		const size_t Count = OutList.TaskResults[Task].size();
+		if (Task < FirstDynamicTask)
+		{
+			OutList.NumStatic += static_cast<uint32>(Count);
+		}
+		else
+		{
+			OutList.NumDynamic += static_cast<uint32>(Count);
+		}
+		if (Count > 0)
+		{
+			Total += Count;
+			Runs.push_back(Total);
+		}
+	}
+
+	OutList.Primitives.resize(Total);
+	Scheduler.ParallelFor(NumTasks, 1, [&](int64 Begin, int64 End)
+		{
+			size_t Offset = 0;
+			for (int64 Task = 0; Task < Begin; ++Task)
+			{
+				Offset += OutList.TaskResults[Task].size();
+			}
+			for (int64 Task = Begin; Task < End; ++Task)
+			{
+				const TArray<FVisiblePrimitive>& Result = OutList.TaskResults[Task];
+				std::copy(Result.begin(), Result.end(), OutList.Primitives.begin() + Offset);
+				Offset += Result.size();
+			}
+		});
+
+	MergeSortedRuns(OutList.Primitives, OutList.MergeScratch, Runs, Scheduler);
+
+	// 4. CPU 오클루전 (선택)
+	if (Request.OcclusionBuffer)
+	{
+		ApplyOcclusion(Request, Scheduler);
+	}
+}
+
+void FSceneCuller::ApplyOcclusion(const FViewCullRequest& Request, FTaskScheduler& Scheduler)
+{
+	FVisibleList& OutList = *Request.OutList;
+	FSoftwareOcclusionBuffer& Buffer = *Request.OcclusionBuffer;
+	Buffer.BeginFrame(Request.ViewProjection);
+
+	// 이 함수는 워커 스레드에서도 실행되므로 월드 변환은 계산 없이 읽기만 한다
+	// 더티 노드가 남아 있으면 GetWorldTransform이 공유 버퍼를 쓰며 계산하므로, 호출 순서가 바뀌면 여기서 바로 드러나게 한다
+	assert("UpdateTransforms must run before culling" && FTransformHierarchy::Get().IsClean());
+
+	const int64 NumPrimitives = static_cast<int64>(OutList.Primitives.size());
+	OutList.OcclusionBounds.resize(NumPrimitives);
+	OutList.OcclusionCoverage.resize(NumPrimitives);
+	OutList.OccludedFlags.resize(NumPrimitives);
+
+	// 1. 월드 AABB와 오클루더 후보의 화면 점유율 계산 (AABB를 구할 수 없으면 Min > Max로 표시해 항상 보이게 둔다)
+	// 월드 AABB는 컬링 전에 일괄 갱신된 표에서 읽기만 하므로 워커 스레드에서 읽어도 된다
+	const FPrimitiveBoundsTable& BoundsTable = FPrimitiveBoundsTable::Get();
+	Scheduler.ParallelFor(NumPrimitives, 256, [&](int64 Begin, int64 End)
+		{
+			for (int64 i = Begin; i < End; ++i)
+			{
+				UPrimitiveComponent* Primitive = OutList.Primitives[i].Primitive;
+				FAABB& Bounds = OutList.OcclusionBounds[i];
+				float& Coverage = OutList.OcclusionCoverage[i];
+				Coverage = 0.0f;
+				if (!BoundsTable.GetCachedWorldBounds(Primitive->GetBoundsHandle(), Bounds))
+				{
+					Bounds = FAABB(FVector(1.0f, 1.0f, 1.0f), FVector(-1.0f, -1.0f, -1.0f));
+					continue;
+				}
+				if (GetOccluderMesh(Primitive))
+				{
+					Coverage = Buffer.GetScreenCoverage(Bounds);
+				}
+			}
+		});
+
+	// 2. 화면을 많이 덮는 것부터 오클루더로 래스터화
+	TArray<int32> Candidates;
+	for (int32 i = 0; i < static_cast<int32>(NumPrimitives); ++i)
+	{
+		if (OutList.OcclusionCoverage[i] >= MinOccluderCoverage)
+		{
+			Candidates.push_back(i);
+		}
+	}
+	const auto ByCoverage = [&OutList](int32 A, int32 B) { return OutList.OcclusionCoverage[A] > OutList.OcclusionCoverage[B]; };
+	if (Candidates.size() > static_cast<size_t>(MaxOccluders))
+	{
+		std::partial_sort(Candidates.begin(), Candidates.begin() + MaxOccluders, Candidates.end(), ByCoverage);
+		Candidates.resize(MaxOccluders);
+	}
+	else
+	{
+		std::sort(Candidates.begin(), Candidates.end(), ByCoverage);
+	}
+
+	uint32 NumOccluderTriangles = 0;
+	for (int32 Index : Candidates)
+	{
+		UPrimitiveComponent* Primitive = OutList.Primitives[Index].Primitive;
+		const FStaticMesh* Mesh = GetOccluderMesh(Primitive);
+		const uint32 NumTriangles = static_cast<uint32>(Mesh->Indices.size() / 3);
+		if (NumOccluderTriangles + NumTriangles > MaxOccluderTriangles)
+		{
+			continue;
+		}
+		NumOccluderTriangles += NumTriangles;
+		Buffer.AddOccluder(Primitive->GetCachedWorldTransform(), Mesh->Vertices.data(), static_cast<uint32>(Mesh->Vertices.size()),
+			Mesh->Indices.data(), static_cast<uint32>(Mesh->Indices.size()));
+	}
+
+	if (Buffer.GetNumTriangles() == 0)
+	{
+		return;
+	}
+	Buffer.Rasterize(&Scheduler);
+
+	// 3. 가려진 프리미티브 표시 후 순서를 유지하며 제거 (정렬 상태 유지)
+	Scheduler.ParallelFor(NumPrimitives, 256, [&](int64 Begin, int64 End)
+		{
+			for (int64 i = Begin; i < End; ++i)
+			{
+				const FAABB& Bounds = OutList.OcclusionBounds[i];
+				OutList.OccludedFlags[i] = (Bounds.Min.X <= Bounds.Max.X && Buffer.IsBoxOccluded(Bounds)) ? 1 : 0;
+			}
+		});
+
+	size_t NumKept = 0;
+	for (int64 i = 0; i < NumPrimitives; ++i)
+	{
+		if (!OutList.OccludedFlags[i])
+		{
+			OutList.Primitives[NumKept++] = OutList.Primitives[i];
+		}
+	}
+	OutList.NumOccluded = static_cast<uint32>(NumPrimitives - NumKept);
+	OutList.Primitives.resize(NumKept);
+}
+
+void FSceneCuller::CullViews(const TArray<FViewCullRequest>& Requests, FTaskScheduler* InScheduler)
+{
+	FTaskScheduler& Scheduler = InScheduler ? *InScheduler : FTaskScheduler::Get();
+	if (Requests.size() <= 1)
+	{
+		if (!Requests.empty())
+		{
+			CullView(Requests[0], &Scheduler);
+		}
+		return;
+	}
+
+	// 첫 뷰는 호출 스레드가 직접 처리 (각 뷰 안의 ParallelFor가 남는 워커를 나눠 쓴다)
+	FTaskGroup Group;
+	for (size_t i = 1; i < Requests.size(); ++i)
+	{
+		const FViewCullRequest* Request = &Requests[i];
+		Scheduler.Dispatch(Group, [Request, &Scheduler]() { CullView(*Request, &Scheduler); });
+	}
+	CullView(Requests[0], &Scheduler);
+	Scheduler.Wait(Group);
+}
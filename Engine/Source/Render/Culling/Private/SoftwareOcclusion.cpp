@@ -0,0 +1,569 @@
+#include "pch.h"
+#include "Render/Culling/Public/SoftwareOcclusion.h"
+#include "Utility/Public/TaskScheduler.h"
+#include "Utility/Public/PlatformSIMD.h"
+
+#include <immintrin.h>
+#include <algorithm>
+
+namespace
+{
+	// 화면 밖으로 이만큼(NDC 배수) 넘어가는 정점이 있는 삼각형은 버린다 (엣지 함수 정밀도 보호)
+	constexpr float GuardBandNDC = 16.0f;
+
+	// 화면 면적이 이보다 작은 삼각형은 버린다 (픽셀 제곱 단위)
+	constexpr float MinTriangleArea = 1.0e-4f;
+
+	constexpr uint32 TILE_PIXELS = FSoftwareOcclusionBuffer::TILE_SIZE * FSoftwareOcclusionBuffer::TILE_SIZE;
+
+	// 행 벡터 규약: Out = (X, Y, Z, 1) * M
+	inline __m128 TransformPoint(const __m128 Row[4], float X, float Y, float Z)
+	{
+		__m128 Result = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(X), Row[0]), Row[3]);
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Y), Row[1]));
+		return _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Z), Row[2]));
+	}
+
+	inline void LoadRows(const FMatrix& M, __m128 OutRows[4])
+	{
+		for (int32 i = 0; i < 4; ++i)
+		{
+			OutRows[i] = _mm_loadu_ps(M.Data[i]);
+		}
+	}
+
+	inline float HorizontalMin(__m128 V)
+	{
+		V = _mm_min_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 0, 3, 2)));
+		V = _mm_min_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_cvtss_f32(V);
+	}
+
+	inline float HorizontalMax(__m128 V)
+	{
+		V = _mm_max_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 0, 3, 2)));
+		V = _mm_max_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_cvtss_f32(V);
+	}
+
+	// 한 줄 8픽셀: 세 엣지가 모두 0 이상인 픽셀에 min(기존, 평면 깊이 + 바이어스, 삼각형 최대 깊이)를 기록
+	struct FTileSetup
+	{
+		float RelX, RelY;                       // 타일 첫 픽셀 중심의 기준점 상대 좌표
+		bool bFullyCovered;
+	};
+
+	void RasterizeTileSSE(const float* EdgeA, const float* EdgeB, const float* EdgeC, float Depth0, float DepthDx, float DepthDy,
+		float DepthBias, float MaxDepth, const FTileSetup& Setup, float* Tile)
+	{
+		const __m128 Offsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+		const __m128 X0 = _mm_add_ps(_mm_set1_ps(Setup.RelX), Offsets);
+		const __m128 X1 = _mm_add_ps(X0, _mm_set1_ps(4.0f));
+		const __m128 MaxZ = _mm_set1_ps(MaxDepth);
+		const __m128 Zero = _mm_setzero_ps();
+
+		__m128 A[3], B[3], C[3];
+		for (int32 e = 0; e < 3; ++e)
+		{
+			A[e] = _mm_set1_ps(EdgeA[e]);
+			B[e] = _mm_set1_ps(EdgeB[e]);
+			C[e] = _mm_set1_ps(EdgeC[e]);
+		}
+		const __m128 Dx = _mm_set1_ps(DepthDx);
+		const __m128 Z0 = _mm_add_ps(_mm_set1_ps(Depth0 + DepthBias), _mm_mul_ps(Dx, X0));
+		const __m128 Z1 = _mm_add_ps(_mm_set1_ps(Depth0 + DepthBias), _mm_mul_ps(Dx, X1));
+
+		for (uint32 Row = 0; Row < FSoftwareOcclusionBuffer::TILE_SIZE; ++Row)
+		{
+			const float RelY = Setup.RelY + static_cast<float>(Row);
+			const __m128 Y = _mm_set1_ps(RelY);
+			const __m128 RowDepth = _mm_set1_ps(DepthDy * RelY);
+			float* Dst = Tile + Row * FSoftwareOcclusionBuffer::TILE_SIZE;
+
+			__m128 Depth0V = _mm_min_ps(_mm_add_ps(Z0, RowDepth), MaxZ);
+			__m128 Depth1V = _mm_min_ps(_mm_add_ps(Z1, RowDepth), MaxZ);
+			__m128 Old0 = _mm_loadu_ps(Dst);
+			__m128 Old1 = _mm_loadu_ps(Dst + 4);
+
+			if (Setup.bFullyCovered)
+			{
+				_mm_storeu_ps(Dst, _mm_min_ps(Old0, Depth0V));
+				_mm_storeu_ps(Dst + 4, _mm_min_ps(Old1, Depth1V));
+				continue;
+			}
+
+			__m128 Mask0 = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			__m128 Mask1 = Mask0;
+			for (int32 e = 0; e < 3; ++e)
+			{
+				const __m128 RowEdge = _mm_add_ps(_mm_mul_ps(B[e], Y), C[e]);
+				Mask0 = _mm_and_ps(Mask0, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(A[e], X0), RowEdge), Zero));
+				Mask1 = _mm_and_ps(Mask1, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(A[e], X1), RowEdge), Zero));
+			}
+			_mm_storeu_ps(Dst, _mm_blendv_ps(Old0, _mm_min_ps(Old0, Depth0V), Mask0));
+			_mm_storeu_ps(Dst + 4, _mm_blendv_ps(Old1, _mm_min_ps(Old1, Depth1V), Mask1));
+		}
+	}
+
+	SIMD_TARGET_AVX2 void RasterizeTileAVX2(const float* EdgeA, const float* EdgeB, const float* EdgeC, float Depth0, float DepthDx,
+		float DepthDy, float DepthBias, float MaxDepth, const FTileSetup& Setup, float* Tile)
+	{
+		const __m256 X = _mm256_add_ps(_mm256_set1_ps(Setup.RelX), _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f));
+		const __m256 MaxZ = _mm256_set1_ps(MaxDepth);
+		const __m256 Zero = _mm256_setzero_ps();
+		const __m256 Z = _mm256_fmadd_ps(_mm256_set1_ps(DepthDx), X, _mm256_set1_ps(Depth0 + DepthBias));
+
+		__m256 EdgeX[3], B[3];
+		for (int32 e = 0; e < 3; ++e)
+		{
+			EdgeX[e] = _mm256_fmadd_ps(_mm256_set1_ps(EdgeA[e]), X, _mm256_set1_ps(EdgeC[e]));
+			B[e] = _mm256_set1_ps(EdgeB[e]);
+		}
+
+		for (uint32 Row = 0; Row < FSoftwareOcclusionBuffer::TILE_SIZE; ++Row)
+		{
+			const float RelY = Setup.RelY + static_cast<float>(Row);
+			const __m256 Y = _mm256_set1_ps(RelY);
+			float* Dst = Tile + Row * FSoftwareOcclusionBuffer::TILE_SIZE;
+
+			const __m256 Depth = _mm256_min_ps(_mm256_add_ps(Z, _mm256_set1_ps(DepthDy * RelY)), MaxZ);
+			const __m256 Old = _mm256_loadu_ps(Dst);
+
+			if (Setup.bFullyCovered)
+			{
+				_mm256_storeu_ps(Dst, _mm256_min_ps(Old, Depth));
+				continue;
+			}
+
+			__m256 Mask = _mm256_cmp_ps(_mm256_fmadd_ps(B[0], Y, EdgeX[0]), Zero, _CMP_GE_OQ);
+			Mask = _mm256_and_ps(Mask, _mm256_cmp_ps(_mm256_fmadd_ps(B[1], Y, EdgeX[1]), Zero, _CMP_GE_OQ));
+			Mask = _mm256_and_ps(Mask, _mm256_cmp_ps(_mm256_fmadd_ps(B[2], Y, EdgeX[2]), Zero, _CMP_GE_OQ));
+			_mm256_storeu_ps(Dst, _mm256_blendv_ps(Old, _mm256_min_ps(Old, Depth), Mask));
+		}
+	}
+}
+
+void FSoftwareOcclusionBuffer::Initialize(uint32 InWidth, uint32 InHeight)
+{
+	const uint32 NewWidth = std::max(TILE_SIZE, (InWidth + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE);
+	const uint32 NewHeight = std::max(TILE_SIZE, (InHeight + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE);
+	if (NewWidth == Width && NewHeight == Height)
+	{
+		return;
+	}
+
+	Width = NewWidth;
+	Height = NewHeight;
+	TilesX = Width / TILE_SIZE;
+	TilesY = Height / TILE_SIZE;
+
+	for (int32 Level = 0; Level < NUM_LEVELS; ++Level)
+	{
+		Levels[Level].assign(static_cast<size_t>(GetLevelWidth(Level)) * GetLevelHeight(Level), 1.0f);
+	}
+	TileRowBins.resize(TilesY);
+}
+
+void FSoftwareOcclusionBuffer::BeginFrame(const FMatrix& InViewProjection)
+{
+	ViewProjection = InViewProjection;
+	Triangles.clear();
+	for (TArray<int32>& Bin : TileRowBins)
+	{
+		Bin.clear();
+	}
+}
+
+void FSoftwareOcclusionBuffer::AddOccluder(const FMatrix& InLocalToWorld, const FNormalVertex* InVertices, uint32 InNumVertices,
+	const uint32* InIndices, uint32 InNumIndices)
+{
+	if (Width == 0 || InNumVertices == 0)
+	{
+		return;
+	}
+
+	__m128 Rows[4];
+	LoadRows(InLocalToWorld * ViewProjection, Rows);
+
+	ClipVertices.resize(InNumVertices);
+	for (uint32 i = 0; i < InNumVertices; ++i)
+	{
+		const FVector& Position = InVertices[i].Position;
+		_mm_storeu_ps(&ClipVertices[i].X, TransformPoint(Rows, Position.X, Position.Y, Position.Z));
+	}
+
+	const float HalfWidth = static_cast<float>(Width) * 0.5f;
+	const float HalfHeight = static_cast<float>(Height) * 0.5f;
+
+	for (uint32 i = 0; i + 2 < InNumIndices; i += 3)
+	{
+		FVector4 Screen[3];
+		bool bValid = true;
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32 Index = InIndices[i + Corner];
+			if (Index >= InNumVertices)
+			{
+				bValid = false;
+				break;
+			}
+
+			// near 평면 앞(z < 0)에 걸치는 삼각형은 클리핑하지 않고 버린다
+			const FVector4& Clip = ClipVertices[Index];
+			if (Clip.W <= 0.0f || Clip.Z < 0.0f)
+			{
+				bValid = false;
+				break;
+			}
+
+			const float InvW = 1.0f / Clip.W;
+			const float NdcX = Clip.X * InvW;
+			const float NdcY = Clip.Y * InvW;
+			if (std::abs(NdcX) > GuardBandNDC || std::abs(NdcY) > GuardBandNDC)
+			{
+				bValid = false;
+				break;
+			}
+
+			Screen[Corner] = FVector4((NdcX + 1.0f) * HalfWidth, (1.0f - NdcY) * HalfHeight, Clip.Z * InvW, 1.0f);
+		}
+
+		if (bValid)
+		{
+			SetupTriangle(Screen[0], Screen[1], Screen[2]);
+		}
+	}
+}
+
+void FSoftwareOcclusionBuffer::SetupTriangle(const FVector4& V0, const FVector4& InV1, const FVector4& InV2)
+{
+	float Area = (InV1.X - V0.X) * (InV2.Y - V0.Y) - (InV2.X - V0.X) * (InV1.Y - V0.Y);
+	if (std::abs(Area) < MinTriangleArea)
+	{
+		return;
+	}
+
+	// 양면 모두 가리므로 감김 방향을 통일해 안쪽이 양수가 되게 한다
+	const bool bFlip = Area < 0.0f;
+	const FVector4& V1 = bFlip ? InV2 : InV1;
+	const FVector4& V2 = bFlip ? InV1 : InV2;
+	Area = std::abs(Area);
+
+	FScreenTriangle Triangle;
+
+	// 픽셀 i의 중심은 i + 0.5
+	const float MinX = std::min({ V0.X, V1.X, V2.X });
+	const float MaxX = std::max({ V0.X, V1.X, V2.X });
+	const float MinY = std::min({ V0.Y, V1.Y, V2.Y });
+	const float MaxY = std::max({ V0.Y, V1.Y, V2.Y });
+	Triangle.MinX = std::max(0, static_cast<int32>(std::ceil(MinX - 0.5f)));
+	Triangle.MaxX = std::min(static_cast<int32>(Width) - 1, static_cast<int32>(std::floor(MaxX - 0.5f)));
+	Triangle.MinY = std::max(0, static_cast<int32>(std::ceil(MinY - 0.5f)));
+	Triangle.MaxY = std::min(static_cast<int32>(Height) - 1, static_cast<int32>(std::floor(MaxY - 0.5f)));
+	if (Triangle.MinX > Triangle.MaxX || Triangle.MinY > Triangle.MaxY)
+	{
+		return;
+	}
+
+	Triangle.OriginX = V0.X;
+	Triangle.OriginY = V0.Y;
+
+	// 엣지 Va -> Vb: E = (Ya - Yb) * x + (Xb - Xa) * y + (Xa * Yb - Xb * Ya), 정점 0 기준 좌표로 옮겨 계산
+	const FVector4* Vertices[3] = { &V0, &V1, &V2 };
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const FVector4& A = *Vertices[Edge];
+		const FVector4& B = *Vertices[(Edge + 1) % 3];
+		const float AX = A.X - V0.X;
+		const float AY = A.Y - V0.Y;
+		const float BX = B.X - V0.X;
+		const float BY = B.Y - V0.Y;
+		Triangle.EdgeA[Edge] = AY - BY;
+		Triangle.EdgeB[Edge] = BX - AX;
+		Triangle.EdgeC[Edge] = AX * BY - BX * AY;
+	}
+
+	const float InvArea = 1.0f / Area;
+	const float DZ1 = V1.Z - V0.Z;
+	const float DZ2 = V2.Z - V0.Z;
+	Triangle.Depth0 = V0.Z;
+	Triangle.DepthDx = (DZ1 * (V2.Y - V0.Y) - DZ2 * (V1.Y - V0.Y)) * InvArea;
+	Triangle.DepthDy = ((V1.X - V0.X) * DZ2 - (V2.X - V0.X) * DZ1) * InvArea;
+
+	// 픽셀 중심 깊이로 덮으면 픽셀 안의 더 먼 부분을 가까이 기록하게 되므로 픽셀 안 최대 증가량만큼 올려 보수적으로 만든다
+	Triangle.DepthBias = 0.5f * (std::abs(Triangle.DepthDx) + std::abs(Triangle.DepthDy));
+	Triangle.MinDepth = std::min({ V0.Z, V1.Z, V2.Z });
+	Triangle.MaxDepth = std::max({ V0.Z, V1.Z, V2.Z });
+
+	const int32 TriangleIndex = static_cast<int32>(Triangles.size());
+	Triangles.push_back(Triangle);
+	for (int32 TileY = Triangle.MinY / static_cast<int32>(TILE_SIZE); TileY <= Triangle.MaxY / static_cast<int32>(TILE_SIZE); ++TileY)
+	{
+		TileRowBins[TileY].push_back(TriangleIndex);
+	}
+}
+
+void FSoftwareOcclusionBuffer::Rasterize(FTaskScheduler* InScheduler)
+{
+	if (Width == 0)
+	{
+		return;
+	}
+
+	// 타일 행끼리는 쓰는 메모리가 겹치지 않으므로 행 단위로 나눈다
+	if (InScheduler)
+	{
+		InScheduler->ParallelFor(TilesY, 1, [this](int64 Begin, int64 End)
+			{
+				for (int64 TileY = Begin; TileY < End; ++TileY)
+				{
+					RasterizeTileRow(static_cast<uint32>(TileY));
+				}
+			});
+	}
+	else
+	{
+		for (uint32 TileY = 0; TileY < TilesY; ++TileY)
+		{
+			RasterizeTileRow(TileY);
+		}
+	}
+}
+
+void FSoftwareOcclusionBuffer::RasterizeTileRow(uint32 TileY)
+{
+	// 이 행의 타일과 3단계(타일 최대 깊이) 초기화: 3단계는 래스터화 중 타일 조기 기각에도 쓰인다
+	float* RowTiles = &Levels[0][static_cast<size_t>(TileY) * TilesX * TILE_PIXELS];
+	std::fill(RowTiles, RowTiles + static_cast<size_t>(TilesX) * TILE_PIXELS, 1.0f);
+	float* RowMax = &Levels[3][static_cast<size_t>(TileY) * TilesX];
+	std::fill(RowMax, RowMax + TilesX, 1.0f);
+
+	for (int32 TriangleIndex : TileRowBins[TileY])
+	{
+		const FScreenTriangle& Triangle = Triangles[TriangleIndex];
+		const uint32 FirstTileX = static_cast<uint32>(Triangle.MinX) / TILE_SIZE;
+		const uint32 LastTileX = static_cast<uint32>(Triangle.MaxX) / TILE_SIZE;
+		for (uint32 TileX = FirstTileX; TileX <= LastTileX; ++TileX)
+		{
+			RasterizeTile(Triangle, TileX, TileY);
+		}
+	}
+
+	for (uint32 TileX = 0; TileX < TilesX; ++TileX)
+	{
+		BuildTileLevels(TileX, TileY);
+	}
+}
+
+void FSoftwareOcclusionBuffer::RasterizeTile(const FScreenTriangle& Triangle, uint32 TileX, uint32 TileY)
+{
+	// 기록되는 깊이는 항상 삼각형 최소 깊이 이상이므로, 타일이 이미 그보다 가까우면 바뀔 픽셀이 없다
+	float& TileMaxDepth = Levels[3][static_cast<size_t>(TileY) * TilesX + TileX];
+	if (Triangle.MinDepth >= TileMaxDepth)
+	{
+		return;
+	}
+
+	FTileSetup Setup;
+	Setup.RelX = static_cast<float>(TileX * TILE_SIZE) + 0.5f - Triangle.OriginX;
+	Setup.RelY = static_cast<float>(TileY * TILE_SIZE) + 0.5f - Triangle.OriginY;
+
+	// 타일 네 모서리 픽셀 중심에서 엣지 함수의 최대/최소로 완전 기각·완전 포함 판정
+	const float Span = static_cast<float>(TILE_SIZE - 1);
+	Setup.bFullyCovered = true;
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const float A = Triangle.EdgeA[Edge];
+		const float B = Triangle.EdgeB[Edge];
+		const float Base = A * Setup.RelX + B * Setup.RelY + Triangle.EdgeC[Edge];
+		const float MaxValue = Base + std::max(A, 0.0f) * Span + std::max(B, 0.0f) * Span;
+		const float MinValue = Base + std::min(A, 0.0f) * Span + std::min(B, 0.0f) * Span;
+		if (MaxValue < 0.0f)
+		{
+			return;
+		}
+		Setup.bFullyCovered &= MinValue >= 0.0f;
+	}
+
+	float* Tile = &Levels[0][(static_cast<size_t>(TileY) * TilesX + TileX) * TILE_PIXELS];
+	if (FPlatformSIMD::HasAVX2())
+	{
+		RasterizeTileAVX2(Triangle.EdgeA, Triangle.EdgeB, Triangle.EdgeC, Triangle.Depth0, Triangle.DepthDx, Triangle.DepthDy,
+			Triangle.DepthBias, Triangle.MaxDepth, Setup, Tile);
+	}
+	else
+	{
+		RasterizeTileSSE(Triangle.EdgeA, Triangle.EdgeB, Triangle.EdgeC, Triangle.Depth0, Triangle.DepthDx, Triangle.DepthDy,
+			Triangle.DepthBias, Triangle.MaxDepth, Setup, Tile);
+	}
+
+	__m128 Max = _mm_loadu_ps(Tile);
+	for (uint32 i = 4; i < TILE_PIXELS; i += 4)
+	{
+		Max = _mm_max_ps(Max, _mm_loadu_ps(Tile + i));
+	}
+	TileMaxDepth = HorizontalMax(Max);
+}
+
+void FSoftwareOcclusionBuffer::BuildTileLevels(uint32 TileX, uint32 TileY)
+{
+	const float* Tile = &Levels[0][(static_cast<size_t>(TileY) * TilesX + TileX) * TILE_PIXELS];
+
+	// 1단계 (4x4): 2x2 픽셀 최대값, 2단계 (2x2), 3단계 (1x1) 순으로 줄인다
+	float Level1[4][4];
+	for (uint32 Y = 0; Y < 4; ++Y)
+	{
+		const __m128 Row0Lo = _mm_loadu_ps(Tile + (Y * 2) * TILE_SIZE);
+		const __m128 Row0Hi = _mm_loadu_ps(Tile + (Y * 2) * TILE_SIZE + 4);
+		const __m128 Row1Lo = _mm_loadu_ps(Tile + (Y * 2 + 1) * TILE_SIZE);
+		const __m128 Row1Hi = _mm_loadu_ps(Tile + (Y * 2 + 1) * TILE_SIZE + 4);
+		const __m128 Lo = _mm_max_ps(Row0Lo, Row1Lo);
+		const __m128 Hi = _mm_max_ps(Row0Hi, Row1Hi);
+		// 짝수/홀수 열끼리 최대
+		const __m128 Even = _mm_shuffle_ps(Lo, Hi, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 Odd = _mm_shuffle_ps(Lo, Hi, _MM_SHUFFLE(3, 1, 3, 1));
+		_mm_storeu_ps(Level1[Y], _mm_max_ps(Even, Odd));
+	}
+
+	const uint32 Level1Width = GetLevelWidth(1);
+	float* Level1Dst = &Levels[1][static_cast<size_t>(TileY * 4) * Level1Width + TileX * 4];
+	for (uint32 Y = 0; Y < 4; ++Y)
+	{
+		std::copy(Level1[Y], Level1[Y] + 4, Level1Dst + Y * Level1Width);
+	}
+
+	const uint32 Level2Width = GetLevelWidth(2);
+	float* Level2Dst = &Levels[2][static_cast<size_t>(TileY * 2) * Level2Width + TileX * 2];
+	float TileMax = 0.0f;
+	for (uint32 Y = 0; Y < 2; ++Y)
+	{
+		for (uint32 X = 0; X < 2; ++X)
+		{
+			const float Value = std::max({ Level1[Y * 2][X * 2], Level1[Y * 2][X * 2 + 1], Level1[Y * 2 + 1][X * 2], Level1[Y * 2 + 1][X * 2 + 1] });
+			Level2Dst[Y * Level2Width + X] = Value;
+			TileMax = std::max(TileMax, Value);
+		}
+	}
+
+	Levels[3][static_cast<size_t>(TileY) * TilesX + TileX] = TileMax;
+}
+
+bool FSoftwareOcclusionBuffer::ProjectBounds(const FAABB& InWorldBounds, float OutRect[4], float& OutMinDepth) const
+{
+	// 8개 모서리를 SoA로 두 묶음(Min.Z / Max.Z)에 나눠 한 번에 변환
+	const __m128 CornerX = _mm_setr_ps(InWorldBounds.Min.X, InWorldBounds.Max.X, InWorldBounds.Min.X, InWorldBounds.Max.X);
+	const __m128 CornerY = _mm_setr_ps(InWorldBounds.Min.Y, InWorldBounds.Min.Y, InWorldBounds.Max.Y, InWorldBounds.Max.Y);
+	const __m128 CornerZ[2] = { _mm_set1_ps(InWorldBounds.Min.Z), _mm_set1_ps(InWorldBounds.Max.Z) };
+
+	__m128 Clip[2][4];
+	for (int32 Component = 0; Component < 4; ++Component)
+	{
+		const __m128 XY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(CornerX, _mm_set1_ps(ViewProjection.Data[0][Component])),
+			_mm_mul_ps(CornerY, _mm_set1_ps(ViewProjection.Data[1][Component]))), _mm_set1_ps(ViewProjection.Data[3][Component]));
+		for (int32 Half = 0; Half < 2; ++Half)
+		{
+			Clip[Half][Component] = _mm_add_ps(XY, _mm_mul_ps(CornerZ[Half], _mm_set1_ps(ViewProjection.Data[2][Component])));
+		}
+	}
+
+	// near 평면에 걸치면 화면 사각형을 구할 수 없다
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 Behind = _mm_or_ps(_mm_or_ps(_mm_cmple_ps(Clip[0][3], Zero), _mm_cmplt_ps(Clip[0][2], Zero)),
+		_mm_or_ps(_mm_cmple_ps(Clip[1][3], Zero), _mm_cmplt_ps(Clip[1][2], Zero)));
+	if (_mm_movemask_ps(Behind))
+	{
+		return false;
+	}
+
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 InvW0 = _mm_div_ps(One, Clip[0][3]);
+	const __m128 InvW1 = _mm_div_ps(One, Clip[1][3]);
+	const __m128 NdcX0 = _mm_mul_ps(Clip[0][0], InvW0);
+	const __m128 NdcX1 = _mm_mul_ps(Clip[1][0], InvW1);
+	const __m128 NdcY0 = _mm_mul_ps(Clip[0][1], InvW0);
+	const __m128 NdcY1 = _mm_mul_ps(Clip[1][1], InvW1);
+	const __m128 Depth = _mm_min_ps(_mm_mul_ps(Clip[0][2], InvW0), _mm_mul_ps(Clip[1][2], InvW1));
+
+	const float MinNdcX = HorizontalMin(_mm_min_ps(NdcX0, NdcX1));
+	const float MaxNdcX = HorizontalMax(_mm_max_ps(NdcX0, NdcX1));
+	const float MinNdcY = HorizontalMin(_mm_min_ps(NdcY0, NdcY1));
+	const float MaxNdcY = HorizontalMax(_mm_max_ps(NdcY0, NdcY1));
+	OutMinDepth = HorizontalMin(Depth);
+
+	const float HalfWidth = static_cast<float>(Width) * 0.5f;
+	const float HalfHeight = static_cast<float>(Height) * 0.5f;
+	OutRect[0] = std::max(0.0f, (MinNdcX + 1.0f) * HalfWidth);
+	OutRect[1] = std::max(0.0f, (1.0f - MaxNdcY) * HalfHeight);
+	OutRect[2] = std::min(static_cast<float>(Width), (MaxNdcX + 1.0f) * HalfWidth);
+	OutRect[3] = std::min(static_cast<float>(Height), (1.0f - MinNdcY) * HalfHeight);
+	return OutRect[0] < OutRect[2] && OutRect[1] < OutRect[3];
+}
+
+float FSoftwareOcclusionBuffer::GetScreenCoverage(const FAABB& InWorldBounds) const
+{
+	float Rect[4];
+	float MinDepth;
+	if (Width == 0 || !ProjectBounds(InWorldBounds, Rect, MinDepth))
+	{
+		return 0.0f;
+	}
+	return (Rect[2] - Rect[0]) * (Rect[3] - Rect[1]) / (static_cast<float>(Width) * static_cast<float>(Height));
+}
+
+bool FSoftwareOcclusionBuffer::IsBoxOccluded(const FAABB& InWorldBounds) const
+{
+	// 화면 사각형을 구할 수 없거나 화면 밖이면 판단하지 않고 보이는 것으로 취급
+	float Rect[4];
+	float MinDepth;
+	if (Width == 0 || Triangles.empty() || !ProjectBounds(InWorldBounds, Rect, MinDepth))
+	{
+		return false;
+	}
+
+	// 사각형이 한 변에 4텍셀 안팎이 되는 가장 세밀한 단계 선택 (최대 깊이는 단계가 거칠수록 보수적)
+	const float Extent = std::max(Rect[2] - Rect[0], Rect[3] - Rect[1]);
+	int32 Level = 1;
+	while (Level < NUM_LEVELS - 1 && Extent > static_cast<float>(4u << Level))
+	{
+		++Level;
+	}
+
+	return IsRectOccluded(Level, Rect[0], Rect[1], Rect[2], Rect[3], MinDepth);
+}
+
+bool FSoftwareOcclusionBuffer::IsRectOccluded(int32 InLevel, float InMinX, float InMinY, float InMaxX, float InMaxY, float InMinDepth) const
+{
+	const uint32 LevelWidth = GetLevelWidth(InLevel);
+	const uint32 LevelHeight = GetLevelHeight(InLevel);
+	const float Scale = 1.0f / static_cast<float>(1u << InLevel);
+
+	// 사각형에 조금이라도 걸치는 텍셀은 모두 포함
+	const uint32 X0 = static_cast<uint32>(InMinX * Scale);
+	const uint32 Y0 = static_cast<uint32>(InMinY * Scale);
+	const uint32 X1 = std::min(LevelWidth, static_cast<uint32>(std::ceil(InMaxX * Scale)));
+	const uint32 Y1 = std::min(LevelHeight, static_cast<uint32>(std::ceil(InMaxY * Scale)));
+
+	const TArray<float>& Level = Levels[InLevel];
+	const __m128 MinDepth = _mm_set1_ps(InMinDepth);
+	for (uint32 Y = Y0; Y < Y1; ++Y)
+	{
+		const float* Row = &Level[static_cast<size_t>(Y) * LevelWidth];
+		uint32 X = X0;
+		for (; X + 4 <= X1; X += 4)
+		{
+			// 한 텍셀이라도 박스의 가장 가까운 깊이보다 멀면 그 틈으로 보일 수 있다
+			if (_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(Row + X), MinDepth)))
+			{
+				return false;
+			}
+		}
+		for (; X < X1; ++X)
+		{
+			if (Row[X] >= InMinDepth)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
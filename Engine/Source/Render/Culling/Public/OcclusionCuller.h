@@ -4,6 +4,18 @@
 
 class UDeviceResources;
 class UCamera;
+class FSoftwareOcclusionBuffer;
+
+/**
+ * @brief 오클루전 깊이 피라미드를 만드는 방식
+ * GPU: 깊이 버퍼에서 컴퓨트 쉐이더로 HZB 생성 후 mip 3을 리드백
+ * CPU: 컬링 단계에서 오클루더를 소프트웨어 래스터화 (리드백 대기 없음, 같은 프레임 결과 사용)
+ */
+enum class EOcclusionMode : uint8
+{
+	GPU,
+	CPU
+};
 
 /**
  * @brief HZB (Hierarchical Z-Buffer) 기반 Occlusion Culling 관리 클래스
@@ -24,6 +36,11 @@ public:
 	 */
 	void Initialize(UDeviceResources* InDeviceResources);
 
+	/**
+	 * @brief 설정 파일에서 오클루전 방식을 읽습니다.
+	 */
+	void LoadSettings();
+
 	/**
 	 * @brief HZB 리소스를 해제합니다 (컴퓨트 쉐이더는 유지).
 	 */
@@ -49,6 +66,12 @@ public:
 	 */
 	void CacheHZBForOcclusion() const;
 
+	/**
+	 * @brief 소프트웨어 오클루전 버퍼의 1/8 단계를 HZB mipLevel 3 캐시로 옮깁니다 (CPU 모드).
+	 * 버퍼 해상도가 달라도 캐시 텍셀이 덮는 영역의 최대 깊이를 취해 보수적으로 맞춥니다.
+	 */
+	void CacheHZBFromSoftwareBuffer(const FSoftwareOcclusionBuffer& InBuffer) const;
+
 	/**
 	 * @brief 캐시된 HZB 데이터를 해제합니다.
 	 */
@@ -89,6 +112,8 @@ public:
 
 	// Getters
 	bool IsHZBCacheValid() const { return bHZBCacheValid; }
+	EOcclusionMode GetOcclusionMode() const { return OcclusionMode; }
+	void SetOcclusionMode(EOcclusionMode InMode) { OcclusionMode = InMode; }
 	ID3D11Device* GetDevice() const;
 	ID3D11DeviceContext* GetDeviceContext() const;
 
@@ -111,6 +136,8 @@ private:
 	// Direct3D 리소스
 	UDeviceResources* DeviceResources = nullptr;
 
+	EOcclusionMode OcclusionMode = EOcclusionMode::GPU;
+
 	// HZB Compute Shaders
 	ID3D11ComputeShader* HZBComputeShader = nullptr;
 	ID3D11ComputeShader* DepthCopyComputeShader = nullptr;
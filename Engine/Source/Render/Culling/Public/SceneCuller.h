@@ -0,0 +1,94 @@
+#pragma once
+#include "Render/Spatial/Public/Octree.h"
+
+class FTaskScheduler;
+class FSoftwareOcclusionBuffer;
+class UPrimitiveComponent;
+
+/**
+ * @brief 컬링을 통과한 프리미티브 하나와 제출 순서 정렬 키
+ * 키는 상위 비트부터 프리미티브 타입 / 메시 / 머티리얼 순이라 정렬하면 같은 메시·머티리얼이 연속으로 제출된다
+ */
+struct FVisiblePrimitive
+{
+	uint64 SortKey = 0;
+	UPrimitiveComponent* Primitive = nullptr;
+
+	// 키만 비교 (같은 키끼리의 순서는 상관없음)
+	bool operator<(const FVisiblePrimitive& Other) const { return SortKey < Other.SortKey; }
+};
+
+/**
+ * @brief 뷰 하나의 컬링 결과 (뷰포트마다 하나를 두고 매 프레임 재사용)
+ * 제출 단계는 Primitives를 순서대로 그리기만 한다
+ */
+struct FVisibleList
+{
+	TArray<FVisiblePrimitive> Primitives;      // 정렬 완료된 제출 목록
+	uint32 NumStatic = 0;                      // 프러스텀을 통과한 개수 (오클루전으로 빠진 것 포함)
+	uint32 NumDynamic = 0;
+	uint32 NumOccluded = 0;                    // 소프트웨어 오클루전으로 제외된 개수
+
+	// 작업별 결과 버퍼와 병합용 임시 배열 (할당 재사용)
+	TArray<TArray<FVisiblePrimitive>> TaskResults;
+	TArray<FVisiblePrimitive> MergeScratch;
+
+	// 오클루전 단계용 임시 배열 (Primitives와 같은 인덱스)
+	TArray<FAABB> OcclusionBounds;
+	TArray<float> OcclusionCoverage;
+	TArray<uint8> OccludedFlags;
+
+	void Reset();
+};
+
+/**
+ * @brief 레벨의 동적 프리미티브 스냅샷 (프레임마다 한 번 만들고 여러 뷰의 컬링이 읽기만 한다)
+ * 유효하고 보이는 프리미티브만 모아 정렬 키와 월드 AABB(SoA)를 보관하므로 뷰 컬링은 컴포넌트를 읽지 않는다
+ * GetWorldAABB의 캐시 갱신도 여기서 미리 끝내 뷰 컬링 스레드끼리 컴포넌트에 동시에 쓰지 않게 한다
+ */
+struct FDynamicPrimitiveSet
+{
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<uint64> SortKeys;                    // Primitives와 같은 인덱스
+	FBoundsSoA Bounds;                          // 8개 단위로 읽도록 길이를 8의 배수로 맞춘다 (남는 칸은 마스크로 제외)
+
+	void Reset();
+	void Build(const TArray<UPrimitiveComponent*>& InPrimitives);
+	void Add(UPrimitiveComponent* Primitive, const FAABB& WorldBounds);
+	int32 Num() const { return static_cast<int32>(Primitives.size()); }
+};
+
+// 뷰 하나의 컬링 입력과 결과를 쓸 목록
+struct FViewCullRequest
+{
+	FFrustum Frustum;
+	const FOctree* StaticOctree = nullptr;
+	const FDynamicPrimitiveSet* DynamicPrimitives = nullptr;
+	FVisibleList* OutList = nullptr;
+
+	// 지정하면 프러스텀 컬링 뒤 CPU 오클루전까지 수행 (버퍼는 뷰마다 따로, ViewProjection은 버퍼 변환에 사용)
+	FSoftwareOcclusionBuffer* OcclusionBuffer = nullptr;
+	FMatrix ViewProjection;
+};
+
+/**
+ * @brief GPU 없이 동작하는 씬 컬링 단계
+ * 옥트리 서브트리와 동적 프리미티브 구간을 워커 스레드에 나눠 프러스텀 검사하고,
+ * 작업별로 정렬한 결과를 병합해 메시/머티리얼 순으로 정렬된 보이는 목록을 만든다
+ * 오클루전 버퍼가 주어지면 화면을 크게 덮는 정적 메시를 낮은 LOD로 래스터화해 가려진 프리미티브를 목록에서 뺀다
+ */
+class FSceneCuller
+{
+public:
+	// InScheduler가 nullptr이면 전역 스케줄러 사용
+	static void CullView(const FViewCullRequest& Request, FTaskScheduler* InScheduler = nullptr);
+
+	// 여러 뷰를 동시에 컬링 (뷰마다 작업 하나를 띄우고, 각 뷰 안에서도 다시 나눠 실행)
+	static void CullViews(const TArray<FViewCullRequest>& Requests, FTaskScheduler* InScheduler = nullptr);
+
+	static uint64 MakeSortKey(UPrimitiveComponent* Primitive);
+
+private:
+	// 프러스텀 컬링이 끝난 목록에서 오클루더를 골라 래스터화하고 가려진 프리미티브를 순서를 유지한 채 제거
+	static void ApplyOcclusion(const FViewCullRequest& Request, FTaskScheduler& Scheduler);
+};
@@ -0,0 +1,85 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+
+class FTaskScheduler;
+
+/**
+ * @brief CPU 소프트웨어 래스터라이저 기반 오클루전 버퍼
+ * 소수의 오클루더 삼각형을 저해상도 깊이 버퍼에 8x8 타일 단위로 래스터화하고 최대 깊이 피라미드(1/2, 1/4, 1/8)를 만든다
+ * GPU HZB 리드백 없이 같은 프레임 안에서 오클루전 테스트가 가능하고, D3D 없이 동작한다
+ * 깊이는 D3D 규약(near = 0, far = 1)이며 버퍼에는 가장 가까운 깊이를, 피라미드에는 영역에서 가장 먼 깊이를 저장한다
+ */
+class FSoftwareOcclusionBuffer
+{
+public:
+	static constexpr uint32 TILE_SIZE = 8;
+	static constexpr int32 NUM_LEVELS = 4;     // 0: 원본(타일 배치), 1..3: 1/2, 1/4, 1/8 (3단계는 타일당 1텍셀)
+
+	// 크기는 TILE_SIZE의 배수로 올린다 (크기가 같으면 아무것도 하지 않음)
+	void Initialize(uint32 InWidth, uint32 InHeight);
+
+	// 오클루더를 모으기 전에 호출: 삼각형 목록을 비우고 변환 행렬을 정한다
+	void BeginFrame(const FMatrix& InViewProjection);
+
+	/**
+	 * @brief 로컬 공간 삼각형 목록을 오클루더로 추가 (InLocalToWorld * ViewProjection으로 변환)
+	 * near 평면을 넘거나 가드 밴드를 크게 벗어나는 삼각형은 버린다 (오클루더가 줄어들 뿐이라 보수적)
+	 */
+	void AddOccluder(const FMatrix& InLocalToWorld, const FNormalVertex* InVertices, uint32 InNumVertices,
+		const uint32* InIndices, uint32 InNumIndices);
+
+	// 추가된 삼각형을 타일 행 단위로 나눠 래스터화하고 피라미드까지 만든다 (InScheduler가 nullptr이면 호출 스레드에서만)
+	void Rasterize(FTaskScheduler* InScheduler = nullptr);
+
+	// 월드 AABB가 오클루더 뒤에 완전히 가려지면 true (near 평면에 걸치는 등 판단할 수 없으면 false)
+	bool IsBoxOccluded(const FAABB& InWorldBounds) const;
+
+	// 월드 AABB의 화면 사각형이 버퍼에서 차지하는 비율 (0..1, near 평면에 걸치면 0) - 오클루더 선택용
+	float GetScreenCoverage(const FAABB& InWorldBounds) const;
+
+	uint32 GetWidth() const { return Width; }
+	uint32 GetHeight() const { return Height; }
+	uint32 GetNumTriangles() const { return static_cast<uint32>(Triangles.size()); }
+
+	// 피라미드 단계 (1..3, 행 우선 배열)
+	const TArray<float>& GetLevel(int32 InLevel) const { return Levels[InLevel]; }
+	uint32 GetLevelWidth(int32 InLevel) const { return Width >> InLevel; }
+	uint32 GetLevelHeight(int32 InLevel) const { return Height >> InLevel; }
+
+private:
+	// 화면 공간 삼각형: 안쪽이 양수인 엣지 함수 3개와 깊이 평면 (정밀도를 위해 정점 0 기준 좌표로 계산)
+	struct FScreenTriangle
+	{
+		float OriginX, OriginY;
+		float EdgeA[3], EdgeB[3], EdgeC[3];     // E(x, y) = A * (x - OriginX) + B * (y - OriginY) + C
+		float Depth0, DepthDx, DepthDy;         // z(x, y) = Depth0 + Dx * (x - OriginX) + Dy * (y - OriginY)
+		float DepthBias;                        // 픽셀 안에서 깊이 평면이 가질 수 있는 최대 증가량
+		float MinDepth, MaxDepth;
+		int32 MinX, MinY, MaxX, MaxY;           // 픽셀 중심이 들어올 수 있는 범위 (포함)
+	};
+
+	void SetupTriangle(const FVector4& V0, const FVector4& V1, const FVector4& V2);
+	void RasterizeTileRow(uint32 TileY);
+	void RasterizeTile(const FScreenTriangle& Triangle, uint32 TileX, uint32 TileY);
+	void BuildTileLevels(uint32 TileX, uint32 TileY);
+
+	// 8개 모서리를 투영한 화면 사각형(MinX, MinY, MaxX, MaxY, 버퍼 안으로 자름)과 최소 깊이 (near 평면에 걸치거나 화면 밖이면 false)
+	bool ProjectBounds(const FAABB& InWorldBounds, float OutRect[4], float& OutMinDepth) const;
+
+	// 피라미드 InLevel에서 사각형(픽셀 단위)을 덮는 텍셀이 모두 InMinDepth보다 가까우면 true
+	bool IsRectOccluded(int32 InLevel, float InMinX, float InMinY, float InMaxX, float InMaxY, float InMinDepth) const;
+
+	uint32 Width = 0;
+	uint32 Height = 0;
+	uint32 TilesX = 0;
+	uint32 TilesY = 0;
+
+	FMatrix ViewProjection;
+
+	TArray<FVector4> ClipVertices;               // AddOccluder 변환 결과 (할당 재사용)
+	TArray<FScreenTriangle> Triangles;
+	TArray<TArray<int32>> TileRowBins;           // 타일 행마다 걸치는 삼각형 인덱스
+
+	// 0단계는 8x8 타일이 연속(64개)으로 놓인 배치, 1..3단계는 행 우선
+	TArray<float> Levels[NUM_LEVELS];
+};
@@ -5,6 +5,7 @@
 #include "Render/FontRenderer/Public/FontRenderer.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Public/PrimitiveBoundsTable.h"
 #include "Editor/Public/Editor.h"
 #include "Editor/Public/Viewport.h"
 #include "Editor/Public/ViewportClient.h"
@@ -285,9 +286,15 @@ void URenderer::Update()
 
 	RenderBegin();
 
+	// 모든 뷰포트의 카메라를 갱신하고 보이는 프리미티브 목록을 한 번에 만듭니다. (뷰포트끼리 병렬)
+	CullViewports();
+
 	// FViewportClient로부터 모든 뷰포트를 가져옵니다.
-	for (FViewportClient& ViewportClient : ViewportClient->GetViewports())
+	TArray<FViewportClient>& Viewports = ViewportClient->GetViewports();
+	for (size_t ViewportIndex = 0; ViewportIndex < Viewports.size(); ++ViewportIndex)
 	{
+		FViewportClient& ViewportClient = Viewports[ViewportIndex];
+
 		// 0. 뷰포트가 숨겨져 있다면 렌더링을 하지 않습니다.
 		if (!ViewportClient.bIsVisible) { continue; }
 
@@ -300,12 +307,11 @@ void URenderer::Update()
 		// 2. 현재 뷰포트의 카메라 정보를 가져옵니다.
 		UCamera* CurrentCamera = &ViewportClient.Camera;
 
-		// 3. 해당 카메라의 View/Projection 행렬로 상수 버퍼를 업데이트합니다.
-		CurrentCamera->Update(ViewportClient.GetViewportInfo());
+		// 3. 해당 카메라의 View/Projection 행렬로 상수 버퍼를 업데이트합니다. (카메라는 CullViewports에서 갱신됨)
 		UpdateConstant(CurrentCamera->GetFViewProjConstants());
 
-		// 4. 씬(레벨, 에디터 요소 등)을 이 뷰포트와 카메라 기준으로 렌더링합니다.
-		RenderLevel(ViewportClient);
+		// 4. 씬(레벨, 에디터 요소 등)을 이 뷰포트의 컬링 결과로 렌더링합니다.
+		RenderLevel(ViewportClient, ViewportVisibleLists[ViewportIndex]);
 
 		// 5. 에디터를 렌더링합니다.
 		// PIE World인 경우 에디터 오버레이 렌더링 스킵 (그리드, 축, 기즈모 숨김)
@@ -320,9 +326,22 @@ void URenderer::Update()
 	// HZB 생성 (매 프레임 깊이 버퍼 완료 후)
 	if (CullingManager && CullingManager->GetOcclusionCuller())
 	{
-		CullingManager->GetOcclusionCuller()->GenerateHZB();
-		// HZB 생성 직후 Occlusion Culling용 캐시 생성
-		CullingManager->GetOcclusionCuller()->CacheHZBForOcclusion();
+		UOcclusionCuller* OcclusionCuller = CullingManager->GetOcclusionCuller();
+		if (OcclusionCuller->GetOcclusionMode() == EOcclusionMode::CPU)
+		{
+			// CPU 모드: 이번 프레임에 컬링한 뷰포트의 소프트웨어 깊이 피라미드를 그대로 사용 (GPU 리드백 없음)
+			// 숨겨졌거나 닫힌 뷰포트의 버퍼는 지난 상태이므로 쓰지 않는다
+			if (0 <= OcclusionViewportIndex && OcclusionViewportIndex < static_cast<int32>(ViewportOcclusionBuffers.size()))
+			{
+				OcclusionCuller->CacheHZBFromSoftwareBuffer(ViewportOcclusionBuffers[OcclusionViewportIndex]);
+			}
+		}
+		else
+		{
+			OcclusionCuller->GenerateHZB();
+			// HZB 생성 직후 Occlusion Culling용 캐시 생성
+			OcclusionCuller->CacheHZBForOcclusion();
+		}
 	}
 
 
@@ -350,71 +369,134 @@ void URenderer::RenderBegin() const
 	DeviceResources->UpdateViewport();
 }
 
-/**
- * @brief Buffer에 데이터 입력 및 Draw
- */
-void URenderer::RenderLevel(FViewportClient& InViewport)
+ULevel* URenderer::FindRenderLevel(const FViewportClient& InViewport)
 {
 	// Viewport가 렌더링할 World 결정: RenderTargetWorld가 있으면 사용, 없으면 Editor World 사용
 	UWorld* TargetWorld = InViewport.RenderTargetWorld
 		? InViewport.RenderTargetWorld
 		: UWorldManager::GetInstance().GetCurrentWorld().Get();
 
-	// PIE World 확인
-	bool bIsPIEWorld = InViewport.RenderTargetWorld && InViewport.RenderTargetWorld->IsPIEWorld();
-
 	// World 없으면 Early Return
 	if (!TargetWorld)
 	{
-		return;
+		return nullptr;
 	}
 
 	// World로부터 Level 가져오기
 	ULevel* TargetLevel = TargetWorld->GetLevel();
 	if (!TargetLevel)
-		return;
+		return nullptr;
 
 	// CRITICAL: Validate Level has actors before rendering
 	// If Level is being cleaned up, actors might be deleted
-	const auto& LevelActors = TargetLevel->GetActors();
-	if (LevelActors.empty())
+	if (TargetLevel->GetActors().empty())
 	{
 		// Level is empty or being cleaned up, skip rendering
-		return;
+		return nullptr;
 	}
+	return TargetLevel;
+}
 
-	// 통계 초기화
-	uint32 totalStaticPrimitives = TargetLevel->GetStaticOctree().GetObjectCount();
-	uint32 totalDynamicPrimitives = TargetLevel->GetDynamicPrimitives().size();
-	uint32 lodCounts[3] = { 0 };
+/**
+ * @brief 보이는 모든 뷰포트의 카메라를 갱신하고 뷰포트별 보이는 프리미티브 목록을 만든다
+ * 레벨마다 동적 프리미티브 스냅샷을 한 번 만든 뒤, 뷰포트들을 FSceneCuller로 동시에 컬링한다
+ */
+void URenderer::CullViewports()
+{
+	FScopeCycleCounter Counter(GetCullingStatId());
 
-	// Viewport의 Camera 사용
-	UCamera* InCurrentCamera = &InViewport.Camera;
+	// 컬링 워커는 월드 변환과 월드 AABB를 읽기만 하므로 여기서 남은 더티 노드와 AABB를 모두 갱신해 둔다
+	FPrimitiveBoundsTable::Get().UpdateBounds();
 
-	// Frustum Culling Test
-	FFrustum ViewFrustum = InCurrentCamera->GetViewFrustum();
+	TArray<FViewportClient>& Viewports = ViewportClient->GetViewports();
+	ViewportVisibleLists.resize(Viewports.size());
+	ViewCullRequests.clear();
+	CulledLevels.clear();
 
-	// 옥클루전 콜백 구조체 준비
-	struct OcclusionContext
+	// 요청이 스냅샷을 포인터로 가리키므로 미리 최대 개수만큼 잡아 둔다
+	if (DynamicPrimitiveSets.size() < Viewports.size())
 	{
-		UOcclusionCuller* OcclusionCuller;
-		const UCamera* Camera;
-		bool bHZBValid;
-	};
-
-	UOcclusionCuller* OcclusionCuller = CullingManager ? CullingManager->GetOcclusionCuller() : nullptr;
-	bool bHZBValid = OcclusionCuller && OcclusionCuller->IsHZBCacheValid();
+		DynamicPrimitiveSets.resize(Viewports.size());
+	}
 
-	OcclusionContext Context = { OcclusionCuller, InCurrentCamera, bHZBValid };
+	const bool bSoftwareOcclusion = CullingManager && CullingManager->GetOcclusionCuller() &&
+		CullingManager->GetOcclusionCuller()->GetOcclusionMode() == EOcclusionMode::CPU;
+	if (bSoftwareOcclusion && ViewportOcclusionBuffers.size() < Viewports.size())
+	{
+		ViewportOcclusionBuffers.resize(Viewports.size());
+	}
+	OcclusionViewportIndex = -1;
 
-	// 옥클루전 콜백 함수 (노드 AABB용 - 보수적 처리)
-	auto IsOccludedCallback = [](const FAABB& bounds, const void* context) -> bool
+	for (size_t ViewportIndex = 0; ViewportIndex < Viewports.size(); ++ViewportIndex)
 	{
-		const OcclusionContext* ctx = static_cast<const OcclusionContext*>(context);
-		if (!ctx->bHZBValid || !ctx->OcclusionCuller) return false;
+		FViewportClient& Viewport = Viewports[ViewportIndex];
+		FVisibleList& VisibleList = ViewportVisibleLists[ViewportIndex];
+		VisibleList.Reset();
 
-		return ctx->OcclusionCuller->IsOccluded(bounds.Min, bounds.Max, ctx->Camera, 2.5f);  // 노드도 2.5배 확장 (보수적)
-	};
+		// Update()와 같은 조건으로 숨겨졌거나 닫힌 뷰포트는 건너뜁니다.
+		if (!Viewport.bIsVisible) { continue; }
+		if (Viewport.GetViewportInfo().Width < 1.0f || Viewport.GetViewportInfo().Height < 1.0f) { continue; }
+
+		UCamera* CurrentCamera = &Viewport.Camera;
+		CurrentCamera->Update(Viewport.GetViewportInfo());
+
+		ULevel* TargetLevel = FindRenderLevel(Viewport);
+		if (!TargetLevel) { continue; }
+
+		// 같은 레벨을 보는 뷰포트끼리는 동적 프리미티브 스냅샷을 공유
+		auto LevelIt = std::find(CulledLevels.begin(), CulledLevels.end(), TargetLevel);
+		const size_t SetIndex = static_cast<size_t>(LevelIt - CulledLevels.begin());
+		if (LevelIt == CulledLevels.end())
+		{
+			CulledLevels.push_back(TargetLevel);
+			DynamicPrimitiveSets[SetIndex].Build(TargetLevel->GetDynamicPrimitives());
+		}
+
+		FViewCullRequest Request{ CurrentCamera->GetViewFrustum(), &TargetLevel->GetStaticOctree(), &DynamicPrimitiveSets[SetIndex], &VisibleList };
+		if (bSoftwareOcclusion)
+		{
+			// 뷰포트의 1/4 해상도 (가로 최대 512)로 오클루더를 래스터화
+			const D3D11_VIEWPORT ViewportInfo = Viewport.GetViewportInfo();
+			const float BufferScale = std::min(0.25f, 512.0f / ViewportInfo.Width);
+			FSoftwareOcclusionBuffer& OcclusionBuffer = ViewportOcclusionBuffers[ViewportIndex];
+			OcclusionBuffer.Initialize(static_cast<uint32>(ViewportInfo.Width * BufferScale), static_cast<uint32>(ViewportInfo.Height * BufferScale));
+
+			const FViewProjConstants& ViewProj = CurrentCamera->GetFViewProjConstants();
+			Request.OcclusionBuffer = &OcclusionBuffer;
+			Request.ViewProjection = ViewProj.View * ViewProj.Projection;
+
+			// HZB 캐시는 하나뿐이므로 활성 뷰포트의 버퍼를 우선한다
+			if (OcclusionViewportIndex < 0 || &Viewport == ViewportClient->GetActiveViewportClient())
+			{
+				OcclusionViewportIndex = static_cast<int32>(ViewportIndex);
+			}
+		}
+		ViewCullRequests.push_back(Request);
+	}
+
+	FScopeCycleCounter FrustumCullingCounter(GetFrustumCullingStatId());
+	FSceneCuller::CullViews(ViewCullRequests);
+}
+
+/**
+ * @brief 컬링 결과(메시/머티리얼 순으로 정렬된 목록)를 순서대로 Draw
+ */
+void URenderer::RenderLevel(FViewportClient& InViewport, const FVisibleList& InVisibleList)
+{
+	ULevel* TargetLevel = FindRenderLevel(InViewport);
+	if (!TargetLevel)
+		return;
+
+	// PIE World 확인
+	bool bIsPIEWorld = InViewport.RenderTargetWorld && InViewport.RenderTargetWorld->IsPIEWorld();
+
+	// 통계 초기화
+	uint32 totalStaticPrimitives = TargetLevel->GetStaticOctree().GetObjectCount();
+	uint32 totalDynamicPrimitives = TargetLevel->GetDynamicPrimitives().size();
+	uint32 lodCounts[3] = { 0 };
+
+	// Viewport의 Camera 사용
+	UCamera* InCurrentCamera = &InViewport.Camera;
 
 	// 렌더링 통계를 위한 카운터
 	uint32 renderedPrimitiveCount = 0;
@@ -545,51 +627,16 @@ void URenderer::RenderLevel(FViewportClient& InViewport)
 	};
 
 
+	// 컬링 단계에서 이미 보이는 것만 골라 정렬해 두었으므로 순서대로 제출만 한다
+	for (const FVisiblePrimitive& Visible : InVisibleList.Primitives)
 	{
-		FScopeCycleCounter Counter(GetCullingStatId());
-		// 옵트리에서 람다 기반 렌더링 수행 (Static Primitives)
-		TargetLevel->GetStaticOctree().QueryFrustumWithRenderCallback(ViewFrustum, nullptr, &Context, RenderCallback, nullptr);
-	}
-	// Dynamic Primitives 처리
-	const auto& DynamicPrimitives = TargetLevel->GetDynamicPrimitives();
-	
-	uint32 dynamicRenderedCount = 0;
-	for (UPrimitiveComponent* DynPrim : DynamicPrimitives)
-	{
-		// Skip null or deleted components
-		if (!DynPrim || DynPrim->IsPendingKill())
-		{
-			continue;
-		}
-		if (!DynPrim->IsVisible())
-		{
-			if (bIsPIEWorld)
-			{
-				printf("PIE Mode: Dynamic primitive is not visible: %s\n", DynPrim->GetName().ToString().c_str());
-			}
-			continue;
-		}
-		FVector WorldMin, WorldMax;
-		DynPrim->GetWorldAABB(WorldMin, WorldMax);
-		bool bInFrustum = ViewFrustum.IsBoxInFrustum(FAABB(WorldMin, WorldMax));
-		if (!bInFrustum)
-		{
-			continue;
-		}
-		
-		dynamicRenderedCount++;
-		if (bIsPIEWorld)
-		{
-			printf("PIE Mode: Rendering dynamic primitive: %s\n", DynPrim->GetName().ToString().c_str());
-		}
-		
-		RenderCallback(DynPrim, nullptr);
+		RenderCallback(Visible.Primitive, nullptr);
 	}
-	
+
 	// PIE 모드에서 최종 렌더링 통계 로그
 	if (bIsPIEWorld)
 	{
-		printf("PIE Mode: Successfully rendered %d dynamic primitives\n", dynamicRenderedCount);
+		printf("PIE Mode: Successfully rendered %u dynamic primitives\n", InVisibleList.NumDynamic);
 	}
 	
 }
@@ -4,6 +4,8 @@
 #include "Component/Public/PrimitiveComponent.h"
 #include "Editor/Public/EditorPrimitive.h"
 #include "Editor/Public/ViewportClient.h"
+#include "Render/Culling/Public/SceneCuller.h"
+#include "Render/Culling/Public/SoftwareOcclusion.h"
 
 class UPipeline;
 class UDeviceResources;
@@ -18,6 +20,7 @@ class FViewport;
 class UCamera;
 class UCullingManager;
 class UBillboardComponent;
+class ULevel;
 
 /**
  * @brief Rendering Pipeline 전반을 처리하는 클래스
@@ -73,7 +76,8 @@ public:
 	// Render
 	void Update();
 	void RenderBegin() const;
-	void RenderLevel(FViewportClient& InViewport);
+	void CullViewports();
+	void RenderLevel(FViewportClient& InViewport, const FVisibleList& InVisibleList);
 	void RenderEnd() const;
 	void RenderStaticMesh(UStaticMeshComponent* InMeshComp, ID3D11RasterizerState* InRasterizerState);
 	void RenderText(UTextRenderComponent* TextRenderComp, UCamera* InCurrentCamera);
@@ -122,6 +126,8 @@ public:
 	// Helper function
 	static D3D11_CULL_MODE ToD3D11(ECullMode InCull);
 	static D3D11_FILL_MODE ToD3D11(EFillMode InFill);
+	// 뷰포트가 렌더링할 레벨 (RenderTargetWorld가 없으면 Editor World, 액터가 없으면 nullptr)
+	static ULevel* FindRenderLevel(const FViewportClient& InViewport);
 
 	// Getter & Setter
 	ID3D11Device* GetDevice() const { return DeviceResources->GetDevice(); }
@@ -142,6 +148,14 @@ private:
 	UCullingManager* CullingManager = nullptr;
 	TArray<UPrimitiveComponent*> PrimitiveComponents;
 
+	// 뷰포트별 컬링 결과 (GetViewports()와 같은 인덱스, 매 프레임 재사용)
+	TArray<FVisibleList> ViewportVisibleLists;
+	TArray<FViewCullRequest> ViewCullRequests;
+	TArray<ULevel*> CulledLevels;                          // DynamicPrimitiveSets와 같은 인덱스
+	TArray<FDynamicPrimitiveSet> DynamicPrimitiveSets;     // 레벨별 동적 프리미티브 스냅샷 (뷰포트끼리 공유)
+	TArray<FSoftwareOcclusionBuffer> ViewportOcclusionBuffers;  // CPU 오클루전 모드에서 뷰포트별 깊이 버퍼
+	int32 OcclusionViewportIndex = -1;                     // 이번 프레임 HZB 캐시에 쓸 뷰포트 (보이는 활성 뷰포트, 없으면 처음 컬링한 뷰포트)
+
 	ID3D11DepthStencilState* DefaultDepthStencilState = nullptr;
 	ID3D11DepthStencilState* DisabledDepthStencilState = nullptr;
 	ID3D11DepthStencilState* ReadOnlyDepthStencilState = nullptr;  // Z-Test O, Z-Write X
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Render/Spatial/Public/Frustum.h"
+#include "Utility/Public/PlatformSIMD.h"
 #include <immintrin.h>  // SSE/AVX 지원
 #include <xmmintrin.h>  // SSE
 #include <emmintrin.h>  // SSE2
@@ -91,6 +92,166 @@ bool FFrustum::IsBoxInFrustum(const FAABB& Box) const
 	return true;
 }
 
+EFrustumTest FFrustum::ClassifyBox(const FAABB& Box) const
+{
+	bool bFullyInside = true;
+	for (int i = 0; i < PlaneCount; ++i)
+	{
+		const FPlane& Plane = Planes[i];
+
+		// 평면 노멀 방향으로 가장 먼 꼭짓점(P)과 가장 가까운 꼭짓점(N)
+		const FVector P(Plane.Normal.X > 0.0f ? Box.Max.X : Box.Min.X,
+			Plane.Normal.Y > 0.0f ? Box.Max.Y : Box.Min.Y,
+			Plane.Normal.Z > 0.0f ? Box.Max.Z : Box.Min.Z);
+		const FVector N(Plane.Normal.X > 0.0f ? Box.Min.X : Box.Max.X,
+			Plane.Normal.Y > 0.0f ? Box.Min.Y : Box.Max.Y,
+			Plane.Normal.Z > 0.0f ? Box.Min.Z : Box.Max.Z);
+
+		if (Plane.GetDistanceToPoint(P) < -FRUSTUM_EPSILON)
+			return EFrustumTest::Outside;
+		if (Plane.GetDistanceToPoint(N) < 0.0f)
+			bFullyInside = false;
+	}
+	return bFullyInside ? EFrustumTest::Inside : EFrustumTest::Intersects;
+}
+
+namespace
+{
+	// 평면마다 노멀 부호로 Min/Max 중 한쪽을 고르는 것은 박스와 무관하므로 배열 포인터를 고른다
+	// 합산 순서는 IsBoxInFrustum의 hadd와 같은 (nx*x + ny*y) + nz*z + d
+	SIMD_TARGET_AVX2 uint32 AreBoxesInFrustum8AVX2(const FPlane* Planes, const float* MinX, const float* MinY, const float* MinZ,
+		const float* MaxX, const float* MaxY, const float* MaxZ)
+	{
+		const __m256 Epsilon = _mm256_set1_ps(-FRUSTUM_EPSILON);
+		__m256 Inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+		for (int i = 0; i < FFrustum::PlaneCount; ++i)
+		{
+			const FPlane& Plane = Planes[i];
+			const __m256 X = _mm256_loadu_ps(Plane.Normal.X > 0.0f ? MaxX : MinX);
+			const __m256 Y = _mm256_loadu_ps(Plane.Normal.Y > 0.0f ? MaxY : MinY);
+			const __m256 Z = _mm256_loadu_ps(Plane.Normal.Z > 0.0f ? MaxZ : MinZ);
+
+			__m256 Dist = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(Plane.Normal.X), X), _mm256_mul_ps(_mm256_set1_ps(Plane.Normal.Y), Y));
+			Dist = _mm256_add_ps(Dist, _mm256_mul_ps(_mm256_set1_ps(Plane.Normal.Z), Z));
+			Dist = _mm256_add_ps(Dist, _mm256_set1_ps(Plane.Distance));
+
+			Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(Dist, Epsilon, _CMP_NLT_UQ));
+		}
+		return static_cast<uint32>(_mm256_movemask_ps(Inside));
+	}
+
+	// P 꼭짓점 검사(겹침)와 N 꼭짓점 검사(완전히 안쪽)를 같은 루프에서 계산
+	SIMD_TARGET_AVX2 void ClassifyBoxes8AVX2(const FPlane* Planes, const float* MinX, const float* MinY, const float* MinZ,
+		const float* MaxX, const float* MaxY, const float* MaxZ, uint32& OutVisibleMask, uint32& OutInsideMask)
+	{
+		const __m256 Epsilon = _mm256_set1_ps(-FRUSTUM_EPSILON);
+		const __m256 Zero = _mm256_setzero_ps();
+		__m256 Visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		__m256 Inside = Visible;
+
+		for (int i = 0; i < FFrustum::PlaneCount; ++i)
+		{
+			const FPlane& Plane = Planes[i];
+			const __m256 NX = _mm256_set1_ps(Plane.Normal.X);
+			const __m256 NY = _mm256_set1_ps(Plane.Normal.Y);
+			const __m256 NZ = _mm256_set1_ps(Plane.Normal.Z);
+			const __m256 D = _mm256_set1_ps(Plane.Distance);
+			const bool bPosX = Plane.Normal.X > 0.0f, bPosY = Plane.Normal.Y > 0.0f, bPosZ = Plane.Normal.Z > 0.0f;
+
+			__m256 DistP = _mm256_add_ps(_mm256_mul_ps(NX, _mm256_loadu_ps(bPosX ? MaxX : MinX)), _mm256_mul_ps(NY, _mm256_loadu_ps(bPosY ? MaxY : MinY)));
+			DistP = _mm256_add_ps(_mm256_add_ps(DistP, _mm256_mul_ps(NZ, _mm256_loadu_ps(bPosZ ? MaxZ : MinZ))), D);
+			__m256 DistN = _mm256_add_ps(_mm256_mul_ps(NX, _mm256_loadu_ps(bPosX ? MinX : MaxX)), _mm256_mul_ps(NY, _mm256_loadu_ps(bPosY ? MinY : MaxY)));
+			DistN = _mm256_add_ps(_mm256_add_ps(DistN, _mm256_mul_ps(NZ, _mm256_loadu_ps(bPosZ ? MinZ : MaxZ))), D);
+
+			Visible = _mm256_and_ps(Visible, _mm256_cmp_ps(DistP, Epsilon, _CMP_NLT_UQ));
+			Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(DistN, Zero, _CMP_GE_OQ));
+		}
+		OutVisibleMask = static_cast<uint32>(_mm256_movemask_ps(Visible));
+		OutInsideMask = static_cast<uint32>(_mm256_movemask_ps(_mm256_and_ps(Inside, Visible)));
+	}
+
+	void ClassifyBoxes4(const FPlane* Planes, const float* MinX, const float* MinY, const float* MinZ,
+		const float* MaxX, const float* MaxY, const float* MaxZ, uint32& OutVisibleMask, uint32& OutInsideMask)
+	{
+		const __m128 Epsilon = _mm_set1_ps(-FRUSTUM_EPSILON);
+		const __m128 Zero = _mm_setzero_ps();
+		__m128 Visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		__m128 Inside = Visible;
+
+		for (int i = 0; i < FFrustum::PlaneCount; ++i)
+		{
+			const FPlane& Plane = Planes[i];
+			const __m128 NX = _mm_set1_ps(Plane.Normal.X);
+			const __m128 NY = _mm_set1_ps(Plane.Normal.Y);
+			const __m128 NZ = _mm_set1_ps(Plane.Normal.Z);
+			const __m128 D = _mm_set1_ps(Plane.Distance);
+			const bool bPosX = Plane.Normal.X > 0.0f, bPosY = Plane.Normal.Y > 0.0f, bPosZ = Plane.Normal.Z > 0.0f;
+
+			__m128 DistP = _mm_add_ps(_mm_mul_ps(NX, _mm_loadu_ps(bPosX ? MaxX : MinX)), _mm_mul_ps(NY, _mm_loadu_ps(bPosY ? MaxY : MinY)));
+			DistP = _mm_add_ps(_mm_add_ps(DistP, _mm_mul_ps(NZ, _mm_loadu_ps(bPosZ ? MaxZ : MinZ))), D);
+			__m128 DistN = _mm_add_ps(_mm_mul_ps(NX, _mm_loadu_ps(bPosX ? MinX : MaxX)), _mm_mul_ps(NY, _mm_loadu_ps(bPosY ? MinY : MaxY)));
+			DistN = _mm_add_ps(_mm_add_ps(DistN, _mm_mul_ps(NZ, _mm_loadu_ps(bPosZ ? MinZ : MaxZ))), D);
+
+			Visible = _mm_and_ps(Visible, _mm_cmpnlt_ps(DistP, Epsilon));
+			Inside = _mm_and_ps(Inside, _mm_cmpge_ps(DistN, Zero));
+		}
+		OutVisibleMask = static_cast<uint32>(_mm_movemask_ps(Visible));
+		OutInsideMask = static_cast<uint32>(_mm_movemask_ps(_mm_and_ps(Inside, Visible)));
+	}
+}
+
+uint32 FFrustum::AreBoxesInFrustum4(const float* MinX, const float* MinY, const float* MinZ,
+	const float* MaxX, const float* MaxY, const float* MaxZ) const
+{
+	const __m128 Epsilon = _mm_set1_ps(-FRUSTUM_EPSILON);
+	__m128 Inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+	for (int i = 0; i < PlaneCount; ++i)
+	{
+		const FPlane& Plane = Planes[i];
+		const __m128 X = _mm_loadu_ps(Plane.Normal.X > 0.0f ? MaxX : MinX);
+		const __m128 Y = _mm_loadu_ps(Plane.Normal.Y > 0.0f ? MaxY : MinY);
+		const __m128 Z = _mm_loadu_ps(Plane.Normal.Z > 0.0f ? MaxZ : MinZ);
+
+		__m128 Dist = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Plane.Normal.X), X), _mm_mul_ps(_mm_set1_ps(Plane.Normal.Y), Y));
+		Dist = _mm_add_ps(Dist, _mm_mul_ps(_mm_set1_ps(Plane.Normal.Z), Z));
+		Dist = _mm_add_ps(Dist, _mm_set1_ps(Plane.Distance));
+
+		Inside = _mm_and_ps(Inside, _mm_cmpnlt_ps(Dist, Epsilon));
+	}
+	return static_cast<uint32>(_mm_movemask_ps(Inside));
+}
+
+uint32 FFrustum::AreBoxesInFrustum8(const float* MinX, const float* MinY, const float* MinZ,
+	const float* MaxX, const float* MaxY, const float* MaxZ) const
+{
+	if (FPlatformSIMD::HasAVX2())
+	{
+		return AreBoxesInFrustum8AVX2(Planes, MinX, MinY, MinZ, MaxX, MaxY, MaxZ);
+	}
+
+	const uint32 Low = AreBoxesInFrustum4(MinX, MinY, MinZ, MaxX, MaxY, MaxZ);
+	const uint32 High = AreBoxesInFrustum4(MinX + 4, MinY + 4, MinZ + 4, MaxX + 4, MaxY + 4, MaxZ + 4);
+	return Low | (High << 4);
+}
+
+void FFrustum::ClassifyBoxes8(const float* MinX, const float* MinY, const float* MinZ,
+	const float* MaxX, const float* MaxY, const float* MaxZ, uint32& OutVisibleMask, uint32& OutInsideMask) const
+{
+	if (FPlatformSIMD::HasAVX2())
+	{
+		ClassifyBoxes8AVX2(Planes, MinX, MinY, MinZ, MaxX, MaxY, MaxZ, OutVisibleMask, OutInsideMask);
+		return;
+	}
+
+	uint32 LowVisible, LowInside, HighVisible, HighInside;
+	ClassifyBoxes4(Planes, MinX, MinY, MinZ, MaxX, MaxY, MaxZ, LowVisible, LowInside);
+	ClassifyBoxes4(Planes, MinX + 4, MinY + 4, MinZ + 4, MaxX + 4, MaxY + 4, MaxZ + 4, HighVisible, HighInside);
+	OutVisibleMask = LowVisible | (HighVisible << 4);
+	OutInsideMask = LowInside | (HighInside << 4);
+}
+
 /* point test */
 bool FFrustum::IsPointInFrustum(const FVector& Point) const
 {
@@ -2,237 +2,10 @@
 #include "Render/Spatial/Public/Octree.h"
 #include "Component/Public/PrimitiveComponent.h"
 
-FOctree::FOctreeNode::~FOctreeNode()
+namespace
 {
-	for (FOctreeNode* Child : Children)
-	{
-		delete Child;
-	}
-}
-
-void FOctree::FOctreeNode::Subdivide()
-{
-	/**
-	 * @brief 노드를 8개의 자식 노드로 분할합니다
-	 * Octree는 3D 공간을 8개의 사분면으로 나눅니다
-	 */
-
-	if (!bIsLeaf) return;  // 이미 분할된 노드
-
-	const FVector Center = (Bounds.Min + Bounds.Max) * 0.5f;
-	const FVector Size = (Bounds.Max - Bounds.Min) * 0.5f;
-
-	// 8개 자식 노드 생성
-	for (int i = 0; i < 8; ++i)
-	{
-		Children[i] = new FOctreeNode(GetChildBounds(i));
-	}
-
-	bIsLeaf = false;
-}
-
-void FOctree::FOctreeNode::Insert(UPrimitiveComponent* Object, const FAABB& ObjectBounds, int Depth)
-{
-	/**
-	 * @brief 오브젝트를 Octree에 삽입합니다
-	 * 리프 노드이고 용량이 있으면 여기에 저장
-	 * 그렇지 않으면 분할 후 적절한 자식에게 위임
-	 */
-
-	 // 최대 깊이 체크
-	if (Depth >= MAX_DEPTH)
-	{
-		Objects.push_back(Object);
-		return;
-	}
-
-	// 리프 노드이고 용량에 여유가 있으면 여기에 저장
-	if (bIsLeaf && Objects.size() < MAX_OBJECTS_PER_NODE)
-	{
-		Objects.push_back(Object);
-		return;
-	}
-
-	// 분할 필요 → 자식 생성 후 재배치
-	if (bIsLeaf)
-	{
-		Subdivide();
-
-		// 기존 오브젝트들을 자식에게 재배치
-		for (UPrimitiveComponent* ExistingObject : Objects)
-		{
-			FVector Min, Max;
-			ExistingObject->GetWorldAABB(Min, Max);
-			FAABB ExistingBounds(Min, Max);
-
-			int BestChild = GetBestChildIndex(ExistingBounds);
-			if (BestChild >= 0)
-			{
-				Children[BestChild]->Insert(ExistingObject, ExistingBounds, Depth + 1);
-			}
-		}
-		Objects.clear();
-	}
-
-	// 새 오브젝트를 적절한 자식에게 삽입
-	int BestChild = GetBestChildIndex(ObjectBounds);
-	if (BestChild >= 0)
-	{
-		Children[BestChild]->Insert(Object, ObjectBounds, Depth + 1);
-	}
-	else
-	{
-		// 여러 자식에 걸칩 - 여기에 저장
-		Objects.push_back(Object);
-	}
-}
-
-
-void FOctree::FOctreeNode::Query(const FAABB& QueryBounds, TArray<UPrimitiveComponent*>& Results) const
-{
-	/**
-	 * @brief AABB와 교집합하는 모든 오브젝트를 찾습니다
-	 */
-
-	 // 이 노드가 쿼리 영역과 교집합하는지 확인
-	if (!Bounds.Intersects(QueryBounds))
-		return;
-
-	// 이 노드의 오브젝트들 추가
-	for (UPrimitiveComponent* Object : Objects)
-	{
-		FVector Min, Max;
-		Object->GetWorldAABB(Min, Max);
-		FAABB ObjectBounds(Min, Max);
-
-		if (ObjectBounds.Intersects(QueryBounds))
-		{
-			Results.push_back(Object);
-		}
-	}
-
-	// 자식들도 재귀적으로 쿼리
-	if (!bIsLeaf)
-	{
-		for (FOctreeNode* Child : Children)
-		{
-			if (Child)
-			{
-				Child->Query(QueryBounds, Results);
-			}
-		}
-	}
-}
-
-void FOctree::FOctreeNode::QueryFrustum(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& Results) const
-{
-	/**
-	 * @brief Frustum과 교집합하는 모든 오브젝트를 찾습니다
-	 * 핵심 기능: Spatial Partitioning + Frustum Culling 통합!
-	 */
-
-	 // 1. 이 노드가 Frustum과 교집합하는지 확인
-	if (!Frustum.IsBoxInFrustum(Bounds))
-		return;  // 이 노드와 모든 자식 스킵
-
-	// 2. 이 노드의 오브젝트들 추가
-	for (UPrimitiveComponent* Object : Objects)
-	{
-		FVector Min, Max;
-		Object->GetWorldAABB(Min, Max);
-		FAABB ObjectBounds(Min, Max);
-
-		if (Frustum.IsBoxInFrustum(ObjectBounds))
-		{
-			Results.push_back(Object);
-		}
-	}
-
-	// 3. 자식들도 재귀적으로 쿼리
-	if (!bIsLeaf)
-	{
-		for (FOctreeNode* Child : Children)
-		{
-			if (Child)
-			{
-				Child->QueryFrustum(Frustum, Results);
-			}
-		}
-	}
-}
-
-void FOctree::FOctreeNode::QueryFrustumWithOcclusion(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& Results,
-	bool (*IsOccludedFunc)(const FAABB&, const void*), const void* OcclusionContext) const
-{
-	/**
-	 * @brief Frustum과 교집합하고 옥클루전되지 않은 모든 오브젝트를 찾습니다
-	 * 노드 레벨에서 옥클루전 컬링을 수행합니다
-	 */
-
-	 // 1. 이 노드가 Frustum과 교집합하는지 확인
-	if (!Frustum.IsBoxInFrustum(Bounds))
-		return;  // 이 노드와 모든 자식 스킵
-
-	// 2. 계층적 노드 옥클루전 - n 프레임 연속 시스템
-	if (IsOccludedFunc)
-	{
-		bool bIsNodeOccluded = IsOccludedFunc(Bounds, OcclusionContext);
-
-		// 노드 옥클루전 상태 업데이트
-		UpdateNodeOcclusionState(bIsNodeOccluded);
-
-		// n 프레임 이상 연속으로 가려진 경우에만 실제 컬링
-		if (ShouldCullNodeForOcclusion())
-		{
-			// 노드 레벨 컬링: 이 노드와 모든 자식, 객체들을 스킵
-			return;
-		}
-	}
-
-	// 3. 노드가 가려지지 않았으므로 이 노드의 모든 객체들을 추가
-	for (UPrimitiveComponent* Object : Objects)
-	{
-		FVector Min, Max;
-		Object->GetWorldAABB(Min, Max);
-		FAABB ObjectBounds(Min, Max);
-
-		if (Frustum.IsBoxInFrustum(ObjectBounds))
-		{
-			Results.push_back(Object);
-		}
-	}
-
-	// 5. 자식들도 재귀적으로 쿼리
-	if (!bIsLeaf)
-	{
-		for (FOctreeNode* Child : Children)
-		{
-			if (Child)
-			{
-				Child->QueryFrustumWithOcclusion(Frustum, Results, IsOccludedFunc, OcclusionContext);
-			}
-		}
-	}
-}
-
-
-void FOctree::FOctreeNode::Clear()
-{
-	/**
-	 * @brief 노드의 모든 데이터를 삭제합니다
-	 */
-
-	Objects.clear();
-
-	if (!bIsLeaf)
-	{
-		for (FOctreeNode* Child : Children)
-		{
-			delete Child;
-		}
-		Children.fill(nullptr);
-		bIsLeaf = true;
-	}
+	// 노드 구간의 첫 용량 (4 -> 8 -> 16). SoA 바운드를 4개 단위로 읽으므로 구간 시작/용량은 4의 배수를 유지
+	constexpr int32 InitialNodeCapacity = 4;
 }
 
 FAABB FOctree::FOctreeNode::GetChildBounds(int ChildIndex) const
@@ -314,13 +87,19 @@ void FOctree::Initialize(const FAABB& InWorldBounds)
 {
 	Clear();
 	WorldBounds = InWorldBounds;
-	Root = new FOctreeNode(InWorldBounds);
+	CreateNode(InWorldBounds, InWorldBounds, INDEX_NONE);
 }
 
 void FOctree::Clear()
 {
-	delete Root;
-	Root = nullptr;
+	// 용량은 유지해서 재초기화 시 할당이 없도록 한다
+	// 컴포넌트에 남은 핸들은 FindNode에서 슬롯 검증으로 걸러진다
+	Nodes.clear();
+	NodeLooseBounds.Clear();
+	ObjectPool.clear();
+	BoundsPool.Clear();
+	WastedSlots = 0;
+	NumObjects = 0;
 }
 
 bool FOctree::Insert(UPrimitiveComponent* Object)
@@ -336,24 +115,28 @@ bool FOctree::Insert(UPrimitiveComponent* Object)
 
 bool FOctree::Insert(UPrimitiveComponent* Object, const FAABB& ObjectBounds)
 {
-	if (Root && IsValidObject(Object, ObjectBounds))
+	if (Nodes.empty() || !Object) return false;
+
+	// 이미 들어 있으면 중복 삽입 대신 위치 갱신
+	if (FindNode(Object) != INDEX_NONE)
 	{
-		Root->Insert(Object, ObjectBounds, 0);
-		return true;
+		return Update(Object, ObjectBounds);
 	}
-	return false;
+
+	if (!IsValidObject(Object, ObjectBounds)) return false;
+
+	InsertIntoNode(0, Object, ObjectBounds);
+	return true;
 }
 
 void FOctree::Remove(UPrimitiveComponent* Object)
 {
 	if (!Object) return;
 
-	uint32 ObjectUUID = Object->GetUUID();
-	// Object not found in location map - perform exhaustive search
-	// This handles cases where ObjectLocationMap is out of sync
-	if (Root)
+	const int32 NodeIndex = FindNode(Object);
+	if (NodeIndex != INDEX_NONE)
 	{
-		RemoveFromNodeRecursive(Root, Object);
+		RemoveFromNode(NodeIndex, Object->OctreeSlot);
 	}
 }
 
@@ -361,41 +144,178 @@ bool FOctree::Update(UPrimitiveComponent* Object)
 {
 	if (!Object) return false;
 
-	// Simple approach: remove and reinsert
-	Remove(Object);
-	Insert(Object);
+	FVector Min, Max;
+	Object->GetWorldAABB(Min, Max);
+	FAABB ObjectBounds(Min, Max);
+
+	return Update(Object, ObjectBounds);
+}
+
+bool FOctree::Update(UPrimitiveComponent* Object, const FAABB& ObjectBounds)
+{
+	if (!Object) return false;
+
+	const int32 NodeIndex = FindNode(Object);
+	if (NodeIndex == INDEX_NONE)
+	{
+		return Insert(Object, ObjectBounds);
+	}
+
+	if (!IsValidObject(Object, ObjectBounds))
+	{
+		RemoveFromNode(NodeIndex, Object->OctreeSlot);
+		return false;
+	}
+
+	// 현재 노드의 loose 범위 안에서 움직였으면 노드는 그대로 두고 바운드만 갱신
+	const FOctreeNode& Node = Nodes[NodeIndex];
+	if (Node.LooseBounds.Contains(ObjectBounds))
+	{
+		BoundsPool.Set(Node.ObjectStart + Object->OctreeSlot, ObjectBounds);
+		return true;
+	}
+
+	// 벗어났으면 새 바운드를 담을 수 있는 가장 가까운 조상에서부터 다시 내려간다 (루트 = 월드 범위)
+	int32 Target = Node.Parent != INDEX_NONE ? Node.Parent : 0;
+	RemoveFromNode(NodeIndex, Object->OctreeSlot);
+
+	while (Nodes[Target].Parent != INDEX_NONE && !Nodes[Target].LooseBounds.Contains(ObjectBounds))
+	{
+		Target = Nodes[Target].Parent;
+	}
+
+	InsertIntoNode(Target, Object, ObjectBounds);
 	return true;
 }
 
 TArray<UPrimitiveComponent*> FOctree::Query(const FAABB& QueryBounds) const
 {
+	/**
+	 * @brief AABB와 교집합하는 모든 오브젝트를 찾습니다
+	 */
+
 	TArray<UPrimitiveComponent*> Results;
-	if (Root)
+	if (Nodes.empty()) return Results;
+
+	int32 Stack[TRAVERSAL_STACK_SIZE];
+	int32 StackSize = 0;
+	Stack[StackSize++] = 0;
+
+	while (StackSize > 0)
 	{
-		Root->Query(QueryBounds, Results);
+		const FOctreeNode& Node = Nodes[Stack[--StackSize]];
+
+		// 이 노드가 쿼리 영역과 교집합하는지 확인 (오브젝트는 loose 범위까지 걸쳐 있을 수 있음)
+		if (!Node.LooseBounds.Intersects(QueryBounds))
+			continue;
+
+		const int32 End = Node.ObjectStart + Node.ObjectCount;
+		for (int32 i = Node.ObjectStart; i < End; ++i)
+		{
+			if (BoundsPool.Get(i).Intersects(QueryBounds))
+			{
+				Results.push_back(ObjectPool[i]);
+			}
+		}
+
+		if (!Node.IsLeaf())
+		{
+			for (int32 Child = 7; Child >= 0; --Child)
+			{
+				Stack[StackSize++] = Node.FirstChild + Child;
+			}
+		}
 	}
 	return Results;
 }
 
 TArray<UPrimitiveComponent*> FOctree::QueryFrustum(const FFrustum& Frustum) const
 {
+	/**
+	 * @brief Frustum과 교집합하는 모든 오브젝트를 찾습니다
+	 * 핵심 기능: Spatial Partitioning + Frustum Culling 통합!
+	 */
+
 	TArray<UPrimitiveComponent*> Results;
-	if (Root)
+	QueryFrustum(Frustum, Results);
+	return Results;
+}
+
+void FOctree::QueryFrustum(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& OutResults) const
+{
+	TraverseFrustum(Frustum, nullptr, nullptr, [&](UPrimitiveComponent* Object) { OutResults.push_back(Object); });
+}
+
+void FOctree::SplitFrustumQuery(const FFrustum& Frustum, int32 InMinSubtrees,
+	TArray<FFrustumSubtree>& OutSubtrees, TArray<UPrimitiveComponent*>& OutResults) const
+{
+	OutSubtrees.clear();
+	if (Nodes.empty()) return;
+
+	const EFrustumTest RootTest = Frustum.ClassifyBox(Nodes[0].LooseBounds);
+	if (RootTest == EFrustumTest::Outside) return;
+
+	OutSubtrees.push_back({ 0, RootTest == EFrustumTest::Inside });
+
+	// 한 단계씩 펼친다: 리프는 그대로 두고, 내부 노드는 자기 오브젝트를 결과에 넣은 뒤 보이는 자식들로 대체
+	TArray<FFrustumSubtree> NextLevel;
+	while (static_cast<int32>(OutSubtrees.size()) < InMinSubtrees)
 	{
-		Root->QueryFrustum(Frustum, Results);
+		bool bExpanded = false;
+		NextLevel.clear();
+		for (const FFrustumSubtree& Entry : OutSubtrees)
+		{
+			const FOctreeNode& Node = Nodes[Entry.NodeIndex];
+			if (Node.IsLeaf())
+			{
+				NextLevel.push_back(Entry);
+				continue;
+			}
+
+			bExpanded = true;
+			VisitNodeObjects(Frustum, Node, Entry.bFullyInside, [&](UPrimitiveComponent* Object) { OutResults.push_back(Object); });
+
+			uint32 VisibleMask, InsideMask;
+			ClassifyChildren(Frustum, Node, Entry.bFullyInside, VisibleMask, InsideMask);
+			for (int32 Child = 0; Child < 8; ++Child)
+			{
+				if (VisibleMask & (1u << Child))
+				{
+					NextLevel.push_back({ Node.FirstChild + Child, (InsideMask & (1u << Child)) != 0 });
+				}
+			}
+		}
+
+		if (!bExpanded) break;
+		OutSubtrees.swap(NextLevel);
 	}
-	return Results;
+}
+
+void FOctree::ClassifyChildren(const FFrustum& Frustum, const FOctreeNode& Node, bool bFullyInside, uint32& OutVisibleMask, uint32& OutInsideMask) const
+{
+	if (bFullyInside)
+	{
+		OutVisibleMask = 0xFFu;
+		OutInsideMask = 0xFFu;
+		return;
+	}
+
+	const int32 First = Node.FirstChild;
+	Frustum.ClassifyBoxes8(&NodeLooseBounds.MinX[First], &NodeLooseBounds.MinY[First], &NodeLooseBounds.MinZ[First],
+		&NodeLooseBounds.MaxX[First], &NodeLooseBounds.MaxY[First], &NodeLooseBounds.MaxZ[First], OutVisibleMask, OutInsideMask);
 }
 
 
 TArray<UPrimitiveComponent*> FOctree::QueryFrustumWithOcclusion(const FFrustum& Frustum,
 	bool (*IsOccludedFunc)(const FAABB&, const void*), const void* OcclusionContext) const
 {
+	/**
+	 * @brief Frustum과 교집합하고 옥클루전되지 않은 모든 오브젝트를 찾습니다
+	 * 노드 레벨에서 옥클루전 컬링을 수행합니다
+	 */
+
 	TArray<UPrimitiveComponent*> Results;
-	if (Root)
-	{
-		Root->QueryFrustumWithOcclusion(Frustum, Results, IsOccludedFunc, OcclusionContext);
-	}
+	TraverseFrustum(Frustum, IsOccludedFunc, OcclusionContext, [&](UPrimitiveComponent* Object) { Results.push_back(Object); });
 	return Results;
 }
 
@@ -419,17 +339,22 @@ void FOctree::FOctreeNode::UpdateNodeOcclusionState(bool bIsOccludedThisFrame) c
 
 uint32 FOctree::GetObjectCount() const
 {
-	return Root ? CountObjects(Root) : 0;
+	return NumObjects;
 }
 
 uint32 FOctree::GetNodeCount() const
 {
-	return Root ? CountNodes(Root) : 0;
+	return static_cast<uint32>(Nodes.size());
 }
 
 uint32 FOctree::GetMaxNodeObjectCount() const
 {
-	return Root ? GetMaxNodeObjectCount(Root) : 0;
+	int32 MaxCount = 0;
+	for (const FOctreeNode& Node : Nodes)
+	{
+		MaxCount = std::max(MaxCount, Node.ObjectCount);
+	}
+	return static_cast<uint32>(MaxCount);
 }
 
 bool FOctree::IsValidObject(UPrimitiveComponent* Object, const FAABB& ObjectBounds) const
@@ -437,78 +362,202 @@ bool FOctree::IsValidObject(UPrimitiveComponent* Object, const FAABB& ObjectBoun
 	return Object != nullptr && WorldBounds.Contains(ObjectBounds);
 }
 
-uint32 FOctree::CountObjects(FOctreeNode* Node) const
+int32 FOctree::CreateNode(const FAABB& InBounds, const FAABB& InLooseBounds, int32 InParent)
+{
+	const int32 Depth = InParent != INDEX_NONE ? Nodes[InParent].Depth + 1 : 0;
+	Nodes.emplace_back(InBounds, InLooseBounds, InParent, Depth);
+	NodeLooseBounds.Add(InLooseBounds);
+	return static_cast<int32>(Nodes.size()) - 1;
+}
+
+void FOctree::Subdivide(int32 NodeIndex)
 {
-	if (!Node) return 0;
+	/**
+	 * @brief 노드를 8개의 자식 노드로 분할하고, 자식 하나의 loose 범위에 들어가는 기존 오브젝트를 내려보낸다
+	 * 자식 8개는 노드 풀 끝에 연속으로 추가되며, 여러 자식에 걸치는 오브젝트는 이 노드에 남는다
+	 */
+
+	if (!Nodes[NodeIndex].IsLeaf()) return;  // 이미 분할된 노드
+
+	// emplace_back으로 풀이 재할당될 수 있으므로 부모 노드는 복사본에서 바운드를 계산
+	const FOctreeNode Parent = Nodes[NodeIndex];
+	const int32 FirstChild = static_cast<int32>(Nodes.size());
+	for (int i = 0; i < 8; ++i)
+	{
+		CreateNode(Parent.GetChildBounds(i), Parent.GetChildLooseBounds(i), NodeIndex);
+	}
+	Nodes[NodeIndex].FirstChild = FirstChild;
 
-uint32 Count = static_cast<uint32>(Node->Objects.size());
-	if (!Node->bIsLeaf)
+	// 뒤에서부터 순회: swap-and-pop으로 당겨지는 마지막 원소는 이미 검사가 끝난 원소
+	for (int32 Slot = Nodes[NodeIndex].ObjectCount - 1; Slot >= 0; --Slot)
 	{
-		for (FOctreeNode* Child : Node->Children)
-		{
-			Count += CountObjects(Child);
-		}
+		const int32 PoolIndex = Nodes[NodeIndex].ObjectStart + Slot;
+		const FAABB ObjectBounds = BoundsPool.Get(PoolIndex);
+		const int BestChild = Nodes[NodeIndex].GetBestChildIndex(ObjectBounds);
+		if (BestChild < 0) continue;
+
+		UPrimitiveComponent* Object = ObjectPool[PoolIndex];
+		RemoveFromNode(NodeIndex, Slot);
+		AddToNode(FirstChild + BestChild, Object, ObjectBounds);
 	}
-	return Count;
 }
 
-uint32 FOctree::CountNodes(FOctreeNode* Node) const
+void FOctree::InsertIntoNode(int32 NodeIndex, UPrimitiveComponent* Object, const FAABB& ObjectBounds)
 {
-	if (!Node) return 0;
+	/**
+	 * @brief 오브젝트를 NodeIndex 노드 아래에 삽입합니다
+	 * 리프 노드이고 용량이 있으면 여기에 저장
+	 * 그렇지 않으면 분할 후 적절한 자식으로 내려가고, 여러 자식에 걸치면 현재 노드에 저장
+	 */
 
-	uint32 Count = 1;
-	if (!Node->bIsLeaf)
+	while (true)
 	{
-		for (FOctreeNode* Child : Node->Children)
+		const FOctreeNode& Node = Nodes[NodeIndex];
+
+		// 최대 깊이 체크
+		if (Node.Depth >= FOctreeNode::MAX_DEPTH)
+		{
+			break;
+		}
+
+		// 리프 노드이고 용량에 여유가 있으면 여기에 저장
+		if (Node.IsLeaf() && Node.ObjectCount < FOctreeNode::MAX_OBJECTS_PER_NODE)
+		{
+			break;
+		}
+
+		if (Node.IsLeaf())
+		{
+			Subdivide(NodeIndex);
+		}
+
+		// Subdivide 후에는 풀이 재할당됐을 수 있으므로 다시 참조
+		const int BestChild = Nodes[NodeIndex].GetBestChildIndex(ObjectBounds);
+		if (BestChild < 0)
 		{
-			Count += CountNodes(Child);
+			break;
 		}
+		NodeIndex = Nodes[NodeIndex].FirstChild + BestChild;
 	}
-	return Count;
+
+	AddToNode(NodeIndex, Object, ObjectBounds);
 }
 
-uint32 FOctree::GetMaxNodeObjectCount(FOctreeNode* Node) const
+void FOctree::AddToNode(int32 NodeIndex, UPrimitiveComponent* Object, const FAABB& ObjectBounds)
 {
-	if (!Node) return 0;
+	if (Nodes[NodeIndex].ObjectCount == Nodes[NodeIndex].ObjectCapacity)
+	{
+		GrowNodeRange(NodeIndex);
+	}
 
-uint32 MaxCount = static_cast<uint32>(Node->Objects.size());
+	FOctreeNode& Node = Nodes[NodeIndex];
+	const int32 PoolIndex = Node.ObjectStart + Node.ObjectCount;
+	ObjectPool[PoolIndex] = Object;
+	BoundsPool.Set(PoolIndex, ObjectBounds);
 
-	if (!Node->bIsLeaf)
+	Object->OctreeNodeIndex = NodeIndex;
+	Object->OctreeSlot = Node.ObjectCount;
+	++Node.ObjectCount;
+	++NumObjects;
+}
+
+void FOctree::RemoveFromNode(int32 NodeIndex, int32 Slot)
+{
+	FOctreeNode& Node = Nodes[NodeIndex];
+	const int32 PoolIndex = Node.ObjectStart + Slot;
+	const int32 LastIndex = Node.ObjectStart + Node.ObjectCount - 1;
+
+	UPrimitiveComponent* Removed = ObjectPool[PoolIndex];
+	if (PoolIndex != LastIndex)
 	{
-		for (FOctreeNode* Child : Node->Children)
-		{
-			uint32 ChildMaxCount = GetMaxNodeObjectCount(Child);
-			MaxCount = (ChildMaxCount > MaxCount) ? ChildMaxCount : MaxCount;
-		}
+		ObjectPool[PoolIndex] = ObjectPool[LastIndex];
+		BoundsPool.Copy(PoolIndex, LastIndex);
+		ObjectPool[PoolIndex]->OctreeSlot = Slot;
+	}
+	ObjectPool[LastIndex] = nullptr;
+	--Node.ObjectCount;
+
+	Removed->OctreeNodeIndex = -1;
+	Removed->OctreeSlot = -1;
+	--NumObjects;
+}
+
+void FOctree::GrowNodeRange(int32 NodeIndex)
+{
+	const int32 OldCapacity = Nodes[NodeIndex].ObjectCapacity;
+	const int32 NewCapacity = std::max(InitialNodeCapacity, OldCapacity * 2);
+
+	// 구멍이 전체의 절반을 넘으면 먼저 압축 (압축 후에도 이 노드는 새 구간으로 옮긴다)
+	if (WastedSlots > 1024 && WastedSlots * 2 > static_cast<int32>(ObjectPool.size()))
+	{
+		CompactObjectPool();
 	}
 
-	return MaxCount;
+	FOctreeNode& Node = Nodes[NodeIndex];
+	const int32 NewStart = static_cast<int32>(ObjectPool.size());
+	ObjectPool.resize(NewStart + NewCapacity, nullptr);
+	BoundsPool.Resize(NewStart + NewCapacity);
+
+	// 슬롯은 구간 시작 기준이므로 컴포넌트 핸들은 그대로 유효
+	for (int32 i = 0; i < Node.ObjectCount; ++i)
+	{
+		ObjectPool[NewStart + i] = ObjectPool[Node.ObjectStart + i];
+		BoundsPool.Copy(NewStart + i, Node.ObjectStart + i);
+		ObjectPool[Node.ObjectStart + i] = nullptr;
+	}
+
+	WastedSlots += Node.ObjectCapacity;
+	Node.ObjectStart = NewStart;
+	Node.ObjectCapacity = NewCapacity;
 }
 
-bool FOctree::RemoveFromNodeRecursive(FOctreeNode* Node, UPrimitiveComponent* Object)
+void FOctree::CompactObjectPool()
 {
-	if (!Node || !Object) return false;
+	/**
+	 * @brief 노드 순서대로 구간을 다시 채워 구멍을 없앤다
+	 * 노드 용량은 유지하고 시작 위치만 바뀌므로 컴포넌트 핸들(노드, 슬롯)은 영향 없음
+	 */
 
-	// Check if object is in this node's Objects array
-	auto& Objects = Node->Objects;
-	auto FoundIt = std::find(Objects.begin(), Objects.end(), Object);
-	if (FoundIt != Objects.end())
+	int32 LiveSlots = 0;
+	for (const FOctreeNode& Node : Nodes)
 	{
-		Objects.erase(FoundIt);
-		return true; // Found and removed
+		LiveSlots += Node.ObjectCapacity;
 	}
 
-	// Search in children if this is not a leaf node
-	if (!Node->bIsLeaf)
+	TArray<UPrimitiveComponent*> NewObjectPool(LiveSlots, nullptr);
+	FBoundsSoA NewBoundsPool;
+	NewBoundsPool.Resize(LiveSlots);
+
+	int32 Cursor = 0;
+	for (FOctreeNode& Node : Nodes)
 	{
-		for (FOctreeNode* Child : Node->Children)
+		for (int32 i = 0; i < Node.ObjectCount; ++i)
 		{
-			if (Child && RemoveFromNodeRecursive(Child, Object))
-			{
-				return true; // Found and removed in child
-			}
+			NewObjectPool[Cursor + i] = ObjectPool[Node.ObjectStart + i];
+			NewBoundsPool.Set(Cursor + i, BoundsPool.Get(Node.ObjectStart + i));
 		}
+		Node.ObjectStart = Cursor;
+		Cursor += Node.ObjectCapacity;
 	}
 
-	return false; // Not found in this subtree
+	ObjectPool = std::move(NewObjectPool);
+	BoundsPool = std::move(NewBoundsPool);
+	WastedSlots = 0;
+}
+
+int32 FOctree::FindNode(UPrimitiveComponent* Object) const
+{
+	const int32 NodeIndex = Object->OctreeNodeIndex;
+	const int32 Slot = Object->OctreeSlot;
+	if (NodeIndex < 0 || NodeIndex >= static_cast<int32>(Nodes.size()))
+	{
+		return INDEX_NONE;
+	}
+
+	const FOctreeNode& Node = Nodes[NodeIndex];
+	if (Slot < 0 || Slot >= Node.ObjectCount || ObjectPool[Node.ObjectStart + Slot] != Object)
+	{
+		return INDEX_NONE;
+	}
+	return NodeIndex;
 }
@@ -46,6 +46,17 @@ struct FPlane
 	}
 };
 
+/**
+ * @brief ClassifyBox 결과
+ * Inside는 박스 전체가 6개 평면 안쪽이라 안에 든 박스는 더 검사할 필요가 없음을 뜻한다
+ */
+enum class EFrustumTest : uint8
+{
+	Outside,
+	Intersects,
+	Inside,
+};
+
 /**
  * @brief View frustum defined by 6 planes
  * Support: LH (DirectX)
@@ -68,6 +79,22 @@ struct FFrustum
 	void ConstructFromViewProjectionMatrix(const FMatrix& ViewProjMatrix);
 
 	bool IsBoxInFrustum(const FAABB& Box) const;
+	EFrustumTest ClassifyBox(const FAABB& Box) const;
+
+	/**
+	 * @brief 축별 SoA로 저장된 박스 4개/8개를 한 번에 검사 (IsBoxInFrustum과 같은 판정)
+	 * 각 배열에서 4개/8개를 읽으므로 호출 측은 그만큼 읽을 수 있는 메모리를 보장해야 한다
+	 * 반환: 프러스텀과 겹치는 박스의 비트마스크 (bit i = i번째 박스)
+	 */
+	uint32 AreBoxesInFrustum4(const float* MinX, const float* MinY, const float* MinZ,
+		const float* MaxX, const float* MaxY, const float* MaxZ) const;
+	// AVX2가 없으면 4개씩 두 번
+	uint32 AreBoxesInFrustum8(const float* MinX, const float* MinY, const float* MinZ,
+		const float* MaxX, const float* MaxY, const float* MaxZ) const;
+
+	// 박스 8개의 ClassifyBox. OutVisibleMask: Outside가 아닌 박스, OutInsideMask: Inside인 박스
+	void ClassifyBoxes8(const float* MinX, const float* MinY, const float* MinZ,
+		const float* MaxX, const float* MaxY, const float* MaxZ, uint32& OutVisibleMask, uint32& OutInsideMask) const;
 	bool IsPointInFrustum(const FVector& Point) const;
 	bool IsSphereInFrustum(const FVector& Center, float Radius) const;
 };
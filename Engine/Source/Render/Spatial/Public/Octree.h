@@ -3,21 +3,34 @@
 #include "Global/Types.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Render/Spatial/Public/Frustum.h"
-#include <array>
+#include <bit>
 
 class UPrimitiveComponent;
 
+/**
+ * @brief Loose octree
+ * 노드는 하나의 노드 풀(Nodes)에 연속으로 저장되고 자식 8개는 FirstChild부터 연속된 인덱스를 가진다
+ * 오브젝트 목록은 공유 배열(ObjectPool/BoundsPool)에서 노드별 구간 [ObjectStart, ObjectStart + ObjectCapacity)를 사용
+ * 트리 해제는 배열 몇 개를 비우는 것으로 끝나며, Clear 후 재초기화 시에는 용량을 재사용한다
+ * 바운드는 축별 SoA로 보관해 프러스텀 컬링 시 4/8개씩 한 번에 검사한다 (구간 시작/용량은 항상 4의 배수)
+ */
 struct FOctree
 {
 private:
-	struct FOctreeNode;
+	static constexpr int32 INDEX_NONE = -1;
 
 	struct FOctreeNode
 	{
 		FAABB Bounds;
-		TArray<UPrimitiveComponent*> Objects;
-		std::array<FOctreeNode*, 8> Children;  // 8개 자식 (고정 크기)
-		bool bIsLeaf = true;
+		FAABB LooseBounds;                     // 이 노드에 저장된 오브젝트가 항상 들어 있는 범위 (루트는 월드 범위)
+		int32 FirstChild = INDEX_NONE;         // 자식 8개의 시작 인덱스 (리프면 INDEX_NONE)
+		int32 Parent = INDEX_NONE;
+		int32 Depth = 0;
+
+		// 공유 오브젝트 배열의 이 노드 구간
+		int32 ObjectStart = 0;
+		int32 ObjectCount = 0;
+		int32 ObjectCapacity = 0;
 
 		// 계층적 노드 컬링 (n 프레임 연속 시스템)
 		mutable int ConsecutiveOccludedFrames = 0;
@@ -27,94 +40,48 @@ private:
 		static constexpr int MAX_OBJECTS_PER_NODE = 10;
 		static constexpr int MAX_DEPTH = 32;  // Very high limit, effectively unlimited
 
-		FOctreeNode(const FAABB& InBounds) : Bounds(InBounds) { Children.fill(nullptr); }
-		~FOctreeNode();
-
-		void Subdivide();
-		void Insert(UPrimitiveComponent* Object, const FAABB& ObjectBounds, int Depth);
-		void Query(const FAABB& QueryBounds, TArray<UPrimitiveComponent*>& Results) const;
-		void QueryFrustum(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& Results) const;
-		void QueryFrustumWithOcclusion(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& Results,
-			bool (*IsOccludedFunc)(const FAABB&, const void*), const void* OcclusionContext) const;
-		template<typename RenderCallbackType>
-		void QueryFrustumWithRenderCallback(const FFrustum& Frustum,
-			bool (*IsOccludedFunc)(const FAABB&, const void*), const void* OcclusionContext,
-			RenderCallbackType RenderFunc, const void* RenderContext) const
+		FOctreeNode(const FAABB& InBounds, const FAABB& InLooseBounds, int32 InParent, int32 InDepth)
+			: Bounds(InBounds), LooseBounds(InLooseBounds), Parent(InParent), Depth(InDepth)
 		{
-			// 1. 이 노드가 Frustum과 교집합하는지 확인
-			if (!Frustum.IsBoxInFrustum(Bounds))
-				return;  // 이 노드와 모든 자식 스킵
-
-			// 2. 계층적 노드 옥클루전 - n 프레임 연속 시스템
-			if (IsOccludedFunc)
-			{
-				bool bIsNodeOccluded = IsOccludedFunc(Bounds, OcclusionContext);
-
-				// 노드 옥클루전 상태 업데이트
-				UpdateNodeOcclusionState(bIsNodeOccluded);
-
-				// n 프레임 이상 연속으로 가려진 경우에만 실제 컬링
-				if (ShouldCullNodeForOcclusion())
-				{
-					// 노드 레벨 컬링: 이 노드와 모든 자식, 객체들을 스킵
-					return;
-				}
-			}
-
-			// 3. 노드가 가려지지 않았으므로 이 노드의 모든 객체들을 즉시 렌더링
-			for (UPrimitiveComponent* Object : Objects)
-			{
-				FVector Min, Max;
-				Object->GetWorldAABB(Min, Max);
-				FAABB ObjectBounds(Min, Max);
-
-				if (Frustum.IsBoxInFrustum(ObjectBounds))
-				{
-					RenderFunc(Object, RenderContext);
-				}
-			}
-
-			// 4. 자식들도 재귀적으로 처리
-			if (!bIsLeaf)
-			{
-				for (FOctreeNode* Child : Children)
-				{
-					if (Child)
-					{
-						Child->QueryFrustumWithRenderCallback(Frustum, IsOccludedFunc, OcclusionContext, RenderFunc, RenderContext);
-					}
-				}
-			}
 		}
-		void Clear();
+
+		bool IsLeaf() const { return FirstChild == INDEX_NONE; }
 
 		// 노드 레벨 옥클루전 관리
 		void UpdateNodeOcclusionState(bool bIsOccludedThisFrame) const;
 		bool ShouldCullNodeForOcclusion() const { return bShouldCullForOcclusion; }
 
-
 		FAABB GetChildBounds(int ChildIndex) const;
 		FAABB GetChildLooseBounds(int ChildIndex) const;  // 1.5x expanded bounds
 		int GetBestChildIndex(const FAABB& ObjectBounds) const;
 	};
 
-	FOctreeNode* Root = nullptr;
+	// 트래버설 스택 크기: 깊이마다 형제 7개가 남을 수 있다
+	static constexpr int32 TRAVERSAL_STACK_SIZE = 8 * (FOctreeNode::MAX_DEPTH + 1);
+
+	// 노드 풀 (인덱스 0 = 루트, 비어 있으면 트리 없음)
+	TArray<FOctreeNode> Nodes;
+	FBoundsSoA NodeLooseBounds;                // Nodes와 같은 인덱스의 LooseBounds (형제 8개를 한 번에 분류)
+
+	// 노드 구간으로 나눠 쓰는 오브젝트 배열. 구간이 가득 차면 끝으로 옮기고 남은 구멍은 WastedSlots로 집계
+	TArray<UPrimitiveComponent*> ObjectPool;
+	FBoundsSoA BoundsPool;                     // ObjectPool과 같은 인덱스의 삽입/갱신 시점 월드 AABB
+	int32 WastedSlots = 0;
+
 	FAABB WorldBounds;
+	uint32 NumObjects = 0;
 
 public:
 	FOctree() = default;
-	FOctree(const FAABB& InWorldBounds) : WorldBounds(InWorldBounds)
-	{
-		Root = new FOctreeNode(InWorldBounds);
-	}
-	~FOctree() { delete Root; }
+	FOctree(const FAABB& InWorldBounds) { Initialize(InWorldBounds); }
 
 	FOctree(const FOctree&) = delete;
 	FOctree& operator=(const FOctree&) = delete;
 	FOctree(FOctree&& Other) noexcept
-		: Root(Other.Root), WorldBounds(Other.WorldBounds)
+		: Nodes(std::move(Other.Nodes)), NodeLooseBounds(std::move(Other.NodeLooseBounds)), ObjectPool(std::move(Other.ObjectPool)), BoundsPool(std::move(Other.BoundsPool)),
+		WastedSlots(Other.WastedSlots), WorldBounds(Other.WorldBounds), NumObjects(Other.NumObjects)
 	{
-		Other.Root = nullptr;
+		Other.Clear();
 	}
 
 	void Initialize(const FAABB& InWorldBounds);
@@ -123,24 +90,55 @@ public:
 	bool Insert(UPrimitiveComponent* Object);
 	bool Insert(UPrimitiveComponent* Object, const FAABB& ObjectBounds);
 
+	// 컴포넌트에 저장된 노드 인덱스/슬롯으로 swap-and-pop 제거 (O(1))
 	void Remove(UPrimitiveComponent* Object);
+
+	// 새 바운드가 현재 노드의 loose 바운드 안이면 바운드만 갱신하고, 벗어나면 담을 수 있는 조상까지 올라가 다시 내려간다
+	// 월드 범위를 벗어나면 트리에서 빠지고 false
 	bool Update(UPrimitiveComponent* Object);
+	bool Update(UPrimitiveComponent* Object, const FAABB& ObjectBounds);
+
+	bool Contains(UPrimitiveComponent* Object) const { return FindNode(Object) != INDEX_NONE; }
 
 	TArray<UPrimitiveComponent*> Query(const FAABB& QueryBounds) const;
 	TArray<UPrimitiveComponent*> QueryFrustum(const FFrustum& Frustum) const;
+	// OutResults 뒤에 추가 (매 프레임 같은 배열을 재사용할 때)
+	void QueryFrustum(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& OutResults) const;
 	TArray<UPrimitiveComponent*> QueryFrustumWithOcclusion(const FFrustum& Frustum,
 		bool (*IsOccludedFunc)(const FAABB&, const void*), const void* OcclusionContext) const;
 
+	// 병렬 프러스텀 질의 단위: 보이는 서브트리의 루트 노드와 그 서브트리가 프러스텀 안에 완전히 들어가는지 여부
+	struct FFrustumSubtree
+	{
+		int32 NodeIndex;
+		bool bFullyInside;
+	};
+
+	/**
+	 * @brief 루트부터 너비 우선으로 펼쳐 보이는 서브트리가 InMinSubtrees개 이상이 되도록 나눈다 (리프만 남으면 그 전에 멈춤)
+	 * 펼친 노드의 보이는 오브젝트는 OutResults 뒤에 추가하고, 남은 서브트리는 ForEachInFrustumSubtree로 각각(다른 스레드에서) 질의한다
+	 * 두 결과를 합치면 QueryFrustum과 같은 집합이 된다 (순서는 다를 수 있음)
+	 */
+	void SplitFrustumQuery(const FFrustum& Frustum, int32 InMinSubtrees,
+		TArray<FFrustumSubtree>& OutSubtrees, TArray<UPrimitiveComponent*>& OutResults) const;
+
+	// 서브트리 안에서 프러스텀을 통과한 오브젝트마다 Visit 호출 (트리를 읽기만 하므로 서로 다른 스레드에서 동시에 호출 가능)
+	template<typename TVisitor>
+	void ForEachInFrustumSubtree(const FFrustum& Frustum, const FFrustumSubtree& Subtree, TVisitor&& Visit) const
+	{
+		TraverseFrustumFrom(Frustum, Subtree, nullptr, nullptr, Visit);
+	}
+
 	// 람다 기반 렌더링 방식
 	template<typename RenderCallbackType>
 	void QueryFrustumWithRenderCallback(const FFrustum& Frustum,
 		bool (*IsOccludedFunc)(const FAABB&, const void*), const void* OcclusionContext,
 		RenderCallbackType RenderFunc, const void* RenderContext) const
 	{
-		if (Root)
-		{
-			Root->QueryFrustumWithRenderCallback(Frustum, IsOccludedFunc, OcclusionContext, RenderFunc, RenderContext);
-		}
+		TraverseFrustum(Frustum, IsOccludedFunc, OcclusionContext, [&](UPrimitiveComponent* Object)
+			{
+				RenderFunc(Object, RenderContext);
+			});
 	}
 
 
@@ -150,12 +148,135 @@ public:
 
 	const FAABB& GetWorldBounds() const { return WorldBounds; }
 	uint32 GetMaxNodeObjectCount() const;
-	
+
 private:
+	/**
+	 * @brief 프러스텀(+노드 옥클루전)을 통과한 노드의 오브젝트 중 프러스텀 안에 있는 것마다 Visit 호출
+	 * 방문 순서는 재귀 깊이 우선과 같다 (노드 오브젝트 -> 자식 0..7)
+	 * 자식 8개는 push 전에 한 번에 분류해 보이는 것만 스택에 넣고,
+	 * 프러스텀 안에 완전히 들어간 노드의 서브트리는 노드/오브젝트 평면 검사를 모두 생략한다
+	 */
+	template<typename TVisitor>
+	void TraverseFrustum(const FFrustum& Frustum, bool (*IsOccludedFunc)(const FAABB&, const void*), const void* OcclusionContext,
+		TVisitor&& Visit) const
+	{
+		if (Nodes.empty()) return;
+
+		const EFrustumTest RootTest = Frustum.ClassifyBox(Nodes[0].LooseBounds);
+		if (RootTest == EFrustumTest::Outside) return;
+
+		TraverseFrustumFrom(Frustum, { 0, RootTest == EFrustumTest::Inside }, IsOccludedFunc, OcclusionContext, Visit);
+	}
+
+	// 이미 보이는 것으로 분류된 서브트리 Start부터 TraverseFrustum과 같은 방식으로 내려간다
+	template<typename TVisitor>
+	void TraverseFrustumFrom(const FFrustum& Frustum, const FFrustumSubtree& Start,
+		bool (*IsOccludedFunc)(const FAABB&, const void*), const void* OcclusionContext, TVisitor&& Visit) const
+	{
+		FFrustumSubtree Stack[TRAVERSAL_STACK_SIZE];
+		int32 StackSize = 0;
+		Stack[StackSize++] = Start;
+
+		while (StackSize > 0)
+		{
+			const FFrustumSubtree Entry = Stack[--StackSize];
+			const FOctreeNode& Node = Nodes[Entry.NodeIndex];
+
+			// 1. 계층적 노드 옥클루전 - n 프레임 연속 시스템
+			if (IsOccludedFunc)
+			{
+				bool bIsNodeOccluded = IsOccludedFunc(Node.LooseBounds, OcclusionContext);
+
+				// 노드 옥클루전 상태 업데이트
+				Node.UpdateNodeOcclusionState(bIsNodeOccluded);
+
+				// n 프레임 이상 연속으로 가려진 경우에만 실제 컬링
+				if (Node.ShouldCullNodeForOcclusion())
+					continue;
+			}
+
+			// 2. 노드가 가려지지 않았으므로 이 노드의 모든 객체들을 처리
+			VisitNodeObjects(Frustum, Node, Entry.bFullyInside, Visit);
+
+			// 3. 자식 8개를 한 번에 분류해 보이는 자식만 역순으로 push (0번부터 방문)
+			if (!Node.IsLeaf())
+			{
+				uint32 VisibleMask, InsideMask;
+				ClassifyChildren(Frustum, Node, Entry.bFullyInside, VisibleMask, InsideMask);
+
+				for (int32 Child = 7; Child >= 0; --Child)
+				{
+					if (VisibleMask & (1u << Child))
+					{
+						Stack[StackSize++] = { Node.FirstChild + Child, (InsideMask & (1u << Child)) != 0 };
+					}
+				}
+			}
+		}
+	}
+
+	// 노드에 저장된 오브젝트 중 프러스텀 안에 있는 것마다 Visit (bFullyInside면 검사 없이 전부)
+	template<typename TVisitor>
+	void VisitNodeObjects(const FFrustum& Frustum, const FOctreeNode& Node, bool bFullyInside, TVisitor&& Visit) const
+	{
+		if (bFullyInside)
+		{
+			const int32 End = Node.ObjectStart + Node.ObjectCount;
+			for (int32 i = Node.ObjectStart; i < End; ++i)
+			{
+				Visit(ObjectPool[i]);
+			}
+			return;
+		}
+
+		// 구간 용량이 4의 배수라 4개 단위 읽기는 항상 구간 안 (개수를 넘는 레인은 마스크로 제외)
+		for (int32 Offset = 0; Offset < Node.ObjectCount;)
+		{
+			const int32 i = Node.ObjectStart + Offset;
+			const int32 Remaining = Node.ObjectCount - Offset;
+			const bool bBatch8 = Remaining > 4 && Offset + 8 <= Node.ObjectCapacity;
+			const int32 BatchSize = bBatch8 ? 8 : 4;
+
+			uint32 Mask = bBatch8
+				? Frustum.AreBoxesInFrustum8(&BoundsPool.MinX[i], &BoundsPool.MinY[i], &BoundsPool.MinZ[i],
+					&BoundsPool.MaxX[i], &BoundsPool.MaxY[i], &BoundsPool.MaxZ[i])
+				: Frustum.AreBoxesInFrustum4(&BoundsPool.MinX[i], &BoundsPool.MinY[i], &BoundsPool.MinZ[i],
+					&BoundsPool.MaxX[i], &BoundsPool.MaxY[i], &BoundsPool.MaxZ[i]);
+			if (Remaining < BatchSize)
+			{
+				Mask &= (1u << Remaining) - 1u;
+			}
+
+			while (Mask)
+			{
+				const int32 Lane = std::countr_zero(Mask);
+				Mask &= Mask - 1;
+				Visit(ObjectPool[i + Lane]);
+			}
+			Offset += BatchSize;
+		}
+	}
+
+	// 리프가 아닌 노드의 자식 8개를 분류 (bFullyInside면 모두 보이고 모두 완전히 안쪽)
+	void ClassifyChildren(const FFrustum& Frustum, const FOctreeNode& Node, bool bFullyInside, uint32& OutVisibleMask, uint32& OutInsideMask) const;
+
 	// Helper Functions
 	bool IsValidObject(UPrimitiveComponent* Object, const FAABB& ObjectBounds) const;
-	uint32 CountObjects(FOctreeNode* Node) const;
-	uint32 CountNodes(FOctreeNode* Node) const;
-	uint32 GetMaxNodeObjectCount(FOctreeNode* Node) const;
-	bool RemoveFromNodeRecursive(FOctreeNode* Node, UPrimitiveComponent* Object);
+
+	int32 CreateNode(const FAABB& InBounds, const FAABB& InLooseBounds, int32 InParent);
+	void Subdivide(int32 NodeIndex);
+
+	// NodeIndex부터 내려가며 담을 노드를 찾아 저장 (리프가 가득 차면 분할)
+	void InsertIntoNode(int32 NodeIndex, UPrimitiveComponent* Object, const FAABB& ObjectBounds);
+
+	// 노드 구간에 추가/제거하면서 컴포넌트 핸들 갱신
+	void AddToNode(int32 NodeIndex, UPrimitiveComponent* Object, const FAABB& ObjectBounds);
+	void RemoveFromNode(int32 NodeIndex, int32 Slot);
+
+	// 가득 찬 노드 구간을 두 배 용량으로 배열 끝에 옮긴다 (구멍이 많이 쌓이면 전체를 압축)
+	void GrowNodeRange(int32 NodeIndex);
+	void CompactObjectPool();
+
+	// 핸들이 이 트리의 유효한 슬롯을 가리키면 그 노드 인덱스 (다른 트리에 들어 있거나 없으면 INDEX_NONE)
+	int32 FindNode(UPrimitiveComponent* Object) const;
 };
@@ -5,6 +5,7 @@
 #include "Global/Memory.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "Utility/Public/ThreadStats.h"
+#include "Manager/Asset/Public/AssetManager.h"
 
 IMPLEMENT_SINGLETON_CLASS_BASE(UStatOverlay)
 
@@ -72,6 +73,9 @@ void UStatOverlay::Render()
 	if (IsStatEnabled(EStatType::BVH))      { RenderBVH(); }
 	if (IsStatEnabled(EStatType::Culling))	{ RenderCulling(); }
 
+	// 스태틱 메시 비동기 로딩 중에는 STAT 설정과 관계없이 진행 상황 표시
+	RenderStaticMeshLoading();
+
 	D2DRenderTarget->EndDraw();
 }
 
@@ -129,10 +133,10 @@ void UStatOverlay::RenderFPS()
 
 void UStatOverlay::RenderMemory()
 {
-	float MemoryMB = static_cast<float>(TotalAllocationBytes) / (1024.0f * 1024.0f);
+	float MemoryMB = static_cast<float>(TotalAllocationBytes.load(std::memory_order_relaxed)) / (1024.0f * 1024.0f);
 
 	char MemoryBuffer[64];
-	sprintf_s(MemoryBuffer, sizeof(MemoryBuffer), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount);
+	sprintf_s(MemoryBuffer, sizeof(MemoryBuffer), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount.load(std::memory_order_relaxed));
 	FString MemoryText = MemoryBuffer;
 
 	float OffsetY = IsStatEnabled(EStatType::FPS) ? 20.0f : 0.0f;
@@ -221,7 +225,7 @@ void UStatOverlay::RenderCulling()
 	float OffsetY = 0;
 	for (const EStatType& StatTarget : StatTargets)
 	{
-		OffsetY += (IsStatEnabled(StatTarget));
+		if (IsStatEnabled(StatTarget)) OffsetY += 20.0f;
 	}
 
 	const TStatId StatId = GetCullingStatId();
@@ -230,11 +234,38 @@ void UStatOverlay::RenderCulling()
 	const double TotalMs = FThreadStats::GetTotalMilliseconds(StatId); // 추가한 API
 	const uint32 Count = FThreadStats::GetCount(StatId);
 
+	// 컬링 + 렌더 제출 중 옥트리 프러스텀 컬링만의 시간
+	const TStatId FrustumStatId = GetFrustumCullingStatId();
+	const double FrustumLastMs = FThreadStats::GetLastMilliseconds(FrustumStatId);
+	const double FrustumAvgMs = FThreadStats::GetAverageMilliseconds(FrustumStatId);
+
 	std::stringstream result;
 	result << "Culling : " << LastMs << " / " << TotalMs/Count << "ms";
+	result << " | Frustum Cull : " << FrustumLastMs << " / " << FrustumAvgMs << "ms";
 	RenderText(result.str(), OverlayX, OverlayY + OffsetY, 1.0f, 1.0f, 1.0f);
 }
 
+void UStatOverlay::RenderStaticMeshLoading()
+{
+	const FStaticMeshLoadProgress Progress = UAssetManager::GetInstance().GetStaticMeshLoadProgress();
+	if (Progress.IsComplete())
+	{
+		return;
+	}
+
+	const TArray<EStatType> StatTargets = {EStatType::FPS, EStatType::Memory, EStatType::Picking, EStatType::BVH, EStatType::Culling};
+	float OffsetY = 0;
+	for (const EStatType& StatTarget : StatTargets)
+	{
+		if (IsStatEnabled(StatTarget)) OffsetY += 20.0f;
+	}
+
+	char LoadingBuffer[128];
+	sprintf_s(LoadingBuffer, sizeof(LoadingBuffer), "Loading Meshes: %u / %u (%.0f%%, %u processed)",
+		Progress.NumRegistered + Progress.NumFailed, Progress.NumTotal, Progress.GetRatio() * 100.0f, Progress.NumLoaded);
+	RenderText(LoadingBuffer, OverlayX, OverlayY + OffsetY, 0.6f, 0.8f, 1.0f);
+}
+
 std::wstring UStatOverlay::ToWString(const FString& InStr)
 {
 	if (InStr.empty()) return std::wstring();
@@ -44,6 +44,7 @@ private:
 	void RenderBVH();
 	void RenderText(const FString& Text, float X, float Y, float R, float G, float B);
 	void RenderCulling();
+	void RenderStaticMeshLoading();
 
 	// FPS Stats
 	float CurrentFPS = 0.0f;
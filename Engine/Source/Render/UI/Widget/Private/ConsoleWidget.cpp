@@ -2,6 +2,8 @@
 #include "Render/UI/Widget/Public/ConsoleWidget.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/UELogParser.h"
+#include "Utility/Public/EngineBenchmark.h"
+#include "Render/Culling/Public/OcclusionCuller.h"
 
 IMPLEMENT_SINGLETON_CLASS(UConsoleWidget, UWidget)
 
@@ -21,6 +23,7 @@ void UConsoleWidget::Initialize()
 	HistoryPosition = -1;
 	bIsAutoScroll = true;
 	bIsScrollToBottom = false;
+	OwnerThreadId = std::this_thread::get_id();
 
 	// Stream Redirection 초기화
 	ConsoleOutputBuffer = nullptr;
@@ -65,6 +68,9 @@ streamsize ConsoleStreamBuffer::xsputn(const char* InString, streamsize InCount)
 
 void UConsoleWidget::RenderWidget()
 {
+	// 워커 스레드에서 쌓인 로그 반영
+	FlushPendingLogs();
+
 	// 제어 버튼들
 	if (ImGui::Button("Clear"))
 	{
@@ -155,6 +161,9 @@ void UConsoleWidget::Update()
 void UConsoleWidget::ClearLog()
 {
 	LogItems.clear();
+
+	std::lock_guard<std::mutex> Lock(PendingLogMutex);
+	PendingLogItems.clear();
 }
 
 /**
@@ -246,7 +255,48 @@ void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list In
 	LogEntry.Message = FString(Buffer);
 	delete[] Buffer;
 
-	LogItems.push_back(LogEntry);
+	PushLogEntry(std::move(LogEntry));
+}
+
+/**
+ * @brief 완성된 로그 한 줄을 추가하는 함수
+ * 콘솔을 초기화한 스레드가 아니면 ImGui가 읽는 LogItems를 건드리지 않고 대기열에 넣는다
+ */
+void UConsoleWidget::PushLogEntry(FLogEntry&& InLogEntry)
+{
+	if (std::this_thread::get_id() != OwnerThreadId)
+	{
+		std::lock_guard<std::mutex> Lock(PendingLogMutex);
+		PendingLogItems.push_back(std::move(InLogEntry));
+		return;
+	}
+
+	FlushPendingLogs();
+	LogItems.push_back(std::move(InLogEntry));
+
+	// Auto Scroll
+	bIsScrollToBottom = true;
+}
+
+/**
+ * @brief 워커 스레드에서 대기열에 넣은 로그를 순서대로 LogItems에 옮기는 함수 (메인 스레드 전용)
+ */
+void UConsoleWidget::FlushPendingLogs()
+{
+	TArray<FLogEntry> Pending;
+	{
+		std::lock_guard<std::mutex> Lock(PendingLogMutex);
+		if (PendingLogItems.empty())
+		{
+			return;
+		}
+		Pending.swap(PendingLogItems);
+	}
+
+	for (FLogEntry& LogEntry : Pending)
+	{
+		LogItems.push_back(std::move(LogEntry));
+	}
 
 	// Auto Scroll
 	bIsScrollToBottom = true;
@@ -283,10 +333,7 @@ void UConsoleWidget::AddSystemLog(const char* InText, bool bInIsError)
 		LogEntry.Message.pop_back();
 	}
 
-	LogItems.push_back(LogEntry);
-
-	// Auto Scroll
-	bIsScrollToBottom = true;
+	PushLogEntry(std::move(LogEntry));
 }
 
 /**
@@ -438,6 +485,29 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// Benchmark 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 6 && CommandLower.substr(0, 6) == "bench ")
+	{
+		FString BenchmarkName = CommandLower.substr(6);
+		if (!FEngineBenchmark::Run(BenchmarkName))
+		{
+			AddLog(ELogType::Error, "Unknown benchmark: %s", BenchmarkName.c_str());
+			FEngineBenchmark::PrintUsage();
+		}
+	}
+
+	// Occlusion 모드 전환
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "occlusion cpu" || CommandLower == "occlusion gpu")
+	{
+		const bool bCPU = CommandLower == "occlusion cpu";
+		UOcclusionCuller::GetInstance().SetOcclusionMode(bCPU ? EOcclusionMode::CPU : EOcclusionMode::GPU);
+		AddLog(ELogType::Success, "Occlusion mode: %s", bCPU ? "CPU (software rasterizer)" : "GPU (HZB readback)");
+	}
+
 	// Help 명령어 입력
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -449,6 +519,8 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT FPS - Show FPS overlay");
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  BENCH <NAME> - Run a headless benchmark (results in log)");
+		AddLog(ELogType::Info, "  OCCLUSION CPU|GPU - Switch occlusion depth source");
 		AddLog(ELogType::Info, "  UE_LOG(\"String with format\", Args...) - Enhanced printf Formatting");
 		AddLog(ELogType::Debug, "    기본 예제: UE_LOG(\"Hello World %%d\", 2025)");
 		AddLog(ELogType::Debug, "    문자열: UE_LOG(\"User: %%s\", \"John\")");
@@ -4,6 +4,7 @@
 #include "Component/Mesh/Public/StaticMesh.h"
 #include "Manager/UI/Public/UIManager.h"
 #include "Core/Public/ObjectIterator.h"
+#include "Manager/Asset/Public/AssetManager.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
 
@@ -29,7 +30,7 @@ void UStaticMeshComponentWidget::RenderWidget()
 void UStaticMeshComponentWidget::RenderStaticMeshSelector(UStaticMeshComponent* InTargetComponent)
 {
     UStaticMesh* CurrentStaticMesh = InTargetComponent->GetStaticMesh();
-    const FName PreviewName = CurrentStaticMesh ? CurrentStaticMesh->GetAssetPathFileName() : "None";
+    const FName PreviewName = CurrentStaticMesh ? InTargetComponent->GetStaticMeshAssetPath() : "None";
 
     if (ImGui::BeginCombo("Static Mesh", PreviewName.ToString().c_str()))
     {
@@ -37,6 +38,8 @@ void UStaticMeshComponentWidget::RenderStaticMeshSelector(UStaticMeshComponent*
         {
             UStaticMesh* MeshInList = *It;
             if (!MeshInList) continue;
+            // 로딩 중 대체 메시는 선택 목록에서 제외
+            if (MeshInList->GetAssetPathFileName() == UAssetManager::GetPlaceholderStaticMeshPath()) continue;
             const bool bIsSelected = (CurrentStaticMesh == MeshInList);
             if (ImGui::Selectable(MeshInList->GetAssetPathFileName().ToString().c_str(), bIsSelected))
             {
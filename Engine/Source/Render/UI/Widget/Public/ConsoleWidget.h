@@ -1,5 +1,7 @@
 #pragma once
 #include "Widget.h"
+#include <mutex>
+#include <thread>
 
 using std::streambuf;
 
@@ -81,6 +83,11 @@ private:
 	bool bIsAutoScroll;
 	bool bIsScrollToBottom;
 
+	// 워커 스레드(에셋 로딩 등)에서 들어온 로그는 여기에 쌓았다가 메인 스레드에서 LogItems로 옮긴다
+	std::thread::id OwnerThreadId;
+	std::mutex PendingLogMutex;
+	TArray<FLogEntry> PendingLogItems;
+
 	// Stream redirection
 	ConsoleStreamBuffer* ConsoleOutputBuffer;
 	ConsoleStreamBuffer* ConsoleErrorBuffer;
@@ -91,4 +98,6 @@ private:
 	static ImVec4 GetColorByLogType(ELogType InType);
 
 	void AddLogInternal(ELogType InType, const char* fmt, va_list InArguments);
+	void PushLogEntry(FLogEntry&& InLogEntry);
+	void FlushPendingLogs();
 };
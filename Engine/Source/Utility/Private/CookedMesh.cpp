@@ -0,0 +1,558 @@
+#include "pch.h"
+#include "Utility/Public/CookedMesh.h"
+#include "Utility/Public/StaticMeshBVH.h"
+#include <fstream>
+
+namespace
+{
+	constexpr uint32 CookedMeshMagic = 0x48534D43; // "CMSH"
+
+	// FHeader::Flags
+	constexpr uint32 CookedMeshFlagQuantizeVertices = 1u << 0;	// 쿠킹할 때 양자화 설정이 켜져 있었음
+
+	// FLODEntry::VertexFormat
+	constexpr uint32 CookedVertexFormatFloat = 0;		// FNormalVertex 배열 (색 포함)
+	constexpr uint32 CookedVertexFormatPacked = 1;		// FPackedNormalVertex 배열 + RGBA8 색 배열 (선택)
+
+	// 문자열 표 안의 구간
+	struct FCookedString
+	{
+		uint32 Offset;
+		uint32 Length;
+	};
+
+	size_t AlignUp(size_t InValue, size_t InAlignment)
+	{
+		return (InValue + InAlignment - 1) & ~(InAlignment - 1);
+	}
+
+	bool IsRangeValid(uint64 InOffset, uint64 InBytes, uint64 InFileSize, size_t InAlignment)
+	{
+		return InOffset % InAlignment == 0 && InOffset <= InFileSize && InBytes <= InFileSize - InOffset;
+	}
+}
+
+// 디스크 레코드는 모두 POD이고 필드 순서대로 패딩 없이 놓인다 (크기는 Open()의 static_assert로 고정)
+struct FCookedMeshFile::FHeader
+{
+	uint32 Magic;
+	uint32 Version;
+	uint32 NumLODs;
+	uint32 NumMaterials;
+	uint32 Flags;
+	uint32 Reserved;
+	uint64 FileSize;
+	uint64 SourceHash;		// 원본 메시(LOD 0)의 위치/인덱스 해시 (BVH 검증에도 사용)
+	int64 SourceTime;		// 원본 .obj 수정 시각
+	uint64 SourceSize;		// 원본 .obj 크기
+	float BoundsMin[3];
+	float BoundsMax[3];
+	uint64 LODTableOffset;
+	uint64 MaterialTableOffset;
+	uint64 StringTableOffset;
+	uint64 StringTableSize;
+	uint64 BVHOffset;
+	uint64 BVHSize;			// 0이면 BVH 없음
+	FCookedString PathFileName;
+};
+
+struct FCookedMeshFile::FLODEntry
+{
+	uint64 VertexOffset;	// FPackedNormalVertex 배열
+	uint64 ColorOffset;		// RGBA8 배열 (0이면 모두 흰색)
+	uint64 IndexOffset;
+	uint64 SectionOffset;
+	uint32 NumVertices;
+	uint32 NumIndices;
+	uint32 NumSections;
+	uint32 VertexFormat;
+	float PositionOrigin[3];
+	float PositionScale[3];
+};
+
+struct FCookedMeshFile::FMaterialEntry
+{
+	FCookedString Name;
+	FCookedString KaMap;
+	FCookedString KdMap;
+	FCookedString KsMap;
+	FCookedString NsMap;
+	FCookedString DMap;
+	FCookedString BumpMap;
+	float Ka[3];
+	float Kd[3];
+	float Ks[3];
+	float Ke[3];
+	float Ns;
+	float Ni;
+	float D;
+	int32 Illumination;
+};
+
+static_assert(sizeof(FPackedNormalVertex) == 16 && alignof(FPackedNormalVertex) <= FCookedMeshFile::BlobAlignment,
+	"Vertex blobs are mapped as FPackedNormalVertex arrays");
+// FVector가 복사 생성자를 직접 정의해 trivially copyable은 아니지만 멤버가 모두 float라 바이트 그대로 읽어도 된다
+static_assert(std::is_standard_layout_v<FNormalVertex> && alignof(FNormalVertex) <= FCookedMeshFile::BlobAlignment,
+	"Unquantized vertex blobs are mapped as FNormalVertex arrays");
+static_assert(sizeof(FMeshSection) == 12, "Section blobs are mapped as FMeshSection arrays");
+
+int64 FCookedMeshFile::GetSourceTime(const std::filesystem::path& InSourcePath)
+{
+	std::error_code ErrorCode;
+	return static_cast<int64>(std::filesystem::last_write_time(InSourcePath, ErrorCode).time_since_epoch().count());
+}
+
+uint64 FCookedMeshFile::GetSourceSize(const std::filesystem::path& InSourcePath)
+{
+	std::error_code ErrorCode;
+	const uintmax_t Size = std::filesystem::file_size(InSourcePath, ErrorCode);
+	return ErrorCode ? 0 : static_cast<uint64>(Size);
+}
+
+bool FCookedMeshFile::Save(const std::filesystem::path& InPath, const TArray<const FStaticMesh*>& InLODs, const FStaticMeshBVH* InBVH,
+	const std::filesystem::path& InSourcePath, bool bInQuantizeVertices, float InBVHBuildMilliseconds)
+{
+	if (InLODs.empty() || !InLODs[0])
+	{
+		return false;
+	}
+	for (const FStaticMesh* LOD : InLODs)
+	{
+		if (!LOD) return false;
+	}
+
+	const FStaticMesh& BaseMesh = *InLODs[0];
+	const uint64 SourceHash = FStaticMeshBVH::ComputeSourceHash(BaseMesh.Vertices, &BaseMesh.Indices);
+	const int64 SourceTime = GetSourceTime(InSourcePath);
+
+	// 문자열 표 (재질 이름/텍스처 경로, 원본 경로)
+	FString Strings;
+	auto AddString = [&Strings](const FString& InString)
+		{
+			const FCookedString Entry{ static_cast<uint32>(Strings.size()), static_cast<uint32>(InString.size()) };
+			Strings += InString;
+			return Entry;
+		};
+
+	FHeader Header = {};
+	Header.Magic = CookedMeshMagic;
+	Header.Version = Version;
+	Header.NumLODs = static_cast<uint32>(InLODs.size());
+	Header.NumMaterials = static_cast<uint32>(BaseMesh.MaterialInfo.size());
+	Header.Flags = bInQuantizeVertices ? CookedMeshFlagQuantizeVertices : 0;
+	Header.SourceHash = SourceHash;
+	Header.SourceTime = SourceTime;
+	Header.SourceSize = GetSourceSize(InSourcePath);
+	Header.PathFileName = AddString(BaseMesh.PathFileName.ToString());
+
+	FVector BoundsMin(0.0f, 0.0f, 0.0f);
+	FVector BoundsMax(0.0f, 0.0f, 0.0f);
+	if (!BaseMesh.Vertices.empty())
+	{
+		BoundsMin = BoundsMax = BaseMesh.Vertices[0].Position;
+		for (const FNormalVertex& Vertex : BaseMesh.Vertices)
+		{
+			BoundsMin.X = std::min(BoundsMin.X, Vertex.Position.X); BoundsMax.X = std::max(BoundsMax.X, Vertex.Position.X);
+			BoundsMin.Y = std::min(BoundsMin.Y, Vertex.Position.Y); BoundsMax.Y = std::max(BoundsMax.Y, Vertex.Position.Y);
+			BoundsMin.Z = std::min(BoundsMin.Z, Vertex.Position.Z); BoundsMax.Z = std::max(BoundsMax.Z, Vertex.Position.Z);
+		}
+	}
+	Header.BoundsMin[0] = BoundsMin.X; Header.BoundsMin[1] = BoundsMin.Y; Header.BoundsMin[2] = BoundsMin.Z;
+	Header.BoundsMax[0] = BoundsMax.X; Header.BoundsMax[1] = BoundsMax.Y; Header.BoundsMax[2] = BoundsMax.Z;
+
+	TArray<FMaterialEntry> Materials(BaseMesh.MaterialInfo.size());
+	for (size_t Index = 0; Index < Materials.size(); ++Index)
+	{
+		const FMaterial& Source = BaseMesh.MaterialInfo[Index];
+		FMaterialEntry& Entry = Materials[Index];
+		Entry.Name = AddString(Source.Name);
+		Entry.KaMap = AddString(Source.KaMap);
+		Entry.KdMap = AddString(Source.KdMap);
+		Entry.KsMap = AddString(Source.KsMap);
+		Entry.NsMap = AddString(Source.NsMap);
+		Entry.DMap = AddString(Source.DMap);
+		Entry.BumpMap = AddString(Source.BumpMap);
+		memcpy(Entry.Ka, &Source.Ka, sizeof(Entry.Ka));
+		memcpy(Entry.Kd, &Source.Kd, sizeof(Entry.Kd));
+		memcpy(Entry.Ks, &Source.Ks, sizeof(Entry.Ks));
+		memcpy(Entry.Ke, &Source.Ke, sizeof(Entry.Ke));
+		Entry.Ns = Source.Ns;
+		Entry.Ni = Source.Ni;
+		Entry.D = Source.D;
+		Entry.Illumination = Source.Illumination;
+	}
+
+	TArray<uint8> BVHBlob;
+	if (InBVH && InBVH->IsBuilt())
+	{
+		InBVH->SaveToBuffer(BVHBlob, SourceHash, SourceTime, InBVHBuildMilliseconds);
+	}
+
+	// LOD마다 자기 AABB로 양자화 (단순화된 LOD가 원본 AABB를 벗어날 수 있음)
+	// UV가 half로 담기지 않는 LOD는 양자화하지 않고 FNormalVertex 그대로 저장
+	TArray<FPackedVertexStream> PackedLODs(InLODs.size());
+	TArray<bool> bIsLODPacked(InLODs.size(), false);
+	for (size_t LODIndex = 0; LODIndex < InLODs.size(); ++LODIndex)
+	{
+		const TArray<FNormalVertex>& Vertices = InLODs[LODIndex]->Vertices;
+		if (bInQuantizeVertices && FPackedVertexStream::CanPackTexCoords(Vertices.data(), Vertices.size()))
+		{
+			PackedLODs[LODIndex].Pack(Vertices);
+			bIsLODPacked[LODIndex] = true;
+		}
+	}
+
+	// 오프셋 배치: 표와 문자열은 앞쪽에 붙이고 블롭은 각각 정렬
+	TArray<FLODEntry> LODEntries(InLODs.size());
+	size_t Offset = sizeof(FHeader);
+	Header.LODTableOffset = Offset;
+	Offset += sizeof(FLODEntry) * LODEntries.size();
+	Header.MaterialTableOffset = Offset;
+	Offset += sizeof(FMaterialEntry) * Materials.size();
+	Header.StringTableOffset = Offset;
+	Header.StringTableSize = Strings.size();
+	Offset += Strings.size();
+
+	for (size_t LODIndex = 0; LODIndex < InLODs.size(); ++LODIndex)
+	{
+		const FStaticMesh& LOD = *InLODs[LODIndex];
+		const FPackedVertexStream& Packed = PackedLODs[LODIndex];
+		FLODEntry& Entry = LODEntries[LODIndex];
+		Entry.NumVertices = static_cast<uint32>(LOD.Vertices.size());
+		Entry.NumIndices = static_cast<uint32>(LOD.Indices.size());
+		Entry.NumSections = static_cast<uint32>(LOD.Sections.size());
+		Entry.VertexFormat = bIsLODPacked[LODIndex] ? CookedVertexFormatPacked : CookedVertexFormatFloat;
+		Entry.PositionOrigin[0] = Packed.PositionOrigin.X; Entry.PositionOrigin[1] = Packed.PositionOrigin.Y; Entry.PositionOrigin[2] = Packed.PositionOrigin.Z;
+		Entry.PositionScale[0] = Packed.PositionScale.X; Entry.PositionScale[1] = Packed.PositionScale.Y; Entry.PositionScale[2] = Packed.PositionScale.Z;
+
+		Offset = AlignUp(Offset, BlobAlignment);
+		Entry.VertexOffset = Offset;
+		Offset += bIsLODPacked[LODIndex] ? sizeof(FPackedNormalVertex) * Packed.Vertices.size() : sizeof(FNormalVertex) * LOD.Vertices.size();
+		if (!Packed.Colors.empty())
+		{
+			Offset = AlignUp(Offset, BlobAlignment);
+			Entry.ColorOffset = Offset;
+			Offset += sizeof(uint32) * Packed.Colors.size();
+		}
+		Offset = AlignUp(Offset, BlobAlignment);
+		Entry.IndexOffset = Offset;
+		Offset += sizeof(uint32) * LOD.Indices.size();
+		Offset = AlignUp(Offset, BlobAlignment);
+		Entry.SectionOffset = Offset;
+		Offset += sizeof(FMeshSection) * LOD.Sections.size();
+	}
+
+	Offset = AlignUp(Offset, BlobAlignment);
+	Header.BVHOffset = BVHBlob.empty() ? 0 : Offset;
+	Header.BVHSize = BVHBlob.size();
+	Offset += BVHBlob.size();
+	Header.FileSize = Offset;
+
+	TArray<uint8> Buffer(Offset, 0);
+	auto Write = [&Buffer](uint64 InOffset, const void* InData, size_t InBytes)
+		{
+			if (InBytes == 0) return;
+			memcpy(Buffer.data() + InOffset, InData, InBytes);
+		};
+
+	Write(0, &Header, sizeof(Header));
+	Write(Header.LODTableOffset, LODEntries.data(), sizeof(FLODEntry) * LODEntries.size());
+	Write(Header.MaterialTableOffset, Materials.data(), sizeof(FMaterialEntry) * Materials.size());
+	Write(Header.StringTableOffset, Strings.data(), Strings.size());
+	for (size_t LODIndex = 0; LODIndex < InLODs.size(); ++LODIndex)
+	{
+		const FStaticMesh& LOD = *InLODs[LODIndex];
+		const FPackedVertexStream& Packed = PackedLODs[LODIndex];
+		const FLODEntry& Entry = LODEntries[LODIndex];
+		if (bIsLODPacked[LODIndex])
+		{
+			Write(Entry.VertexOffset, Packed.Vertices.data(), sizeof(FPackedNormalVertex) * Packed.Vertices.size());
+		}
+		else
+		{
+			Write(Entry.VertexOffset, LOD.Vertices.data(), sizeof(FNormalVertex) * LOD.Vertices.size());
+		}
+		Write(Entry.ColorOffset, Packed.Colors.data(), sizeof(uint32) * Packed.Colors.size());
+		Write(Entry.IndexOffset, LOD.Indices.data(), sizeof(uint32) * LOD.Indices.size());
+		Write(Entry.SectionOffset, LOD.Sections.data(), sizeof(FMeshSection) * LOD.Sections.size());
+	}
+	Write(Header.BVHOffset, BVHBlob.data(), BVHBlob.size());
+
+	// 쓰다 실패한 파일이 다음 실행에서 읽히지 않도록 임시 파일에 쓴 뒤 교체
+	std::filesystem::path TempPath = InPath;
+	TempPath += ".tmp";
+	{
+		std::ofstream Stream(TempPath, std::ios::binary | std::ios::trunc);
+		if (!Stream) return false;
+		Stream.write(reinterpret_cast<const char*>(Buffer.data()), static_cast<std::streamsize>(Buffer.size()));
+		if (!Stream) return false;
+	}
+
+	std::error_code Error;
+	std::filesystem::rename(TempPath, InPath, Error);
+	if (Error)
+	{
+		std::filesystem::remove(TempPath, Error);
+		return false;
+	}
+	return true;
+}
+
+bool FCookedMeshFile::Open(const std::filesystem::path& InPath, const std::filesystem::path& InSourcePath)
+{
+	// 매핑한 바이트를 그대로 이 구조체로 읽으므로 크기나 패딩이 바뀌면 이전 .meshbin을 잘못 읽는다 (바꾸면 Version도 올릴 것)
+	// 중첩 구조체가 private이라 멤버 함수 안에서 검사한다
+	static_assert(sizeof(FHeader) == 136 && std::is_trivially_copyable_v<FHeader>, "FHeader is mapped directly from .meshbin files");
+	static_assert(sizeof(FLODEntry) == 72 && std::is_trivially_copyable_v<FLODEntry>, "FLODEntry is mapped directly from .meshbin files");
+	static_assert(sizeof(FMaterialEntry) == 120 && std::is_trivially_copyable_v<FMaterialEntry>,
+		"FMaterialEntry is mapped directly from .meshbin files");
+
+	Close();
+
+	if (!File.Open(InPath) || File.GetSize() < sizeof(FHeader))
+	{
+		Close();
+		return false;
+	}
+
+	const char* Base = File.GetData();
+	const uint64 FileSize = File.GetSize();
+	const FHeader* MappedHeader = reinterpret_cast<const FHeader*>(Base);
+
+	bool bValid = MappedHeader->Magic == CookedMeshMagic && MappedHeader->Version == Version &&
+		MappedHeader->FileSize == FileSize && MappedHeader->NumLODs > 0;
+	if (bValid && !InSourcePath.empty())
+	{
+		bValid = MappedHeader->SourceTime == GetSourceTime(InSourcePath) && MappedHeader->SourceSize == GetSourceSize(InSourcePath);
+	}
+
+	// 표와 블롭이 모두 파일 안에 있고 정렬되어 있어야 포인터로 바꿀 수 있다
+	bValid = bValid &&
+		IsRangeValid(MappedHeader->LODTableOffset, sizeof(FLODEntry) * static_cast<uint64>(MappedHeader->NumLODs), FileSize, alignof(FLODEntry)) &&
+		IsRangeValid(MappedHeader->MaterialTableOffset, sizeof(FMaterialEntry) * static_cast<uint64>(MappedHeader->NumMaterials), FileSize,
+			alignof(FMaterialEntry)) &&
+		IsRangeValid(MappedHeader->StringTableOffset, MappedHeader->StringTableSize, FileSize, 1) &&
+		IsRangeValid(MappedHeader->BVHOffset, MappedHeader->BVHSize, FileSize, 1);
+	if (!bValid)
+	{
+		Close();
+		return false;
+	}
+
+	const FLODEntry* MappedLODs = reinterpret_cast<const FLODEntry*>(Base + MappedHeader->LODTableOffset);
+	for (uint32 LODIndex = 0; LODIndex < MappedHeader->NumLODs && bValid; ++LODIndex)
+	{
+		const FLODEntry& Entry = MappedLODs[LODIndex];
+		const bool bIsPacked = Entry.VertexFormat == CookedVertexFormatPacked;
+		const uint64 VertexStride = bIsPacked ? sizeof(FPackedNormalVertex) : sizeof(FNormalVertex);
+		bValid = (bIsPacked || Entry.VertexFormat == CookedVertexFormatFloat) &&
+			IsRangeValid(Entry.VertexOffset, VertexStride * Entry.NumVertices, FileSize, BlobAlignment) &&
+			(Entry.ColorOffset == 0 || IsRangeValid(Entry.ColorOffset, sizeof(uint32) * static_cast<uint64>(Entry.NumVertices), FileSize, BlobAlignment)) &&
+			IsRangeValid(Entry.IndexOffset, sizeof(uint32) * static_cast<uint64>(Entry.NumIndices), FileSize, BlobAlignment) &&
+			IsRangeValid(Entry.SectionOffset, sizeof(FMeshSection) * static_cast<uint64>(Entry.NumSections), FileSize, BlobAlignment);
+
+		const FMeshSection* Sections = reinterpret_cast<const FMeshSection*>(Base + Entry.SectionOffset);
+		for (uint32 Section = 0; Section < Entry.NumSections && bValid; ++Section)
+		{
+			bValid = static_cast<uint64>(Sections[Section].StartIndex) + Sections[Section].IndexCount <= Entry.NumIndices;
+		}
+
+		// 손상된 파일의 인덱스가 BVH/피킹/단순화에서 정점 배열 밖을 읽지 않도록 한 번 훑는다 (CreateStaticMesh의 복사보다 싸다)
+		if (bValid)
+		{
+			const uint32* Indices = reinterpret_cast<const uint32*>(Base + Entry.IndexOffset);
+			uint32 MaxIndex = 0;
+			for (uint32 Index = 0; Index < Entry.NumIndices; ++Index)
+			{
+				MaxIndex = std::max(MaxIndex, Indices[Index]);
+			}
+			bValid = Entry.NumIndices == 0 || MaxIndex < Entry.NumVertices;
+		}
+	}
+
+	const FMaterialEntry* MappedMaterials = reinterpret_cast<const FMaterialEntry*>(Base + MappedHeader->MaterialTableOffset);
+	auto IsStringValid = [MappedHeader](const FCookedString& InString)
+		{
+			return static_cast<uint64>(InString.Offset) + InString.Length <= MappedHeader->StringTableSize;
+		};
+	bValid = bValid && IsStringValid(MappedHeader->PathFileName);
+	for (uint32 Index = 0; Index < MappedHeader->NumMaterials && bValid; ++Index)
+	{
+		const FMaterialEntry& Entry = MappedMaterials[Index];
+		bValid = IsStringValid(Entry.Name) && IsStringValid(Entry.KaMap) && IsStringValid(Entry.KdMap) && IsStringValid(Entry.KsMap) &&
+			IsStringValid(Entry.NsMap) && IsStringValid(Entry.DMap) && IsStringValid(Entry.BumpMap);
+	}
+
+	if (!bValid)
+	{
+		Close();
+		return false;
+	}
+
+	Header = MappedHeader;
+	LODEntries = MappedLODs;
+	MaterialEntries = MappedMaterials;
+	return true;
+}
+
+void FCookedMeshFile::Close()
+{
+	Header = nullptr;
+	LODEntries = nullptr;
+	MaterialEntries = nullptr;
+	File.Close();
+}
+
+int32 FCookedMeshFile::GetNumLODs() const
+{
+	return Header ? static_cast<int32>(Header->NumLODs) : 0;
+}
+
+uint32 FCookedMeshFile::GetNumVertices(int32 InLODIndex) const
+{
+	return InLODIndex >= 0 && InLODIndex < GetNumLODs() ? LODEntries[InLODIndex].NumVertices : 0;
+}
+
+uint32 FCookedMeshFile::GetNumIndices(int32 InLODIndex) const
+{
+	return InLODIndex >= 0 && InLODIndex < GetNumLODs() ? LODEntries[InLODIndex].NumIndices : 0;
+}
+
+uint32 FCookedMeshFile::GetNumSections(int32 InLODIndex) const
+{
+	return InLODIndex >= 0 && InLODIndex < GetNumLODs() ? LODEntries[InLODIndex].NumSections : 0;
+}
+
+bool FCookedMeshFile::IsVertexQuantized(int32 InLODIndex) const
+{
+	return InLODIndex >= 0 && InLODIndex < GetNumLODs() && LODEntries[InLODIndex].VertexFormat == CookedVertexFormatPacked;
+}
+
+const FNormalVertex* FCookedMeshFile::GetVertices(int32 InLODIndex) const
+{
+	if (InLODIndex < 0 || InLODIndex >= GetNumLODs() || IsVertexQuantized(InLODIndex)) return nullptr;
+	return reinterpret_cast<const FNormalVertex*>(File.GetData() + LODEntries[InLODIndex].VertexOffset);
+}
+
+const FPackedNormalVertex* FCookedMeshFile::GetPackedVertices(int32 InLODIndex) const
+{
+	if (!IsVertexQuantized(InLODIndex)) return nullptr;
+	return reinterpret_cast<const FPackedNormalVertex*>(File.GetData() + LODEntries[InLODIndex].VertexOffset);
+}
+
+const uint32* FCookedMeshFile::GetVertexColors(int32 InLODIndex) const
+{
+	if (!IsVertexQuantized(InLODIndex) || LODEntries[InLODIndex].ColorOffset == 0) return nullptr;
+	return reinterpret_cast<const uint32*>(File.GetData() + LODEntries[InLODIndex].ColorOffset);
+}
+
+FVector FCookedMeshFile::GetPositionOrigin(int32 InLODIndex) const
+{
+	if (InLODIndex < 0 || InLODIndex >= GetNumLODs()) return FVector(0.0f, 0.0f, 0.0f);
+	const float* Origin = LODEntries[InLODIndex].PositionOrigin;
+	return FVector(Origin[0], Origin[1], Origin[2]);
+}
+
+FVector FCookedMeshFile::GetPositionScale(int32 InLODIndex) const
+{
+	if (InLODIndex < 0 || InLODIndex >= GetNumLODs()) return FVector(1.0f, 1.0f, 1.0f);
+	const float* Scale = LODEntries[InLODIndex].PositionScale;
+	return FVector(Scale[0], Scale[1], Scale[2]);
+}
+
+const uint32* FCookedMeshFile::GetIndices(int32 InLODIndex) const
+{
+	if (InLODIndex < 0 || InLODIndex >= GetNumLODs()) return nullptr;
+	return reinterpret_cast<const uint32*>(File.GetData() + LODEntries[InLODIndex].IndexOffset);
+}
+
+const FMeshSection* FCookedMeshFile::GetSections(int32 InLODIndex) const
+{
+	if (InLODIndex < 0 || InLODIndex >= GetNumLODs()) return nullptr;
+	return reinterpret_cast<const FMeshSection*>(File.GetData() + LODEntries[InLODIndex].SectionOffset);
+}
+
+FAABB FCookedMeshFile::GetBounds() const
+{
+	if (!Header) return FAABB();
+	return FAABB(FVector(Header->BoundsMin[0], Header->BoundsMin[1], Header->BoundsMin[2]),
+		FVector(Header->BoundsMax[0], Header->BoundsMax[1], Header->BoundsMax[2]));
+}
+
+uint64 FCookedMeshFile::GetSourceHash() const
+{
+	return Header ? Header->SourceHash : 0;
+}
+
+bool FCookedMeshFile::HasBVH() const
+{
+	return Header && Header->BVHSize > 0;
+}
+
+bool FCookedMeshFile::WasQuantizationEnabled() const
+{
+	return Header && (Header->Flags & CookedMeshFlagQuantizeVertices) != 0;
+}
+
+bool FCookedMeshFile::LoadBVH(FStaticMeshBVH& OutBVH, float* OutBuildMilliseconds) const
+{
+	if (!HasBVH()) return false;
+	return OutBVH.LoadFromBuffer(reinterpret_cast<const uint8*>(File.GetData() + Header->BVHOffset), Header->BVHSize,
+		Header->SourceHash, Header->SourceTime, OutBuildMilliseconds);
+}
+
+FString FCookedMeshFile::GetString(uint32 InOffset, uint32 InLength) const
+{
+	return FString(File.GetData() + Header->StringTableOffset + InOffset, InLength);
+}
+
+FStaticMesh* FCookedMeshFile::CreateStaticMesh(int32 InLODIndex) const
+{
+	if (InLODIndex < 0 || InLODIndex >= GetNumLODs())
+	{
+		return nullptr;
+	}
+
+	const FLODEntry& Entry = LODEntries[InLODIndex];
+	FStaticMesh* Mesh = new FStaticMesh();
+	Mesh->PathFileName = FName(GetString(Header->PathFileName.Offset, Header->PathFileName.Length));
+
+	const uint32* Indices = GetIndices(InLODIndex);
+	const FMeshSection* Sections = GetSections(InLODIndex);
+	if (const FNormalVertex* Vertices = GetVertices(InLODIndex))
+	{
+		Mesh->Vertices.assign(Vertices, Vertices + Entry.NumVertices);
+	}
+	else
+	{
+		Mesh->Vertices.resize(Entry.NumVertices);
+		FPackedVertexStream::UnpackVertices(GetPackedVertices(InLODIndex), GetVertexColors(InLODIndex), Entry.NumVertices,
+			GetPositionOrigin(InLODIndex), GetPositionScale(InLODIndex), Mesh->Vertices.data());
+	}
+	Mesh->Indices.assign(Indices, Indices + Entry.NumIndices);
+	Mesh->Sections.assign(Sections, Sections + Entry.NumSections);
+
+	Mesh->MaterialInfo.resize(Header->NumMaterials);
+	for (uint32 Index = 0; Index < Header->NumMaterials; ++Index)
+	{
+		const FMaterialEntry& Source = MaterialEntries[Index];
+		FMaterial& Material = Mesh->MaterialInfo[Index];
+		Material.Name = GetString(Source.Name.Offset, Source.Name.Length);
+		Material.KaMap = GetString(Source.KaMap.Offset, Source.KaMap.Length);
+		Material.KdMap = GetString(Source.KdMap.Offset, Source.KdMap.Length);
+		Material.KsMap = GetString(Source.KsMap.Offset, Source.KsMap.Length);
+		Material.NsMap = GetString(Source.NsMap.Offset, Source.NsMap.Length);
+		Material.DMap = GetString(Source.DMap.Offset, Source.DMap.Length);
+		Material.BumpMap = GetString(Source.BumpMap.Offset, Source.BumpMap.Length);
+		Material.Ka = FVector(Source.Ka[0], Source.Ka[1], Source.Ka[2]);
+		Material.Kd = FVector(Source.Kd[0], Source.Kd[1], Source.Kd[2]);
+		Material.Ks = FVector(Source.Ks[0], Source.Ks[1], Source.Ks[2]);
+		Material.Ke = FVector(Source.Ke[0], Source.Ke[1], Source.Ke[2]);
+		Material.Ns = Source.Ns;
+		Material.Ni = Source.Ni;
+		Material.D = Source.D;
+		Material.Illumination = Source.Illumination;
+	}
+
+	return Mesh;
+}
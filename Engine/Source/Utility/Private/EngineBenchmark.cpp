@@ -0,0 +1,3179 @@
+#include "pch.h"
+#include "Utility/Public/EngineBenchmark.h"
+#include "Utility/Public/ScopeCycleCounter.h"
+#include "Utility/Public/SceneBVH.h"
+#include "Utility/Public/StaticMeshBVH.h"
+#include "Utility/Public/PlatformSIMD.h"
+#include "Utility/Public/TaskScheduler.h"
+#include "Utility/Public/MeshSimplifier.h"
+#include "Utility/Public/MeshOptimizer.h"
+#include "Utility/Public/CookedMesh.h"
+#include "Utility/Public/ObjExporter.h"
+#include "Utility/Public/PackedVertex.h"
+#include "Utility/Public/StaticMeshSerializer.h"
+#include "Render/Spatial/Public/Octree.h"
+#include "Render/Culling/Public/SceneCuller.h"
+#include "Render/Culling/Public/SoftwareOcclusion.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/TransformHierarchy.h"
+#include "Component/Public/PrimitiveBoundsTable.h"
+#include "Manager/Asset/Public/ObjImporter.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Core/Public/WindowsBinReader.h"
+#include "Core/Public/WindowsBinWriter.h"
+#include "Core/Public/BufferedBinReader.h"
+#include "Core/Public/BufferedBinWriter.h"
+#include "Core/Public/MappedBinReader.h"
+#include "Core/Public/ObjectIterator.h"
+
+#include <atomic>
+#include <cctype>
+#include <filesystem>
+#include <random>
+#include <shared_mutex>
+
+// 오브젝트 순회 벤치마크용 클래스 (UStaticMeshComponent처럼 UObject에서 4단계 아래에 메시 컴포넌트가 있는 계층)
+UCLASS()
+class UBenchmarkComponent : public UObject
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(UBenchmarkComponent, UObject)
+};
+
+UCLASS()
+class UBenchmarkSceneComponent : public UBenchmarkComponent
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(UBenchmarkSceneComponent, UBenchmarkComponent)
+};
+
+UCLASS()
+class UBenchmarkPrimitiveComponent : public UBenchmarkSceneComponent
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(UBenchmarkPrimitiveComponent, UBenchmarkSceneComponent)
+};
+
+UCLASS()
+class UBenchmarkMeshComponent : public UBenchmarkPrimitiveComponent
+{
+	GENERATED_BODY()
+	DECLARE_CLASS(UBenchmarkMeshComponent, UBenchmarkPrimitiveComponent)
+};
+
+IMPLEMENT_CLASS(UBenchmarkComponent, UObject)
+IMPLEMENT_CLASS(UBenchmarkSceneComponent, UBenchmarkComponent)
+IMPLEMENT_CLASS(UBenchmarkPrimitiveComponent, UBenchmarkSceneComponent)
+IMPLEMENT_CLASS(UBenchmarkMeshComponent, UBenchmarkPrimitiveComponent)
+
+namespace
+{
+	// 결과 비교가 가능하도록 고정 시드 사용
+	constexpr uint32 BenchmarkSeed = 0x5EED1234u;
+
+	// 한 변이 InWorldExtent인 정육면체 안에 크기가 제각각인 AABB를 뿌린다
+	TArray<FAABB> MakeSyntheticAABBs(int64 InCount, float InWorldExtent)
+	{
+		std::mt19937 Rng(BenchmarkSeed);
+		std::uniform_real_distribution<float> PosDist(0.0f, InWorldExtent);
+		std::uniform_real_distribution<float> SizeDist(0.25f, 4.0f);
+
+		TArray<FAABB> Bounds;
+		Bounds.reserve(InCount);
+		for (int64 i = 0; i < InCount; ++i)
+		{
+			const FVector Center(PosDist(Rng), PosDist(Rng), PosDist(Rng));
+			const FVector Half(SizeDist(Rng), SizeDist(Rng), SizeDist(Rng));
+			Bounds.emplace_back(Center - Half, Center + Half);
+		}
+		return Bounds;
+	}
+
+	// 월드 큐브 바깥 구면에서 큐브 내부의 임의 지점을 향하는 레이 (방향은 정규화)
+	TArray<FRay> MakeSyntheticRays(int64 InCount, float InWorldExtent)
+	{
+		std::mt19937 Rng(BenchmarkSeed ^ 0xA5A5A5A5u);
+		std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> PosDist(0.0f, InWorldExtent);
+
+		const FVector Center(InWorldExtent * 0.5f, InWorldExtent * 0.5f, InWorldExtent * 0.5f);
+		TArray<FRay> Rays;
+		Rays.reserve(InCount);
+		for (int64 i = 0; i < InCount; ++i)
+		{
+			FVector OnSphere(Unit(Rng), Unit(Rng), Unit(Rng));
+			OnSphere.Normalize();
+			const FVector Origin = Center + OnSphere * InWorldExtent;
+			FVector Dir = FVector(PosDist(Rng), PosDist(Rng), PosDist(Rng)) - Origin;
+			Dir.Normalize();
+
+			FRay Ray;
+			Ray.Origin = FVector4(Origin.X, Origin.Y, Origin.Z, 1.0f);
+			Ray.Direction = FVector4(Dir.X, Dir.Y, Dir.Z, 0.0f);
+			Rays.push_back(Ray);
+		}
+		return Rays;
+	}
+
+	const char* GetLayoutName(EBVHLayout InLayout)
+	{
+		switch (InLayout)
+		{
+		case EBVHLayout::Binary: return "binary";
+		case EBVHLayout::Wide4:  return "wide4 ";
+		case EBVHLayout::Wide8:  return "wide8 ";
+		}
+		return "?";
+	}
+
+	/**
+	 * @brief Target의 바운딩 구를 화면에 꽉 채우는 InSize x InSize 카메라 레이
+	 * 패킷이 화면상 인접한 레이로 묶이도록 4x4 타일 순서로 나열한다 (16개 = 타일 하나, 8개 = 4x2, 4개 = 한 줄)
+	 */
+	TArray<FRay> MakeCameraRays(const FAABB& InTarget, int32 InSize)
+	{
+		const FVector Center = (InTarget.Min + InTarget.Max) * 0.5f;
+		const float Radius = std::max((InTarget.Max - InTarget.Min).Length() * 0.5f, 1e-3f);
+
+		FVector Forward(-1.0f, -0.7f, -0.5f);
+		Forward.Normalize();
+		const FVector Eye = Center - Forward * (Radius * 2.5f);
+		FVector Right = FVector(0.0f, 0.0f, 1.0f).Cross(Forward);
+		Right.Normalize();
+		const FVector Up = Forward.Cross(Right);
+
+		TArray<FRay> Rays;
+		Rays.reserve(static_cast<size_t>(InSize) * InSize);
+		for (int32 TileY = 0; TileY < InSize; TileY += 4)
+		{
+			for (int32 TileX = 0; TileX < InSize; TileX += 4)
+			{
+				for (int32 Y = TileY; Y < std::min(TileY + 4, InSize); ++Y)
+				{
+					for (int32 X = TileX; X < std::min(TileX + 4, InSize); ++X)
+					{
+						const float U = ((X + 0.5f) / InSize) * 2.0f - 1.0f;
+						const float V = ((Y + 0.5f) / InSize) * 2.0f - 1.0f;
+						FVector Dir = Center + Right * (U * Radius) + Up * (V * Radius) - Eye;
+						Dir.Normalize();
+
+						FRay Ray;
+						Ray.Origin = FVector4(Eye.X, Eye.Y, Eye.Z, 1.0f);
+						Ray.Direction = FVector4(Dir.X, Dir.Y, Dir.Z, 0.0f);
+						Rays.push_back(Ray);
+					}
+				}
+			}
+		}
+		return Rays;
+	}
+
+	// 단일 레이 API 기준선: front-to-back 트래버설 + 스칼라 Moller-Trumbore (패킷 버전과 같은 판정식)
+	float IntersectClosestTriangle(const FStaticMeshBVH& InBVH, const FRay& InRay)
+	{
+		const FVector O(InRay.Origin.X, InRay.Origin.Y, InRay.Origin.Z);
+		const FVector D(InRay.Direction.X, InRay.Direction.Y, InRay.Direction.Z);
+		float Best = std::numeric_limits<float>::infinity();
+
+		InBVH.TraverseFrontToBack(InRay, 0.0f, [&](int32 TriIndex)
+			{
+				FVector V0, E1, E2;
+				InBVH.GetTriV0E1E2(TriIndex, V0, E1, E2);
+				const FVector P = D.Cross(E2);
+				const float Det = E1.Dot(P);
+				if (std::fabs(Det) < TRayPacket<4>::ParallelEpsilon) return;
+				const float InvDet = 1.0f / Det;
+				const FVector S = O - V0;
+				const float U = S.Dot(P) * InvDet;
+				if (U < 0.0f || U > 1.0f) return;
+				const FVector Q = S.Cross(E1);
+				const float V = D.Dot(Q) * InvDet;
+				if (V < 0.0f || U + V > 1.0f) return;
+				const float T = E2.Dot(Q) * InvDet;
+				if (T > 0.0f && T < Best) Best = T;
+			});
+		return Best;
+	}
+
+	// 히트 거리 합 비교 (삼각형이 같은 거리에서 겹치는 경우 인덱스는 달라질 수 있으므로 거리로 비교)
+	bool IsSameChecksum(double InChecksum, double InReference)
+	{
+		return std::fabs(InChecksum - InReference) <= 1e-5 * std::max(1.0, std::fabs(InReference));
+	}
+
+	// InEye에서 +X를 바라보는 90도 시야 프러스텀 (평면 노멀은 안쪽)
+	FFrustum MakeBoxFrustum(const FVector& InEye, float InNear, float InFar)
+	{
+		FFrustum Frustum;
+		Frustum.Planes[FFrustum::Near] = FPlane(FVector(1.0f, 0.0f, 0.0f), InEye + FVector(InNear, 0.0f, 0.0f));
+		Frustum.Planes[FFrustum::Far] = FPlane(FVector(-1.0f, 0.0f, 0.0f), InEye + FVector(InFar, 0.0f, 0.0f));
+		Frustum.Planes[FFrustum::Left] = FPlane(FVector(1.0f, 1.0f, 0.0f), InEye);
+		Frustum.Planes[FFrustum::Right] = FPlane(FVector(1.0f, -1.0f, 0.0f), InEye);
+		Frustum.Planes[FFrustum::Bottom] = FPlane(FVector(1.0f, 0.0f, 1.0f), InEye);
+		Frustum.Planes[FFrustum::Top] = FPlane(FVector(1.0f, 0.0f, -1.0f), InEye);
+		return Frustum;
+	}
+
+	// +X를 바라보는 원근 카메라의 View * Projection (UCamera::UpdateMatrixByPers와 같은 행렬 규약)
+	FMatrix MakeLookForwardViewProjection(const FVector& InEye, float InAspect, float InNear, float InFar)
+	{
+		const FVector Forward(1.0f, 0.0f, 0.0f);
+		const FVector Up(0.0f, 0.0f, 1.0f);
+		const FVector Right(0.0f, 1.0f, 0.0f);
+		const FMatrix View = FMatrix::TranslationMatrixInverse(InEye) * FMatrix(Right, Up, Forward).Transpose();
+
+		// 수직 화각 90도
+		FMatrix Projection = FMatrix::Identity();
+		Projection.Data[0][0] = 1.0f / InAspect;
+		Projection.Data[1][1] = 1.0f;
+		Projection.Data[2][2] = InFar / (InFar - InNear);
+		Projection.Data[2][3] = 1.0f;
+		Projection.Data[3][2] = -InNear * InFar / (InFar - InNear);
+		Projection.Data[3][3] = 0.0f;
+		return View * Projection;
+	}
+
+	// InRepeat번 실행해 가장 빠른 시간(ms)을 반환
+	template<typename TFunc>
+	double MeasureBestMilliseconds(int32 InRepeat, TFunc&& InFunc)
+	{
+		double BestMs = std::numeric_limits<double>::max();
+		for (int32 i = 0; i < InRepeat; ++i)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			InFunc();
+			BestMs = std::min(BestMs, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start));
+		}
+		return BestMs;
+	}
+
+	// 정점을 공유하는 울퉁불퉁한 닫힌 토러스 (InRingCount x InSideCount 사각형 = 삼각형 2배)
+	FStaticMesh* MakeBumpyTorusMesh(int32 InRingCount, int32 InSideCount)
+	{
+		constexpr float MajorRadius = 10.0f;
+		constexpr float MinorRadius = 3.0f;
+		constexpr float TwoPi = 6.28318530718f;
+
+		FStaticMesh* Mesh = new FStaticMesh();
+		Mesh->Vertices.reserve(static_cast<size_t>(InRingCount) * InSideCount);
+		for (int32 Ring = 0; Ring < InRingCount; ++Ring)
+		{
+			const float U = TwoPi * Ring / InRingCount;
+			for (int32 Side = 0; Side < InSideCount; ++Side)
+			{
+				const float V = TwoPi * Side / InSideCount;
+				const float Radius = MinorRadius * (1.0f + 0.08f * std::sin(U * 7.0f) * std::sin(V * 5.0f));
+				const FVector Normal(std::cos(U) * std::cos(V), std::sin(U) * std::cos(V), std::sin(V));
+
+				FNormalVertex Vertex = {};
+				Vertex.Position = FVector(std::cos(U) * MajorRadius, std::sin(U) * MajorRadius, 0.0f) + Normal * Radius;
+				Vertex.Normal = Normal;
+				Vertex.Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+				Vertex.TexCoord = FVector2(static_cast<float>(Ring) / InRingCount, static_cast<float>(Side) / InSideCount);
+				Mesh->Vertices.push_back(Vertex);
+			}
+		}
+
+		Mesh->Indices.reserve(static_cast<size_t>(InRingCount) * InSideCount * 6);
+		for (int32 Ring = 0; Ring < InRingCount; ++Ring)
+		{
+			for (int32 Side = 0; Side < InSideCount; ++Side)
+			{
+				const uint32 I0 = Ring * InSideCount + Side;
+				const uint32 I1 = ((Ring + 1) % InRingCount) * InSideCount + Side;
+				const uint32 I2 = ((Ring + 1) % InRingCount) * InSideCount + (Side + 1) % InSideCount;
+				const uint32 I3 = Ring * InSideCount + (Side + 1) % InSideCount;
+				Mesh->Indices.insert(Mesh->Indices.end(), { I0, I1, I2, I0, I2, I3 });
+			}
+		}
+
+		FMeshSection Section;
+		Section.StartIndex = 0;
+		Section.IndexCount = static_cast<uint32>(Mesh->Indices.size());
+		Section.MaterialSlot = 0;
+		Mesh->Sections.push_back(Section);
+		return Mesh;
+	}
+
+	/**
+	 * @brief Data/ 아래의 원본 .obj 메시(LOD 파일 제외, 같은 이름은 한 번만)를 에디터 시작 시와 같은 설정으로 읽어 InFunc(이름, 메시) 호출
+	 * @return Data/ 디렉토리가 없으면 false
+	 */
+	template<typename TFunc>
+	bool ForEachDataMesh(TFunc&& InFunc)
+	{
+		FObjImporter::Configuration Config;
+		Config.bFlipWindingOrder = false;
+		Config.bIsBinaryEnabled = true;
+		Config.bUVToUEBasis = true;
+		Config.bPositionToUEBasis = true;
+
+		const FString DataDirectory = "Data/";
+		if (!std::filesystem::is_directory(DataDirectory))
+		{
+			return false;
+		}
+
+		TSet<FString> MeshNames;
+		for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+		{
+			if (!Entry.is_regular_file() || Entry.path().extension() != ".obj") continue;
+
+			const FString PathString = Entry.path().generic_string();
+			if (PathString.find("_lod_") != FString::npos) continue;
+			if (!MeshNames.insert(Entry.path().filename().generic_string()).second) continue;
+
+			const TUniquePtr<FStaticMesh> Mesh(FObjManager::LoadObjStaticMeshAsset(FName(PathString), Config));
+			if (Mesh && Mesh->Indices.size() >= 3)
+			{
+				InFunc(Entry.path().filename().generic_string(), *Mesh);
+			}
+		}
+		return true;
+	}
+
+	// 점 P에서 삼각형 ABC까지의 최단 거리 제곱 (Ericson, Real-Time Collision Detection 5.1.5)
+	float PointTriangleDistanceSquared(const FVector& P, const FVector& A, const FVector& B, const FVector& C)
+	{
+		const FVector AB = B - A;
+		const FVector AC = C - A;
+		const FVector AP = P - A;
+		const float D1 = AB.Dot(AP);
+		const float D2 = AC.Dot(AP);
+		if (D1 <= 0.0f && D2 <= 0.0f) return AP.LengthSquared();
+
+		const FVector BP = P - B;
+		const float D3 = AB.Dot(BP);
+		const float D4 = AC.Dot(BP);
+		if (D3 >= 0.0f && D4 <= D3) return BP.LengthSquared();
+
+		const float VC = D1 * D4 - D3 * D2;
+		if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+		{
+			const float T = D1 / (D1 - D3);
+			return (P - (A + AB * T)).LengthSquared();
+		}
+
+		const FVector CP = P - C;
+		const float D5 = AB.Dot(CP);
+		const float D6 = AC.Dot(CP);
+		if (D6 >= 0.0f && D5 <= D6) return CP.LengthSquared();
+
+		const float VB = D5 * D2 - D1 * D6;
+		if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+		{
+			const float T = D2 / (D2 - D6);
+			return (P - (A + AC * T)).LengthSquared();
+		}
+
+		const float VA = D3 * D6 - D5 * D4;
+		if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+		{
+			const float T = (D4 - D3) / ((D4 - D3) + (D5 - D6));
+			return (P - (B + (C - B) * T)).LengthSquared();
+		}
+
+		const float Denom = 1.0f / (VA + VB + VC);
+		const float V = VB * Denom;
+		const float W = VC * Denom;
+		return (P - (A + AB * V + AC * W)).LengthSquared();
+	}
+
+	/**
+	 * @brief InFrom의 정점과 삼각형 중심에서 InTo 표면까지의 최대 거리 (단방향 하우스도르프 근사)
+	 * InTo의 삼각형을 균일 격자에 넣고, 찾은 최단 거리보다 먼 껍질이 나올 때까지 셀을 넓혀 가며 찾는다
+	 */
+	float ComputeOneSidedHausdorff(const FStaticMesh& InFrom, const FStaticMesh& InTo, const FAABB& InBounds)
+	{
+		const int32 NumTris = static_cast<int32>(InTo.Indices.size() / 3);
+		if (NumTris == 0) return 0.0f;
+
+		const FVector Extent = InBounds.Max - InBounds.Min;
+		const float CellSize = std::max(std::cbrt(Extent.X * Extent.Y * Extent.Z / NumTris) * 2.0f, Extent.Length() / 256.0f);
+		const int32 DimX = std::max(1, static_cast<int32>(Extent.X / CellSize) + 1);
+		const int32 DimY = std::max(1, static_cast<int32>(Extent.Y / CellSize) + 1);
+		const int32 DimZ = std::max(1, static_cast<int32>(Extent.Z / CellSize) + 1);
+
+		auto ToCell = [&](float InValue, float InMin, int32 InDim)
+			{
+				return std::clamp(static_cast<int32>((InValue - InMin) / CellSize), 0, InDim - 1);
+			};
+
+		// 셀별 삼각형 목록 (CSR)
+		TArray<uint32> CellStart(static_cast<size_t>(DimX) * DimY * DimZ + 1, 0);
+		TArray<uint32> CellTris;
+		for (int32 Pass = 0; Pass < 2; ++Pass)
+		{
+			for (int32 Tri = 0; Tri < NumTris; ++Tri)
+			{
+				const FVector& A = InTo.Vertices[InTo.Indices[Tri * 3 + 0]].Position;
+				const FVector& B = InTo.Vertices[InTo.Indices[Tri * 3 + 1]].Position;
+				const FVector& C = InTo.Vertices[InTo.Indices[Tri * 3 + 2]].Position;
+				const int32 MinX = ToCell(std::min({ A.X, B.X, C.X }), InBounds.Min.X, DimX), MaxX = ToCell(std::max({ A.X, B.X, C.X }), InBounds.Min.X, DimX);
+				const int32 MinY = ToCell(std::min({ A.Y, B.Y, C.Y }), InBounds.Min.Y, DimY), MaxY = ToCell(std::max({ A.Y, B.Y, C.Y }), InBounds.Min.Y, DimY);
+				const int32 MinZ = ToCell(std::min({ A.Z, B.Z, C.Z }), InBounds.Min.Z, DimZ), MaxZ = ToCell(std::max({ A.Z, B.Z, C.Z }), InBounds.Min.Z, DimZ);
+				for (int32 Z = MinZ; Z <= MaxZ; ++Z)
+				{
+					for (int32 Y = MinY; Y <= MaxY; ++Y)
+					{
+						for (int32 X = MinX; X <= MaxX; ++X)
+						{
+							const size_t Cell = (static_cast<size_t>(Z) * DimY + Y) * DimX + X;
+							if (Pass == 0) ++CellStart[Cell + 1];
+							else CellTris[CellStart[Cell]++] = Tri;
+						}
+					}
+				}
+			}
+
+			if (Pass == 0)
+			{
+				for (size_t Cell = 1; Cell < CellStart.size(); ++Cell) CellStart[Cell] += CellStart[Cell - 1];
+				CellTris.resize(CellStart.back());
+			}
+			else
+			{
+				// 두 번째 패스에서 시작 위치가 끝 위치로 밀렸으므로 한 칸씩 되돌린다
+				for (size_t Cell = CellStart.size() - 1; Cell > 0; --Cell) CellStart[Cell] = CellStart[Cell - 1];
+				CellStart[0] = 0;
+			}
+		}
+
+		const int32 MaxShell = std::max({ DimX, DimY, DimZ });
+		auto DistanceToSurface = [&](const FVector& InPoint)
+			{
+				const int32 CX = ToCell(InPoint.X, InBounds.Min.X, DimX);
+				const int32 CY = ToCell(InPoint.Y, InBounds.Min.Y, DimY);
+				const int32 CZ = ToCell(InPoint.Z, InBounds.Min.Z, DimZ);
+
+				float BestSquared = std::numeric_limits<float>::max();
+				for (int32 Shell = 0; Shell <= MaxShell; ++Shell)
+				{
+					// 아직 방문하지 않은 셀은 최소 (Shell - 1) * CellSize만큼 떨어져 있다
+					const float ShellDistance = std::max(0.0f, (Shell - 1) * CellSize);
+					if (ShellDistance * ShellDistance > BestSquared) break;
+
+					for (int32 Z = CZ - Shell; Z <= CZ + Shell; ++Z)
+					{
+						if (Z < 0 || Z >= DimZ) continue;
+						for (int32 Y = CY - Shell; Y <= CY + Shell; ++Y)
+						{
+							if (Y < 0 || Y >= DimY) continue;
+							for (int32 X = CX - Shell; X <= CX + Shell; ++X)
+							{
+								if (X < 0 || X >= DimX) continue;
+								// 껍질 표면의 셀만 방문
+								if (std::abs(X - CX) != Shell && std::abs(Y - CY) != Shell && std::abs(Z - CZ) != Shell) continue;
+
+								const size_t Cell = (static_cast<size_t>(Z) * DimY + Y) * DimX + X;
+								for (uint32 Ref = CellStart[Cell]; Ref < CellStart[Cell + 1]; ++Ref)
+								{
+									const uint32 Tri = CellTris[Ref];
+									BestSquared = std::min(BestSquared, PointTriangleDistanceSquared(InPoint,
+										InTo.Vertices[InTo.Indices[Tri * 3 + 0]].Position,
+										InTo.Vertices[InTo.Indices[Tri * 3 + 1]].Position,
+										InTo.Vertices[InTo.Indices[Tri * 3 + 2]].Position));
+								}
+							}
+						}
+					}
+				}
+				return std::sqrt(BestSquared);
+			};
+
+		float MaxDistance = 0.0f;
+		for (const FNormalVertex& Vertex : InFrom.Vertices)
+		{
+			MaxDistance = std::max(MaxDistance, DistanceToSurface(Vertex.Position));
+		}
+		for (size_t Index = 0; Index + 2 < InFrom.Indices.size(); Index += 3)
+		{
+			const FVector Centroid = (InFrom.Vertices[InFrom.Indices[Index]].Position + InFrom.Vertices[InFrom.Indices[Index + 1]].Position +
+				InFrom.Vertices[InFrom.Indices[Index + 2]].Position) * (1.0f / 3.0f);
+			MaxDistance = std::max(MaxDistance, DistanceToSurface(Centroid));
+		}
+		return MaxDistance;
+	}
+
+	// FArchive에 배열 일괄 경로가 생기기 전의 원소별 직렬화 (비교 기준, 파일 형식은 같다)
+	template<typename T>
+	void SerializeArrayPerElement(FArchive& InArchive, TArray<T>& InArray)
+	{
+		size_t Length = InArray.size();
+		InArchive << Length;
+		if (InArchive.IsLoading())
+		{
+			InArray.resize(Length);
+		}
+		for (T& Element : InArray)
+		{
+			InArchive << Element;
+		}
+	}
+
+	void SerializeObjInfoPerElement(FArchive& InArchive, FObjInfo& InObjInfo)
+	{
+		size_t NumObjects = InObjInfo.ObjectInfoList.size();
+		InArchive << NumObjects;
+		if (InArchive.IsLoading())
+		{
+			InObjInfo.ObjectInfoList.resize(NumObjects);
+		}
+		for (FObjectInfo& ObjectInfo : InObjInfo.ObjectInfoList)
+		{
+			InArchive << ObjectInfo.Name;
+			SerializeArrayPerElement(InArchive, ObjectInfo.VertexIndexList);
+			SerializeArrayPerElement(InArchive, ObjectInfo.NormalIndexList);
+			SerializeArrayPerElement(InArchive, ObjectInfo.TexCoordIndexList);
+			SerializeArrayPerElement(InArchive, ObjectInfo.GroupNameList);
+			SerializeArrayPerElement(InArchive, ObjectInfo.GroupIndexList);
+			SerializeArrayPerElement(InArchive, ObjectInfo.MaterialNameList);
+			SerializeArrayPerElement(InArchive, ObjectInfo.MaterialIndexList);
+		}
+		SerializeArrayPerElement(InArchive, InObjInfo.ObjectMaterialInfoList);
+		SerializeArrayPerElement(InArchive, InObjInfo.VertexList);
+		SerializeArrayPerElement(InArchive, InObjInfo.NormalList);
+		SerializeArrayPerElement(InArchive, InObjInfo.TexCoordList);
+	}
+
+	// 이전 USceneComponent 방식: 세터마다 서브트리를 더티로 표시하고 그 자리에서 재귀로 월드/역행렬을 다시 계산
+	struct FEagerTransformTree
+	{
+		TArray<int32> Parents;
+		TArray<TArray<int32>> Children;
+		TArray<FMatrix> LocalTransforms;
+		TArray<FMatrix> WorldTransforms;
+		TArray<FMatrix> WorldInverses;
+		TArray<uint8> DirtyFlags;
+
+		explicit FEagerTransformTree(const TArray<int32>& InParents)
+			: Parents(InParents), Children(InParents.size()), LocalTransforms(InParents.size(), FMatrix::Identity()),
+			WorldTransforms(InParents.size()), WorldInverses(InParents.size()), DirtyFlags(InParents.size(), 1)
+		{
+			for (size_t Node = 0; Node < Parents.size(); ++Node)
+			{
+				if (Parents[Node] >= 0)
+				{
+					Children[Parents[Node]].push_back(static_cast<int32>(Node));
+				}
+			}
+		}
+
+		void SetLocalTransform(int32 InNode, const FMatrix& InLocalTransform)
+		{
+			LocalTransforms[InNode] = InLocalTransform;
+			MarkDirty(InNode);
+			Update(InNode);
+		}
+
+		void MarkDirty(int32 InNode)
+		{
+			DirtyFlags[InNode] = 1;
+			for (const int32 Child : Children[InNode])
+			{
+				MarkDirty(Child);
+			}
+		}
+
+		void Update(int32 InNode)
+		{
+			if (!DirtyFlags[InNode])
+			{
+				return;
+			}
+
+			if (Parents[InNode] >= 0)
+			{
+				Update(Parents[InNode]);
+				WorldTransforms[InNode] = LocalTransforms[InNode] * WorldTransforms[Parents[InNode]];
+			}
+			else
+			{
+				WorldTransforms[InNode] = FMatrix::UEToDx * LocalTransforms[InNode];
+			}
+			WorldInverses[InNode] = WorldTransforms[InNode].Inverse();
+			DirtyFlags[InNode] = 0;
+
+			for (const int32 Child : Children[InNode])
+			{
+				Update(Child);
+			}
+		}
+	};
+
+	// 이전 FMatrix::operator*: 원소마다 열을 모아 수평 덧셈으로 내적
+	FMatrix LegacyMultiply(const FMatrix& InLeft, const FMatrix& InRight)
+	{
+		FMatrix Result;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const __m128 Row = _mm_loadu_ps(InLeft.Data[i]);
+			for (int32 j = 0; j < 4; ++j)
+			{
+				const __m128 Col = _mm_set_ps(InRight.Data[3][j], InRight.Data[2][j], InRight.Data[1][j], InRight.Data[0][j]);
+				const __m128 Mul = _mm_mul_ps(Row, Col);
+				__m128 Sum = _mm_hadd_ps(Mul, Mul);
+				Sum = _mm_hadd_ps(Sum, Sum);
+				Result.Data[i][j] = _mm_cvtss_f32(Sum);
+			}
+		}
+		return Result;
+	}
+
+	// 이전 FVector4 * FMatrix (같은 방식)
+	FVector4 LegacyVectorMultiply(const FVector4& InVector, const FMatrix& InMatrix)
+	{
+		const __m128 Vec = _mm_set_ps(InVector.W, InVector.Z, InVector.Y, InVector.X);
+		float Result[4];
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const __m128 Col = _mm_set_ps(InMatrix.Data[3][i], InMatrix.Data[2][i], InMatrix.Data[1][i], InMatrix.Data[0][i]);
+			const __m128 Mul = _mm_mul_ps(Vec, Col);
+			__m128 Sum = _mm_hadd_ps(Mul, Mul);
+			Sum = _mm_hadd_ps(Sum, Sum);
+			Result[i] = _mm_cvtss_f32(Sum);
+		}
+		return FVector4(Result[0], Result[1], Result[2], Result[3]);
+	}
+
+	// 이전 GetModelMatrix: 축별 회전 행렬 세 개와 S, T를 차례로 곱한다
+	FMatrix LegacyModelMatrix(const FVector& InLocation, const FVector& InRotation, const FVector& InScale)
+	{
+		const FMatrix Rotation = LegacyMultiply(LegacyMultiply(FMatrix::RotationX(InRotation.X), FMatrix::RotationY(InRotation.Y)), FMatrix::RotationZ(InRotation.Z));
+		const FMatrix Model = LegacyMultiply(LegacyMultiply(FMatrix::ScaleMatrix(InScale), Rotation), FMatrix::TranslationMatrix(InLocation));
+		return LegacyMultiply(FMatrix::UEToDx, Model);
+	}
+
+	// 이전 UPrimitiveComponent::GetWorldAABB: 모서리 8개를 변환해 최소/최대
+	void LegacyTransformAABB(const FMatrix& InMatrix, const FAABB& InBounds, FAABB& OutBounds)
+	{
+		FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+		FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector4 Local((Corner & 1) ? InBounds.Max.X : InBounds.Min.X, (Corner & 2) ? InBounds.Max.Y : InBounds.Min.Y,
+				(Corner & 4) ? InBounds.Max.Z : InBounds.Min.Z, 1.0f);
+			const FVector4 World = LegacyVectorMultiply(Local, InMatrix);
+			WorldMin = FVector(std::min(WorldMin.X, World.X), std::min(WorldMin.Y, World.Y), std::min(WorldMin.Z, World.Z));
+			WorldMax = FVector(std::max(WorldMax.X, World.X), std::max(WorldMax.Y, World.Y), std::max(WorldMax.Z, World.Z));
+		}
+		OutBounds = FAABB(WorldMin, WorldMax);
+	}
+
+	float GetMatrixDifference(const FMatrix& InA, const FMatrix& InB)
+	{
+		float MaxDifference = 0.0f;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				MaxDifference = std::max(MaxDifference, std::abs(InA.Data[Row][Col] - InB.Data[Row][Col]));
+			}
+		}
+		return MaxDifference;
+	}
+
+	float GetMatrixMagnitude(const FMatrix& InMatrix)
+	{
+		float Magnitude = 0.0f;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				Magnitude = std::max(Magnitude, std::abs(InMatrix.Data[Row][Col]));
+			}
+		}
+		return Magnitude;
+	}
+
+	float GetVectorDifference(const FVector& InA, const FVector& InB)
+	{
+		return std::max({ std::abs(InA.X - InB.X), std::abs(InA.Y - InB.Y), std::abs(InA.Z - InB.Z) });
+	}
+
+	// 이전 UPrimitiveComponent의 월드 AABB 캐시: 읽을 때마다 월드 변환 버전을 확인하고 바뀌었으면 모서리 8개로 다시 계산
+	struct FLazyBoundsCache
+	{
+		FTransformHierarchy& Hierarchy;
+		const TArray<int32>& TransformHandles;
+		const TArray<FAABB>& LocalBounds;
+		TArray<FAABB> CachedBounds;
+		TArray<uint32> CachedVersions;
+
+		FLazyBoundsCache(FTransformHierarchy& InHierarchy, const TArray<int32>& InTransformHandles, const TArray<FAABB>& InLocalBounds)
+			: Hierarchy(InHierarchy), TransformHandles(InTransformHandles), LocalBounds(InLocalBounds),
+			CachedBounds(InLocalBounds.size()), CachedVersions(InLocalBounds.size(), ~0u)
+		{
+		}
+
+		const FAABB& GetWorldAABB(int32 InIndex)
+		{
+			const FMatrix& World = Hierarchy.GetWorldTransform(TransformHandles[InIndex]);
+			const uint32 Version = Hierarchy.GetWorldVersion(TransformHandles[InIndex]);
+			if (CachedVersions[InIndex] != Version)
+			{
+				LegacyTransformAABB(World, LocalBounds[InIndex], CachedBounds[InIndex]);
+				CachedVersions[InIndex] = Version;
+			}
+			return CachedBounds[InIndex];
+		}
+	};
+
+	// 이전 FName 이름 표: 소문자 복사본을 만들어 공유 잠금 아래 전역 맵에서 찾고, 없으면 배타 잠금으로 등록
+	struct FLegacyNameTable
+	{
+		std::shared_mutex Mutex;
+		TMap<FString, uint32> NameMap = { { "none", 0 } };
+		TDeque<FString> DisplayNames = { "None" };
+
+		int32 FindOrAdd(const FString& InString)
+		{
+			FString LowerString = InString;
+			std::transform(LowerString.begin(), LowerString.end(), LowerString.begin(),
+				[](unsigned char InChar) { return std::tolower(InChar); });
+			{
+				std::shared_lock<std::shared_mutex> ReadLock(Mutex);
+				const auto FindResult = NameMap.find(LowerString);
+				if (FindResult != NameMap.end())
+				{
+					return static_cast<int32>(FindResult->second);
+				}
+			}
+
+			std::unique_lock<std::shared_mutex> WriteLock(Mutex);
+			const auto InsertResult = NameMap.insert({ LowerString, static_cast<uint32>(DisplayNames.size()) });
+			if (InsertResult.second)
+			{
+				DisplayNames.push_back(InString);
+			}
+			return static_cast<int32>(InsertResult.first->second);
+		}
+	};
+
+	// 에셋 경로/오브젝트 이름과 비슷한 이름 (대소문자 섞음)
+	FString MakeBenchmarkName(const char* InPrefix, int32 InIndex)
+	{
+		static const char* const Folders[] = { "Data/Props/", "Data/Characters/", "Engine/Placeholder/", "Object_" };
+		return FString(Folders[InIndex & 3]) + InPrefix + "_" + std::to_string(InIndex);
+	}
+
+	FString FlipCase(FString InString, uint32 InMask)
+	{
+		for (size_t i = 0; i < InString.size(); ++i)
+		{
+			if ((InMask >> (i & 31)) & 1)
+			{
+				const unsigned char Char = static_cast<unsigned char>(InString[i]);
+				InString[i] = static_cast<char>(std::isupper(Char) ? std::tolower(Char) : std::toupper(Char));
+			}
+		}
+		return InString;
+	}
+}
+
+bool FEngineBenchmark::Run(const FString& InName)
+{
+	if (InName == "scenebvh")
+	{
+		RunSceneBVHBuild();
+		return true;
+	}
+	if (InName == "scenebvhinsert")
+	{
+		RunSceneBVHInsertRemove();
+		return true;
+	}
+	if (InName == "bvhrays")
+	{
+		RunBVHRayThroughput();
+		return true;
+	}
+	if (InName == "bvhpackets")
+	{
+		RunBVHRayPackets();
+		return true;
+	}
+	if (InName == "octree")
+	{
+		RunOctreeUpdate();
+		return true;
+	}
+	if (InName == "octreequery")
+	{
+		RunOctreeQuery();
+		return true;
+	}
+	if (InName == "culling")
+	{
+		RunSceneCulling();
+		return true;
+	}
+	if (InName == "occlusion")
+	{
+		RunSoftwareOcclusion();
+		return true;
+	}
+	if (InName == "objparse")
+	{
+		RunObjParse();
+		return true;
+	}
+	if (InName == "simplify")
+	{
+		RunMeshSimplify();
+		return true;
+	}
+	if (InName == "lodchain")
+	{
+		RunLODChain();
+		return true;
+	}
+	if (InName == "meshload")
+	{
+		RunMeshLoad();
+		return true;
+	}
+	if (InName == "objbin")
+	{
+		RunObjBinRoundTrip();
+		return true;
+	}
+	if (InName == "meshopt")
+	{
+		RunMeshOptimize();
+		return true;
+	}
+	if (InName == "vertexpack")
+	{
+		RunVertexPack();
+		return true;
+	}
+	if (InName == "transforms")
+	{
+		RunTransformHierarchy();
+		return true;
+	}
+	if (InName == "math")
+	{
+		RunMathKernels();
+		return true;
+	}
+	if (InName == "bounds")
+	{
+		RunPrimitiveBounds();
+		return true;
+	}
+	if (InName == "names")
+	{
+		RunNameTable();
+		return true;
+	}
+	if (InName == "objects")
+	{
+		RunObjectIteration();
+		return true;
+	}
+	return false;
+}
+
+void FEngineBenchmark::PrintUsage()
+{
+	UE_LOG_INFO("Benchmark: Available: scenebvh, scenebvhinsert, bvhrays, bvhpackets, octree, octreequery, culling, occlusion, objparse, simplify, lodchain, meshload, objbin, meshopt, vertexpack, transforms, math, bounds, names, objects");
+}
+
+void FEngineBenchmark::RunSceneBVHBuild()
+{
+	const int64 PrimCounts[] = { 10'000, 100'000, 1'000'000 };
+
+	// 1, 2, 4, 8, ... 하드웨어 스레드 수까지
+	TArray<uint32> ThreadCounts;
+	const uint32 MaxThreads = std::max(1u, std::thread::hardware_concurrency());
+	for (uint32 Threads = 1; Threads < MaxThreads; Threads *= 2)
+	{
+		ThreadCounts.push_back(Threads);
+	}
+	ThreadCounts.push_back(MaxThreads);
+
+	UE_LOG_SYSTEM("Benchmark: SceneBVH Build (hardware threads: %u)", MaxThreads);
+	for (const int64 Count : PrimCounts)
+	{
+		const TArray<FAABB> Bounds = MakeSyntheticAABBs(Count, 1000.0f);
+		const int32 Repeat = Count >= 1'000'000 ? 1 : 3;
+
+		FSceneBVH BVH;
+		const double SerialMs = MeasureBestMilliseconds(Repeat, [&]() { BVH.BuildFromBounds(Bounds, EBVHBuildMode::Serial); });
+		const float SerialSAH = BVH.ComputeSAHCost();
+		UE_LOG_INFO("  %7lld prims | serial     | %9.2f ms | SAH %.4f", Count, SerialMs, SerialSAH);
+
+		for (const uint32 Threads : ThreadCounts)
+		{
+			// 호출 스레드도 작업에 참여하므로 워커는 Threads - 1개
+			FTaskScheduler Scheduler(Threads - 1);
+			const double ParallelMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					BVH.BuildFromBounds(Bounds, EBVHBuildMode::Parallel, &Scheduler);
+				});
+			const float ParallelSAH = BVH.ComputeSAHCost();
+			// 노드 순서만 다르므로 합산 순서 차이 이상의 오차가 나면 분할 결정이 달라진 것
+			const bool bSameQuality = std::fabs(ParallelSAH - SerialSAH) <= 1e-4f * std::max(1.0f, SerialSAH);
+			UE_LOG_INFO("  %7lld prims | %2u threads | %9.2f ms | SAH %.4f | x%.2f%s", Count, Threads, ParallelMs, ParallelSAH,
+				SerialMs / std::max(ParallelMs, 1e-6), bSameQuality ? "" : " (SAH mismatch)");
+		}
+	}
+}
+
+void FEngineBenchmark::RunSceneBVHInsertRemove()
+{
+	constexpr int64 SceneCount = 100'000;
+	constexpr int32 OpCount = 100;
+
+	const TArray<FAABB> Bounds = MakeSyntheticAABBs(SceneCount + OpCount, 1000.0f);
+	const TArray<FAABB> SceneBounds(Bounds.begin(), Bounds.begin() + SceneCount);
+
+	FSceneBVH BVH;
+	const double BuildMs = MeasureBestMilliseconds(1, [&]() { BVH.BuildFromBounds(SceneBounds); });
+
+	// 액터 100개 스폰: 하나씩 삽입
+	TArray<int64> Inserted;
+	Inserted.reserve(OpCount);
+	const uint64 InsertStart = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < OpCount; ++i)
+	{
+		Inserted.push_back(BVH.Insert(nullptr, Bounds[SceneCount + i]));
+	}
+	const double InsertMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - InsertStart);
+	const float SAHAfterInsert = BVH.GetSAHDegradation();
+
+	const uint64 RemoveStart = FPlatformTime::Cycles64();
+	for (const int64 PrimIdx : Inserted)
+	{
+		BVH.RemoveByIndex(PrimIdx);
+	}
+	const double RemoveMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RemoveStart);
+
+	UE_LOG_SYSTEM("Benchmark: SceneBVH Insert/Remove (%lld prims, %d ops)", SceneCount, OpCount);
+	UE_LOG_INFO("  full build   | %9.2f ms", BuildMs);
+	UE_LOG_INFO("  insert       | %9.2f us/op | SAH x%.3f", InsertMs * 1000.0 / OpCount, SAHAfterInsert);
+	UE_LOG_INFO("  remove       | %9.2f us/op | SAH x%.3f", RemoveMs * 1000.0 / OpCount, BVH.GetSAHDegradation());
+	UE_LOG_INFO("  %d rebuilds would cost %.2f ms vs %.3f ms incremental", OpCount, BuildMs * OpCount, InsertMs);
+}
+
+void FEngineBenchmark::RunBVHRayThroughput()
+{
+	constexpr float WorldExtent = 1000.0f;
+	constexpr int64 RayCount = 200'000;
+	const EBVHLayout Layouts[] = { EBVHLayout::Binary, EBVHLayout::Wide4, EBVHLayout::Wide8 };
+	const TArray<FRay> Rays = MakeSyntheticRays(RayCount, WorldExtent);
+
+	UE_LOG_SYSTEM("Benchmark: BVH ray throughput (%lld rays, AVX2: %s)", RayCount, FPlatformSIMD::HasAVX2() ? "yes" : "no");
+
+	// 1) 씬 BVH: 프리미티브 AABB 자체를 히트 표면으로 취급해 최근접 AABB를 찾는다
+	{
+		const TArray<FAABB> Bounds = MakeSyntheticAABBs(100'000, WorldExtent);
+		FSceneBVH BVH;
+		BVH.BuildFromBounds(Bounds);
+
+		auto AcceptBox = [](UPrimitiveComponent*, int64, float PTMin, float& InOutHitDist)
+			{
+				InOutHitDist = PTMin;
+				return true;
+			};
+
+		double BinaryChecksum = 0.0;
+		for (const EBVHLayout Layout : Layouts)
+		{
+			BVH.SetTraversalLayout(Layout);
+			double Checksum = 0.0;
+			const double Ms = MeasureBestMilliseconds(3, [&]()
+				{
+					Checksum = 0.0;
+					for (const FRay& Ray : Rays)
+					{
+						float BestDist = std::numeric_limits<float>::infinity();
+						UPrimitiveComponent* Hit = nullptr;
+						BVH.TraverseFrontToBackFirstHit(Ray, BestDist, Hit, AcceptBox);
+						if (BestDist < std::numeric_limits<float>::infinity()) Checksum += BestDist;
+					}
+				});
+			if (Layout == EBVHLayout::Binary) BinaryChecksum = Checksum;
+
+			const bool bSame = std::fabs(Checksum - BinaryChecksum) <= 1e-6 * std::max(1.0, std::fabs(BinaryChecksum));
+			UE_LOG_INFO("  scene 100k AABB | %s | %8.3f Mrays/s%s", GetLayoutName(Layout), RayCount / (Ms * 1000.0),
+				bSame ? "" : " (hit mismatch)");
+		}
+	}
+
+	// 2) 메시 BVH: 임의 삼각형 수프에 대한 최근접 삼각형 (Moller-Trumbore)
+	{
+		std::mt19937 Rng(BenchmarkSeed);
+		std::uniform_real_distribution<float> PosDist(0.0f, WorldExtent);
+		std::uniform_real_distribution<float> EdgeDist(-8.0f, 8.0f);
+
+		constexpr int32 TriangleCount = 200'000;
+		TArray<FNormalVertex> Vertices(TriangleCount * 3);
+		TArray<uint32> Indices(TriangleCount * 3);
+		for (int32 t = 0; t < TriangleCount; ++t)
+		{
+			const FVector Center(PosDist(Rng), PosDist(Rng), PosDist(Rng));
+			for (int32 v = 0; v < 3; ++v)
+			{
+				Vertices[t * 3 + v].Position = Center + FVector(EdgeDist(Rng), EdgeDist(Rng), EdgeDist(Rng));
+				Indices[t * 3 + v] = t * 3 + v;
+			}
+		}
+
+		FStaticMeshBVH MeshBVH;
+		MeshBVH.Build(Vertices, &Indices);
+
+		double BinaryChecksum = 0.0;
+		for (const EBVHLayout Layout : Layouts)
+		{
+			MeshBVH.SetTraversalLayout(Layout);
+			double Checksum = 0.0;
+			const double Ms = MeasureBestMilliseconds(3, [&]()
+				{
+					Checksum = 0.0;
+					for (const FRay& Ray : Rays)
+					{
+						const float Best = IntersectClosestTriangle(MeshBVH, Ray);
+						if (Best < std::numeric_limits<float>::infinity()) Checksum += Best;
+					}
+				});
+			if (Layout == EBVHLayout::Binary) BinaryChecksum = Checksum;
+
+			const bool bSame = std::fabs(Checksum - BinaryChecksum) <= 1e-6 * std::max(1.0, std::fabs(BinaryChecksum));
+			UE_LOG_INFO("  mesh  200k tri  | %s | %8.3f Mrays/s%s", GetLayoutName(Layout), RayCount / (Ms * 1000.0),
+				bSame ? "" : " (hit mismatch)");
+		}
+	}
+}
+
+void FEngineBenchmark::RunBVHRayPackets()
+{
+	constexpr float WorldExtent = 1000.0f;
+	constexpr int32 ScreenSize = 256;
+
+	UE_LOG_SYSTEM("Benchmark: BVH ray packets vs single-ray loop");
+
+	// 1) 씬 BVH: 임의 방향 레이(비일관)와 카메라 레이(일관) 각각
+	{
+		const TArray<FAABB> Bounds = MakeSyntheticAABBs(100'000, WorldExtent);
+		FSceneBVH BVH;
+		BVH.BuildFromBounds(Bounds);
+
+		auto AcceptBox = [](UPrimitiveComponent*, int64, float PTMin, float& InOutHitDist)
+			{
+				InOutHitDist = PTMin;
+				return true;
+			};
+		auto AcceptBoxBatch = [](UPrimitiveComponent*, int64, int32, float PTMin, float& InOutHitDist)
+			{
+				InOutHitDist = PTMin;
+				return true;
+			};
+
+		const TArray<FRay> RaySets[] = {
+			MakeSyntheticRays(ScreenSize * ScreenSize, WorldExtent),
+			MakeCameraRays(FAABB(FVector(0.0f, 0.0f, 0.0f), FVector(WorldExtent, WorldExtent, WorldExtent)), ScreenSize) };
+		const char* RaySetNames[] = { "random", "camera" };
+
+		for (int32 Set = 0; Set < 2; ++Set)
+		{
+			const TArray<FRay>& Rays = RaySets[Set];
+			const int32 NumRays = static_cast<int32>(Rays.size());
+			TArray<float> BestDist(NumRays);
+			TArray<UPrimitiveComponent*> Hits(NumRays);
+
+			auto SumHits = [&]()
+				{
+					double Sum = 0.0;
+					for (const float Dist : BestDist)
+					{
+						if (Dist < std::numeric_limits<float>::infinity()) Sum += Dist;
+					}
+					return Sum;
+				};
+
+			const double SingleMs = MeasureBestMilliseconds(3, [&]()
+				{
+					for (int32 i = 0; i < NumRays; ++i)
+					{
+						BestDist[i] = std::numeric_limits<float>::infinity();
+						BVH.TraverseFrontToBackFirstHit(Rays[i], BestDist[i], Hits[i], AcceptBox);
+					}
+				});
+			const double Reference = SumHits();
+			UE_LOG_INFO("  scene 100k AABB %s | single   | %8.3f Mrays/s", RaySetNames[Set], NumRays / (SingleMs * 1000.0));
+
+			auto RunPackets = [&](auto InPacketSize)
+				{
+					constexpr int32 PacketSize = decltype(InPacketSize)::value;
+					const double Ms = MeasureBestMilliseconds(3, [&]()
+						{
+							std::fill(BestDist.begin(), BestDist.end(), std::numeric_limits<float>::infinity());
+							BVH.TraverseRaysFirstHit<PacketSize>(Rays.data(), NumRays, BestDist.data(), Hits.data(), AcceptBoxBatch);
+						});
+					UE_LOG_INFO("  scene 100k AABB %s | packet%2d | %8.3f Mrays/s | x%.2f%s", RaySetNames[Set], PacketSize,
+						NumRays / (Ms * 1000.0), SingleMs / std::max(Ms, 1e-6), IsSameChecksum(SumHits(), Reference) ? "" : " (hit mismatch)");
+				};
+			RunPackets(std::integral_constant<int32, 4>{});
+			RunPackets(std::integral_constant<int32, 8>{});
+			RunPackets(std::integral_constant<int32, 16>{});
+		}
+	}
+
+	// 2) Data/ 메시: 에디터가 시작 시 로드하는 것과 같은 원본 .obj (LOD 제외)
+	FObjImporter::Configuration Config;
+	Config.bFlipWindingOrder = false;
+	Config.bIsBinaryEnabled = true;
+	Config.bUVToUEBasis = true;
+	Config.bPositionToUEBasis = true;
+
+	const FString DataDirectory = "Data/";
+	if (!std::filesystem::is_directory(DataDirectory))
+	{
+		UE_LOG_WARNING("Benchmark: %s 디렉토리가 없어 메시 패킷 측정을 건너뜁니다", DataDirectory.c_str());
+		return;
+	}
+
+	TSet<FString> MeshNames;
+	for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+	{
+		if (!Entry.is_regular_file() || Entry.path().extension() != ".obj") continue;
+
+		const FString PathString = Entry.path().generic_string();
+		// LOD 파일과 같은 메시의 사본(다른 폴더)은 한 번만 측정
+		if (PathString.find("_lod_") != FString::npos) continue;
+		if (!MeshNames.insert(Entry.path().filename().generic_string()).second) continue;
+
+		const TUniquePtr<FStaticMesh> Mesh(FObjManager::LoadObjStaticMeshAsset(FName(PathString), Config));
+		if (!Mesh || Mesh->Indices.size() < 3) continue;
+
+		FStaticMeshBVH MeshBVH;
+		MeshBVH.Build(Mesh->Vertices, &Mesh->Indices);
+
+		FAABB MeshBounds(Mesh->Vertices[0].Position, Mesh->Vertices[0].Position);
+		for (const FNormalVertex& Vertex : Mesh->Vertices)
+		{
+			MeshBounds.Min.X = std::min(MeshBounds.Min.X, Vertex.Position.X); MeshBounds.Max.X = std::max(MeshBounds.Max.X, Vertex.Position.X);
+			MeshBounds.Min.Y = std::min(MeshBounds.Min.Y, Vertex.Position.Y); MeshBounds.Max.Y = std::max(MeshBounds.Max.Y, Vertex.Position.Y);
+			MeshBounds.Min.Z = std::min(MeshBounds.Min.Z, Vertex.Position.Z); MeshBounds.Max.Z = std::max(MeshBounds.Max.Z, Vertex.Position.Z);
+		}
+
+		const TArray<FRay> Rays = MakeCameraRays(MeshBounds, ScreenSize);
+		const int32 NumRays = static_cast<int32>(Rays.size());
+		const int64 NumTris = static_cast<int64>(Mesh->Indices.size() / 3);
+
+		double Reference = 0.0;
+		const double SingleMs = MeasureBestMilliseconds(3, [&]()
+			{
+				Reference = 0.0;
+				for (const FRay& Ray : Rays)
+				{
+					const float Best = IntersectClosestTriangle(MeshBVH, Ray);
+					if (Best < std::numeric_limits<float>::infinity()) Reference += Best;
+				}
+			});
+		UE_LOG_INFO("  %-24s %7lld tri | single   | %8.3f Mrays/s", Entry.path().filename().generic_string().c_str(), NumTris,
+			NumRays / (SingleMs * 1000.0));
+
+		TArray<FMeshRayHit> MeshHits(NumRays);
+		auto RunPackets = [&](auto InPacketSize)
+			{
+				constexpr int32 PacketSize = decltype(InPacketSize)::value;
+				const double Ms = MeasureBestMilliseconds(3, [&]()
+					{
+						MeshBVH.IntersectRays<PacketSize>(Rays.data(), NumRays, MeshHits.data());
+					});
+
+				double Checksum = 0.0;
+				for (const FMeshRayHit& Hit : MeshHits)
+				{
+					if (Hit.TriIndex >= 0) Checksum += Hit.T;
+				}
+				UE_LOG_INFO("  %-24s %7lld tri | packet%2d | %8.3f Mrays/s | x%.2f%s", "", NumTris, PacketSize,
+					NumRays / (Ms * 1000.0), SingleMs / std::max(Ms, 1e-6), IsSameChecksum(Checksum, Reference) ? "" : " (hit mismatch)");
+			};
+		RunPackets(std::integral_constant<int32, 4>{});
+		RunPackets(std::integral_constant<int32, 8>{});
+		RunPackets(std::integral_constant<int32, 16>{});
+	}
+}
+
+void FEngineBenchmark::RunOctreeUpdate()
+{
+	constexpr int64 ObjectCount = 100'000;
+	constexpr int32 FrameCount = 30;
+	constexpr float WorldExtent = 1000.0f;
+	constexpr float MaxSpeed = 0.5f;  // 프레임당 이동 거리 (오브젝트 크기 0.5~8 대비 작은 이동)
+
+	const FAABB OctreeBounds(FVector(-10.0f, -10.0f, -10.0f), FVector(WorldExtent + 10.0f, WorldExtent + 10.0f, WorldExtent + 10.0f));
+
+	TArray<TUniquePtr<UPrimitiveComponent>> Components;
+	Components.reserve(ObjectCount);
+	for (int64 i = 0; i < ObjectCount; ++i)
+	{
+		Components.emplace_back(std::make_unique<UPrimitiveComponent>());
+	}
+
+	const TArray<FAABB> InitialBounds = MakeSyntheticAABBs(ObjectCount, WorldExtent);
+	TArray<FVector> Velocities;
+	Velocities.reserve(ObjectCount);
+	std::mt19937 Rng(BenchmarkSeed ^ 0x0C7EE000u);
+	std::uniform_real_distribution<float> VelDist(-MaxSpeed, MaxSpeed);
+	for (int64 i = 0; i < ObjectCount; ++i)
+	{
+		Velocities.emplace_back(VelDist(Rng), VelDist(Rng), VelDist(Rng));
+	}
+
+	// 모든 프레임의 바운드를 미리 계산 (월드 경계에서 반사) - 측정 구간에는 트리 연산만 포함
+	TArray<TArray<FAABB>> FrameBounds(FrameCount);
+	{
+		TArray<FAABB> Current = InitialBounds;
+		TArray<FVector> Velocity = Velocities;
+		for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+		{
+			for (int64 i = 0; i < ObjectCount; ++i)
+			{
+				FVector Delta = Velocity[i];
+				const FVector Center = (Current[i].Min + Current[i].Max) * 0.5f + Delta;
+				if (Center.X < 0.0f || Center.X > WorldExtent) { Velocity[i].X = -Velocity[i].X; Delta.X = 0.0f; }
+				if (Center.Y < 0.0f || Center.Y > WorldExtent) { Velocity[i].Y = -Velocity[i].Y; Delta.Y = 0.0f; }
+				if (Center.Z < 0.0f || Center.Z > WorldExtent) { Velocity[i].Z = -Velocity[i].Z; Delta.Z = 0.0f; }
+				Current[i] = FAABB(Current[i].Min + Delta, Current[i].Max + Delta);
+			}
+			FrameBounds[Frame] = Current;
+		}
+	}
+
+	FOctree Octree;
+	auto InsertAll = [&]()
+		{
+			Octree.Initialize(OctreeBounds);
+			for (int64 i = 0; i < ObjectCount; ++i)
+			{
+				Octree.Insert(Components[i].get(), InitialBounds[i]);
+			}
+		};
+
+	const double InsertMs = MeasureBestMilliseconds(1, InsertAll);
+	const uint32 NodeCount = Octree.GetNodeCount();
+
+	// 1) Update: loose 범위 안이면 바운드만 갱신, 벗어나면 가까운 조상부터 재삽입
+	const uint64 UpdateStart = FPlatformTime::Cycles64();
+	for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+	{
+		const TArray<FAABB>& Bounds = FrameBounds[Frame];
+		for (int64 i = 0; i < ObjectCount; ++i)
+		{
+			Octree.Update(Components[i].get(), Bounds[i]);
+		}
+	}
+	const double UpdateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - UpdateStart) / FrameCount;
+	const uint32 UpdateCount = Octree.GetObjectCount();
+
+	// 2) 매 프레임 제거 후 루트부터 재삽입
+	InsertAll();
+	const uint64 ReinsertStart = FPlatformTime::Cycles64();
+	for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+	{
+		const TArray<FAABB>& Bounds = FrameBounds[Frame];
+		for (int64 i = 0; i < ObjectCount; ++i)
+		{
+			Octree.Remove(Components[i].get());
+			Octree.Insert(Components[i].get(), Bounds[i]);
+		}
+	}
+	const double ReinsertMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ReinsertStart) / FrameCount;
+	const uint32 ReinsertCount = Octree.GetObjectCount();
+
+	// 3) 매 프레임 트리 재구축
+	const double RebuildMs = MeasureBestMilliseconds(3, [&]()
+		{
+			Octree.Initialize(OctreeBounds);
+			const TArray<FAABB>& Bounds = FrameBounds[FrameCount - 1];
+			for (int64 i = 0; i < ObjectCount; ++i)
+			{
+				Octree.Insert(Components[i].get(), Bounds[i]);
+			}
+		});
+
+	// 컴포넌트 삭제 전에 트리를 비운다
+	Octree.Clear();
+
+	UE_LOG_SYSTEM("Benchmark: Octree Update (%lld objects moving, %d frames)", ObjectCount, FrameCount);
+	UE_LOG_INFO("  initial insert   | %9.2f ms | %u nodes", InsertMs, NodeCount);
+	UE_LOG_INFO("  update           | %9.2f ms/frame | %u objects", UpdateMs, UpdateCount);
+	UE_LOG_INFO("  remove + insert  | %9.2f ms/frame | %u objects", ReinsertMs, ReinsertCount);
+	UE_LOG_INFO("  rebuild          | %9.2f ms/frame", RebuildMs);
+	UE_LOG_INFO("  update speedup   | x%.2f vs remove + insert, x%.2f vs rebuild",
+		ReinsertMs / std::max(UpdateMs, 1e-6), RebuildMs / std::max(UpdateMs, 1e-6));
+}
+
+void FEngineBenchmark::RunOctreeQuery()
+{
+	constexpr int64 ObjectCount = 100'000;
+	constexpr int32 BuildRepeat = 5;
+	constexpr int32 QueryRepeat = 20;
+	constexpr float WorldExtent = 1000.0f;
+
+	const FAABB OctreeBounds(FVector(-10.0f, -10.0f, -10.0f), FVector(WorldExtent + 10.0f, WorldExtent + 10.0f, WorldExtent + 10.0f));
+	const TArray<FAABB> Bounds = MakeSyntheticAABBs(ObjectCount, WorldExtent);
+
+	TArray<TUniquePtr<UPrimitiveComponent>> Components;
+	Components.reserve(ObjectCount);
+	for (int64 i = 0; i < ObjectCount; ++i)
+	{
+		Components.emplace_back(std::make_unique<UPrimitiveComponent>());
+	}
+
+	// 첫 빌드는 워밍업. 이후 Initialize+삽입 / Clear를 따로 측정
+	FOctree Octree;
+	double BuildMs = std::numeric_limits<double>::max();
+	double ClearMs = std::numeric_limits<double>::max();
+	for (int32 Repeat = 0; Repeat <= BuildRepeat; ++Repeat)
+	{
+		const uint64 BuildStart = FPlatformTime::Cycles64();
+		Octree.Initialize(OctreeBounds);
+		for (int64 i = 0; i < ObjectCount; ++i)
+		{
+			Octree.Insert(Components[i].get(), Bounds[i]);
+		}
+		const uint64 ClearStart = FPlatformTime::Cycles64();
+		if (Repeat == BuildRepeat) break;  // 마지막 빌드는 질의용으로 남긴다
+
+		Octree.Clear();
+		const uint64 ClearEnd = FPlatformTime::Cycles64();
+		if (Repeat > 0)
+		{
+			BuildMs = std::min(BuildMs, FPlatformTime::ToMilliseconds(ClearStart - BuildStart));
+			ClearMs = std::min(ClearMs, FPlatformTime::ToMilliseconds(ClearEnd - ClearStart));
+		}
+	}
+
+	// 월드 가장자리 밖에서 안쪽을 보는 카메라 (가시 비율이 다른 세 구간)
+	const FFrustum Frustums[] =
+	{
+		MakeBoxFrustum(FVector(-50.0f, 500.0f, 500.0f), 1.0f, 200.0f),
+		MakeBoxFrustum(FVector(-50.0f, 500.0f, 500.0f), 1.0f, 600.0f),
+		MakeBoxFrustum(FVector(-500.0f, 500.0f, 500.0f), 1.0f, 2000.0f),
+	};
+
+	UE_LOG_SYSTEM("Benchmark: Octree Query (%lld objects, %u nodes)", ObjectCount, Octree.GetNodeCount());
+	UE_LOG_INFO("  initialize + insert | %9.3f ms", BuildMs);
+	UE_LOG_INFO("  clear               | %9.3f ms", ClearMs);
+	for (const FFrustum& Frustum : Frustums)
+	{
+		size_t Visible = 0;
+		const double QueryMs = MeasureBestMilliseconds(QueryRepeat, [&]() { Visible = Octree.QueryFrustum(Frustum).size(); });
+		UE_LOG_INFO("  query frustum       | %9.3f ms | %zu visible", QueryMs, Visible);
+	}
+
+	// 컴포넌트 삭제 전에 트리를 비운다
+	Octree.Clear();
+}
+
+void FEngineBenchmark::RunSceneCulling()
+{
+	constexpr int64 StaticCount = 100'000;
+	constexpr int64 DynamicCount = 10'000;
+	constexpr int32 Repeat = 20;
+	constexpr float WorldExtent = 1000.0f;
+
+	const FAABB OctreeBounds(FVector(-10.0f, -10.0f, -10.0f), FVector(WorldExtent + 10.0f, WorldExtent + 10.0f, WorldExtent + 10.0f));
+	const TArray<FAABB> Bounds = MakeSyntheticAABBs(StaticCount + DynamicCount, WorldExtent);
+
+	TArray<TUniquePtr<UPrimitiveComponent>> Components;
+	Components.reserve(StaticCount + DynamicCount);
+	for (int64 i = 0; i < StaticCount + DynamicCount; ++i)
+	{
+		Components.emplace_back(std::make_unique<UPrimitiveComponent>());
+	}
+
+	FOctree Octree(OctreeBounds);
+	for (int64 i = 0; i < StaticCount; ++i)
+	{
+		Octree.Insert(Components[i].get(), Bounds[i]);
+	}
+
+	// 동적 프리미티브는 GetWorldAABB 대신 합성 바운드로 스냅샷을 채운다
+	TArray<UPrimitiveComponent*> DynamicPrimitives;
+	FDynamicPrimitiveSet Dynamics;
+	for (int64 i = StaticCount; i < StaticCount + DynamicCount; ++i)
+	{
+		DynamicPrimitives.push_back(Components[i].get());
+		Dynamics.Add(Components[i].get(), Bounds[i]);
+	}
+
+	// 쿼드 뷰포트처럼 서로 다른 위치의 카메라 4개
+	const FFrustum Frustums[] =
+	{
+		MakeBoxFrustum(FVector(-50.0f, 500.0f, 500.0f), 1.0f, 600.0f),
+		MakeBoxFrustum(FVector(-500.0f, 500.0f, 500.0f), 1.0f, 2000.0f),
+		MakeBoxFrustum(FVector(-50.0f, 250.0f, 250.0f), 1.0f, 1000.0f),
+		MakeBoxFrustum(FVector(-200.0f, 750.0f, 750.0f), 1.0f, 800.0f),
+	};
+	constexpr int32 NumViews = 4;
+
+	// 기존 방식: 메인 스레드에서 옥트리 질의 + 동적 프리미티브 순회, 제출 직전 IsVisible 확인 (정렬 없음)
+	TArray<UPrimitiveComponent*> SerialResults[NumViews];
+	size_t SerialVisible = 0;
+	const double SerialMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			SerialVisible = 0;
+			for (int32 View = 0; View < NumViews; ++View)
+			{
+				SerialResults[View].clear();
+				Octree.QueryFrustum(Frustums[View], SerialResults[View]);
+				for (int64 i = 0; i < DynamicCount; ++i)
+				{
+					if (DynamicPrimitives[i]->IsVisible() && Frustums[View].IsBoxInFrustum(Bounds[StaticCount + i]))
+					{
+						SerialResults[View].push_back(DynamicPrimitives[i]);
+					}
+				}
+				for (UPrimitiveComponent* Primitive : SerialResults[View])
+				{
+					SerialVisible += Primitive->IsVisible() ? 1 : 0;
+				}
+			}
+		});
+
+	FVisibleList Lists[NumViews];
+	TArray<FViewCullRequest> Requests;
+	for (int32 View = 0; View < NumViews; ++View)
+	{
+		Requests.push_back({ Frustums[View], &Octree, &Dynamics, &Lists[View] });
+	}
+
+	FTaskScheduler SingleThread(0);
+	const double SingleMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (const FViewCullRequest& Request : Requests) FSceneCuller::CullView(Request, &SingleThread);
+		});
+	const double PerViewMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (const FViewCullRequest& Request : Requests) FSceneCuller::CullView(Request);
+		});
+	const double ConcurrentMs = MeasureBestMilliseconds(Repeat, [&]() { FSceneCuller::CullViews(Requests); });
+
+	// 정렬 순서만 다르고 같은 집합이어야 한다
+	bool bSameResults = true;
+	size_t TotalVisible = 0;
+	for (int32 View = 0; View < NumViews; ++View)
+	{
+		TArray<UPrimitiveComponent*> Culled;
+		for (const FVisiblePrimitive& Visible : Lists[View].Primitives)
+		{
+			Culled.push_back(Visible.Primitive);
+		}
+		std::sort(Culled.begin(), Culled.end());
+		std::sort(SerialResults[View].begin(), SerialResults[View].end());
+		bSameResults &= Culled == SerialResults[View];
+		bSameResults &= std::is_sorted(Lists[View].Primitives.begin(), Lists[View].Primitives.end());
+		TotalVisible += Culled.size();
+	}
+
+	UE_LOG_SYSTEM("Benchmark: Scene Culling (%lld static + %lld dynamic, %d views, %zu visible, %u threads)",
+		StaticCount, DynamicCount, NumViews, TotalVisible, FTaskScheduler::Get().GetConcurrency());
+	UE_LOG_INFO("  serial query (unsorted)   | %9.3f ms", SerialMs);
+	bSameResults &= SerialVisible == TotalVisible;
+	UE_LOG_INFO("  cull view, 1 thread       | %9.3f ms", SingleMs);
+	UE_LOG_INFO("  cull view, parallel       | %9.3f ms | x%.2f", PerViewMs, SerialMs / std::max(PerViewMs, 1e-6));
+	UE_LOG_INFO("  cull views, concurrent    | %9.3f ms | x%.2f%s", ConcurrentMs, SerialMs / std::max(ConcurrentMs, 1e-6),
+		bSameResults ? "" : " (result mismatch)");
+
+	// 컴포넌트 삭제 전에 트리를 비운다
+	Octree.Clear();
+}
+
+void FEngineBenchmark::RunSoftwareOcclusion()
+{
+	constexpr int64 OccludeeCount = 100'000;
+	constexpr int32 WallCount = 16;
+	constexpr int32 Repeat = 20;
+	constexpr float WorldExtent = 1000.0f;
+	constexpr uint32 BufferWidth = 480;
+	constexpr uint32 BufferHeight = 272;
+
+	const FVector Eye(-50.0f, 500.0f, 500.0f);
+	const FMatrix ViewProjection = MakeLookForwardViewProjection(Eye, static_cast<float>(BufferWidth) / BufferHeight, 0.1f, 3000.0f);
+	FFrustum Frustum;
+	Frustum.ConstructFromViewProjectionMatrix(ViewProjection);
+
+	// 오클루더: 단위 큐브 메시(12 삼각형)를 늘려 만든 벽, 카메라 앞쪽 구간에 흩어 놓는다
+	FNormalVertex CubeVertices[8] = {};
+	for (int32 i = 0; i < 8; ++i)
+	{
+		CubeVertices[i].Position = FVector((i & 1) ? 1.0f : 0.0f, (i & 2) ? 1.0f : 0.0f, (i & 4) ? 1.0f : 0.0f);
+	}
+	const uint32 CubeIndices[36] =
+	{
+		0, 1, 3, 0, 3, 2,  4, 6, 7, 4, 7, 5,  0, 4, 5, 0, 5, 1,
+		2, 3, 7, 2, 7, 6,  0, 2, 6, 0, 6, 4,  1, 5, 7, 1, 7, 3
+	};
+
+	std::mt19937 Rng(BenchmarkSeed);
+	std::uniform_real_distribution<float> WallX(50.0f, 400.0f);
+	std::uniform_real_distribution<float> WallPos(0.0f, WorldExtent - 300.0f);
+	std::uniform_real_distribution<float> WallSize(100.0f, 300.0f);
+	TArray<FMatrix> WallTransforms;
+	for (int32 i = 0; i < WallCount; ++i)
+	{
+		FMatrix Transform = FMatrix::Identity();
+		Transform.Data[0][0] = 10.0f;
+		Transform.Data[1][1] = WallSize(Rng);
+		Transform.Data[2][2] = WallSize(Rng);
+		Transform.Data[3][0] = WallX(Rng);
+		Transform.Data[3][1] = WallPos(Rng);
+		Transform.Data[3][2] = WallPos(Rng);
+		WallTransforms.push_back(Transform);
+	}
+
+	// 오클루디: 프러스텀을 통과한 합성 AABB만 검사
+	TArray<FAABB> Occludees;
+	for (const FAABB& Bounds : MakeSyntheticAABBs(OccludeeCount, WorldExtent))
+	{
+		if (Frustum.IsBoxInFrustum(Bounds))
+		{
+			Occludees.push_back(Bounds);
+		}
+	}
+
+	FSoftwareOcclusionBuffer Buffer;
+	Buffer.Initialize(BufferWidth, BufferHeight);
+	const auto BuildBuffer = [&](FTaskScheduler* InScheduler)
+		{
+			Buffer.BeginFrame(ViewProjection);
+			for (const FMatrix& Transform : WallTransforms)
+			{
+				Buffer.AddOccluder(Transform, CubeVertices, 8, CubeIndices, 36);
+			}
+			Buffer.Rasterize(InScheduler);
+		};
+
+	FTaskScheduler SingleThread(0);
+	const double RasterSingleMs = MeasureBestMilliseconds(Repeat, [&]() { BuildBuffer(&SingleThread); });
+	const double RasterParallelMs = MeasureBestMilliseconds(Repeat, [&]() { BuildBuffer(&FTaskScheduler::Get()); });
+
+	TArray<uint8> Occluded(Occludees.size());
+	const double TestSerialMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (size_t i = 0; i < Occludees.size(); ++i)
+			{
+				Occluded[i] = Buffer.IsBoxOccluded(Occludees[i]) ? 1 : 0;
+			}
+		});
+	const double TestParallelMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			FTaskScheduler::Get().ParallelFor(static_cast<int64>(Occludees.size()), 256, [&](int64 Begin, int64 End)
+				{
+					for (int64 i = Begin; i < End; ++i)
+					{
+						Occluded[i] = Buffer.IsBoxOccluded(Occludees[i]) ? 1 : 0;
+					}
+				});
+		});
+
+	size_t NumOccluded = 0;
+	for (uint8 Flag : Occluded)
+	{
+		NumOccluded += Flag;
+	}
+
+	UE_LOG_SYSTEM("Benchmark: Software Occlusion (%ux%u, %d occluders / %u triangles, %zu occludees in frustum, %u threads, %s)",
+		Buffer.GetWidth(), Buffer.GetHeight(), WallCount, Buffer.GetNumTriangles(), Occludees.size(),
+		FTaskScheduler::Get().GetConcurrency(), FPlatformSIMD::HasAVX2() ? "AVX2" : "SSE");
+	UE_LOG_INFO("  rasterize + pyramid, 1 thread | %9.3f ms", RasterSingleMs);
+	UE_LOG_INFO("  rasterize + pyramid, parallel | %9.3f ms", RasterParallelMs);
+	UE_LOG_INFO("  occlusion test, serial        | %9.3f ms", TestSerialMs);
+	UE_LOG_INFO("  occlusion test, parallel      | %9.3f ms | %zu occluded (%.1f%%)", TestParallelMs, NumOccluded,
+		Occludees.empty() ? 0.0 : 100.0 * NumOccluded / Occludees.size());
+}
+
+void FEngineBenchmark::RunObjParse()
+{
+	constexpr int32 GridSize = 400;
+	constexpr int32 Repeat = 5;
+
+	// 합성 OBJ: GridSize x GridSize 정점 격자(v/vt/vn)와 "f v/vt/vn" 사각형 면
+	const std::filesystem::path FilePath = std::filesystem::temp_directory_path() / "GTL_ObjParseBenchmark.obj";
+	{
+		std::ofstream File(FilePath, std::ios::binary);
+		char Line[128];
+		File << "o Grid\n";
+		for (int32 Y = 0; Y < GridSize; ++Y)
+		{
+			for (int32 X = 0; X < GridSize; ++X)
+			{
+				const float U = static_cast<float>(X) / (GridSize - 1);
+				const float V = static_cast<float>(Y) / (GridSize - 1);
+				snprintf(Line, sizeof(Line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn 0.000000 0.000000 1.000000\n",
+					U * 100.0f, V * 100.0f, std::sin(U * 10.0f) * std::cos(V * 10.0f), U, V);
+				File << Line;
+			}
+		}
+		for (int32 Y = 0; Y + 1 < GridSize; ++Y)
+		{
+			for (int32 X = 0; X + 1 < GridSize; ++X)
+			{
+				const int32 I0 = Y * GridSize + X + 1;
+				const int32 I1 = I0 + 1;
+				const int32 I2 = I1 + GridSize;
+				const int32 I3 = I0 + GridSize;
+				snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", I0, I0, I0, I1, I1, I1, I2, I2, I2, I3, I3, I3);
+				File << Line;
+			}
+		}
+	}
+	const double FileMB = static_cast<double>(std::filesystem::file_size(FilePath)) / (1024.0 * 1024.0);
+
+	FObjImporter::Configuration Config;
+	Config.bIsBinaryEnabled = false;
+	Config.bPositionToUEBasis = true;
+	Config.bUVToUEBasis = true;
+
+	FObjInfo StreamInfo;
+	FObjInfo MappedInfo;
+	FObjInfo ParallelInfo;
+	bool bLoaded = true;
+
+	Config.bUseMappedTokenizer = false;
+	const double StreamMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			StreamInfo = FObjInfo();
+			bLoaded &= FObjImporter::LoadObj(FilePath, &StreamInfo, Config);
+		});
+
+	Config.bUseMappedTokenizer = true;
+	Config.bIsParallelEnabled = false;
+	const double MappedMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			MappedInfo = FObjInfo();
+			bLoaded &= FObjImporter::LoadObj(FilePath, &MappedInfo, Config);
+		});
+
+	Config.bIsParallelEnabled = true;
+	const double ParallelMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			ParallelInfo = FObjInfo();
+			bLoaded &= FObjImporter::LoadObj(FilePath, &ParallelInfo, Config);
+		});
+
+	std::error_code ErrorCode;
+	std::filesystem::remove(FilePath, ErrorCode);
+
+	// 세 경로의 결과가 비트 단위로 같은지 확인
+	const auto IsSameBytes = [](const auto& A, const auto& B)
+		{
+			return A.size() == B.size() && (A.empty() || memcmp(A.data(), B.data(), A.size() * sizeof(A[0])) == 0);
+		};
+	const auto IsSameObjInfo = [&IsSameBytes](const FObjInfo& A, const FObjInfo& B)
+		{
+			if (!IsSameBytes(A.VertexList, B.VertexList) || !IsSameBytes(A.NormalList, B.NormalList) ||
+				!IsSameBytes(A.TexCoordList, B.TexCoordList) || A.ObjectInfoList.size() != B.ObjectInfoList.size())
+			{
+				return false;
+			}
+			for (size_t i = 0; i < A.ObjectInfoList.size(); ++i)
+			{
+				const FObjectInfo& ObjectA = A.ObjectInfoList[i];
+				const FObjectInfo& ObjectB = B.ObjectInfoList[i];
+				if (ObjectA.Name != ObjectB.Name || ObjectA.VertexIndexList != ObjectB.VertexIndexList ||
+					ObjectA.NormalIndexList != ObjectB.NormalIndexList || ObjectA.TexCoordIndexList != ObjectB.TexCoordIndexList ||
+					ObjectA.GroupNameList != ObjectB.GroupNameList || ObjectA.GroupIndexList != ObjectB.GroupIndexList ||
+					ObjectA.MaterialNameList != ObjectB.MaterialNameList || ObjectA.MaterialIndexList != ObjectB.MaterialIndexList)
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+	const bool bIdentical = bLoaded && IsSameObjInfo(StreamInfo, MappedInfo) && IsSameObjInfo(StreamInfo, ParallelInfo);
+
+	UE_LOG_SYSTEM("Benchmark: OBJ Parse (%.1f MB, %zu vertices, %zu triangles, %u threads)", FileMB, MappedInfo.VertexList.size(),
+		MappedInfo.ObjectInfoList.empty() ? 0 : MappedInfo.ObjectInfoList[0].VertexIndexList.size() / 3, FTaskScheduler::Get().GetConcurrency());
+	UE_LOG_INFO("  getline + istringstream | %9.3f ms | %8.1f MB/s", StreamMs, FileMB * 1000.0 / StreamMs);
+	UE_LOG_INFO("  mapped tokenizer        | %9.3f ms | %8.1f MB/s | x%.2f", MappedMs, FileMB * 1000.0 / MappedMs, StreamMs / MappedMs);
+	UE_LOG_INFO("  mapped, parallel chunks | %9.3f ms | %8.1f MB/s | x%.2f", ParallelMs, FileMB * 1000.0 / ParallelMs, StreamMs / ParallelMs);
+	UE_LOG_INFO("  results identical       | %s", bIdentical ? "yes" : "NO");
+}
+
+void FEngineBenchmark::RunMeshSimplify()
+{
+	const float Ratios[] = { 0.5f, 0.25f };
+
+	UE_LOG_SYSTEM("Benchmark: Mesh Simplify (QEM, Hausdorff = max(A->B, B->A) / bounding diagonal)");
+
+	auto MeasureMesh = [&](const FString& InName, const FStaticMesh& InMesh)
+		{
+			if (InMesh.Indices.size() < 3) return;
+
+			FAABB Bounds(InMesh.Vertices[0].Position, InMesh.Vertices[0].Position);
+			for (const FNormalVertex& Vertex : InMesh.Vertices)
+			{
+				Bounds.Min.X = std::min(Bounds.Min.X, Vertex.Position.X); Bounds.Max.X = std::max(Bounds.Max.X, Vertex.Position.X);
+				Bounds.Min.Y = std::min(Bounds.Min.Y, Vertex.Position.Y); Bounds.Max.Y = std::max(Bounds.Max.Y, Vertex.Position.Y);
+				Bounds.Min.Z = std::min(Bounds.Min.Z, Vertex.Position.Z); Bounds.Max.Z = std::max(Bounds.Max.Z, Vertex.Position.Z);
+			}
+			const float Diagonal = std::max((Bounds.Max - Bounds.Min).Length(), 1e-6f);
+			const int64 NumTris = static_cast<int64>(InMesh.Indices.size() / 3);
+
+			for (const float Ratio : Ratios)
+			{
+				TUniquePtr<FStaticMesh> Simplified;
+				const double Ms = MeasureBestMilliseconds(NumTris > 100'000 ? 1 : 3, [&]()
+					{
+						Simplified.reset(UMeshSimplifier::Simplify(&InMesh, Ratio));
+					});
+				if (!Simplified) continue;
+
+				const float Hausdorff = std::max(ComputeOneSidedHausdorff(InMesh, *Simplified, Bounds),
+					ComputeOneSidedHausdorff(*Simplified, InMesh, Bounds));
+				UE_LOG_INFO("  %-24s %7lld tri | x%.2f | %9.3f ms | %7.3f Mtri/s | %7zu tri out | sections %zu -> %zu | Hausdorff %.4f%%",
+					InName.c_str(), NumTris, Ratio, Ms, NumTris / (Ms * 1000.0), Simplified->Indices.size() / 3, InMesh.Sections.size(),
+					Simplified->Sections.size(), Hausdorff / Diagonal * 100.0f);
+			}
+		};
+
+	// 1) 합성 닫힌 메시 (약 50만 삼각형)
+	{
+		const TUniquePtr<FStaticMesh> Torus(MakeBumpyTorusMesh(700, 360));
+		MeasureMesh("synthetic torus", *Torus);
+	}
+
+	// 2) Data/ 메시: 에디터가 시작 시 LOD를 만드는 원본 .obj
+	if (!ForEachDataMesh(MeasureMesh))
+	{
+		UE_LOG_WARNING("Benchmark: Data/ 디렉토리가 없어 메시 단순화 측정을 건너뜁니다");
+	}
+}
+
+void FEngineBenchmark::RunLODChain()
+{
+	const TArray<float> TwoRatios = { 0.5f, 0.25f };
+	const TArray<float> FourRatios = { 0.5f, 0.25f, 0.125f, 0.0625f };
+
+	UE_LOG_SYSTEM("Benchmark: LOD Chain (separate Simplify per LOD vs one SimplifyChain run, progressive mesh for continuous LOD)");
+
+	auto MeasureMesh = [&](const FString& InName, const FStaticMesh& InMesh)
+		{
+			const int64 NumTris = static_cast<int64>(InMesh.Indices.size() / 3);
+			const int32 Repeat = NumTris > 100'000 ? 1 : 3;
+			const auto DeleteAll = [](TArray<FStaticMesh*>& InMeshes)
+				{
+					for (FStaticMesh*& Mesh : InMeshes) SafeDelete(Mesh);
+				};
+
+			const double SeparateMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					TArray<FStaticMesh*> LODs;
+					for (const float Ratio : TwoRatios) LODs.push_back(UMeshSimplifier::Simplify(&InMesh, Ratio));
+					DeleteAll(LODs);
+				});
+			const double ChainMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					TArray<FStaticMesh*> LODs = UMeshSimplifier::SimplifyChain(&InMesh, TwoRatios);
+					DeleteAll(LODs);
+				});
+			const double Chain4Ms = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					TArray<FStaticMesh*> LODs = UMeshSimplifier::SimplifyChain(&InMesh, FourRatios);
+					DeleteAll(LODs);
+				});
+
+			TUniquePtr<FProgressiveMesh> Progressive;
+			const double ProgressiveMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					Progressive.reset(UMeshSimplifier::BuildProgressiveMesh(&InMesh));
+				});
+			if (!Progressive) return;
+
+			// 연속 LOD: 최대~최소 삼각형 수 사이 64개 예산으로 인덱스 버퍼를 만들 때의 출력 처리량
+			constexpr int32 NumBudgets = 64;
+			TArray<uint32> StreamIndices;
+			uint64 NumStreamedTris = 0;
+			const double StreamMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					NumStreamedTris = 0;
+					for (int32 Step = 0; Step < NumBudgets; ++Step)
+					{
+						const uint32 Budget = Progressive->GetMaxTriangleCount() -
+							static_cast<uint32>((static_cast<uint64>(Progressive->GetMaxTriangleCount()) * Step) / NumBudgets);
+						NumStreamedTris += Progressive->BuildIndices(Budget, StreamIndices);
+					}
+				});
+
+			UE_LOG_INFO("  %-24s %7lld tri | 2 LODs separate %8.2f ms | chain %8.2f ms (x%.2f) | 4 LODs chain %8.2f ms",
+				InName.c_str(), NumTris, SeparateMs, ChainMs, SeparateMs / std::max(ChainMs, 1e-6), Chain4Ms);
+			UE_LOG_INFO("  %-24s %7s     | progressive %8.2f ms (min %u tri) | index stream %7.1f Mtri/s", "", "",
+				ProgressiveMs, Progressive->GetMinTriangleCount(), NumStreamedTris / (StreamMs * 1000.0));
+		};
+
+	{
+		const TUniquePtr<FStaticMesh> Torus(MakeBumpyTorusMesh(350, 180));
+		MeasureMesh("synthetic torus", *Torus);
+	}
+
+	if (!ForEachDataMesh(MeasureMesh))
+	{
+		UE_LOG_WARNING("Benchmark: Data/ 디렉토리가 없어 메시 LOD 체인 측정을 건너뜁니다");
+	}
+}
+
+void FEngineBenchmark::RunMeshLoad()
+{
+	const TArray<float> LODRatios = { 0.5f, 0.25f };
+	const std::filesystem::path TempDirectory = std::filesystem::temp_directory_path();
+
+	UE_LOG_SYSTEM("Benchmark: Mesh Load (text OBJ / legacy .objbin + LOD .objbin + .bvhbin / cooked .meshbin)");
+
+	auto MeasureFile = [&](const FString& InName, const std::filesystem::path& InObjPath)
+		{
+			FObjImporter::Configuration Config;
+			Config.bFlipWindingOrder = false;
+			Config.bUVToUEBasis = true;
+			Config.bPositionToUEBasis = true;
+			Config.bIsBinaryEnabled = false;
+			FObjImporter::Configuration BinaryConfig = Config;
+			BinaryConfig.bIsBinaryEnabled = true;
+
+			const FName ObjPath(InObjPath.generic_string());
+			const TUniquePtr<FStaticMesh> BaseMesh(FObjManager::LoadObjStaticMeshAsset(ObjPath, Config));
+			if (!BaseMesh || BaseMesh->Indices.size() < 3) return;
+
+			// 준비: 엔진이 시작 시 만드는 것과 같은 LOD/BVH를 만들고 이전 형식 캐시와 컨테이너를 임시 디렉토리에 쓴다
+			FPackedVertexStream::Quantize(BaseMesh->Vertices);
+			TArray<FStaticMesh*> LODs = UMeshSimplifier::SimplifyChain(BaseMesh.get(), LODRatios);
+			for (FStaticMesh* LODMesh : LODs)
+			{
+				if (LODMesh) FPackedVertexStream::Quantize(LODMesh->Vertices);
+			}
+			FStaticMeshBVH BVH;
+			BVH.Build(BaseMesh->Vertices, &BaseMesh->Indices);
+
+			const FString Stem = "GTL_MeshLoad_" + InObjPath.stem().string();
+			TArray<std::filesystem::path> LegacyLODPaths;
+			TArray<const FStaticMesh*> CookedLODs = { BaseMesh.get() };
+			for (size_t Index = 0; Index < LODs.size(); ++Index)
+			{
+				if (!LODs[Index]) break;
+				LegacyLODPaths.push_back(TempDirectory / (Stem + "_lod_" + std::to_string(Index) + ".objbin"));
+				StaticMeshSerializer::SaveFStaticMeshToBin(LODs[Index], LegacyLODPaths.back());
+				CookedLODs.push_back(LODs[Index]);
+			}
+
+			const int64 SourceTime = FCookedMeshFile::GetSourceTime(InObjPath);
+			const uint64 SourceHash = FStaticMeshBVH::ComputeSourceHash(BaseMesh->Vertices, &BaseMesh->Indices);
+			const std::filesystem::path LegacyBVHPath = TempDirectory / (Stem + ".bvhbin");
+			const std::filesystem::path CookedPath = TempDirectory / (Stem + ".meshbin");
+			BVH.SaveToFile(LegacyBVHPath, SourceHash, SourceTime, 0.0f);
+			const bool bSaved = FCookedMeshFile::Save(CookedPath, CookedLODs, &BVH, InObjPath, true);
+
+			// 원본 .objbin은 임포터가 .obj 옆에 만든다 (엔진 시작 시와 같은 위치)
+			delete FObjManager::LoadObjStaticMeshAsset(ObjPath, BinaryConfig);
+
+			const int64 NumTris = static_cast<int64>(BaseMesh->Indices.size() / 3);
+			const int32 Repeat = NumTris > 100'000 ? 3 : 10;
+
+			const double TextMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					delete FObjManager::LoadObjStaticMeshAsset(ObjPath, Config);
+				});
+
+			const double LegacyMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					delete FObjManager::LoadObjStaticMeshAsset(ObjPath, BinaryConfig);
+					for (const std::filesystem::path& LODPath : LegacyLODPaths)
+					{
+						delete StaticMeshSerializer::LoadFStaticMeshFromBin(LODPath);
+					}
+					FStaticMeshBVH LoadedBVH;
+					LoadedBVH.LoadFromFile(LegacyBVHPath, SourceHash, SourceTime);
+				});
+
+			// 엔진 경로: 매핑 후 LOD마다 FStaticMesh로 복사하고 BVH 복원
+			bool bIdentical = bSaved;
+			const double CookedMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					FCookedMeshFile CookedFile;
+					bIdentical &= CookedFile.Open(CookedPath, InObjPath) && CookedFile.GetNumLODs() == static_cast<int32>(CookedLODs.size());
+					for (int32 LODIndex = 0; LODIndex < CookedFile.GetNumLODs(); ++LODIndex)
+					{
+						delete CookedFile.CreateStaticMesh(LODIndex);
+					}
+					FStaticMeshBVH LoadedBVH;
+					bIdentical &= CookedFile.LoadBVH(LoadedBVH);
+				});
+
+			// 복사 없이 매핑된 블롭을 그대로 쓰는 경우 (GPU 업로드가 포인터를 바로 받을 수 있을 때)
+			const double ViewMs = MeasureBestMilliseconds(Repeat, [&]()
+				{
+					FCookedMeshFile CookedFile;
+					CookedFile.Open(CookedPath, InObjPath);
+					FStaticMeshBVH LoadedBVH;
+					CookedFile.LoadBVH(LoadedBVH);
+				});
+
+			// 컨테이너에서 읽은 데이터가 쓴 것(양자화된 정점)과 바이트 단위로 같은지 확인
+			FCookedMeshFile CookedFile;
+			if (CookedFile.Open(CookedPath))
+			{
+				for (int32 LODIndex = 0; LODIndex < CookedFile.GetNumLODs() && bIdentical; ++LODIndex)
+				{
+					const FStaticMesh& Source = *CookedLODs[LODIndex];
+					const TUniquePtr<FStaticMesh> Loaded(CookedFile.CreateStaticMesh(LODIndex));
+					bIdentical = CookedFile.GetNumVertices(LODIndex) == Source.Vertices.size() &&
+						CookedFile.GetNumIndices(LODIndex) == Source.Indices.size() &&
+						CookedFile.GetNumSections(LODIndex) == Source.Sections.size() &&
+						memcmp(Loaded->Vertices.data(), Source.Vertices.data(), Source.Vertices.size() * sizeof(FNormalVertex)) == 0 &&
+						memcmp(CookedFile.GetIndices(LODIndex), Source.Indices.data(), Source.Indices.size() * sizeof(uint32)) == 0 &&
+						memcmp(CookedFile.GetSections(LODIndex), Source.Sections.data(), Source.Sections.size() * sizeof(FMeshSection)) == 0;
+				}
+				CookedFile.Close();
+			}
+			else
+			{
+				bIdentical = false;
+			}
+
+			std::error_code ErrorCode;
+			std::filesystem::path ObjBinPath = InObjPath;
+			ObjBinPath.replace_extension(".objbin");
+			uint64 LegacyBytes = std::filesystem::file_size(ObjBinPath, ErrorCode) + std::filesystem::file_size(LegacyBVHPath, ErrorCode);
+			for (const std::filesystem::path& LODPath : LegacyLODPaths)
+			{
+				LegacyBytes += std::filesystem::file_size(LODPath, ErrorCode);
+				std::filesystem::remove(LODPath, ErrorCode);
+			}
+			const uint64 CookedBytes = std::filesystem::file_size(CookedPath, ErrorCode);
+			std::filesystem::remove(LegacyBVHPath, ErrorCode);
+			std::filesystem::remove(CookedPath, ErrorCode);
+			for (FStaticMesh*& LODMesh : LODs) SafeDelete(LODMesh);
+
+			UE_LOG_INFO("  %-24s %7lld tri | text %8.2f ms (no LOD/BVH) | legacy bins %7.2f ms (%.1f MB) | cooked %7.2f ms (x%.1f, %.1f MB) | mapped views %6.3f ms | identical %s",
+				InName.c_str(), NumTris, TextMs, LegacyMs, LegacyBytes / (1024.0 * 1024.0), CookedMs, LegacyMs / std::max(CookedMs, 1e-6),
+				CookedBytes / (1024.0 * 1024.0), ViewMs, bIdentical ? "yes" : "NO");
+		};
+
+	// 1) 합성 토러스를 임시 .obj로 내보내 Data/ 없이도 측정
+	{
+		const TUniquePtr<FStaticMesh> Torus(MakeBumpyTorusMesh(350, 180));
+		const std::filesystem::path TorusPath = TempDirectory / "GTL_MeshLoadBenchmark.obj";
+		UObjExporter::ExportMesh(Torus.get(), TorusPath.string(), "GTL_MeshLoadBenchmark.mtl");
+		MeasureFile("synthetic torus", TorusPath);
+
+		std::error_code ErrorCode;
+		std::filesystem::path TorusBinPath = TorusPath;
+		std::filesystem::remove(TorusPath, ErrorCode);
+		std::filesystem::remove(TorusBinPath.replace_extension(".objbin"), ErrorCode);
+	}
+
+	// 2) Data/ 메시
+	const FString DataDirectory = "Data/";
+	if (!std::filesystem::is_directory(DataDirectory))
+	{
+		UE_LOG_WARNING("Benchmark: Data/ 디렉토리가 없어 메시 로드 측정을 건너뜁니다");
+		return;
+	}
+
+	TSet<FString> MeshNames;
+	for (const auto& Entry : std::filesystem::recursive_directory_iterator(DataDirectory))
+	{
+		if (!Entry.is_regular_file() || Entry.path().extension() != ".obj") continue;
+		if (Entry.path().generic_string().find("_lod_") != FString::npos) continue;
+		if (!MeshNames.insert(Entry.path().filename().generic_string()).second) continue;
+
+		MeasureFile(Entry.path().filename().generic_string(), Entry.path());
+	}
+}
+
+void FEngineBenchmark::RunObjBinRoundTrip()
+{
+	constexpr int32 GridSize = 1000;
+	constexpr int32 Repeat = 3;
+
+	// 합성 FObjInfo: GridSize x GridSize 정점 격자(v/vn/vt)와 삼각형 면 인덱스 (FObjImporter가 채우는 형태)
+	FObjInfo Source;
+	Source.VertexList.reserve(static_cast<size_t>(GridSize) * GridSize);
+	for (int32 Y = 0; Y < GridSize; ++Y)
+	{
+		for (int32 X = 0; X < GridSize; ++X)
+		{
+			const float U = static_cast<float>(X) / (GridSize - 1);
+			const float V = static_cast<float>(Y) / (GridSize - 1);
+			Source.VertexList.emplace_back(U * 100.0f, V * 100.0f, std::sin(U * 10.0f) * std::cos(V * 10.0f));
+			Source.NormalList.emplace_back(0.0f, 0.0f, 1.0f);
+			Source.TexCoordList.emplace_back(U, V);
+		}
+	}
+
+	FObjectInfo& ObjectInfo = Source.ObjectInfoList.emplace_back();
+	ObjectInfo.Name = "Grid";
+	for (int32 Y = 0; Y + 1 < GridSize; ++Y)
+	{
+		for (int32 X = 0; X + 1 < GridSize; ++X)
+		{
+			const size_t I0 = static_cast<size_t>(Y) * GridSize + X;
+			const size_t I1 = I0 + 1;
+			const size_t I2 = I1 + GridSize;
+			const size_t I3 = I0 + GridSize;
+			for (const size_t Index : { I0, I1, I2, I0, I2, I3 })
+			{
+				ObjectInfo.VertexIndexList.push_back(Index);
+				ObjectInfo.NormalIndexList.push_back(Index);
+				ObjectInfo.TexCoordIndexList.push_back(Index);
+			}
+		}
+	}
+	ObjectInfo.MaterialNameList.push_back("GridMaterial");
+	ObjectInfo.MaterialIndexList.push_back(0);
+	FObjectMaterialInfo& Material = Source.ObjectMaterialInfoList.emplace_back();
+	Material.Name = "GridMaterial";
+	Material.KdMap = "Grid.png";
+
+	const std::filesystem::path PerElementPath = std::filesystem::temp_directory_path() / "GTL_ObjBinBenchmark_PerElement.objbin";
+	const std::filesystem::path BulkPath = std::filesystem::temp_directory_path() / "GTL_ObjBinBenchmark_Bulk.objbin";
+
+	// 쓰기: 원소별 + ofstream / 일괄 + 버퍼
+	const double PerElementWriteMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			FWindowsBinWriter Writer(PerElementPath);
+			SerializeObjInfoPerElement(Writer, Source);
+		});
+	const double BulkWriteMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			FBufferedBinWriter Writer(BulkPath);
+			Writer << Source;
+			Writer.Flush();
+		});
+
+	std::error_code ErrorCode;
+	const double FileMB = static_cast<double>(std::filesystem::file_size(BulkPath, ErrorCode)) / (1024.0 * 1024.0);
+
+	// 읽기: 원소별 + ifstream (이전 경로) / 일괄 + ifstream / 일괄 + 버퍼 / 일괄 + 메모리 매핑
+	FObjInfo PerElementInfo;
+	FObjInfo StreamInfo;
+	FObjInfo BufferedInfo;
+	FObjInfo MappedInfo;
+	bool bNoError = true;
+
+	const double PerElementReadMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			PerElementInfo = FObjInfo();
+			FWindowsBinReader Reader(BulkPath);
+			SerializeObjInfoPerElement(Reader, PerElementInfo);
+			bNoError &= !Reader.IsError();
+		});
+	const double StreamReadMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			StreamInfo = FObjInfo();
+			FWindowsBinReader Reader(BulkPath);
+			Reader << StreamInfo;
+			bNoError &= !Reader.IsError();
+		});
+	const double BufferedReadMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			BufferedInfo = FObjInfo();
+			FBufferedBinReader Reader(BulkPath);
+			Reader << BufferedInfo;
+			bNoError &= !Reader.IsError();
+		});
+	const double MappedReadMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			MappedInfo = FObjInfo();
+			FMappedBinReader Reader(BulkPath);
+			Reader << MappedInfo;
+			bNoError &= !Reader.IsError();
+		});
+
+	// 두 방식으로 쓴 파일이 같고 모든 경로가 원본을 그대로 복원하는지 확인
+	bool bSameFile = false;
+	{
+		FMappedFile PerElementFile;
+		FMappedFile BulkFile;
+		if (PerElementFile.Open(PerElementPath) && BulkFile.Open(BulkPath))
+		{
+			bSameFile = PerElementFile.GetSize() == BulkFile.GetSize() &&
+				memcmp(PerElementFile.GetData(), BulkFile.GetData(), BulkFile.GetSize()) == 0;
+		}
+	}
+	const auto IsSameObjInfo = [](const FObjInfo& A, const FObjInfo& B)
+		{
+			const auto IsSameBytes = [](const auto& InA, const auto& InB)
+				{
+					return InA.size() == InB.size() && (InA.empty() || memcmp(InA.data(), InB.data(), InA.size() * sizeof(InA[0])) == 0);
+				};
+			return A.ObjectInfoList.size() == B.ObjectInfoList.size() && A.ObjectMaterialInfoList.size() == B.ObjectMaterialInfoList.size() &&
+				IsSameBytes(A.VertexList, B.VertexList) && IsSameBytes(A.NormalList, B.NormalList) && IsSameBytes(A.TexCoordList, B.TexCoordList) &&
+				A.ObjectInfoList[0].VertexIndexList == B.ObjectInfoList[0].VertexIndexList &&
+				A.ObjectInfoList[0].NormalIndexList == B.ObjectInfoList[0].NormalIndexList &&
+				A.ObjectInfoList[0].TexCoordIndexList == B.ObjectInfoList[0].TexCoordIndexList &&
+				A.ObjectInfoList[0].MaterialNameList == B.ObjectInfoList[0].MaterialNameList &&
+				A.ObjectMaterialInfoList[0].KdMap == B.ObjectMaterialInfoList[0].KdMap;
+		};
+	const bool bIdentical = bNoError && bSameFile && IsSameObjInfo(Source, PerElementInfo) && IsSameObjInfo(Source, StreamInfo) &&
+		IsSameObjInfo(Source, BufferedInfo) && IsSameObjInfo(Source, MappedInfo);
+
+	// 잘린 파일은 할당 없이 오류로 끝나야 한다
+	bool bTruncatedRejected = false;
+	{
+		std::filesystem::resize_file(BulkPath, std::filesystem::file_size(BulkPath, ErrorCode) / 2, ErrorCode);
+		FObjInfo TruncatedInfo;
+		FMappedBinReader Reader(BulkPath);
+		Reader << TruncatedInfo;
+		bTruncatedRejected = !ErrorCode && Reader.IsError();
+	}
+
+	std::filesystem::remove(PerElementPath, ErrorCode);
+	std::filesystem::remove(BulkPath, ErrorCode);
+
+	UE_LOG_SYSTEM("Benchmark: .objbin Round Trip (%.1f MB, %zu vertices, %zu triangles)", FileMB, Source.VertexList.size(),
+		ObjectInfo.VertexIndexList.size() / 3);
+	UE_LOG_INFO("  write per element, ofstream  | %9.2f ms | %8.1f MB/s", PerElementWriteMs, FileMB * 1000.0 / PerElementWriteMs);
+	UE_LOG_INFO("  write bulk, buffered         | %9.2f ms | %8.1f MB/s | x%.1f", BulkWriteMs, FileMB * 1000.0 / BulkWriteMs,
+		PerElementWriteMs / BulkWriteMs);
+	UE_LOG_INFO("  read per element, ifstream   | %9.2f ms | %8.1f MB/s", PerElementReadMs, FileMB * 1000.0 / PerElementReadMs);
+	UE_LOG_INFO("  read bulk, ifstream          | %9.2f ms | %8.1f MB/s | x%.1f", StreamReadMs, FileMB * 1000.0 / StreamReadMs,
+		PerElementReadMs / StreamReadMs);
+	UE_LOG_INFO("  read bulk, buffered          | %9.2f ms | %8.1f MB/s | x%.1f", BufferedReadMs, FileMB * 1000.0 / BufferedReadMs,
+		PerElementReadMs / BufferedReadMs);
+	UE_LOG_INFO("  read bulk, memory mapped     | %9.2f ms | %8.1f MB/s | x%.1f", MappedReadMs, FileMB * 1000.0 / MappedReadMs,
+		PerElementReadMs / MappedReadMs);
+	UE_LOG_INFO("  same file format / identical | %s / %s | truncated file rejected %s", bSameFile ? "yes" : "NO",
+		bIdentical ? "yes" : "NO", bTruncatedRejected ? "yes" : "NO");
+}
+
+void FEngineBenchmark::RunMeshOptimize()
+{
+	UE_LOG_SYSTEM("Benchmark: Mesh Optimize (FIFO cache %u, ACMR / ATVR / overfetch per stage)", FMeshOptimizer::DefaultCacheSize);
+
+	auto MeasureMesh = [&](const FString& InName, const FStaticMesh& InMesh)
+		{
+			const uint32 NumVertices = static_cast<uint32>(InMesh.Vertices.size());
+			const FVertexCacheStatistics Before = FMeshOptimizer::AnalyzeVertexCache(InMesh.Indices, NumVertices, sizeof(FNormalVertex));
+
+			// 단계별: 캐시 순서만 / + 오버드로 정렬 / + 정점 페치 (= OptimizeStaticMesh)
+			FStaticMesh CacheOnly = InMesh;
+			const double CacheMs = MeasureBestMilliseconds(1, [&]()
+				{
+					for (const FMeshSection& Section : CacheOnly.Sections)
+					{
+						FMeshOptimizer::OptimizeVertexCache(CacheOnly.Indices, NumVertices, Section.StartIndex, Section.IndexCount);
+					}
+				});
+			const FVertexCacheStatistics AfterCache = FMeshOptimizer::AnalyzeVertexCache(CacheOnly.Indices, NumVertices, sizeof(FNormalVertex));
+
+			FStaticMesh Optimized = InMesh;
+			FVertexCacheStatistics AfterAll;
+			const double TotalMs = MeasureBestMilliseconds(1, [&]()
+				{
+					FMeshOptimizer::OptimizeStaticMesh(Optimized, FMeshOptimizer::DefaultOverdrawThreshold, nullptr, &AfterAll);
+				});
+
+			UE_LOG_INFO("  %-24s %7zu tri | ACMR %.3f -> %.3f -> %.3f | ATVR %.3f -> %.3f -> %.3f | overfetch %.2f -> %.2f | cache %7.2f ms, all %7.2f ms",
+				InName.c_str(), InMesh.Indices.size() / 3, Before.ACMR, AfterCache.ACMR, AfterAll.ACMR, Before.ATVR, AfterCache.ATVR, AfterAll.ATVR,
+				Before.Overfetch, AfterAll.Overfetch, CacheMs, TotalMs);
+		};
+
+	// 1) 합성 토러스: 생성 순서(격자 순서라 이미 지역적) / 삼각형과 정점을 섞은 것 (최악에 가까운 입력)
+	{
+		const TUniquePtr<FStaticMesh> Torus(MakeBumpyTorusMesh(350, 180));
+		MeasureMesh("synthetic torus", *Torus);
+
+		std::mt19937 Random(7);
+		TArray<uint32> TriangleOrder(Torus->Indices.size() / 3);
+		for (uint32 Index = 0; Index < TriangleOrder.size(); ++Index) TriangleOrder[Index] = Index;
+		std::shuffle(TriangleOrder.begin(), TriangleOrder.end(), Random);
+		TArray<uint32> VertexOrder(Torus->Vertices.size());
+		for (uint32 Index = 0; Index < VertexOrder.size(); ++Index) VertexOrder[Index] = Index;
+		std::shuffle(VertexOrder.begin(), VertexOrder.end(), Random);
+
+		FStaticMesh Shuffled = *Torus;
+		for (size_t Index = 0; Index < VertexOrder.size(); ++Index)
+		{
+			Shuffled.Vertices[VertexOrder[Index]] = Torus->Vertices[Index];
+		}
+		for (size_t Triangle = 0; Triangle < TriangleOrder.size(); ++Triangle)
+		{
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				Shuffled.Indices[Triangle * 3 + Corner] = VertexOrder[Torus->Indices[TriangleOrder[Triangle] * 3 + Corner]];
+			}
+		}
+		MeasureMesh("synthetic torus shuffled", Shuffled);
+
+		// 단순화 결과 (LOD로 캐시되는 메시)
+		const TUniquePtr<FStaticMesh> Simplified(UMeshSimplifier::Simplify(Torus.get(), 0.25f));
+		if (Simplified)
+		{
+			MeasureMesh("synthetic torus LOD x0.25", *Simplified);
+		}
+	}
+
+	// 2) Data/ 메시 (임포트 직후의 첫 등장 순서)
+	if (!ForEachDataMesh(MeasureMesh))
+	{
+		UE_LOG_WARNING("Benchmark: Data/ 디렉토리가 없어 메시 최적화 측정을 건너뜁니다");
+	}
+}
+
+void FEngineBenchmark::RunVertexPack()
+{
+	UE_LOG_SYSTEM("Benchmark: Vertex Pack (FNormalVertex %zu B -> FPackedNormalVertex %zu B + RGBA8 when colored)",
+		sizeof(FNormalVertex), sizeof(FPackedNormalVertex));
+
+	uint64 TotalFloatBytes = 0;
+	uint64 TotalPackedBytes = 0;
+
+	auto MeasureMesh = [&](const FString& InName, const FStaticMesh& InMesh)
+		{
+			const TArray<FNormalVertex>& Source = InMesh.Vertices;
+			const int32 Repeat = Source.size() > 500'000 ? 3 : 10;
+
+			FPackedVertexStream Stream;
+			const double PackMs = MeasureBestMilliseconds(Repeat, [&]() { Stream.Pack(Source); });
+			TArray<FNormalVertex> Unpacked;
+			const double UnpackMs = MeasureBestMilliseconds(Repeat, [&]() { Stream.Unpack(Unpacked); });
+
+			// 오차: 위치는 AABB 대각선 대비, 노멀은 각도, UV는 절댓값
+			FVector Min = Source[0].Position;
+			FVector Max = Source[0].Position;
+			for (const FNormalVertex& Vertex : Source)
+			{
+				Min.X = std::min(Min.X, Vertex.Position.X); Max.X = std::max(Max.X, Vertex.Position.X);
+				Min.Y = std::min(Min.Y, Vertex.Position.Y); Max.Y = std::max(Max.Y, Vertex.Position.Y);
+				Min.Z = std::min(Min.Z, Vertex.Position.Z); Max.Z = std::max(Max.Z, Vertex.Position.Z);
+			}
+			const float Diagonal = std::max((Max - Min).Length(), 1e-6f);
+
+			float MaxPositionError = 0.0f;
+			float MinNormalDot = 1.0f;
+			float MaxUVError = 0.0f;
+			for (size_t Index = 0; Index < Source.size(); ++Index)
+			{
+				const FNormalVertex& Original = Source[Index];
+				const FNormalVertex& Restored = Unpacked[Index];
+				MaxPositionError = std::max(MaxPositionError, (Original.Position - Restored.Position).Length());
+				MaxUVError = std::max({ MaxUVError, std::abs(Original.TexCoord.X - Restored.TexCoord.X),
+					std::abs(Original.TexCoord.Y - Restored.TexCoord.Y) });
+
+				const float NormalLength = Original.Normal.Length();
+				if (NormalLength > 1e-6f)
+				{
+					MinNormalDot = std::min(MinNormalDot, Original.Normal.Dot(Restored.Normal) / NormalLength);
+				}
+			}
+			const float MaxNormalDegrees = std::acos(std::clamp(MinNormalDot, -1.0f, 1.0f)) * 57.2957795f;
+
+			// 양자화된 값을 다시 양자화해도 바뀌지 않아야 쿠킹 전후 데이터가 같다
+			TArray<FNormalVertex> Requantized = Unpacked;
+			FPackedVertexStream::Quantize(Requantized);
+			const bool bStable = memcmp(Requantized.data(), Unpacked.data(), Unpacked.size() * sizeof(FNormalVertex)) == 0;
+
+			const uint64 FloatBytes = sizeof(FNormalVertex) * Source.size();
+			const uint64 PackedBytes = Stream.GetNumBytes();
+			TotalFloatBytes += FloatBytes;
+			TotalPackedBytes += PackedBytes;
+
+			UE_LOG_INFO("  %-24s %8zu vtx | %7.2f MB -> %6.2f MB (x%.1f, color %s) | pos %.1e of diag, normal %.3f deg, uv %.1e | pack %6.2f ms, unpack %6.2f ms | stable %s",
+				InName.c_str(), Source.size(), FloatBytes / (1024.0 * 1024.0), PackedBytes / (1024.0 * 1024.0),
+				static_cast<double>(FloatBytes) / std::max<uint64>(PackedBytes, 1), Stream.Colors.empty() ? "dropped" : "kept",
+				MaxPositionError / Diagonal, MaxNormalDegrees, MaxUVError, PackMs, UnpackMs, bStable ? "yes" : "NO");
+		};
+
+	// 1) 합성 토러스 (흰색) / 정점 색을 칠한 토러스 (색 스트림 유지)
+	{
+		const TUniquePtr<FStaticMesh> Torus(MakeBumpyTorusMesh(700, 360));
+		MeasureMesh("synthetic torus", *Torus);
+
+		for (size_t Index = 0; Index < Torus->Vertices.size(); ++Index)
+		{
+			const float T = static_cast<float>(Index) / Torus->Vertices.size();
+			Torus->Vertices[Index].Color = FVector4(T, 1.0f - T, 0.5f, 1.0f);
+		}
+		MeasureMesh("synthetic torus colored", *Torus);
+	}
+
+	// 2) Data/ 메시: 에셋 전체의 정점 메모리 절감량
+	TotalFloatBytes = 0;
+	TotalPackedBytes = 0;
+	if (!ForEachDataMesh(MeasureMesh))
+	{
+		UE_LOG_WARNING("Benchmark: Data/ 디렉토리가 없어 정점 양자화 측정을 건너뜁니다");
+		return;
+	}
+	UE_LOG_INFO("  Data/ total: %.2f MB -> %.2f MB (saved %.2f MB, x%.1f)", TotalFloatBytes / (1024.0 * 1024.0),
+		TotalPackedBytes / (1024.0 * 1024.0), (TotalFloatBytes - TotalPackedBytes) / (1024.0 * 1024.0),
+		static_cast<double>(TotalFloatBytes) / std::max<uint64>(TotalPackedBytes, 1));
+}
+
+void FEngineBenchmark::RunTransformHierarchy()
+{
+	constexpr int32 ActorCount = 500;
+	constexpr int32 NodesPerActor = 200;
+	constexpr int32 NodeCount = ActorCount * NodesPerActor;
+	constexpr int32 FrameCount = 10;
+	constexpr int32 DragActorCount = 32;
+	constexpr int32 ReparentPerFrame = NodeCount / 100;
+
+	// 액터마다 루트 아래로 최근 노드 8개 중 하나를 부모로 삼는 트리 (부모 번호가 항상 자식보다 작다)
+	std::mt19937 Rng(BenchmarkSeed ^ 0x7EA45F00u);
+	TArray<int32> Parents(NodeCount);
+	for (int32 Actor = 0; Actor < ActorCount; ++Actor)
+	{
+		const int32 Base = Actor * NodesPerActor;
+		Parents[Base] = -1;
+		for (int32 Local = 1; Local < NodesPerActor; ++Local)
+		{
+			std::uniform_int_distribution<int32> ParentDist(std::max(0, Local - 8), Local - 1);
+			Parents[Base + Local] = Base + ParentDist(Rng);
+		}
+	}
+
+	// 짝수/홀수 프레임에 번갈아 쓰는 로컬 변환 두 벌 (측정 구간에는 행렬 생성이 들어가지 않는다)
+	TArray<FMatrix> FrameLocals[2];
+	std::uniform_real_distribution<float> OffsetDist(-2.0f, 2.0f);
+	std::uniform_real_distribution<float> AngleDist(-0.3f, 0.3f);
+	std::uniform_real_distribution<float> ScaleDist(0.9f, 1.1f);
+	for (TArray<FMatrix>& Locals : FrameLocals)
+	{
+		Locals.reserve(NodeCount);
+		for (int32 Node = 0; Node < NodeCount; ++Node)
+		{
+			const FVector Location(OffsetDist(Rng), OffsetDist(Rng), OffsetDist(Rng));
+			const FVector Rotation(AngleDist(Rng), AngleDist(Rng), AngleDist(Rng));
+			const float Scale = ScaleDist(Rng);
+			Locals.push_back(FMatrix::ScaleMatrix(FVector(Scale, Scale, Scale)) * FMatrix::RotationMatrix(Rotation) * FMatrix::TranslationMatrix(Location));
+		}
+	}
+
+	FEagerTransformTree EagerTree(Parents);
+	FTransformHierarchy Hierarchy;
+	TArray<int32> Handles(NodeCount);
+	for (int32 Node = 0; Node < NodeCount; ++Node)
+	{
+		Handles[Node] = Hierarchy.Register();
+		if (Parents[Node] >= 0)
+		{
+			Hierarchy.SetParent(Handles[Node], Handles[Parents[Node]]);
+		}
+	}
+	FTaskScheduler SingleThread(0);
+	const double InitialSortMs = MeasureBestMilliseconds(1, [&]() { Hierarchy.UpdateTransforms(&SingleThread); });
+
+	const auto MaxWorldDifference = [&]()
+		{
+			float MaxDifference = 0.0f;
+			for (int32 Node = 0; Node < NodeCount; ++Node)
+			{
+				const FMatrix& World = Hierarchy.GetWorldTransform(Handles[Node]);
+				for (int32 Row = 0; Row < 4; ++Row)
+				{
+					for (int32 Col = 0; Col < 4; ++Col)
+					{
+						MaxDifference = std::max(MaxDifference, std::abs(World.Data[Row][Col] - EagerTree.WorldTransforms[Node].Data[Row][Col]));
+					}
+				}
+			}
+			return MaxDifference;
+		};
+
+	// 1) 모든 노드 애니메이션: 부모 먼저 순서로 매 노드 로컬 변환 설정
+	const auto TimeFrames = [&](auto&& InFrameFunc)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+			{
+				InFrameFunc(FrameLocals[Frame & 1]);
+			}
+			return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / FrameCount;
+		};
+
+	const double EagerAllMs = TimeFrames([&](const TArray<FMatrix>& InLocals)
+		{
+			for (int32 Node = 0; Node < NodeCount; ++Node)
+			{
+				EagerTree.SetLocalTransform(Node, InLocals[Node]);
+			}
+		});
+	const double BatchedAllMs = TimeFrames([&](const TArray<FMatrix>& InLocals)
+		{
+			for (int32 Node = 0; Node < NodeCount; ++Node)
+			{
+				Hierarchy.SetLocalTransform(Handles[Node], InLocals[Node]);
+			}
+			Hierarchy.UpdateTransforms(&SingleThread);
+		});
+	const uint32 UpdatedAll = Hierarchy.GetNumUpdatedLastPass();
+	const double ParallelAllMs = TimeFrames([&](const TArray<FMatrix>& InLocals)
+		{
+			for (int32 Node = 0; Node < NodeCount; ++Node)
+			{
+				Hierarchy.SetLocalTransform(Handles[Node], InLocals[Node]);
+			}
+			Hierarchy.UpdateTransforms(&FTaskScheduler::Get());
+		});
+	const float AllDifference = MaxWorldDifference();
+
+	// 2) 다중 선택 드래그: 선택된 액터 루트만 매 프레임 이동
+	const auto DragFrame = [&](const TArray<FMatrix>& InLocals, auto&& InSetFunc)
+		{
+			for (int32 Actor = 0; Actor < DragActorCount; ++Actor)
+			{
+				const int32 Root = Actor * (ActorCount / DragActorCount) * NodesPerActor;
+				InSetFunc(Root, InLocals[Root]);
+			}
+		};
+	const double EagerDragMs = TimeFrames([&](const TArray<FMatrix>& InLocals)
+		{
+			DragFrame(InLocals, [&](int32 InNode, const FMatrix& InLocal) { EagerTree.SetLocalTransform(InNode, InLocal); });
+		});
+	const double BatchedDragMs = TimeFrames([&](const TArray<FMatrix>& InLocals)
+		{
+			DragFrame(InLocals, [&](int32 InNode, const FMatrix& InLocal) { Hierarchy.SetLocalTransform(Handles[InNode], InLocal); });
+			Hierarchy.UpdateTransforms();
+		});
+	const uint32 UpdatedDrag = Hierarchy.GetNumUpdatedLastPass();
+	const float DragDifference = MaxWorldDifference();
+
+	// 3) 아무것도 바뀌지 않은 프레임 (더티 비트 스캔만)
+	const double IdleMs = TimeFrames([&](const TArray<FMatrix>&) { Hierarchy.UpdateTransforms(); });
+
+	// 4) 재부모화: 매 프레임 1% 노드를 같은 액터의 더 앞 노드 아래로 옮긴 뒤 재정렬 + 갱신
+	std::uniform_int_distribution<int32> NodeDist(0, NodeCount - 1);
+	const double ReparentMs = TimeFrames([&](const TArray<FMatrix>&)
+		{
+			for (int32 Move = 0; Move < ReparentPerFrame; ++Move)
+			{
+				const int32 Node = NodeDist(Rng);
+				const int32 Local = Node % NodesPerActor;
+				if (Local == 0)
+				{
+					continue;
+				}
+				const int32 NewParent = Node - Local + static_cast<int32>(Rng() % Local);
+				Parents[Node] = NewParent;
+				Hierarchy.SetParent(Handles[Node], Handles[NewParent]);
+			}
+			Hierarchy.UpdateTransforms();
+		});
+	const uint32 UpdatedReparent = Hierarchy.GetNumUpdatedLastPass();
+
+	// 재부모화 결과를 즉시 갱신 방식으로 다시 계산해 비교
+	FEagerTransformTree ReparentedTree(Parents);
+	for (int32 Node = 0; Node < NodeCount; ++Node)
+	{
+		ReparentedTree.LocalTransforms[Node] = EagerTree.LocalTransforms[Node];
+	}
+	for (int32 Node = 0; Node < NodeCount; ++Node)
+	{
+		ReparentedTree.Update(Node);
+	}
+	EagerTree.WorldTransforms.swap(ReparentedTree.WorldTransforms);
+	const float ReparentDifference = MaxWorldDifference();
+
+	UE_LOG_SYSTEM("Benchmark: Transform Hierarchy (%d actors x %d nodes = %d transforms, %d frames, %u threads)",
+		ActorCount, NodesPerActor, NodeCount, FrameCount, FTaskScheduler::Get().GetConcurrency());
+	UE_LOG_INFO("  initial sort + update      | %8.2f ms", InitialSortMs);
+	UE_LOG_INFO("  animate all: eager setters | %8.2f ms/frame", EagerAllMs);
+	UE_LOG_INFO("  animate all: batched       | %8.2f ms/frame (x%.1f) | %u updated | max diff %.1e",
+		BatchedAllMs, EagerAllMs / std::max(BatchedAllMs, 1e-6), UpdatedAll, AllDifference);
+	UE_LOG_INFO("  animate all: batched par.  | %8.2f ms/frame (x%.1f)", ParallelAllMs, EagerAllMs / std::max(ParallelAllMs, 1e-6));
+	UE_LOG_INFO("  drag %2d actors: eager      | %8.3f ms/frame", DragActorCount, EagerDragMs);
+	UE_LOG_INFO("  drag %2d actors: batched    | %8.3f ms/frame (x%.1f) | %u updated | max diff %.1e",
+		DragActorCount, BatchedDragMs, EagerDragMs / std::max(BatchedDragMs, 1e-6), UpdatedDrag, DragDifference);
+	UE_LOG_INFO("  idle frame                 | %8.3f ms/frame", IdleMs);
+	UE_LOG_INFO("  reparent %4d + resort     | %8.2f ms/frame | %u updated | max diff %.1e",
+		ReparentPerFrame, ReparentMs, UpdatedReparent, ReparentDifference);
+}
+
+void FEngineBenchmark::RunMathKernels()
+{
+	constexpr int32 TransformCount = 100'000;
+	constexpr int32 PointCount = 1'000'000;
+	constexpr int32 Repeat = 5;
+	constexpr int32 RefitFrameCount = 10;
+
+	std::mt19937 Rng(BenchmarkSeed ^ 0x3A7F1C00u);
+	std::uniform_real_distribution<float> LocationDist(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> AngleDist(-3.14159265f, 3.14159265f);
+	std::uniform_real_distribution<float> ScaleDist(0.25f, 4.0f);
+	std::uniform_real_distribution<float> UnitDist(-1.0f, 1.0f);
+
+	TArray<FVector> Locations(TransformCount);
+	TArray<FVector> Rotations(TransformCount);
+	TArray<FVector> Scales(TransformCount);
+	TArray<FAABB> LocalBounds(TransformCount);
+	for (int32 i = 0; i < TransformCount; ++i)
+	{
+		Locations[i] = FVector(LocationDist(Rng), LocationDist(Rng), LocationDist(Rng));
+		Rotations[i] = FVector(AngleDist(Rng), AngleDist(Rng), AngleDist(Rng));
+		Scales[i] = FVector(ScaleDist(Rng), ScaleDist(Rng), ScaleDist(Rng));
+		const FVector Half(ScaleDist(Rng), ScaleDist(Rng), ScaleDist(Rng));
+		const FVector Center(UnitDist(Rng), UnitDist(Rng), UnitDist(Rng));
+		LocalBounds[i] = FAABB(Center - Half, Center + Half);
+	}
+
+	UE_LOG_SYSTEM("Benchmark: Math Kernels (%d transforms, %d points, AVX2: %s)",
+		TransformCount, PointCount, FPlatformSIMD::HasAVX2() ? "yes" : "no");
+
+	// 1) TRS 합성: 행렬 다섯 개 곱 대비 닫힌 식
+	TArray<FMatrix> LegacyWorlds(TransformCount);
+	TArray<FMatrix> Worlds(TransformCount);
+	const double LegacyComposeMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				LegacyWorlds[i] = LegacyModelMatrix(Locations[i], Rotations[i], Scales[i]);
+			}
+		});
+	const double ComposeMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				Worlds[i] = FMatrix::GetModelMatrix(Locations[i], Rotations[i], Scales[i]);
+			}
+		});
+	float ComposeDifference = 0.0f;
+	for (int32 i = 0; i < TransformCount; ++i)
+	{
+		ComposeDifference = std::max(ComposeDifference, GetMatrixDifference(LegacyWorlds[i], Worlds[i]));
+	}
+	UE_LOG_INFO("  TRS compose   | legacy %8.3f ms | MakeTransform   %8.3f ms (x%.1f) | max diff %.1e",
+		LegacyComposeMs, ComposeMs, LegacyComposeMs / std::max(ComposeMs, 1e-6), ComposeDifference);
+
+	// 2) 행렬 곱: 로컬 * 부모 월드 형태로 인접한 두 행렬을 곱한다
+	TArray<FMatrix> Rights(TransformCount);
+	for (int32 i = 0; i < TransformCount; ++i)
+	{
+		Rights[i] = Worlds[(i + 1) % TransformCount];
+	}
+	TArray<FMatrix> LegacyProducts(TransformCount);
+	TArray<FMatrix> Products(TransformCount);
+	TArray<FMatrix> BatchProducts(TransformCount);
+	const double LegacyMultiplyMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				LegacyProducts[i] = LegacyMultiply(Worlds[i], Rights[i]);
+			}
+		});
+	const double MultiplyMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				Products[i] = Worlds[i] * Rights[i];
+			}
+		});
+	const double BatchMultiplyMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			FMatrix::MultiplyMatrices(Worlds.data(), Rights.data(), BatchProducts.data(), TransformCount);
+		});
+	float MultiplyDifference = 0.0f;
+	for (int32 i = 0; i < TransformCount; ++i)
+	{
+		const float Magnitude = std::max(1.0f, GetMatrixMagnitude(LegacyProducts[i]));
+		MultiplyDifference = std::max(MultiplyDifference, GetMatrixDifference(LegacyProducts[i], Products[i]) / Magnitude);
+		MultiplyDifference = std::max(MultiplyDifference, GetMatrixDifference(LegacyProducts[i], BatchProducts[i]) / Magnitude);
+	}
+	UE_LOG_INFO("  multiply      | legacy %8.3f ms | operator*       %8.3f ms (x%.1f) | batch %8.3f ms (x%.1f) | max rel diff %.1e",
+		LegacyMultiplyMs, MultiplyMs, LegacyMultiplyMs / std::max(MultiplyMs, 1e-6),
+		BatchMultiplyMs, LegacyMultiplyMs / std::max(BatchMultiplyMs, 1e-6), MultiplyDifference);
+
+	// 3) 역행렬: 일반 4x4 대비 아핀 전용
+	TArray<FMatrix> LegacyInverses(TransformCount);
+	TArray<FMatrix> Inverses(TransformCount);
+	const double LegacyInverseMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				LegacyInverses[i] = Worlds[i].Inverse();
+			}
+		});
+	const double InverseMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				Inverses[i] = Worlds[i].InverseAffine();
+			}
+		});
+	float InverseDifference = 0.0f;
+	for (int32 i = 0; i < TransformCount; ++i)
+	{
+		// 역행렬 자체보다 원래 행렬과 곱한 결과가 항등에 얼마나 가까운지가 의미 있다
+		InverseDifference = std::max(InverseDifference, GetMatrixDifference(Worlds[i] * Inverses[i], FMatrix::Identity()));
+	}
+	UE_LOG_INFO("  inverse       | legacy %8.3f ms | InverseAffine   %8.3f ms (x%.1f) | max |M*inv - I| %.1e",
+		LegacyInverseMs, InverseMs, LegacyInverseMs / std::max(InverseMs, 1e-6), InverseDifference);
+
+	// 4) 피킹 레이 준비: 프리미티브마다 월드 역행렬을 구해 레이를 모델 공간으로 옮긴다 (UObjectPicker::GetModelRay)
+	const FVector4 RayOrigin(-1000.0f, 250.0f, 300.0f, 1.0f);
+	const FVector4 RayDirection(0.8f, -0.2f, -0.1f, 0.0f);
+	TArray<FRay> LegacyModelRays(TransformCount);
+	TArray<FRay> ModelRays(TransformCount);
+	const double LegacyPickingMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				const FMatrix ModelInverse = Worlds[i].Inverse();
+				LegacyModelRays[i].Origin = LegacyVectorMultiply(RayOrigin, ModelInverse);
+				LegacyModelRays[i].Direction = LegacyVectorMultiply(RayDirection, ModelInverse);
+			}
+		});
+	const double PickingMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				const FMatrix ModelInverse = Worlds[i].InverseAffine();
+				ModelRays[i].Origin = RayOrigin * ModelInverse;
+				ModelRays[i].Direction = RayDirection * ModelInverse;
+			}
+		});
+	float PickingDifference = 0.0f;
+	for (int32 i = 0; i < TransformCount; ++i)
+	{
+		const FVector LegacyOrigin(LegacyModelRays[i].Origin.X, LegacyModelRays[i].Origin.Y, LegacyModelRays[i].Origin.Z);
+		const FVector Origin(ModelRays[i].Origin.X, ModelRays[i].Origin.Y, ModelRays[i].Origin.Z);
+		PickingDifference = std::max(PickingDifference, GetVectorDifference(LegacyOrigin, Origin) / std::max(1.0f, LegacyOrigin.Length()));
+	}
+	UE_LOG_INFO("  picking rays  | legacy %8.3f ms | affine + SIMD   %8.3f ms (x%.1f) | max rel diff %.1e",
+		LegacyPickingMs, PickingMs, LegacyPickingMs / std::max(PickingMs, 1e-6), PickingDifference);
+
+	// 5) 월드 AABB: 모서리 8개 변환 대비 중심/반경 변환 (단건, 일괄)
+	TArray<FAABB> LegacyWorldBounds(TransformCount);
+	TArray<FAABB> WorldBounds(TransformCount);
+	TArray<FVector> LocalMins(TransformCount);
+	TArray<FVector> LocalMaxs(TransformCount);
+	TArray<FVector> WorldMins(TransformCount);
+	TArray<FVector> WorldMaxs(TransformCount);
+	for (int32 i = 0; i < TransformCount; ++i)
+	{
+		LocalMins[i] = LocalBounds[i].Min;
+		LocalMaxs[i] = LocalBounds[i].Max;
+	}
+	const double LegacyBoundsMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				LegacyTransformAABB(Worlds[i], LocalBounds[i], LegacyWorldBounds[i]);
+			}
+		});
+	const double BoundsMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				FMatrix::TransformAABB(Worlds[i], LocalBounds[i].Min, LocalBounds[i].Max, WorldBounds[i].Min, WorldBounds[i].Max);
+			}
+		});
+	const double BatchBoundsMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			FMatrix::TransformAABBs(Worlds.data(), LocalMins.data(), LocalMaxs.data(), WorldMins.data(), WorldMaxs.data(), TransformCount);
+		});
+	float BoundsDifference = 0.0f;
+	for (int32 i = 0; i < TransformCount; ++i)
+	{
+		const float Size = std::max(1.0f, (LegacyWorldBounds[i].Max - LegacyWorldBounds[i].Min).Length());
+		BoundsDifference = std::max(BoundsDifference, GetVectorDifference(LegacyWorldBounds[i].Min, WorldBounds[i].Min) / Size);
+		BoundsDifference = std::max(BoundsDifference, GetVectorDifference(LegacyWorldBounds[i].Max, WorldBounds[i].Max) / Size);
+		BoundsDifference = std::max(BoundsDifference, GetVectorDifference(LegacyWorldBounds[i].Min, WorldMins[i]) / Size);
+		BoundsDifference = std::max(BoundsDifference, GetVectorDifference(LegacyWorldBounds[i].Max, WorldMaxs[i]) / Size);
+	}
+	UE_LOG_INFO("  world AABB    | legacy %8.3f ms | TransformAABB   %8.3f ms (x%.1f) | batch %8.3f ms (x%.1f) | max rel diff %.1e",
+		LegacyBoundsMs, BoundsMs, LegacyBoundsMs / std::max(BoundsMs, 1e-6),
+		BatchBoundsMs, LegacyBoundsMs / std::max(BatchBoundsMs, 1e-6), BoundsDifference);
+
+	// 6) 점 일괄 변환 (한 메시의 정점을 한 행렬로)
+	TArray<FVector> Points(PointCount);
+	for (FVector& Point : Points)
+	{
+		Point = FVector(UnitDist(Rng), UnitDist(Rng), UnitDist(Rng)) * 50.0f;
+	}
+	TArray<FVector> LegacyTransformed(PointCount);
+	TArray<FVector> Transformed(PointCount);
+	const FMatrix& PointMatrix = Worlds[0];
+	const double LegacyPointsMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			for (int32 i = 0; i < PointCount; ++i)
+			{
+				const FVector4 World = LegacyVectorMultiply(FVector4(Points[i].X, Points[i].Y, Points[i].Z, 1.0f), PointMatrix);
+				LegacyTransformed[i] = FVector(World.X, World.Y, World.Z);
+			}
+		});
+	const double PointsMs = MeasureBestMilliseconds(Repeat, [&]()
+		{
+			FMatrix::TransformPoints(PointMatrix, Points.data(), Transformed.data(), PointCount);
+		});
+	float PointsDifference = 0.0f;
+	for (int32 i = 0; i < PointCount; ++i)
+	{
+		PointsDifference = std::max(PointsDifference, GetVectorDifference(LegacyTransformed[i], Transformed[i]) / std::max(1.0f, LegacyTransformed[i].Length()));
+	}
+	UE_LOG_INFO("  points        | legacy %8.3f ms | TransformPoints %8.3f ms (x%.1f) | max rel diff %.1e",
+		LegacyPointsMs, PointsMs, LegacyPointsMs / std::max(PointsMs, 1e-6), PointsDifference);
+
+	// 7) BVH 리핏: 프레임마다 모든 프리미티브가 조금씩 움직였을 때 월드 AABB 계산 + 전체 리핏
+	FSceneBVH BVH;
+	BVH.BuildFromBounds(LegacyWorldBounds);
+	TArray<FMatrix> FrameWorlds[2] = { Worlds, Worlds };
+	for (FMatrix& World : FrameWorlds[1])
+	{
+		World.Data[3][0] += UnitDist(Rng);
+		World.Data[3][1] += UnitDist(Rng);
+		World.Data[3][2] += UnitDist(Rng);
+	}
+	const auto TimeRefitFrames = [&](auto&& InComputeBounds)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int32 Frame = 0; Frame < RefitFrameCount; ++Frame)
+			{
+				InComputeBounds(FrameWorlds[Frame & 1]);
+				BVH.RefitFromBounds(WorldBounds);
+			}
+			return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / RefitFrameCount;
+		};
+	const double LegacyRefitMs = TimeRefitFrames([&](const TArray<FMatrix>& InWorlds)
+		{
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				LegacyTransformAABB(InWorlds[i], LocalBounds[i], WorldBounds[i]);
+			}
+		});
+	const double RefitMs = TimeRefitFrames([&](const TArray<FMatrix>& InWorlds)
+		{
+			FMatrix::TransformAABBs(InWorlds.data(), LocalMins.data(), LocalMaxs.data(), WorldMins.data(), WorldMaxs.data(), TransformCount);
+			for (int32 i = 0; i < TransformCount; ++i)
+			{
+				WorldBounds[i].Min = WorldMins[i];
+				WorldBounds[i].Max = WorldMaxs[i];
+			}
+		});
+	const double RefitOnlyMs = TimeRefitFrames([](const TArray<FMatrix>&) {});
+	UE_LOG_INFO("  BVH refit     | legacy %8.3f ms | batch bounds    %8.3f ms (x%.1f) | refit only %.3f ms | SAH x%.2f",
+		LegacyRefitMs, RefitMs, LegacyRefitMs / std::max(RefitMs, 1e-6), RefitOnlyMs, BVH.GetSAHDegradation());
+}
+
+void FEngineBenchmark::RunPrimitiveBounds()
+{
+	constexpr int32 ActorCount = 2'000;
+	constexpr int32 PrimitivesPerActor = 50;
+	constexpr int32 PrimitiveCount = ActorCount * PrimitivesPerActor;
+	constexpr int32 FrameCount = 10;
+	constexpr int32 MovingActorCount = ActorCount / 20;
+
+	// 프레임마다 월드 AABB를 읽는 곳 (옥트리 갱신, BVH 리핏, 동적 프리미티브 스냅샷)
+	constexpr int32 ConsumerCount = 3;
+
+	// 액터 루트 아래에 프리미티브가 붙은 얕은 계층 (루트는 프리미티브가 아닌 씬 컴포넌트 역할)
+	std::mt19937 Rng(BenchmarkSeed ^ 0xB0B0A5A5u);
+	std::uniform_real_distribution<float> OffsetDist(-5.0f, 5.0f);
+	std::uniform_real_distribution<float> AngleDist(-3.14159265f, 3.14159265f);
+	std::uniform_real_distribution<float> SizeDist(0.25f, 2.0f);
+
+	FTransformHierarchy Hierarchy;
+	FPrimitiveBoundsTable Table(Hierarchy);
+	TArray<int32> RootHandles(ActorCount);
+	TArray<int32> TransformHandles(PrimitiveCount);
+	TArray<int32> BoundsHandles(PrimitiveCount);
+	TArray<FAABB> LocalBounds(PrimitiveCount);
+	const TArray<FAABB> ActorPlacements = MakeSyntheticAABBs(ActorCount, 2000.0f);
+	for (int32 Actor = 0; Actor < ActorCount; ++Actor)
+	{
+		RootHandles[Actor] = Hierarchy.Register();
+		Hierarchy.SetLocalTransform(RootHandles[Actor], FMatrix::TranslationMatrix(ActorPlacements[Actor].Min));
+		for (int32 Local = 0; Local < PrimitivesPerActor; ++Local)
+		{
+			const int32 Index = Actor * PrimitivesPerActor + Local;
+			TransformHandles[Index] = Hierarchy.Register();
+			Hierarchy.SetParent(TransformHandles[Index], RootHandles[Actor]);
+			Hierarchy.SetLocalTransform(TransformHandles[Index], FMatrix::MakeTransform(
+				FVector(OffsetDist(Rng), OffsetDist(Rng), OffsetDist(Rng)), FVector(AngleDist(Rng), AngleDist(Rng), AngleDist(Rng)), FVector(1.0f, 1.0f, 1.0f)));
+
+			const FVector Half(SizeDist(Rng), SizeDist(Rng), SizeDist(Rng));
+			LocalBounds[Index] = FAABB(-Half, Half);
+			BoundsHandles[Index] = Table.Register(nullptr, TransformHandles[Index]);
+			Table.SetLocalBounds(BoundsHandles[Index], LocalBounds[Index]);
+		}
+	}
+
+	FTaskScheduler SingleThread(0);
+	FLazyBoundsCache LazyCache(Hierarchy, TransformHandles, LocalBounds);
+	TArray<FAABB> ConsumerBounds[ConsumerCount];
+	for (TArray<FAABB>& Bounds : ConsumerBounds)
+	{
+		Bounds.resize(PrimitiveCount);
+	}
+
+	// 짝수/홀수 프레임에 번갈아 쓰는 루트 위치 두 벌
+	TArray<FMatrix> FrameRoots[2];
+	for (TArray<FMatrix>& Roots : FrameRoots)
+	{
+		Roots.reserve(ActorCount);
+		for (int32 Actor = 0; Actor < ActorCount; ++Actor)
+		{
+			const FVector Jitter(OffsetDist(Rng), OffsetDist(Rng), OffsetDist(Rng));
+			Roots.push_back(FMatrix::MakeTransform(ActorPlacements[Actor].Min + Jitter, FVector(0.0f, AngleDist(Rng), 0.0f), FVector(1.0f, 1.0f, 1.0f)));
+		}
+	}
+
+	const auto MoveActors = [&](int32 InFrame, int32 InNumActors)
+		{
+			for (int32 Actor = 0; Actor < InNumActors; ++Actor)
+			{
+				Hierarchy.SetLocalTransform(RootHandles[Actor], FrameRoots[InFrame & 1][Actor]);
+			}
+		};
+
+	// 이전 방식: 계층만 일괄 갱신하고, 읽는 곳마다 컴포넌트의 지연 캐시를 거쳐 자기 배열에 복사
+	const auto RunLazyFrames = [&](int32 InNumActors)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+			{
+				MoveActors(Frame, InNumActors);
+				Hierarchy.UpdateTransforms(&SingleThread);
+				for (TArray<FAABB>& Bounds : ConsumerBounds)
+				{
+					for (int32 i = 0; i < PrimitiveCount; ++i)
+					{
+						Bounds[i] = LazyCache.GetWorldAABB(i);
+					}
+				}
+			}
+			return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / FrameCount;
+		};
+
+	// 표 방식: 바뀐 항목만 일괄 계산한 뒤 읽는 곳은 표를 그대로 읽는다
+	const auto RunTableFrames = [&](int32 InNumActors, FTaskScheduler* InScheduler)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+			{
+				MoveActors(Frame, InNumActors);
+				Table.UpdateBounds(InScheduler);
+				for (TArray<FAABB>& Bounds : ConsumerBounds)
+				{
+					for (int32 i = 0; i < PrimitiveCount; ++i)
+					{
+						Table.GetCachedWorldBounds(BoundsHandles[i], Bounds[i]);
+					}
+				}
+			}
+			return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / FrameCount;
+		};
+
+	const auto MaxBoundsDifference = [&]()
+		{
+			float MaxDifference = 0.0f;
+			for (int32 i = 0; i < PrimitiveCount; ++i)
+			{
+				FAABB TableBounds;
+				Table.GetCachedWorldBounds(BoundsHandles[i], TableBounds);
+				const FAABB& LazyBounds = LazyCache.GetWorldAABB(i);
+				MaxDifference = std::max(MaxDifference, GetVectorDifference(TableBounds.Min, LazyBounds.Min));
+				MaxDifference = std::max(MaxDifference, GetVectorDifference(TableBounds.Max, LazyBounds.Max));
+			}
+			return MaxDifference;
+		};
+
+	const double InitialMs = MeasureBestMilliseconds(1, [&]() { Table.UpdateBounds(&SingleThread); });
+
+	const double LazyAllMs = RunLazyFrames(ActorCount);
+	const double TableAllMs = RunTableFrames(ActorCount, &SingleThread);
+	const uint32 UpdatedAll = Table.GetNumUpdatedLastPass();
+	const float AllDifference = MaxBoundsDifference();
+	const double ParallelAllMs = RunTableFrames(ActorCount, nullptr);
+
+	const double LazyMovingMs = RunLazyFrames(MovingActorCount);
+	const double TableMovingMs = RunTableFrames(MovingActorCount, &SingleThread);
+	const uint32 UpdatedMoving = Table.GetNumUpdatedLastPass();
+	const float MovingDifference = MaxBoundsDifference();
+
+	const double LazyIdleMs = RunLazyFrames(0);
+	const double TableIdleMs = RunTableFrames(0, &SingleThread);
+
+	UE_LOG_SYSTEM("Benchmark: Primitive Bounds (%d actors x %d primitives = %d, %d readers/frame, %d frames, %u threads)",
+		ActorCount, PrimitivesPerActor, PrimitiveCount, ConsumerCount, FrameCount, FTaskScheduler::Get().GetConcurrency());
+	UE_LOG_INFO("  initial batch              | %8.3f ms", InitialMs);
+	UE_LOG_INFO("  move all: lazy per reader  | %8.3f ms/frame", LazyAllMs);
+	UE_LOG_INFO("  move all: batched table    | %8.3f ms/frame (x%.1f) | %u updated | max diff %.1e",
+		TableAllMs, LazyAllMs / std::max(TableAllMs, 1e-6), UpdatedAll, AllDifference);
+	UE_LOG_INFO("  move all: batched par.     | %8.3f ms/frame (x%.1f)", ParallelAllMs, LazyAllMs / std::max(ParallelAllMs, 1e-6));
+	UE_LOG_INFO("  move %3d: lazy per reader  | %8.3f ms/frame", MovingActorCount, LazyMovingMs);
+	UE_LOG_INFO("  move %3d: batched table    | %8.3f ms/frame (x%.1f) | %u updated | max diff %.1e",
+		MovingActorCount, TableMovingMs, LazyMovingMs / std::max(TableMovingMs, 1e-6), UpdatedMoving, MovingDifference);
+	UE_LOG_INFO("  idle: lazy per reader      | %8.3f ms/frame", LazyIdleMs);
+	UE_LOG_INFO("  idle: batched table        | %8.3f ms/frame (x%.1f)", TableIdleMs, LazyIdleMs / std::max(TableIdleMs, 1e-6));
+}
+
+void FEngineBenchmark::RunNameTable()
+{
+	constexpr int32 NameCount = 50'000;
+	constexpr int32 LookupsPerThread = 400'000;
+	constexpr int32 LookupStringCount = 1 << 16;
+	const uint32 ThreadCounts[] = { 1, 8 };
+
+	// 조회용 이름을 두 표에 미리 등록하고, 대소문자를 섞은 조회 문자열을 만들어 둔다
+	std::mt19937 Rng(BenchmarkSeed ^ 0x4E414D45u);
+	FLegacyNameTable LookupLegacy;
+	TArray<FString> Names;
+	Names.reserve(NameCount);
+	for (int32 i = 0; i < NameCount; ++i)
+	{
+		Names.push_back(MakeBenchmarkName("Lookup", i));
+		LookupLegacy.FindOrAdd(Names.back());
+		FName Registered(Names.back());
+	}
+	TArray<FString> LookupStrings;
+	TArray<int32> LookupSources;
+	LookupStrings.reserve(LookupStringCount);
+	LookupSources.reserve(LookupStringCount);
+	for (int32 i = 0; i < LookupStringCount; ++i)
+	{
+		LookupSources.push_back(static_cast<int32>(Rng() % NameCount));
+		LookupStrings.push_back(FlipCase(Names[LookupSources.back()], Rng()));
+	}
+
+	// 대소문자만 다른 문자열이 모두 같은 이름이 되고 처음 등록한 표기를 유지하는지 확인
+	int32 MismatchCount = 0;
+	for (int32 i = 0; i < LookupStringCount; i += 97)
+	{
+		const FName Lookup(LookupStrings[i]);
+		const FString& Source = Names[LookupSources[i]];
+		if (Lookup != FName(Source) || Lookup != FName(FlipCase(Source, ~0u)) || Lookup.ToString() != Source)
+		{
+			++MismatchCount;
+		}
+	}
+
+	UE_LOG_SYSTEM("Benchmark: FName Table (%d names, %d lookups/thread, case check %s)", NameCount, LookupsPerThread,
+		MismatchCount == 0 ? "ok" : "MISMATCH");
+
+	std::atomic<int32> Sink{ 0 };
+	for (const uint32 Threads : ThreadCounts)
+	{
+		// 호출 스레드도 작업에 참여하므로 워커는 Threads - 1개
+		FTaskScheduler Scheduler(Threads - 1);
+		const auto RunThreads = [&](const TFunction<int32(int32)>& InBody)
+			{
+				const uint64 Start = FPlatformTime::Cycles64();
+				Scheduler.ParallelFor(Threads, 1, [&](int64 Begin, int64 End)
+					{
+						for (int64 Thread = Begin; Thread < End; ++Thread)
+						{
+							Sink.fetch_add(InBody(static_cast<int32>(Thread)), std::memory_order_relaxed);
+						}
+					});
+				return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+			};
+		const auto GetMops = [](double InOps, double InMs) { return InOps / std::max(InMs, 1e-6) / 1000.0; };
+
+		// 새 이름 등록: 스레드마다 겹치지 않는 이름을 (이전 방식은 새 표에, 새 방식은 아직 없는 이름으로) 등록
+		TArray<FString> InsertNames;
+		InsertNames.reserve(NameCount);
+		const FString InsertPrefix = "Insert" + std::to_string(Threads);
+		for (int32 i = 0; i < NameCount; ++i)
+		{
+			InsertNames.push_back(MakeBenchmarkName(InsertPrefix.c_str(), i));
+		}
+		const int32 InsertsPerThread = NameCount / static_cast<int32>(Threads);
+		const auto InsertSlice = [&](int32 InThread, const TFunction<int32(const FString&)>& InInsert)
+			{
+				int32 Sum = 0;
+				for (int32 i = InThread * InsertsPerThread; i < (InThread + 1) * InsertsPerThread; ++i)
+				{
+					Sum += InInsert(InsertNames[i]);
+				}
+				return Sum;
+			};
+
+		FLegacyNameTable InsertLegacy;
+		const double LegacyInsertMs = RunThreads([&](int32 InThread)
+			{
+				return InsertSlice(InThread, [&](const FString& InName) { return InsertLegacy.FindOrAdd(InName); });
+			});
+		const double InsertMs = RunThreads([&](int32 InThread)
+			{
+				return InsertSlice(InThread, [](const FString& InName) { return FName(InName).ComparisonIndex; });
+			});
+
+		// 이미 있는 이름 조회 (FString 인자)
+		const auto LookupLoop = [&](int32 InThread, const auto& InLookup)
+			{
+				int32 Sum = 0;
+				uint32 Cursor = static_cast<uint32>(InThread) * 7919u;
+				for (int32 i = 0; i < LookupsPerThread; ++i)
+				{
+					Sum += InLookup(LookupStrings[Cursor++ & (LookupStringCount - 1)]);
+				}
+				return Sum;
+			};
+		const double LegacyLookupMs = RunThreads([&](int32 InThread)
+			{
+				return LookupLoop(InThread, [&](const FString& InName) { return LookupLegacy.FindOrAdd(InName); });
+			});
+		const double LookupMs = RunThreads([&](int32 InThread)
+			{
+				return LookupLoop(InThread, [](const FString& InName) { return FName(InName).ComparisonIndex; });
+			});
+
+		// 문자열 리터럴: 이전 방식(FString 변환 + 소문자 복사) / const char* / 컴파일 타임 해시
+		const double LegacyLiteralMs = RunThreads([&](int32)
+			{
+				int32 Sum = 0;
+				for (int32 i = 0; i < LookupsPerThread; ++i)
+				{
+					Sum += LookupLegacy.FindOrAdd("StaticMeshComponent");
+				}
+				return Sum;
+			});
+		const double LiteralMs = RunThreads([&](int32)
+			{
+				int32 Sum = 0;
+				for (int32 i = 0; i < LookupsPerThread; ++i)
+				{
+					Sum += FName("StaticMeshComponent").ComparisonIndex;
+				}
+				return Sum;
+			});
+		const double HashedLiteralMs = RunThreads([&](int32)
+			{
+				int32 Sum = 0;
+				for (int32 i = 0; i < LookupsPerThread; ++i)
+				{
+					Sum += NAME_LITERAL("StaticMeshComponent").ComparisonIndex;
+				}
+				return Sum;
+			});
+
+		const double InsertOps = static_cast<double>(InsertsPerThread) * Threads;
+		const double LookupOps = static_cast<double>(LookupsPerThread) * Threads;
+		UE_LOG_INFO("  %u thread(s)", Threads);
+		UE_LOG_INFO("    insert new: legacy            | %8.2f ms | %7.2f Mops/s", LegacyInsertMs, GetMops(InsertOps, LegacyInsertMs));
+		UE_LOG_INFO("    insert new: sharded table     | %8.2f ms | %7.2f Mops/s (x%.1f)", InsertMs, GetMops(InsertOps, InsertMs),
+			LegacyInsertMs / std::max(InsertMs, 1e-6));
+		UE_LOG_INFO("    lookup FString: legacy        | %8.2f ms | %7.2f Mops/s", LegacyLookupMs, GetMops(LookupOps, LegacyLookupMs));
+		UE_LOG_INFO("    lookup FString: lock-free     | %8.2f ms | %7.2f Mops/s (x%.1f)", LookupMs, GetMops(LookupOps, LookupMs),
+			LegacyLookupMs / std::max(LookupMs, 1e-6));
+		UE_LOG_INFO("    literal: legacy               | %8.2f ms | %7.2f Mops/s", LegacyLiteralMs, GetMops(LookupOps, LegacyLiteralMs));
+		UE_LOG_INFO("    literal: const char*          | %8.2f ms | %7.2f Mops/s (x%.1f)", LiteralMs, GetMops(LookupOps, LiteralMs),
+			LegacyLiteralMs / std::max(LiteralMs, 1e-6));
+		UE_LOG_INFO("    literal: NAME_LITERAL         | %8.2f ms | %7.2f Mops/s (x%.1f)", HashedLiteralMs, GetMops(LookupOps, HashedLiteralMs),
+			LegacyLiteralMs / std::max(HashedLiteralMs, 1e-6));
+	}
+}
+
+void FEngineBenchmark::RunObjectIteration()
+{
+	constexpr int32 ObjectCount = 200'000;
+	constexpr int32 MeshComponentEvery = 100;		// 1%가 메시 컴포넌트
+	constexpr int32 SessionCycles = 8;				// PIE 시작/종료 횟수
+	constexpr int32 RecreateEvery = 4;				// 주기마다 4개 중 1개를 파괴하고 다시 생성
+	constexpr int32 Repeat = 20;
+
+	// 이전 GetUObjectArray(): 생성 순서대로 붙이기만 하고 파괴된 자리는 nullptr로 남긴다
+	TArray<UObject*> LegacyArray;
+	TArray<UObject*> Objects(ObjectCount, nullptr);
+	TArray<size_t> LegacyIndices(ObjectCount, 0);
+
+	const auto CreateObject = [&](int32 InSlot)
+		{
+			UObject* Object;
+			if (InSlot % MeshComponentEvery == 0)
+			{
+				Object = new UBenchmarkMeshComponent();
+			}
+			else
+			{
+				switch (InSlot & 3)
+				{
+				case 0: Object = new UObject(); break;
+				case 1: Object = new UBenchmarkComponent(); break;
+				case 2: Object = new UBenchmarkSceneComponent(); break;
+				default: Object = new UBenchmarkPrimitiveComponent(); break;
+				}
+			}
+			Objects[InSlot] = Object;
+			LegacyIndices[InSlot] = LegacyArray.size();
+			LegacyArray.push_back(Object);
+		};
+	const auto DestroyObject = [&](int32 InSlot)
+		{
+			LegacyArray[LegacyIndices[InSlot]] = nullptr;
+			delete Objects[InSlot];
+			Objects[InSlot] = nullptr;
+		};
+
+	for (int32 i = 0; i < ObjectCount; ++i)
+	{
+		CreateObject(i);
+	}
+	for (int32 Cycle = 0; Cycle < SessionCycles; ++Cycle)
+	{
+		for (int32 i = Cycle % RecreateEvery; i < ObjectCount; i += RecreateEvery)
+		{
+			DestroyObject(i);
+			CreateObject(i);
+		}
+	}
+
+	// 이전 방식: 배열 전체를 훑으며 Cast<T> (슈퍼클래스 체인 비교)
+	const auto LegacyCollect = [&](auto* InTypeTag, TArray<UObject*>& OutObjects)
+		{
+			using TObject = std::remove_pointer_t<decltype(InTypeTag)>;
+			OutObjects.clear();
+			for (UObject* Object : LegacyArray)
+			{
+				if (TObject* Match = Cast<TObject>(Object))
+				{
+					OutObjects.push_back(Match);
+				}
+			}
+		};
+	const auto IteratorCollect = [&](auto* InTypeTag, TArray<UObject*>& OutObjects)
+		{
+			using TObject = std::remove_pointer_t<decltype(InTypeTag)>;
+			OutObjects.clear();
+			for (TObjectIterator<TObject> It; It; ++It)
+			{
+				if (TObject* Match = *It)
+				{
+					OutObjects.push_back(Match);
+				}
+			}
+		};
+	const auto SameObjects = [](TArray<UObject*> InLhs, TArray<UObject*> InRhs)
+		{
+			std::sort(InLhs.begin(), InLhs.end());
+			std::sort(InRhs.begin(), InRhs.end());
+			return InLhs == InRhs;
+		};
+
+	TArray<UObject*> LegacyObjects;
+	TArray<UObject*> IteratedObjects;
+
+	// 첫 순회는 세션 동안 생성된 오브젝트를 클래스 리스트에 넣는 비용을 포함한다
+	const double FirstIterationMs = MeasureBestMilliseconds(1, [&]() { IteratorCollect(static_cast<UBenchmarkMeshComponent*>(nullptr), IteratedObjects); });
+
+	UE_LOG_SYSTEM("Benchmark: Object Iteration (%d live objects, 1/%d mesh components, %d session cycles recreating 1/%d)",
+		ObjectCount, MeshComponentEvery, SessionCycles, RecreateEvery);
+	UE_LOG_INFO("  object array slots: legacy %zu | chunked + free list %u (%u live)",
+		LegacyArray.size(), FUObjectArray::Get().GetNumSlots(), FUObjectArray::Get().GetNumObjects());
+	UE_LOG_INFO("  first iteration (binds new objects)      | %8.3f ms", FirstIterationMs);
+
+	const auto Compare = [&](const char* InLabel, auto* InTypeTag)
+		{
+			const double LegacyMs = MeasureBestMilliseconds(Repeat, [&]() { LegacyCollect(InTypeTag, LegacyObjects); });
+			const double IteratorMs = MeasureBestMilliseconds(Repeat, [&]() { IteratorCollect(InTypeTag, IteratedObjects); });
+			UE_LOG_INFO("  %-14s: legacy scan + Cast      | %8.3f ms | %zu matches", InLabel, LegacyMs, LegacyObjects.size());
+			UE_LOG_INFO("  %-14s: class lists             | %8.3f ms (x%.1f) | %zu matches | %s", InLabel, IteratorMs,
+				LegacyMs / std::max(IteratorMs, 1e-6), IteratedObjects.size(), SameObjects(LegacyObjects, IteratedObjects) ? "ok" : "MISMATCH");
+		};
+	Compare("mesh comps", static_cast<UBenchmarkMeshComponent*>(nullptr));
+	Compare("all comps", static_cast<UBenchmarkComponent*>(nullptr));
+
+	for (int32 i = 0; i < ObjectCount; ++i)
+	{
+		DestroyObject(i);
+	}
+}
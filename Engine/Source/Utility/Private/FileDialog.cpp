@@ -12,6 +12,7 @@
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Global/Macro.h"
 #include "Level/Public/Level.h"
+#include "Manager/Asset/Public/AssetManager.h"
 #include "Manager/Level/Public/LevelManager.h"
 #include "Utility/Public/FileDialog.h"
 
@@ -105,6 +106,9 @@ bool OpenObjFromFileDialog()
 		return false;
 	}
 
+	// 파일을 고르는 동안 진행된 비동기 로딩의 나머지를 마저 끝내 모든 메시를 목록에서 찾을 수 있게 한다
+	UAssetManager::GetInstance().FlushStaticMeshLoading();
+
 	for (TObjectIterator<UStaticMesh> It; It; ++It)
 	{
 		UStaticMesh* MeshInList = *It;
@@ -0,0 +1,450 @@
+#include "pch.h"
+#include "Utility/Public/MeshOptimizer.h"
+
+namespace
+{
+	constexpr uint32 INVALID_INDEX = 0xFFFFFFFFu;
+
+	// 정점 페치 시뮬레이션: 64바이트 라인 64개(4KB)짜리 FIFO 캐시
+	constexpr uint32 FetchLineSize = 64;
+	constexpr uint32 FetchCacheLines = 64;
+
+	/**
+	 * @brief 타임스탬프 기반 FIFO 정점 캐시
+	 * 정점이 들어온 시각만 기록하고, 그 뒤로 CacheSize번 이상 다른 정점이 들어왔으면 밀려난 것으로 본다
+	 */
+	struct FFifoCache
+	{
+		TArray<uint32> Timestamps;
+		uint32 CacheSize;
+		uint32 Time;
+
+		FFifoCache(uint32 InNumVertices, uint32 InCacheSize)
+			: Timestamps(InNumVertices, 0), CacheSize(InCacheSize), Time(InCacheSize + 1)
+		{
+		}
+
+		bool IsCached(uint32 InVertex) const { return Time - Timestamps[InVertex] <= CacheSize; }
+
+		// 미스면 캐시에 넣고 true
+		bool Access(uint32 InVertex)
+		{
+			if (IsCached(InVertex))
+			{
+				return false;
+			}
+			Timestamps[InVertex] = Time++;
+			return true;
+		}
+
+		// 캐시를 비운다 (다음 접근은 모두 미스)
+		void Flush() { Time += CacheSize + 1; }
+	};
+
+	/**
+	 * @brief 범위 안 삼각형의 정점 → 삼각형 인접 목록 (CSR)
+	 * 삼각형 번호는 범위 시작 기준, 정점 번호는 전역
+	 */
+	struct FTriangleAdjacency
+	{
+		TArray<uint32> Offsets;		// 정점별 시작 위치 (NumVertices + 1)
+		TArray<uint32> Triangles;
+		TArray<uint32> LiveCounts;	// 아직 출력되지 않은 인접 삼각형 수
+
+		void Build(const uint32* InIndices, uint32 InNumTriangles, uint32 InNumVertices)
+		{
+			Offsets.assign(InNumVertices + 1, 0);
+			for (uint32 Index = 0; Index < InNumTriangles * 3; ++Index)
+			{
+				++Offsets[InIndices[Index] + 1];
+			}
+			for (uint32 Vertex = 0; Vertex < InNumVertices; ++Vertex)
+			{
+				Offsets[Vertex + 1] += Offsets[Vertex];
+			}
+
+			Triangles.resize(InNumTriangles * 3);
+			TArray<uint32> Cursor(Offsets.begin(), Offsets.end() - 1);
+			for (uint32 Triangle = 0; Triangle < InNumTriangles; ++Triangle)
+			{
+				for (uint32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Triangles[Cursor[InIndices[Triangle * 3 + Corner]]++] = Triangle;
+				}
+			}
+
+			LiveCounts.resize(InNumVertices);
+			for (uint32 Vertex = 0; Vertex < InNumVertices; ++Vertex)
+			{
+				LiveCounts[Vertex] = Offsets[Vertex + 1] - Offsets[Vertex];
+			}
+		}
+	};
+
+	/**
+	 * @brief 삼각형 순서를 유지하며 캐시 미스가 세 정점 모두인 곳(하드 경계)과
+	 * 그 안에서 누적 ACMR이 임계값 이하로 떨어지는 곳(소프트 경계)에서 클러스터를 나눈다 (Sander et al. 2007, 4절)
+	 * @return 클러스터 시작 삼각형 번호 (오름차순, 첫 원소 0)
+	 */
+	TArray<uint32> BuildClusters(const uint32* InIndices, uint32 InNumTriangles, uint32 InNumVertices, float InThreshold,
+		uint32 InCacheSize)
+	{
+		// 하드 경계
+		TArray<uint32> HardClusters;
+		{
+			FFifoCache Cache(InNumVertices, InCacheSize);
+			for (uint32 Triangle = 0; Triangle < InNumTriangles; ++Triangle)
+			{
+				uint32 Misses = 0;
+				for (uint32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Misses += Cache.Access(InIndices[Triangle * 3 + Corner]) ? 1 : 0;
+				}
+				if (Triangle == 0 || Misses == 3)
+				{
+					HardClusters.push_back(Triangle);
+				}
+			}
+		}
+		HardClusters.push_back(InNumTriangles);
+
+		// 소프트 경계: 하드 클러스터 안에서 새로 시작했을 때의 누적 ACMR이 클러스터 평균 * 임계값 이하면 자른다
+		TArray<uint32> Clusters;
+		FFifoCache Cache(InNumVertices, InCacheSize);
+		for (size_t HardIndex = 0; HardIndex + 1 < HardClusters.size(); ++HardIndex)
+		{
+			const uint32 Begin = HardClusters[HardIndex];
+			const uint32 End = HardClusters[HardIndex + 1];
+
+			Cache.Flush();
+			uint32 ClusterMisses = 0;
+			for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+			{
+				for (uint32 Corner = 0; Corner < 3; ++Corner)
+				{
+					ClusterMisses += Cache.Access(InIndices[Triangle * 3 + Corner]) ? 1 : 0;
+				}
+			}
+			const float ClusterThreshold = InThreshold * static_cast<float>(ClusterMisses) / static_cast<float>(End - Begin);
+
+			Clusters.push_back(Begin);
+			Cache.Flush();
+			uint32 Start = Begin;
+			uint32 Misses = 0;
+			for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+			{
+				for (uint32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Misses += Cache.Access(InIndices[Triangle * 3 + Corner]) ? 1 : 0;
+				}
+
+				if (Triangle + 1 < End && static_cast<float>(Misses) / static_cast<float>(Triangle - Start + 1) <= ClusterThreshold)
+				{
+					Start = Triangle + 1;
+					Clusters.push_back(Start);
+					Misses = 0;
+					Cache.Flush();
+				}
+			}
+		}
+
+		return Clusters;
+	}
+}
+
+void FMeshOptimizer::OptimizeStaticMesh(FStaticMesh& InOutMesh, float InOverdrawThreshold, FVertexCacheStatistics* OutBefore,
+	FVertexCacheStatistics* OutAfter)
+{
+	const uint32 NumVertices = static_cast<uint32>(InOutMesh.Vertices.size());
+	if (OutBefore)
+	{
+		*OutBefore = AnalyzeVertexCache(InOutMesh.Indices, NumVertices, sizeof(FNormalVertex));
+	}
+
+	if (InOutMesh.Indices.size() % 3 == 0 && !InOutMesh.Indices.empty())
+	{
+		// 섹션이 없으면 전체를 한 범위로 본다
+		TArray<FMeshSection> Ranges = InOutMesh.Sections;
+		if (Ranges.empty())
+		{
+			Ranges.push_back({ 0, static_cast<uint32>(InOutMesh.Indices.size()), 0 });
+		}
+
+		for (const FMeshSection& Range : Ranges)
+		{
+			if (Range.IndexCount % 3 != 0 || static_cast<size_t>(Range.StartIndex) + Range.IndexCount > InOutMesh.Indices.size())
+			{
+				continue;
+			}
+
+			OptimizeVertexCache(InOutMesh.Indices, NumVertices, Range.StartIndex, Range.IndexCount);
+			if (InOverdrawThreshold > 1.0f)
+			{
+				OptimizeOverdraw(InOutMesh.Vertices, InOutMesh.Indices, Range.StartIndex, Range.IndexCount, InOverdrawThreshold);
+			}
+		}
+
+		OptimizeVertexFetch(InOutMesh.Vertices, InOutMesh.Indices);
+	}
+
+	if (OutAfter)
+	{
+		*OutAfter = AnalyzeVertexCache(InOutMesh.Indices, static_cast<uint32>(InOutMesh.Vertices.size()), sizeof(FNormalVertex));
+	}
+}
+
+void FMeshOptimizer::OptimizeVertexCache(TArray<uint32>& InOutIndices, uint32 InNumVertices, uint32 InStartIndex, uint32 InIndexCount,
+	uint32 InCacheSize)
+{
+	const uint32 NumTriangles = InIndexCount / 3;
+	if (NumTriangles < 2)
+	{
+		return;
+	}
+
+	const uint32* Indices = InOutIndices.data() + InStartIndex;
+	FTriangleAdjacency Adjacency;
+	Adjacency.Build(Indices, NumTriangles, InNumVertices);
+
+	// 범위가 참조하는 정점을 처음 나온 순서로 (막다른 곳에서 다음 시작점을 찾는 순차 탐색용)
+	TArray<uint32> RangeVertices;
+	{
+		TArray<uint8> bIsListed(InNumVertices, 0);
+		for (uint32 Index = 0; Index < NumTriangles * 3; ++Index)
+		{
+			if (!bIsListed[Indices[Index]])
+			{
+				bIsListed[Indices[Index]] = 1;
+				RangeVertices.push_back(Indices[Index]);
+			}
+		}
+	}
+
+	TArray<uint32> Output;
+	Output.reserve(NumTriangles * 3);
+	TArray<uint8> bIsEmitted(NumTriangles, 0);
+	TArray<uint32> DeadEnds;
+	TArray<uint32> Candidates;
+	FFifoCache Cache(InNumVertices, InCacheSize);
+	size_t ScanCursor = 0;
+
+	uint32 Fanning = RangeVertices[0];
+	while (Fanning != INVALID_INDEX)
+	{
+		// 팬 정점의 남은 삼각형을 모두 출력
+		Candidates.clear();
+		for (uint32 Ref = Adjacency.Offsets[Fanning]; Ref < Adjacency.Offsets[Fanning + 1]; ++Ref)
+		{
+			const uint32 Triangle = Adjacency.Triangles[Ref];
+			if (bIsEmitted[Triangle])
+			{
+				continue;
+			}
+			bIsEmitted[Triangle] = 1;
+
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Vertex = Indices[Triangle * 3 + Corner];
+				Output.push_back(Vertex);
+				DeadEnds.push_back(Vertex);
+				Candidates.push_back(Vertex);
+				--Adjacency.LiveCounts[Vertex];
+				Cache.Access(Vertex);
+			}
+		}
+
+		// 다음 팬 정점: 남은 삼각형을 다 출력해도 캐시에 남아 있을 후보 중 가장 오래 캐시에 있던 것
+		Fanning = INVALID_INDEX;
+		int64 BestPriority = -1;
+		for (const uint32 Vertex : Candidates)
+		{
+			if (Adjacency.LiveCounts[Vertex] == 0)
+			{
+				continue;
+			}
+
+			int64 Priority = 0;
+			const int64 Age = static_cast<int64>(Cache.Time) - Cache.Timestamps[Vertex];
+			if (Age + 2 * static_cast<int64>(Adjacency.LiveCounts[Vertex]) <= static_cast<int64>(InCacheSize))
+			{
+				Priority = Age;
+			}
+			if (Priority > BestPriority)
+			{
+				BestPriority = Priority;
+				Fanning = Vertex;
+			}
+		}
+
+		if (Fanning != INVALID_INDEX)
+		{
+			continue;
+		}
+
+		// 막다른 곳: 최근 출력한 정점 중 남은 삼각형이 있는 것, 없으면 순차 탐색
+		while (!DeadEnds.empty())
+		{
+			const uint32 Vertex = DeadEnds.back();
+			DeadEnds.pop_back();
+			if (Adjacency.LiveCounts[Vertex] > 0)
+			{
+				Fanning = Vertex;
+				break;
+			}
+		}
+		while (Fanning == INVALID_INDEX && ScanCursor < RangeVertices.size())
+		{
+			if (Adjacency.LiveCounts[RangeVertices[ScanCursor]] > 0)
+			{
+				Fanning = RangeVertices[ScanCursor];
+			}
+			++ScanCursor;
+		}
+	}
+
+	std::copy(Output.begin(), Output.end(), InOutIndices.begin() + InStartIndex);
+}
+
+void FMeshOptimizer::OptimizeOverdraw(const TArray<FNormalVertex>& InVertices, TArray<uint32>& InOutIndices, uint32 InStartIndex,
+	uint32 InIndexCount, float InThreshold, uint32 InCacheSize)
+{
+	const uint32 NumTriangles = InIndexCount / 3;
+	if (NumTriangles < 2)
+	{
+		return;
+	}
+
+	uint32* Indices = InOutIndices.data() + InStartIndex;
+	const TArray<uint32> Clusters = BuildClusters(Indices, NumTriangles, static_cast<uint32>(InVertices.size()), InThreshold, InCacheSize);
+	if (Clusters.size() < 2)
+	{
+		return;
+	}
+
+	// 클러스터별 면적 가중 중심과 법선
+	struct FCluster
+	{
+		uint32 Begin;
+		uint32 End;
+		FVector Centroid;
+		FVector Normal;
+		float SortKey;
+	};
+
+	TArray<FCluster> ClusterList(Clusters.size());
+	FVector MeshCentroid(0.0f, 0.0f, 0.0f);
+	float MeshArea = 0.0f;
+	for (size_t ClusterIndex = 0; ClusterIndex < Clusters.size(); ++ClusterIndex)
+	{
+		FCluster& Cluster = ClusterList[ClusterIndex];
+		Cluster.Begin = Clusters[ClusterIndex];
+		Cluster.End = ClusterIndex + 1 < Clusters.size() ? Clusters[ClusterIndex + 1] : NumTriangles;
+		Cluster.Centroid = FVector(0.0f, 0.0f, 0.0f);
+		Cluster.Normal = FVector(0.0f, 0.0f, 0.0f);
+
+		float ClusterArea = 0.0f;
+		for (uint32 Triangle = Cluster.Begin; Triangle < Cluster.End; ++Triangle)
+		{
+			const FVector& P0 = InVertices[Indices[Triangle * 3 + 0]].Position;
+			const FVector& P1 = InVertices[Indices[Triangle * 3 + 1]].Position;
+			const FVector& P2 = InVertices[Indices[Triangle * 3 + 2]].Position;
+
+			// 길이가 면적의 두 배인 법선
+			const FVector AreaNormal = (P1 - P0).Cross(P2 - P0);
+			const float Area = AreaNormal.Length();
+			Cluster.Normal += AreaNormal;
+			Cluster.Centroid += (P0 + P1 + P2) * (Area / 3.0f);
+			ClusterArea += Area;
+		}
+
+		MeshCentroid += Cluster.Centroid;
+		MeshArea += ClusterArea;
+		Cluster.Centroid = ClusterArea > 0.0f ? Cluster.Centroid * (1.0f / ClusterArea) : InVertices[Indices[Cluster.Begin * 3]].Position;
+	}
+	MeshCentroid = MeshArea > 0.0f ? MeshCentroid * (1.0f / MeshArea) : ClusterList[0].Centroid;
+
+	// 중심에서 바깥을 향하는 클러스터일수록 먼저 (다른 면을 가릴 가능성이 높다)
+	for (FCluster& Cluster : ClusterList)
+	{
+		const float NormalLength = Cluster.Normal.Length();
+		Cluster.SortKey = NormalLength > 0.0f ? (Cluster.Centroid - MeshCentroid).Dot(Cluster.Normal) / NormalLength : 0.0f;
+	}
+	std::stable_sort(ClusterList.begin(), ClusterList.end(), [](const FCluster& A, const FCluster& B)
+		{
+			return A.SortKey > B.SortKey;
+		});
+
+	TArray<uint32> Sorted;
+	Sorted.reserve(NumTriangles * 3);
+	for (const FCluster& Cluster : ClusterList)
+	{
+		Sorted.insert(Sorted.end(), Indices + Cluster.Begin * 3, Indices + Cluster.End * 3);
+	}
+	std::copy(Sorted.begin(), Sorted.end(), Indices);
+}
+
+void FMeshOptimizer::OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices)
+{
+	TArray<uint32> Remap(InOutVertices.size(), INVALID_INDEX);
+	TArray<FNormalVertex> Reordered;
+	Reordered.reserve(InOutVertices.size());
+
+	for (uint32& Index : InOutIndices)
+	{
+		if (Remap[Index] == INVALID_INDEX)
+		{
+			Remap[Index] = static_cast<uint32>(Reordered.size());
+			Reordered.push_back(InOutVertices[Index]);
+		}
+		Index = Remap[Index];
+	}
+
+	InOutVertices = std::move(Reordered);
+}
+
+FVertexCacheStatistics FMeshOptimizer::AnalyzeVertexCache(const TArray<uint32>& InIndices, uint32 InNumVertices, uint32 InVertexSize,
+	uint32 InCacheSize)
+{
+	FVertexCacheStatistics Statistics;
+	Statistics.NumTriangles = static_cast<uint32>(InIndices.size() / 3);
+	if (InIndices.empty() || InNumVertices == 0)
+	{
+		return Statistics;
+	}
+
+	FFifoCache Cache(InNumVertices, InCacheSize);
+	TArray<uint8> bIsReferenced(InNumVertices, 0);
+
+	// 미스가 난 정점만 정점 버퍼에서 읽는다
+	const uint32 NumLines = static_cast<uint32>((static_cast<uint64>(InNumVertices) * InVertexSize + FetchLineSize - 1) / FetchLineSize);
+	FFifoCache LineCache(NumLines, FetchCacheLines);
+	uint64 FetchedBytes = 0;
+
+	for (const uint32 Vertex : InIndices)
+	{
+		if (!bIsReferenced[Vertex])
+		{
+			bIsReferenced[Vertex] = 1;
+			++Statistics.NumVertices;
+		}
+
+		if (!Cache.Access(Vertex))
+		{
+			continue;
+		}
+		++Statistics.NumTransformed;
+
+		const uint64 FirstLine = static_cast<uint64>(Vertex) * InVertexSize / FetchLineSize;
+		const uint64 LastLine = (static_cast<uint64>(Vertex) * InVertexSize + InVertexSize - 1) / FetchLineSize;
+		for (uint64 Line = FirstLine; Line <= LastLine; ++Line)
+		{
+			FetchedBytes += LineCache.Access(static_cast<uint32>(Line)) ? FetchLineSize : 0;
+		}
+	}
+
+	Statistics.ACMR = Statistics.NumTriangles > 0 ? static_cast<float>(Statistics.NumTransformed) / Statistics.NumTriangles : 0.0f;
+	Statistics.ATVR = static_cast<float>(Statistics.NumTransformed) / Statistics.NumVertices;
+	Statistics.Overfetch = static_cast<float>(static_cast<double>(FetchedBytes) /
+		(static_cast<double>(Statistics.NumVertices) * InVertexSize));
+	return Statistics;
+}
@@ -3,401 +3,1655 @@
 #include "Utility/Public/MeshSimplifier.h"
 #include "Component/Mesh/Public/StaticMesh.h"
 #include <queue>
-#include <unordered_map>
-#include <unordered_set>
 
-// Helper function to create a quadric matrix from a plane
-FMatrix QuadricFromPlane(const FVector& point, const FVector& normal)
+namespace
 {
-	// Plane equation: ax + by + cz + d = 0
-	float a = normal.X;
-	float b = normal.Y;
-	float c = normal.Z;
-	float d = -normal.Dot(point);
-
-	// Quadric matrix Q = [a b c d]^T * [a b c d]
-	return FMatrix(
-		a * a, a * b, a * c, a * d,
-		a * b, b * b, b * c, b * d,
-		a * c, b * c, c * c, c * d,
-		a * d, b * d, c * d, d * d
-	);
-}
+	constexpr uint32 INVALID_INDEX = 0xFFFFFFFFu;
 
-// Calculate quadric error for a point
-float CalculateQuadricError(const FVector& point, const FMatrix& quadric)
-{
-	// Error = [x y z 1] * Q * [x y z 1]^T
-	float x = point.X, y = point.Y, z = point.Z;
+	// Position vertex flags
+	constexpr uint8 VERTEX_ALIVE = 1 << 0;
+	constexpr uint8 VERTEX_LOCKED = 1 << 1;	// Non-manifold or complex border, never moved
+	constexpr uint8 VERTEX_BORDER = 1 << 2;	// On an open border, may only slide along it
 
-	// First multiply: [x y z 1] * Q
-	float qx = quadric.Data[0][0] * x + quadric.Data[1][0] * y + quadric.Data[2][0] * z + quadric.Data[3][0];
-	float qy = quadric.Data[0][1] * x + quadric.Data[1][1] * y + quadric.Data[2][1] * z + quadric.Data[3][1];
-	float qz = quadric.Data[0][2] * x + quadric.Data[1][2] * y + quadric.Data[2][2] * z + quadric.Data[3][2];
-	float qw = quadric.Data[0][3] * x + quadric.Data[1][3] * y + quadric.Data[2][3] * z + quadric.Data[3][3];
+	// Attribute scale as a fraction of the bounding diagonal: a unit change of the attribute weighs
+	// as much as moving the vertex off the surface by that fraction of the mesh size
+	constexpr double NormalWeight = 0.05;
+	constexpr double TexCoordWeight = 0.1;
 
-	// Second multiply: result * [x y z 1]^T
-	return qx * x + qy * y + qz * z + qw;
-}
+	// Weight of the constraint planes along open borders, seams and material boundaries (a face plane weighs 1)
+	constexpr double BoundaryWeight = 10.0;
 
-// Get shared face count between two vertices
-int GetSharedFaceCount(int v1, int v2, const TArray<UMeshSimplifier::FSimplifyFace>& faces)
-{
-	int sharedFaceCount = 0;
-	for (const auto& face : faces)
+	/**
+	 * @brief Symmetric 4x4 error quadric stored as its 10 unique coefficients.
+	 * Accumulated in double precision: summing many plane quadrics in float loses most of the
+	 * significant bits of the constant term on meshes far from the origin.
+	 */
+	struct FQuadric
+	{
+		double A00 = 0.0, A01 = 0.0, A02 = 0.0, A03 = 0.0;
+		double A11 = 0.0, A12 = 0.0, A13 = 0.0;
+		double A22 = 0.0, A23 = 0.0;
+		double A33 = 0.0;
+
+		// Quadric of the plane ax + by + cz + d = 0 (normal must be unit length)
+		static FQuadric FromPlane(double InA, double InB, double InC, double InD, double InWeight = 1.0)
+		{
+			FQuadric Q;
+			Q.A00 = InWeight * InA * InA; Q.A01 = InWeight * InA * InB; Q.A02 = InWeight * InA * InC; Q.A03 = InWeight * InA * InD;
+			Q.A11 = InWeight * InB * InB; Q.A12 = InWeight * InB * InC; Q.A13 = InWeight * InB * InD;
+			Q.A22 = InWeight * InC * InC; Q.A23 = InWeight * InC * InD;
+			Q.A33 = InWeight * InD * InD;
+			return Q;
+		}
+
+		FQuadric& operator+=(const FQuadric& InOther)
+		{
+			A00 += InOther.A00; A01 += InOther.A01; A02 += InOther.A02; A03 += InOther.A03;
+			A11 += InOther.A11; A12 += InOther.A12; A13 += InOther.A13;
+			A22 += InOther.A22; A23 += InOther.A23;
+			A33 += InOther.A33;
+			return *this;
+		}
+
+		FQuadric operator+(const FQuadric& InOther) const
+		{
+			FQuadric Result = *this;
+			Result += InOther;
+			return Result;
+		}
+
+		// Error = [x y z 1] * Q * [x y z 1]^T
+		double Evaluate(double InX, double InY, double InZ) const
+		{
+			return A00 * InX * InX + 2.0 * A01 * InX * InY + 2.0 * A02 * InX * InZ + 2.0 * A03 * InX
+				+ A11 * InY * InY + 2.0 * A12 * InY * InZ + 2.0 * A13 * InY
+				+ A22 * InZ * InZ + 2.0 * A23 * InZ
+				+ A33;
+		}
+
+		/**
+		 * @brief Position minimizing the quadric (solves the upper 3x3 system with Cramer's rule).
+		 * @return false when the system is (nearly) singular, e.g. for flat or straight-crease regions.
+		 */
+		bool SolveOptimal(double& OutX, double& OutY, double& OutZ) const
+		{
+			const double C00 = A11 * A22 - A12 * A12;
+			const double C01 = A02 * A12 - A01 * A22;
+			const double C02 = A01 * A12 - A02 * A11;
+			const double Det = A00 * C00 + A01 * C01 + A02 * C02;
+
+			// Relative threshold so the test does not depend on the mesh scale
+			const double Scale = A00 * A11 * A22;
+			if (std::abs(Det) <= 1e-6 * std::abs(Scale) || std::abs(Det) < 1e-30)
+			{
+				return false;
+			}
+
+			const double InvDet = 1.0 / Det;
+			const double C11 = A00 * A22 - A02 * A02;
+			const double C12 = A01 * A02 - A00 * A12;
+			const double C22 = A00 * A11 - A01 * A01;
+
+			OutX = -(C00 * A03 + C01 * A13 + C02 * A23) * InvDet;
+			OutY = -(C01 * A03 + C11 * A13 + C12 * A23) * InvDet;
+			OutZ = -(C02 * A03 + C12 * A13 + C22 * A23) * InvDet;
+			return true;
+		}
+	};
+
+	constexpr int32 NumAttributes = 5;	// Normal (3) + TexCoord (2)
+
+	/**
+	 * @brief Garland-Heckbert quadric over (position, normal, texcoord) of one wedge.
+	 * Each face adds the squared distance to its triangle's plane in R^8, so the error grows both when a
+	 * vertex leaves the surface and when its attributes stop matching the interpolation across the face.
+	 */
+	struct FAttributeQuadric
+	{
+		static constexpr int32 Dim = 3 + NumAttributes;
+		static constexpr int32 NumPacked = Dim * (Dim + 1) / 2;
+
+		double A[NumPacked] = {};	// Symmetric matrix, upper triangle row by row
+		double B[Dim] = {};
+		double C = 0.0;
+
+		static constexpr int32 PackedIndex(int32 InRow, int32 InCol)
+		{
+			return InRow <= InCol ? InRow * Dim - InRow * (InRow - 1) / 2 + (InCol - InRow) : PackedIndex(InCol, InRow);
+		}
+
+		// False for triangles that are degenerate in R^8
+		static bool FromTriangle(const double* InP0, const double* InP1, const double* InP2, FAttributeQuadric& OutQuadric)
+		{
+			double E1[Dim], E2[Dim];
+			double Length1 = 0.0;
+			for (int32 i = 0; i < Dim; ++i)
+			{
+				E1[i] = InP1[i] - InP0[i];
+				Length1 += E1[i] * E1[i];
+			}
+			if (Length1 < 1e-24) return false;
+			Length1 = std::sqrt(Length1);
+
+			double Projection = 0.0;
+			for (int32 i = 0; i < Dim; ++i)
+			{
+				E1[i] /= Length1;
+				E2[i] = InP2[i] - InP0[i];
+				Projection += E1[i] * E2[i];
+			}
+
+			double Length2 = 0.0;
+			for (int32 i = 0; i < Dim; ++i)
+			{
+				E2[i] -= Projection * E1[i];
+				Length2 += E2[i] * E2[i];
+			}
+			if (Length2 < 1e-24) return false;
+			Length2 = std::sqrt(Length2);
+
+			double P0E1 = 0.0, P0E2 = 0.0, P0P0 = 0.0;
+			for (int32 i = 0; i < Dim; ++i)
+			{
+				E2[i] /= Length2;
+				P0E1 += InP0[i] * E1[i];
+				P0E2 += InP0[i] * E2[i];
+				P0P0 += InP0[i] * InP0[i];
+			}
+
+			// A = I - e1 e1^T - e2 e2^T, b = (p.e1) e1 + (p.e2) e2 - p, c = p.p - (p.e1)^2 - (p.e2)^2
+			for (int32 Row = 0; Row < Dim; ++Row)
+			{
+				for (int32 Col = Row; Col < Dim; ++Col)
+				{
+					OutQuadric.A[PackedIndex(Row, Col)] = (Row == Col ? 1.0 : 0.0) - E1[Row] * E1[Col] - E2[Row] * E2[Col];
+				}
+				OutQuadric.B[Row] = P0E1 * E1[Row] + P0E2 * E2[Row] - InP0[Row];
+			}
+			OutQuadric.C = P0P0 - P0E1 * P0E1 - P0E2 * P0E2;
+			return true;
+		}
+
+		FAttributeQuadric& operator+=(const FAttributeQuadric& InOther)
+		{
+			for (int32 i = 0; i < NumPacked; ++i) A[i] += InOther.A[i];
+			for (int32 i = 0; i < Dim; ++i) B[i] += InOther.B[i];
+			C += InOther.C;
+			return *this;
+		}
+
+		double Evaluate(const double* InPoint) const
+		{
+			double Result = C;
+			for (int32 Row = 0; Row < Dim; ++Row)
+			{
+				double RowSum = A[PackedIndex(Row, Row)] * InPoint[Row];
+				for (int32 Col = Row + 1; Col < Dim; ++Col)
+				{
+					RowSum += 2.0 * A[PackedIndex(Row, Col)] * InPoint[Col];
+				}
+				Result += InPoint[Row] * (RowSum + 2.0 * B[Row]);
+			}
+			return Result;
+		}
+
+		/**
+		 * @brief Attributes minimizing the error with the position fixed (Cholesky solve of the 5x5 attribute block).
+		 * @param InOutPoint Position in [0, 3); the attributes are written to [3, Dim)
+		 */
+		bool SolveAttributes(double* InOutPoint) const
+		{
+			double M[NumAttributes][NumAttributes];
+			double Rhs[NumAttributes];
+			for (int32 Row = 0; Row < NumAttributes; ++Row)
+			{
+				for (int32 Col = 0; Col < NumAttributes; ++Col)
+				{
+					M[Row][Col] = A[PackedIndex(3 + Row, 3 + Col)];
+				}
+				Rhs[Row] = -B[3 + Row];
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					Rhs[Row] -= A[PackedIndex(Axis, 3 + Row)] * InOutPoint[Axis];
+				}
+			}
+
+			// In-place Cholesky (lower triangle)
+			for (int32 Col = 0; Col < NumAttributes; ++Col)
+			{
+				double Diagonal = M[Col][Col];
+				for (int32 k = 0; k < Col; ++k) Diagonal -= M[Col][k] * M[Col][k];
+				if (Diagonal <= 1e-12 * std::max(1.0, M[Col][Col])) return false;
+				Diagonal = std::sqrt(Diagonal);
+				M[Col][Col] = Diagonal;
+
+				for (int32 Row = Col + 1; Row < NumAttributes; ++Row)
+				{
+					double Value = M[Row][Col];
+					for (int32 k = 0; k < Col; ++k) Value -= M[Row][k] * M[Col][k];
+					M[Row][Col] = Value / Diagonal;
+				}
+			}
+
+			double Y[NumAttributes];
+			for (int32 Row = 0; Row < NumAttributes; ++Row)
+			{
+				double Value = Rhs[Row];
+				for (int32 k = 0; k < Row; ++k) Value -= M[Row][k] * Y[k];
+				Y[Row] = Value / M[Row][Row];
+			}
+			for (int32 Row = NumAttributes - 1; Row >= 0; --Row)
+			{
+				double Value = Y[Row];
+				for (int32 k = Row + 1; k < NumAttributes; ++k) Value -= M[k][Row] * InOutPoint[3 + k];
+				InOutPoint[3 + Row] = Value / M[Row][Row];
+			}
+			return true;
+		}
+	};
+
+	/**
+	 * @brief Edge collapse candidate (16 bytes, so the heap stays cache friendly).
+	 * Kept survives and Removed is merged into it. VersionSum is Versions[Kept] + Versions[Removed] at push time.
+	 * Versions only grow, so the sum matches the current one exactly when neither endpoint changed; otherwise
+	 * a newer entry exists and this one is dropped. The target position is not stored but recomputed for the
+	 * few entries that survive the check.
+	 */
+	struct FCollapseCandidate
+	{
+		float Cost;
+		uint32 Kept;
+		uint32 Removed;
+		uint32 VersionSum;
+
+		bool operator>(const FCollapseCandidate& Other) const
+		{
+			return Cost > Other.Cost;
+		}
+	};
+
+	// Wedge correspondence of one collapse: the faces around Removed that survive use Kept instead
+	struct FWedgePair
+	{
+		uint32 Removed;
+		uint32 Kept;
+	};
+
+	// One wedge removed in half-edge mode, with the index of the collapse that removed it
+	struct FWedgeCollapse
 	{
-		if (!face.bIsActive) continue;
+		uint32 Removed;
+		uint32 Kept;
+		uint32 Step;
+	};
+
+	/**
+	 * @brief Working state of one simplification run.
+	 *
+	 * Source vertices are "wedges": vertices at the same position (split by UV/normal seams) are welded into one
+	 * position vertex for the topology, while faces keep referencing their own wedge for the attributes.
+	 * A collapse moves a position vertex and maps every wedge of the removed vertex onto the wedge of the kept
+	 * vertex on the same side of any seam; collapses without such a one-to-one mapping (crossing or ending a seam)
+	 * are rejected, so seams survive. Open borders, seams and material boundaries add weighted constraint planes
+	 * so vertices on them may only slide along them.
+	 *
+	 * SimplifyToFaceCount can be called repeatedly with decreasing targets to take snapshots along the way.
+	 */
+	class FQuadricSimplifier
+	{
+	public:
+		/**
+		 * @param bInHalfEdgeCollapse Collapse onto one of the endpoints without touching its attributes
+		 * and record the collapse sequence (used for progressive meshes)
+		 */
+		explicit FQuadricSimplifier(const FStaticMesh& InMesh, bool bInHalfEdgeCollapse = false);
+
+		// Collapses edges in cost order until at most InTargetFaceCount faces remain (or no valid collapse is left)
+		void SimplifyToFaceCount(uint32 InTargetFaceCount);
+
+		// Compacts the surviving vertices/faces into a new mesh with one section per material section of the source
+		FStaticMesh* BuildMesh(const FStaticMesh& InOriginalMesh) const;
+
+		// Section group of each face and the material slot of each group
+		const TArray<uint32>& GetFaceSections() const { return FaceSections; }
+		const TArray<uint32>& GetSectionSlots() const { return SectionSlots; }
+
+		// Half-edge mode records
+		const TArray<FWedgeCollapse>& GetWedgeCollapses() const { return WedgeCollapses; }
+		const TArray<uint32>& GetFaceRemovedAt() const { return FaceRemovedAt; }	// INVALID_INDEX if still alive
+		const TArray<uint32>& GetFaceCounts() const { return FaceCounts; }			// Live faces after k collapses
+
+		bool IsFaceAlive(uint32 InFace) const { return FaceAlive[InFace] != 0; }
+
+	private:
+		void WeldPositions();
+		void AssignFaceSections(const FStaticMesh& InMesh);
+		void BuildIncidence();
+		void ComputeQuadrics();
+		void ClassifyEdges();
+		void PushInitialCandidates();
+
+		void AddConstraintPlane(uint32 InV0, uint32 InV1, uint32 InFace);
+		void GetAttributePoint(uint32 InWedge, const FVector& InPosition, double* OutPoint) const;
+
+		bool BuildWedgeMap(uint32 InKept, uint32 InRemoved, TArray<FWedgePair>& OutPairs) const;
+		FVector ComputeCollapsePosition(uint32 InKept, uint32 InRemoved) const;
+		double ComputeCollapseCost(uint32 InKept, uint32 InRemoved, const FVector& InPosition, const TArray<FWedgePair>& InPairs) const;
+		bool MakeCandidate(uint32 InA, uint32 InB, FCollapseCandidate& OutCandidate) const;
+		void PushCandidates(uint32 InVertex);
+
+		bool TryCollapse(const FCollapseCandidate& InCandidate);
+		bool IsCollapseValid(uint32 InKept, uint32 InRemoved, const FVector& InPosition);
+		bool WouldFlipFaces(uint32 InMoved, uint32 InOther, const FVector& InPosition) const;
+		void MergeWedgeAttributes(const FWedgePair& InPair, const FVector& InPosition, float InT);
+
+		void GatherNeighbors(uint32 InVertex, TArray<uint32>& OutNeighbors) const;
+		void CompactIncidence();
+
+		uint32 GetCornerWedge(uint32 InFace, uint32 InVertex) const;
+		bool HasCorner(uint32 InFace, uint32 InVertex) const;
+
+		bool IsVertexAlive(uint32 InVertex) const { return (VertexFlags[InVertex] & VERTEX_ALIVE) != 0; }
+		bool IsVertexLocked(uint32 InVertex) const { return (VertexFlags[InVertex] & VERTEX_LOCKED) != 0; }
+		bool IsVertexBorder(uint32 InVertex) const { return (VertexFlags[InVertex] & VERTEX_BORDER) != 0; }
+
+		// Wedges (source vertices)
+		TArray<FNormalVertex> Wedges;
+		TArray<uint32> WedgeVertex;
+		TArray<FAttributeQuadric> AttributeQuadrics;
+		double NormalScale = 1.0;
+		double TexCoordScale = 1.0;
 
-		bool hasV1 = (face.V[0] == v1 || face.V[1] == v1 || face.V[2] == v1);
-		bool hasV2 = (face.V[0] == v2 || face.V[1] == v2 || face.V[2] == v2);
+		// Position vertices
+		TArray<FVector> Positions;
+		TArray<FQuadric> Quadrics;
+		TArray<uint32> Versions;
+		TArray<uint8> VertexFlags;
+		TArray<uint32> VertexWedgeCounts;	// Upper bound of the wedges still used around each vertex
 
-		if (hasV1 && hasV2)
-			++sharedFaceCount;
+		// Face data (three corners per face)
+		TArray<uint32> Indices;		// Position vertex of each corner
+		TArray<uint32> CornerWedges;	// Wedge of each corner
+		TArray<uint32> FaceSections;
+		TArray<uint32> SectionSlots;
+		TArray<uint32> SectionFaceCounts;
+		TArray<uint8> FaceAlive;
+		uint32 NumAliveFaces = 0;
+
+		// Half-edge mode
+		bool bHalfEdgeCollapse = false;
+		TArray<FWedgeCollapse> WedgeCollapses;
+		TArray<uint32> FaceRemovedAt;
+		TArray<uint32> FaceCounts;
+
+		// Position vertex -> face incidence (CSR). A merged vertex gets a fresh range appended at the end.
+		TArray<uint32> FaceStart;
+		TArray<uint32> FaceCount;
+		TArray<uint32> FaceRefs;
+		size_t CompactFaceRefsSize = 0;
+
+		std::priority_queue<FCollapseCandidate, TArray<FCollapseCandidate>, std::greater<FCollapseCandidate>> Heap;
+
+		// Scratch buffers reused by every collapse
+		TArray<uint32> Neighbors0;
+		TArray<uint32> Neighbors1;
+		TArray<uint32> Neighbors2;
+		mutable TArray<FWedgePair> ScratchPairs;
+		mutable TArray<uint32> ScratchWedges;
+	};
+
+	FQuadricSimplifier::FQuadricSimplifier(const FStaticMesh& InMesh, bool bInHalfEdgeCollapse)
+		: Wedges(InMesh.Vertices)
+		, bHalfEdgeCollapse(bInHalfEdgeCollapse)
+	{
+		const uint32 NumWedges = static_cast<uint32>(Wedges.size());
+		const uint32 NumFaces = static_cast<uint32>(InMesh.Indices.size() / 3);
+
+		CornerWedges.assign(InMesh.Indices.begin(), InMesh.Indices.begin() + NumFaces * 3);
+		FaceAlive.assign(NumFaces, 1);
+
+		WeldPositions();
+		AssignFaceSections(InMesh);
+
+		// Degenerate or out-of-range faces take no part in the simplification
+		Indices.resize(CornerWedges.size());
+		NumAliveFaces = NumFaces;
+		for (uint32 Face = 0; Face < NumFaces; ++Face)
+		{
+			const uint32* Corners = &CornerWedges[Face * 3];
+			if (Corners[0] >= NumWedges || Corners[1] >= NumWedges || Corners[2] >= NumWedges)
+			{
+				FaceAlive[Face] = 0;
+				--NumAliveFaces;
+				continue;
+			}
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				Indices[Face * 3 + Corner] = WedgeVertex[Corners[Corner]];
+			}
+			const FVector& P0 = Positions[Indices[Face * 3 + 0]];
+			const FVector& P1 = Positions[Indices[Face * 3 + 1]];
+			const FVector& P2 = Positions[Indices[Face * 3 + 2]];
+			if (P0 == P1 || P1 == P2 || P2 == P0)
+			{
+				FaceAlive[Face] = 0;
+				--NumAliveFaces;
+			}
+		}
+
+		SectionFaceCounts.assign(SectionSlots.size(), 0);
+		TArray<uint8> bIsWedgeUsed(NumWedges, 0);
+		for (uint32 Face = 0; Face < NumFaces; ++Face)
+		{
+			if (!IsFaceAlive(Face)) continue;
+
+			++SectionFaceCounts[FaceSections[Face]];
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				bIsWedgeUsed[CornerWedges[Face * 3 + Corner]] = 1;
+			}
+		}
+
+		VertexWedgeCounts.assign(Positions.size(), 0);
+		for (uint32 Wedge = 0; Wedge < NumWedges; ++Wedge)
+		{
+			VertexWedgeCounts[WedgeVertex[Wedge]] += bIsWedgeUsed[Wedge];
+		}
+
+		if (bHalfEdgeCollapse)
+		{
+			FaceRemovedAt.assign(NumFaces, INVALID_INDEX);
+			FaceCounts.push_back(NumAliveFaces);
+		}
+
+		BuildIncidence();
+		ComputeQuadrics();
+		ClassifyEdges();
+		PushInitialCandidates();
 	}
-	return sharedFaceCount;
-}
 
-// Check if an edge is a boundary edge (shared by only one face)
-bool IsBoundaryEdge(int v1, int v2, const TArray<UMeshSimplifier::FSimplifyFace>& faces)
-{
-	return GetSharedFaceCount(v1, v2, faces) == 1;
-}
+	/**
+	 * @brief Welds wedges into position vertices.
+	 * Wedges with bit-identical positions are merged only when a face edge joins them to exactly one other face,
+	 * i.e. across UV/normal seams of a manifold surface. Coincident but separate surfaces (double-sided sheets,
+	 * stacked parts) stay apart instead of turning into non-manifold edges that would lock every vertex on them.
+	 */
+	void FQuadricSimplifier::WeldPositions()
+	{
+		const uint32 NumWedges = static_cast<uint32>(Wedges.size());
+		const uint32 NumFaces = static_cast<uint32>(CornerWedges.size() / 3);
 
-// Get common neighbors between two vertices
-TArray<int> GetCommonNeighbors(int v1, int v2, const std::vector<std::unordered_set<int>>& adjacency)
-{
-	TArray<int> commonNeighbors;
-	for (int neighbor : adjacency[v1])
+		// Position classes (exact match)
+		TArray<uint32> Order(NumWedges);
+		for (uint32 Wedge = 0; Wedge < NumWedges; ++Wedge) Order[Wedge] = Wedge;
+		std::sort(Order.begin(), Order.end(), [this](uint32 A, uint32 B)
+			{
+				const FVector& PA = Wedges[A].Position;
+				const FVector& PB = Wedges[B].Position;
+				if (PA.X != PB.X) return PA.X < PB.X;
+				if (PA.Y != PB.Y) return PA.Y < PB.Y;
+				if (PA.Z != PB.Z) return PA.Z < PB.Z;
+				return A < B;
+			});
+
+		TArray<uint32> PositionClass(NumWedges);
+		uint32 NumClasses = 0;
+		for (uint32 Index = 0; Index < NumWedges; ++Index)
+		{
+			if (Index > 0 && !(Wedges[Order[Index]].Position == Wedges[Order[Index - 1]].Position))
+			{
+				++NumClasses;
+			}
+			PositionClass[Order[Index]] = NumClasses;
+		}
+
+		// Face edges keyed by position class: (class pair, face * 3 + corner of the edge start)
+		TArray<TPair<uint64, uint32>> Edges;
+		Edges.reserve(CornerWedges.size());
+		for (uint32 Face = 0; Face < NumFaces; ++Face)
+		{
+			const uint32* Corners = &CornerWedges[Face * 3];
+			if (Corners[0] >= NumWedges || Corners[1] >= NumWedges || Corners[2] >= NumWedges) continue;
+			if (PositionClass[Corners[0]] == PositionClass[Corners[1]] || PositionClass[Corners[1]] == PositionClass[Corners[2]] ||
+				PositionClass[Corners[2]] == PositionClass[Corners[0]]) continue;
+
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				uint32 A = PositionClass[Corners[Corner]];
+				uint32 B = PositionClass[Corners[(Corner + 1) % 3]];
+				if (A > B) std::swap(A, B);
+				Edges.emplace_back((static_cast<uint64>(A) << 32) | B, Face * 3 + Corner);
+			}
+		}
+		std::sort(Edges.begin(), Edges.end());
+
+		// Union-find over wedges: merge the corner wedges of the two faces of every manifold edge
+		TArray<uint32> Parent(NumWedges);
+		for (uint32 Wedge = 0; Wedge < NumWedges; ++Wedge) Parent[Wedge] = Wedge;
+		auto Find = [&Parent](uint32 InWedge)
+			{
+				while (Parent[InWedge] != InWedge)
+				{
+					Parent[InWedge] = Parent[Parent[InWedge]];
+					InWedge = Parent[InWedge];
+				}
+				return InWedge;
+			};
+		auto WedgeAtClass = [this, &PositionClass](uint32 InFace, uint32 InClass)
+			{
+				const uint32* Corners = &CornerWedges[InFace * 3];
+				return PositionClass[Corners[0]] == InClass ? Corners[0] : (PositionClass[Corners[1]] == InClass ? Corners[1] : Corners[2]);
+			};
+
+		for (size_t First = 0; First < Edges.size();)
+		{
+			size_t Last = First;
+			while (Last < Edges.size() && Edges[Last].first == Edges[First].first) ++Last;
+
+			if (Last - First == 2)
+			{
+				const uint32 Face0 = Edges[First].second / 3;
+				const uint32 Face1 = Edges[First + 1].second / 3;
+				for (uint32 Class : { static_cast<uint32>(Edges[First].first >> 32), static_cast<uint32>(Edges[First].first & 0xFFFFFFFFu) })
+				{
+					const uint32 Root0 = Find(WedgeAtClass(Face0, Class));
+					const uint32 Root1 = Find(WedgeAtClass(Face1, Class));
+					if (Root0 != Root1)
+					{
+						Parent[std::max(Root0, Root1)] = std::min(Root0, Root1);
+					}
+				}
+			}
+			First = Last;
+		}
+
+		// Roots always carry the smallest wedge index of their set, so one pass in index order numbers them
+		WedgeVertex.resize(NumWedges);
+		for (uint32 Wedge = 0; Wedge < NumWedges; ++Wedge)
+		{
+			const uint32 Root = Find(Wedge);
+			if (Root == Wedge)
+			{
+				WedgeVertex[Wedge] = static_cast<uint32>(Positions.size());
+				Positions.push_back(Wedges[Wedge].Position);
+			}
+			else
+			{
+				WedgeVertex[Wedge] = WedgeVertex[Root];
+			}
+		}
+
+		const uint32 NumVertices = static_cast<uint32>(Positions.size());
+		Quadrics.resize(NumVertices);
+		Versions.assign(NumVertices, 0);
+		VertexFlags.assign(NumVertices, VERTEX_ALIVE);
+
+		// Attributes are scaled by the bounding diagonal so their error is measured in the same units as the geometry
+		double Diagonal = 1.0;
+		if (NumVertices > 0)
+		{
+			FVector Min = Positions[0], Max = Positions[0];
+			for (const FVector& Position : Positions)
+			{
+				Min.X = std::min(Min.X, Position.X); Max.X = std::max(Max.X, Position.X);
+				Min.Y = std::min(Min.Y, Position.Y); Max.Y = std::max(Max.Y, Position.Y);
+				Min.Z = std::min(Min.Z, Position.Z); Max.Z = std::max(Max.Z, Position.Z);
+			}
+			Diagonal = std::max(static_cast<double>((Max - Min).Length()), 1e-6);
+		}
+		NormalScale = NormalWeight * Diagonal;
+		TexCoordScale = TexCoordWeight * Diagonal;
+	}
+
+	/**
+	 * @brief Section group of every face. Faces not covered by any section form one extra group (material slot 0).
+	 */
+	void FQuadricSimplifier::AssignFaceSections(const FStaticMesh& InMesh)
 	{
-		if (adjacency[v2].count(neighbor) > 0 && neighbor != v1 && neighbor != v2)
-			commonNeighbors.push_back(neighbor);
+		const uint32 NumFaces = static_cast<uint32>(FaceAlive.size());
+		const uint32 UncoveredGroup = static_cast<uint32>(InMesh.Sections.size());
+		FaceSections.assign(NumFaces, UncoveredGroup);
+
+		for (uint32 Section = 0; Section < InMesh.Sections.size(); ++Section)
+		{
+			const FMeshSection& MeshSection = InMesh.Sections[Section];
+			SectionSlots.push_back(MeshSection.MaterialSlot);
+
+			const uint32 FirstFace = MeshSection.StartIndex / 3;
+			const uint32 LastFace = std::min(NumFaces, (MeshSection.StartIndex + MeshSection.IndexCount) / 3);
+			for (uint32 Face = FirstFace; Face < LastFace; ++Face)
+			{
+				FaceSections[Face] = Section;
+			}
+		}
+		SectionSlots.push_back(0);
 	}
-	return commonNeighbors;
-}
 
-// ULTRA-CONSERVATIVE: Check if any vertex is on boundary
-bool IsVertexOnBoundary(int vertexIndex, const TArray<UMeshSimplifier::FSimplifyFace>& faces,
-	const std::vector<std::unordered_set<int>>& adjacency)
-{
-	// Count how many faces each edge from this vertex appears in
-	for (int neighbor : adjacency[vertexIndex])
+	void FQuadricSimplifier::BuildIncidence()
 	{
-		int edgeFaceCount = GetSharedFaceCount(vertexIndex, neighbor, faces);
-		if (edgeFaceCount == 1) // Boundary edge found
-			return true;
+		const uint32 NumVertices = static_cast<uint32>(Positions.size());
+		const uint32 NumFaces = static_cast<uint32>(FaceAlive.size());
+
+		FaceStart.assign(NumVertices, 0);
+		FaceCount.assign(NumVertices, 0);
+
+		for (uint32 Face = 0; Face < NumFaces; ++Face)
+		{
+			if (!IsFaceAlive(Face)) continue;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				++FaceCount[Indices[Face * 3 + Corner]];
+			}
+		}
+
+		uint32 Offset = 0;
+		for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			FaceStart[Vertex] = Offset;
+			Offset += FaceCount[Vertex];
+			FaceCount[Vertex] = 0;
+		}
+
+		FaceRefs.resize(Offset);
+		for (uint32 Face = 0; Face < NumFaces; ++Face)
+		{
+			if (!IsFaceAlive(Face)) continue;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Vertex = Indices[Face * 3 + Corner];
+				FaceRefs[FaceStart[Vertex] + FaceCount[Vertex]++] = Face;
+			}
+		}
+		CompactFaceRefsSize = FaceRefs.size();
 	}
-	return false;
-}
 
-// Check if edge collapse is valid (maintains manifold and watertight properties)
-bool IsValidEdgeCollapse(int v1, int v2, const TArray<UMeshSimplifier::FSimplifyFace>& faces,
-	const std::vector<std::unordered_set<int>>& adjacency, const TArray<UMeshSimplifier::FSimplifyVertex>& vertices,
-	const FVector& newPosition)
-{
-	// ULTRA-CONSERVATIVE POLICY: Don't collapse any edge involving boundary vertices
-	if (IsVertexOnBoundary(v1, faces, adjacency) || IsVertexOnBoundary(v2, faces, adjacency))
-		return false;
+	void FQuadricSimplifier::GetAttributePoint(uint32 InWedge, const FVector& InPosition, double* OutPoint) const
+	{
+		const FNormalVertex& Wedge = Wedges[InWedge];
+		OutPoint[0] = InPosition.X;
+		OutPoint[1] = InPosition.Y;
+		OutPoint[2] = InPosition.Z;
+		OutPoint[3] = Wedge.Normal.X * NormalScale;
+		OutPoint[4] = Wedge.Normal.Y * NormalScale;
+		OutPoint[5] = Wedge.Normal.Z * NormalScale;
+		OutPoint[6] = Wedge.TexCoord.X * TexCoordScale;
+		OutPoint[7] = Wedge.TexCoord.Y * TexCoordScale;
+	}
 
-	int sharedFaceCount = GetSharedFaceCount(v1, v2, faces);
+	void FQuadricSimplifier::ComputeQuadrics()
+	{
+		AttributeQuadrics.resize(Wedges.size());
 
-	// Only allow interior edges (shared by exactly 2 faces)
-	if (sharedFaceCount != 2)
-		return false;
+		const uint32 NumFaces = static_cast<uint32>(FaceAlive.size());
+		for (uint32 Face = 0; Face < NumFaces; ++Face)
+		{
+			if (!IsFaceAlive(Face)) continue;
 
-	// Must have exactly 2 common neighbors to maintain manifold property
-	TArray<int> commonNeighbors = GetCommonNeighbors(v1, v2, adjacency);
-	if (commonNeighbors.size() != 2)
-		return false;
+			const FVector& P0 = Positions[Indices[Face * 3 + 0]];
+			const FVector& P1 = Positions[Indices[Face * 3 + 1]];
+			const FVector& P2 = Positions[Indices[Face * 3 + 2]];
 
-	// Note: Face inversion check removed for simplicity and safety
+			// Face normal in double precision
+			const double E1X = P1.X - P0.X, E1Y = P1.Y - P0.Y, E1Z = P1.Z - P0.Z;
+			const double E2X = P2.X - P0.X, E2Y = P2.Y - P0.Y, E2Z = P2.Z - P0.Z;
+			double NX = E1Y * E2Z - E1Z * E2Y;
+			double NY = E1Z * E2X - E1X * E2Z;
+			double NZ = E1X * E2Y - E1Y * E2X;
+			const double Length = std::sqrt(NX * NX + NY * NY + NZ * NZ);
+			if (Length < 1e-12) continue; // Skip degenerate faces
 
-	return true;
-}
+			NX /= Length; NY /= Length; NZ /= Length;
+			const double D = -(NX * P0.X + NY * P0.Y + NZ * P0.Z);
+			const FQuadric FaceQuadric = FQuadric::FromPlane(NX, NY, NZ, D);
 
-FStaticMesh* UMeshSimplifier::Simplify(const FStaticMesh* InOriginalMesh, float InTargetRatio)
-{
-	if (!InOriginalMesh || InTargetRatio <= 0.0f || InTargetRatio >= 1.0f)
+			Quadrics[Indices[Face * 3 + 0]] += FaceQuadric;
+			Quadrics[Indices[Face * 3 + 1]] += FaceQuadric;
+			Quadrics[Indices[Face * 3 + 2]] += FaceQuadric;
+
+			// The same face in position + attribute space, added to each corner's wedge
+			double Points[3][FAttributeQuadric::Dim];
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				GetAttributePoint(CornerWedges[Face * 3 + Corner], Positions[Indices[Face * 3 + Corner]], Points[Corner]);
+			}
+
+			FAttributeQuadric AttributeQuadric;
+			if (FAttributeQuadric::FromTriangle(Points[0], Points[1], Points[2], AttributeQuadric))
+			{
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					AttributeQuadrics[CornerWedges[Face * 3 + Corner]] += AttributeQuadric;
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Adds the plane through the edge perpendicular to the face to both endpoints (weighted),
+	 * which keeps them on the edge line without forbidding collapses along it.
+	 */
+	void FQuadricSimplifier::AddConstraintPlane(uint32 InV0, uint32 InV1, uint32 InFace)
 	{
-		return nullptr;
+		const FVector& P0 = Positions[Indices[InFace * 3 + 0]];
+		const FVector& P1 = Positions[Indices[InFace * 3 + 1]];
+		const FVector& P2 = Positions[Indices[InFace * 3 + 2]];
+		const FVector FaceNormal = (P1 - P0).Cross(P2 - P0);
+
+		const FVector& EdgeStart = Positions[InV0];
+		const FVector Edge = Positions[InV1] - EdgeStart;
+		FVector PlaneNormal = Edge.Cross(FaceNormal);
+		const float Length = PlaneNormal.Length();
+		if (Length < 1e-20f) return;
+		PlaneNormal = PlaneNormal * (1.0f / Length);
+
+		const double D = -(static_cast<double>(PlaneNormal.X) * EdgeStart.X + static_cast<double>(PlaneNormal.Y) * EdgeStart.Y +
+			static_cast<double>(PlaneNormal.Z) * EdgeStart.Z);
+		const FQuadric Constraint = FQuadric::FromPlane(PlaneNormal.X, PlaneNormal.Y, PlaneNormal.Z, D, BoundaryWeight);
+		Quadrics[InV0] += Constraint;
+		Quadrics[InV1] += Constraint;
+	}
+
+	/**
+	 * @brief Classifies every edge by the faces around it (local to each vertex's face list, O(sum of valence^2)).
+	 * - 1 face: open border. Endpoints become border vertices and get constraint planes.
+	 * - 2 faces with different wedges or material sections: seam / material boundary, constraint planes on both sides.
+	 * - 3+ faces: non-manifold, endpoints are locked.
+	 * Border vertices that do not have exactly two border edges (e.g. two borders touching at one vertex) are locked too.
+	 */
+	void FQuadricSimplifier::ClassifyEdges()
+	{
+		const uint32 NumVertices = static_cast<uint32>(Positions.size());
+		TArray<uint8> BorderEdgeCounts(NumVertices, 0);
+		TArray<TPair<uint32, uint32>> EdgeFaces;	// (other vertex, face)
+
+		for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			EdgeFaces.clear();
+			for (uint32 Ref = 0; Ref < FaceCount[Vertex]; ++Ref)
+			{
+				const uint32 Face = FaceRefs[FaceStart[Vertex] + Ref];
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					const uint32 Other = Indices[Face * 3 + Corner];
+					if (Other != Vertex)
+					{
+						EdgeFaces.emplace_back(Other, Face);
+					}
+				}
+			}
+			std::sort(EdgeFaces.begin(), EdgeFaces.end());
+
+			for (size_t First = 0; First < EdgeFaces.size();)
+			{
+				const uint32 Other = EdgeFaces[First].first;
+				size_t Last = First;
+				while (Last < EdgeFaces.size() && EdgeFaces[Last].first == Other) ++Last;
+				const size_t NumEdgeFaces = Last - First;
+
+				// Every edge is seen from both endpoints; classify it once
+				if (Vertex < Other)
+				{
+					if (NumEdgeFaces == 1)
+					{
+						VertexFlags[Vertex] |= VERTEX_BORDER;
+						VertexFlags[Other] |= VERTEX_BORDER;
+						BorderEdgeCounts[Vertex] = static_cast<uint8>(std::min(BorderEdgeCounts[Vertex] + 1, 255));
+						BorderEdgeCounts[Other] = static_cast<uint8>(std::min(BorderEdgeCounts[Other] + 1, 255));
+						AddConstraintPlane(Vertex, Other, EdgeFaces[First].second);
+					}
+					else if (NumEdgeFaces == 2)
+					{
+						const uint32 Face0 = EdgeFaces[First].second;
+						const uint32 Face1 = EdgeFaces[First + 1].second;
+						const bool bIsSeam = GetCornerWedge(Face0, Vertex) != GetCornerWedge(Face1, Vertex) ||
+							GetCornerWedge(Face0, Other) != GetCornerWedge(Face1, Other);
+						if (bIsSeam || FaceSections[Face0] != FaceSections[Face1])
+						{
+							AddConstraintPlane(Vertex, Other, Face0);
+							AddConstraintPlane(Vertex, Other, Face1);
+						}
+					}
+					else
+					{
+						VertexFlags[Vertex] |= VERTEX_LOCKED;
+						VertexFlags[Other] |= VERTEX_LOCKED;
+					}
+				}
+				First = Last;
+			}
+		}
+
+		for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			if (IsVertexBorder(Vertex) && BorderEdgeCounts[Vertex] != 2)
+			{
+				VertexFlags[Vertex] |= VERTEX_LOCKED;
+			}
+		}
 	}
 
-	// 1. Initialize internal data structures
-	TArray<FSimplifyVertex> vertices;
-	TArray<FSimplifyFace> faces;
+	uint32 FQuadricSimplifier::GetCornerWedge(uint32 InFace, uint32 InVertex) const
+	{
+		const uint32* Corners = &Indices[InFace * 3];
+		const int32 Corner = Corners[0] == InVertex ? 0 : (Corners[1] == InVertex ? 1 : 2);
+		return CornerWedges[InFace * 3 + Corner];
+	}
 
-	// Copy vertices
-	vertices.reserve(InOriginalMesh->Vertices.size());
-	for (const auto& v : InOriginalMesh->Vertices)
+	bool FQuadricSimplifier::HasCorner(uint32 InFace, uint32 InVertex) const
 	{
-		FSimplifyVertex sv;
-		sv.Position = v.Position;
-		sv.Normal = v.Normal;
-		sv.Color = v.Color;
-		sv.TexCoord = v.TexCoord;
-		sv.Quadric = FMatrix(); // Initialize to zero matrix
-		sv.bIsActive = true;
-		vertices.push_back(sv);
+		const uint32* Corners = &Indices[InFace * 3];
+		return Corners[0] == InVertex || Corners[1] == InVertex || Corners[2] == InVertex;
 	}
 
-	// Copy faces
-	faces.reserve(InOriginalMesh->Indices.size() / 3);
-	for (size_t i = 0; i < InOriginalMesh->Indices.size(); i += 3)
+	void FQuadricSimplifier::PushInitialCandidates()
 	{
-		FSimplifyFace sf;
-		sf.V[0] = InOriginalMesh->Indices[i];
-		sf.V[1] = InOriginalMesh->Indices[i + 1];
-		sf.V[2] = InOriginalMesh->Indices[i + 2];
-		sf.bIsActive = true;
-		faces.push_back(sf);
+		// Unique undirected edges between unlocked vertices
+		TArray<uint64> Edges;
+		Edges.reserve(static_cast<size_t>(NumAliveFaces) * 3);
+
+		const uint32 NumFaces = static_cast<uint32>(FaceAlive.size());
+		for (uint32 Face = 0; Face < NumFaces; ++Face)
+		{
+			if (!IsFaceAlive(Face)) continue;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				uint32 A = Indices[Face * 3 + Corner];
+				uint32 B = Indices[Face * 3 + (Corner + 1) % 3];
+				if (IsVertexLocked(A) || IsVertexLocked(B)) continue;
+				if (A > B) std::swap(A, B);
+				Edges.push_back((static_cast<uint64>(A) << 32) | B);
+			}
+		}
+
+		std::sort(Edges.begin(), Edges.end());
+		Edges.erase(std::unique(Edges.begin(), Edges.end()), Edges.end());
+
+		TArray<FCollapseCandidate> Candidates;
+		Candidates.reserve(Edges.size());
+		for (uint64 Edge : Edges)
+		{
+			FCollapseCandidate Candidate;
+			if (MakeCandidate(static_cast<uint32>(Edge >> 32), static_cast<uint32>(Edge & 0xFFFFFFFFu), Candidate))
+			{
+				Candidates.push_back(Candidate);
+			}
+		}
+
+		// Heapify once (O(n)) instead of pushing one by one
+		Heap = decltype(Heap)(std::greater<FCollapseCandidate>(), std::move(Candidates));
 	}
 
-	// Build adjacency information
-	std::vector<std::unordered_set<int>> adjacency(vertices.size());
-	for (const auto& face : faces)
+	/**
+	 * @brief Wedge mapping for merging InRemoved into InKept, taken from the faces that share the edge.
+	 * @return false if a wedge of InRemoved has no partner, two partners, or shares its partner with another wedge
+	 * (the collapse would cross or close a seam)
+	 */
+	bool FQuadricSimplifier::BuildWedgeMap(uint32 InKept, uint32 InRemoved, TArray<FWedgePair>& OutPairs) const
 	{
-		if (!face.bIsActive) continue;
+		OutPairs.clear();
+		for (uint32 Ref = 0; Ref < FaceCount[InRemoved]; ++Ref)
+		{
+			const uint32 Face = FaceRefs[FaceStart[InRemoved] + Ref];
+			if (!IsFaceAlive(Face) || !HasCorner(Face, InKept)) continue;
+
+			const uint32 RemovedWedge = GetCornerWedge(Face, InRemoved);
+			const uint32 KeptWedge = GetCornerWedge(Face, InKept);
+
+			bool bFound = false;
+			for (const FWedgePair& Pair : OutPairs)
+			{
+				if (Pair.Removed == RemovedWedge || Pair.Kept == KeptWedge)
+				{
+					if (Pair.Removed != RemovedWedge || Pair.Kept != KeptWedge) return false;
+					bFound = true;
+				}
+			}
+			if (!bFound)
+			{
+				OutPairs.push_back({ RemovedWedge, KeptWedge });
+			}
+		}
+
+		// A vertex without seams has one wedge, which the shared faces have just mapped
+		if (VertexWedgeCounts[InRemoved] == 1)
+		{
+			return OutPairs.size() == 1;
+		}
 
-		int v0 = face.V[0], v1 = face.V[1], v2 = face.V[2];
+		for (uint32 Ref = 0; Ref < FaceCount[InRemoved]; ++Ref)
+		{
+			const uint32 Face = FaceRefs[FaceStart[InRemoved] + Ref];
+			if (!IsFaceAlive(Face) || HasCorner(Face, InKept)) continue;
 
-		adjacency[v0].insert(v1); adjacency[v1].insert(v0);
-		adjacency[v1].insert(v2); adjacency[v2].insert(v1);
-		adjacency[v2].insert(v0); adjacency[v0].insert(v2);
+			const uint32 RemovedWedge = GetCornerWedge(Face, InRemoved);
+			const bool bMapped = std::any_of(OutPairs.begin(), OutPairs.end(),
+				[RemovedWedge](const FWedgePair& Pair) { return Pair.Removed == RemovedWedge; });
+			if (!bMapped) return false;
+		}
+		return !OutPairs.empty();
 	}
 
-	// 2. Calculate initial quadrics for each vertex
-	for (const auto& face : faces)
+	/**
+	 * @brief Target position: the kept endpoint in half-edge mode, otherwise the best of the optimal position,
+	 * the endpoints and the midpoint under the position quadric (face planes + constraint planes).
+	 */
+	FVector FQuadricSimplifier::ComputeCollapsePosition(uint32 InKept, uint32 InRemoved) const
 	{
-		if (!face.bIsActive) continue;
+		if (bHalfEdgeCollapse)
+		{
+			return Positions[InKept];
+		}
 
-		const FVector& p0 = vertices[face.V[0]].Position;
-		const FVector& p1 = vertices[face.V[1]].Position;
-		const FVector& p2 = vertices[face.V[2]].Position;
+		const FQuadric Combined = Quadrics[InKept] + Quadrics[InRemoved];
+		const FVector& P0 = Positions[InKept];
+		const FVector& P1 = Positions[InRemoved];
 
-		// Calculate face normal
-		FVector edge1 = p1 - p0;
-		FVector edge2 = p2 - p0;
-		FVector normal = edge1.Cross(edge2);
+		FVector BestPosition = (P0 + P1) * 0.5f;
+		double BestCost = Combined.Evaluate(BestPosition.X, BestPosition.Y, BestPosition.Z);
+
+		auto TryPosition = [&](double InX, double InY, double InZ)
+			{
+				const double Cost = Combined.Evaluate(InX, InY, InZ);
+				if (Cost < BestCost)
+				{
+					BestCost = Cost;
+					BestPosition = FVector(static_cast<float>(InX), static_cast<float>(InY), static_cast<float>(InZ));
+				}
+			};
 
-		if (normal.Length() < 1e-6f) continue; // Skip degenerate faces
-		normal.Normalize();
+		TryPosition(P0.X, P0.Y, P0.Z);
+		TryPosition(P1.X, P1.Y, P1.Z);
 
-		// Create quadric for this face
-		FMatrix faceQuadric = QuadricFromPlane(p0, normal);
+		double OptimalX, OptimalY, OptimalZ;
+		if (Combined.SolveOptimal(OptimalX, OptimalY, OptimalZ))
+		{
+			// Reject solutions that fly far away from the edge (ill-conditioned but not singular systems)
+			const double EdgeLength = (P1 - P0).Length();
+			const double DX = OptimalX - BestPosition.X, DY = OptimalY - BestPosition.Y, DZ = OptimalZ - BestPosition.Z;
+			if (DX * DX + DY * DY + DZ * DZ <= 4.0 * EdgeLength * EdgeLength)
+			{
+				TryPosition(OptimalX, OptimalY, OptimalZ);
+			}
+		}
 
-		// Add to each vertex's quadric
-		vertices[face.V[0]].Quadric += faceQuadric;
-		vertices[face.V[1]].Quadric += faceQuadric;
-		vertices[face.V[2]].Quadric += faceQuadric;
+		return BestPosition;
 	}
 
-	// 3. Create priority queue of edge collapse candidates
-	std::priority_queue<FCollapseCandidate, std::vector<FCollapseCandidate>, std::greater<FCollapseCandidate>> edgeQueue;
+	/**
+	 * @brief Position quadric error plus the attribute error of every wedge of the merged vertex.
+	 * Merged wedges use the summed quadric with attributes solved at the new position (half-edge mode keeps the
+	 * kept wedge's attributes); the other wedges of the kept vertex are evaluated as they are.
+	 */
+	double FQuadricSimplifier::ComputeCollapseCost(uint32 InKept, uint32 InRemoved, const FVector& InPosition,
+		const TArray<FWedgePair>& InPairs) const
+	{
+		double Cost = (Quadrics[InKept] + Quadrics[InRemoved]).Evaluate(InPosition.X, InPosition.Y, InPosition.Z);
+
+		double Point[FAttributeQuadric::Dim];
+		for (const FWedgePair& Pair : InPairs)
+		{
+			FAttributeQuadric Merged = AttributeQuadrics[Pair.Kept];
+			Merged += AttributeQuadrics[Pair.Removed];
+
+			GetAttributePoint(Pair.Kept, InPosition, Point);
+			if (!bHalfEdgeCollapse)
+			{
+				Merged.SolveAttributes(Point);
+			}
+			Cost += Merged.Evaluate(Point);
+		}
+
+		// Wedges of the kept vertex on the far side of a seam only see the position change
+		if (!bHalfEdgeCollapse && VertexWedgeCounts[InKept] > InPairs.size())
+		{
+			ScratchWedges.clear();
+			for (uint32 Ref = 0; Ref < FaceCount[InKept]; ++Ref)
+			{
+				const uint32 Face = FaceRefs[FaceStart[InKept] + Ref];
+				if (!IsFaceAlive(Face)) continue;
+
+				const uint32 Wedge = GetCornerWedge(Face, InKept);
+				const bool bMerged = std::any_of(InPairs.begin(), InPairs.end(), [Wedge](const FWedgePair& Pair) { return Pair.Kept == Wedge; });
+				if (!bMerged && std::find(ScratchWedges.begin(), ScratchWedges.end(), Wedge) == ScratchWedges.end())
+				{
+					ScratchWedges.push_back(Wedge);
+					GetAttributePoint(Wedge, InPosition, Point);
+					Cost += AttributeQuadrics[Wedge].Evaluate(Point);
+				}
+			}
+		}
+
+		return std::max(Cost, 0.0);
+	}
 
-	// Helper to add edge to queue
-	auto addEdgeToQueue = [&](int v1, int v2) {
-		if (v1 == v2) return;
-		if (!vertices[v1].bIsActive || !vertices[v2].bIsActive) return;
+	/**
+	 * @brief Picks the collapse direction (which endpoint survives) and evaluates it.
+	 * @return false if neither direction has a valid wedge mapping
+	 */
+	bool FQuadricSimplifier::MakeCandidate(uint32 InA, uint32 InB, FCollapseCandidate& OutCandidate) const
+	{
+		double BestCost = std::numeric_limits<double>::max();
+		for (int32 Direction = 0; Direction < 2; ++Direction)
+		{
+			const uint32 Kept = Direction == 0 ? InA : InB;
+			const uint32 Removed = Direction == 0 ? InB : InA;
+			if (!BuildWedgeMap(Kept, Removed, ScratchPairs)) continue;
 
-		// Combined quadric
-		FMatrix combinedQuadric = vertices[v1].Quadric + vertices[v2].Quadric;
+			const FVector Position = ComputeCollapsePosition(Kept, Removed);
+			const double Cost = ComputeCollapseCost(Kept, Removed, Position, ScratchPairs);
+			if (Cost < BestCost)
+			{
+				BestCost = Cost;
+				OutCandidate.Kept = Kept;
+				OutCandidate.Removed = Removed;
+			}
 
-		// SAFE POSITION: Use midpoint (simple and predictable)
-		FVector midpoint = (vertices[v1].Position + vertices[v2].Position) * 0.5f;
-		float error = CalculateQuadricError(midpoint, combinedQuadric);
+			// Away from seams both directions give the same position and cost
+			if (!bHalfEdgeCollapse) break;
+		}
 
-		FCollapseCandidate candidate;
-		candidate.V1 = v1;
-		candidate.V2 = v2;
-		candidate.Cost = error;
-		candidate.OptimalPosition = midpoint;
+		if (BestCost == std::numeric_limits<double>::max())
+		{
+			return false;
+		}
 
-		edgeQueue.push(candidate);
-		};
+		OutCandidate.Cost = static_cast<float>(BestCost);
+		OutCandidate.VersionSum = Versions[InA] + Versions[InB];
+		return true;
+	}
 
-	// Add all edges to queue
-	for (int i = 0; i < vertices.size(); ++i)
+	void FQuadricSimplifier::PushCandidates(uint32 InVertex)
 	{
-		if (!vertices[i].bIsActive) continue;
-		for (int neighbor : adjacency[i])
+		GatherNeighbors(InVertex, Neighbors0);
+		for (uint32 Neighbor : Neighbors0)
 		{
-			if (i < neighbor) // Avoid duplicate edges
+			FCollapseCandidate Candidate;
+			if (!IsVertexLocked(Neighbor) && MakeCandidate(InVertex, Neighbor, Candidate))
 			{
-				addEdgeToQueue(i, neighbor);
+				Heap.push(Candidate);
 			}
 		}
 	}
 
-	// 4. Perform edge collapses
-	int targetFaceCount = static_cast<int>(faces.size() * InTargetRatio);
+	void FQuadricSimplifier::GatherNeighbors(uint32 InVertex, TArray<uint32>& OutNeighbors) const
+	{
+		OutNeighbors.clear();
+		for (uint32 Ref = 0; Ref < FaceCount[InVertex]; ++Ref)
+		{
+			const uint32 Face = FaceRefs[FaceStart[InVertex] + Ref];
+			if (!IsFaceAlive(Face)) continue;
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Other = Indices[Face * 3 + Corner];
+				if (Other != InVertex && std::find(OutNeighbors.begin(), OutNeighbors.end(), Other) == OutNeighbors.end())
+				{
+					OutNeighbors.push_back(Other);
+				}
+			}
+		}
+	}
 
-	// Helper to count active faces accurately
-	auto countActiveFaces = [&]() -> int {
-		int count = 0;
-		for (const auto& face : faces)
+	/**
+	 * @brief True if moving InMoved to InPosition flips (or collapses to zero area) any of its faces
+	 * that do not also contain InOther (those disappear with the collapse).
+	 */
+	bool FQuadricSimplifier::WouldFlipFaces(uint32 InMoved, uint32 InOther, const FVector& InPosition) const
+	{
+		for (uint32 Ref = 0; Ref < FaceCount[InMoved]; ++Ref)
 		{
-			if (face.bIsActive) count++;
+			const uint32 Face = FaceRefs[FaceStart[InMoved] + Ref];
+			if (!IsFaceAlive(Face) || HasCorner(Face, InOther)) continue;
+
+			const uint32* Corners = &Indices[Face * 3];
+			const FVector& P0 = Positions[Corners[0]];
+			const FVector& P1 = Positions[Corners[1]];
+			const FVector& P2 = Positions[Corners[2]];
+			const FVector OldNormal = (P1 - P0).Cross(P2 - P0);
+
+			const FVector& Q0 = Corners[0] == InMoved ? InPosition : P0;
+			const FVector& Q1 = Corners[1] == InMoved ? InPosition : P1;
+			const FVector& Q2 = Corners[2] == InMoved ? InPosition : P2;
+			const FVector NewNormal = (Q1 - Q0).Cross(Q2 - Q0);
+
+			// Flipped, or rotated so far that the face nearly folds over
+			const float Dot = OldNormal.Dot(NewNormal);
+			if (Dot <= 0.0f || Dot * Dot < 0.04f * OldNormal.LengthSquared() * NewNormal.LengthSquared())
+			{
+				return true;
+			}
 		}
-		return count;
-	};
+		return false;
+	}
 
-	while (countActiveFaces() > targetFaceCount && !edgeQueue.empty())
+	/**
+	 * @brief Manifold-preserving collapse test.
+	 * An interior edge (two faces) needs exactly two common neighbours and must not join two border vertices;
+	 * a border edge (one face) needs exactly one. Every vertex must keep at least three neighbours, so closed parts
+	 * stop at a tetrahedron instead of vanishing, and no section may lose its last face. No remaining face may flip.
+	 */
+	bool FQuadricSimplifier::IsCollapseValid(uint32 InKept, uint32 InRemoved, const FVector& InPosition)
 	{
-		FCollapseCandidate candidate = edgeQueue.top();
-		edgeQueue.pop();
+		uint32 SharedFaces[2];
+		uint32 SharedFaceCount = 0;
+		for (uint32 Ref = 0; Ref < FaceCount[InRemoved]; ++Ref)
+		{
+			const uint32 Face = FaceRefs[FaceStart[InRemoved] + Ref];
+			if (IsFaceAlive(Face) && HasCorner(Face, InKept))
+			{
+				if (SharedFaceCount == 2)
+				{
+					return false;
+				}
+				SharedFaces[SharedFaceCount++] = Face;
+			}
+		}
+		if (SharedFaceCount == 0)
+		{
+			return false;
+		}
+		if (SharedFaceCount == 2 && IsVertexBorder(InKept) && IsVertexBorder(InRemoved))
+		{
+			return false;
+		}
+
+		for (uint32 Index = 0; Index < SharedFaceCount; ++Index)
+		{
+			const uint32 Section = FaceSections[SharedFaces[Index]];
+			const uint32 NumRemovedInSection = (SharedFaceCount == 2 && FaceSections[SharedFaces[1 - Index]] == Section) ? 2 : 1;
+			if (SectionFaceCounts[Section] <= NumRemovedInSection)
+			{
+				return false;
+			}
+		}
+
+		GatherNeighbors(InKept, Neighbors0);
+		GatherNeighbors(InRemoved, Neighbors1);
+
+		uint32 CommonCount = 0;
+		for (uint32 Neighbor : Neighbors0)
+		{
+			if (Neighbor != InRemoved && std::find(Neighbors1.begin(), Neighbors1.end(), Neighbor) != Neighbors1.end())
+			{
+				++CommonCount;
+				// The common neighbour loses the removed vertex from its ring
+				GatherNeighbors(Neighbor, Neighbors2);
+				if (Neighbors2.size() <= 3)
+				{
+					return false;
+				}
+			}
+		}
+		if (CommonCount != SharedFaceCount)
+		{
+			return false;
+		}
+		if (Neighbors0.size() + Neighbors1.size() - 2 - CommonCount < 3)
+		{
+			return false;
+		}
+
+		return !WouldFlipFaces(InKept, InRemoved, InPosition) && !WouldFlipFaces(InRemoved, InKept, InPosition);
+	}
 
-		int v1 = candidate.V1;
-		int v2 = candidate.V2;
+	/**
+	 * @brief Folds the removed wedge into the kept one. Attributes are the quadric optimum at the new position,
+	 * or the interpolation along the edge when that system is singular.
+	 */
+	void FQuadricSimplifier::MergeWedgeAttributes(const FWedgePair& InPair, const FVector& InPosition, float InT)
+	{
+		AttributeQuadrics[InPair.Kept] += AttributeQuadrics[InPair.Removed];
+		if (bHalfEdgeCollapse)
+		{
+			return;
+		}
 
-		// Check if edge is still valid
-		if (!vertices[v1].bIsActive || !vertices[v2].bIsActive) continue;
-		if (adjacency[v1].find(v2) == adjacency[v1].end()) continue;
+		FNormalVertex& Kept = Wedges[InPair.Kept];
+		const FNormalVertex& Removed = Wedges[InPair.Removed];
 
-		// Check if edge collapse is valid (maintains manifold and watertight properties)
-		if (!IsValidEdgeCollapse(v1, v2, faces, adjacency, vertices, candidate.OptimalPosition))
-			continue;
+		FVector NewNormal = Kept.Normal * (1.0f - InT) + Removed.Normal * InT;
+		FVector2 NewTexCoord = Kept.TexCoord * (1.0f - InT) + Removed.TexCoord * InT;
 
-		// Perform collapse: merge v2 into v1
-		vertices[v1].Position = candidate.OptimalPosition;
-		vertices[v1].Quadric = vertices[v1].Quadric + vertices[v2].Quadric;
+		double Point[FAttributeQuadric::Dim];
+		GetAttributePoint(InPair.Kept, InPosition, Point);
+		if (AttributeQuadrics[InPair.Kept].SolveAttributes(Point))
+		{
+			NewNormal = FVector(static_cast<float>(Point[3] / NormalScale), static_cast<float>(Point[4] / NormalScale),
+				static_cast<float>(Point[5] / NormalScale));
+			NewTexCoord = FVector2(static_cast<float>(Point[6] / TexCoordScale), static_cast<float>(Point[7] / TexCoordScale));
+		}
 
-		// CRITICAL: Interpolate vertex attributes (UV, Normal, Color)
-		// Safe normal interpolation for LH Z-up coordinate system
-		FVector newNormal = vertices[v1].Normal + vertices[v2].Normal;
-		if (newNormal.Length() > 1e-6f) // Avoid zero-length normals
+		if (NewNormal.Length() > 1e-6f) // Keep the surviving normal if they cancel out
 		{
-			newNormal.Normalize();
-			vertices[v1].Normal = newNormal;
+			NewNormal.Normalize();
+			Kept.Normal = NewNormal;
 		}
-		// If normals cancel out, keep original v1 normal
+		Kept.TexCoord = NewTexCoord;
+		Kept.Color = Kept.Color * (1.0f - InT) + Removed.Color * InT;
+		Kept.Position = InPosition;
+	}
 
-		vertices[v1].Color = (vertices[v1].Color + vertices[v2].Color) * 0.5f;
-		vertices[v1].TexCoord = (vertices[v1].TexCoord + vertices[v2].TexCoord) * 0.5f;
+	/**
+	 * @brief Merges the removed vertex into the kept one if the candidate is still current and the collapse is valid.
+	 */
+	bool FQuadricSimplifier::TryCollapse(const FCollapseCandidate& InCandidate)
+	{
+		const uint32 Kept = InCandidate.Kept;
+		const uint32 Removed = InCandidate.Removed;
 
-		vertices[v2].bIsActive = false;
+		// Lazy invalidation: a newer entry exists for this edge, or an endpoint is gone
+		if (!IsVertexAlive(Kept) || !IsVertexAlive(Removed) ||
+			Versions[Kept] + Versions[Removed] != InCandidate.VersionSum)
+		{
+			return false;
+		}
 
-		// Update faces: replace v2 with v1
-		for (auto& face : faces)
+		TArray<FWedgePair>& Pairs = ScratchPairs;
+		if (!BuildWedgeMap(Kept, Removed, Pairs))
 		{
-			if (!face.bIsActive) continue;
+			return false;
+		}
 
-			bool modified = false;
-			for (int j = 0; j < 3; ++j)
+		const FVector Position = ComputeCollapsePosition(Kept, Removed);
+		if (!IsCollapseValid(Kept, Removed, Position))
+		{
+			return false;
+		}
+
+		// Attribute interpolation parameter: projection of the new position onto the edge
+		const FVector Edge = Positions[Removed] - Positions[Kept];
+		const float EdgeLengthSquared = Edge.LengthSquared();
+		const float T = EdgeLengthSquared > 1e-20f
+			? std::clamp((Position - Positions[Kept]).Dot(Edge) / EdgeLengthSquared, 0.0f, 1.0f)
+			: 0.5f;
+
+		const uint32 Step = static_cast<uint32>(FaceCounts.empty() ? 0 : FaceCounts.size() - 1);
+		for (const FWedgePair& Pair : Pairs)
+		{
+			MergeWedgeAttributes(Pair, Position, T);
+			if (bHalfEdgeCollapse)
+			{
+				WedgeCollapses.push_back({ Pair.Removed, Pair.Kept, Step });
+			}
+		}
+
+		// Other wedges of the kept vertex move with it
+		for (uint32 Ref = 0; Ref < FaceCount[Kept]; ++Ref)
+		{
+			const uint32 Face = FaceRefs[FaceStart[Kept] + Ref];
+			if (IsFaceAlive(Face))
 			{
-				if (face.V[j] == v2)
+				Wedges[GetCornerWedge(Face, Kept)].Position = Position;
+			}
+		}
+
+		Positions[Kept] = Position;
+		Quadrics[Kept] += Quadrics[Removed];
+		VertexFlags[Kept] |= VertexFlags[Removed] & VERTEX_BORDER;
+		VertexWedgeCounts[Kept] += VertexWedgeCounts[Removed] - static_cast<uint32>(Pairs.size());
+		VertexFlags[Removed] &= ~VERTEX_ALIVE;
+		++Versions[Kept];
+
+		// Faces of the removed vertex: the shared faces die, the rest now reference the kept vertex and its wedges
+		for (uint32 Ref = 0; Ref < FaceCount[Removed]; ++Ref)
+		{
+			const uint32 Face = FaceRefs[FaceStart[Removed] + Ref];
+			if (!IsFaceAlive(Face)) continue;
+
+			if (HasCorner(Face, Kept))
+			{
+				FaceAlive[Face] = 0;
+				--NumAliveFaces;
+				--SectionFaceCounts[FaceSections[Face]];
+				if (bHalfEdgeCollapse)
 				{
-					face.V[j] = v1;
-					modified = true;
+					FaceRemovedAt[Face] = Step;
 				}
+				continue;
 			}
 
-			// Check for degenerate faces after modification
-			if (modified)
+			for (int32 Corner = 0; Corner < 3; ++Corner)
 			{
-				if (face.V[0] == face.V[1] || face.V[1] == face.V[2] || face.V[2] == face.V[0])
+				if (Indices[Face * 3 + Corner] != Removed) continue;
+
+				Indices[Face * 3 + Corner] = Kept;
+				uint32& Wedge = CornerWedges[Face * 3 + Corner];
+				for (const FWedgePair& Pair : Pairs)
 				{
-					face.bIsActive = false;
-					// Note: activeFaceCount is now calculated dynamically in the main loop
+					if (Pair.Removed == Wedge)
+					{
+						Wedge = Pair.Kept;
+						break;
+					}
 				}
 			}
 		}
 
-		// SIMPLE ADJACENCY UPDATE: Original method (safer)
-		// Update adjacency: move v2's neighbors to v1
-		std::vector<int> v2Neighbors(adjacency[v2].begin(), adjacency[v2].end());
-		for (int neighbor : v2Neighbors)
+		if (bHalfEdgeCollapse)
 		{
-			if (neighbor == v1) continue;
+			FaceCounts.push_back(NumAliveFaces);
+		}
 
-			// Remove v2 from neighbor's list
-			adjacency[neighbor].erase(v2);
+		// Append the merged face list of the kept vertex (live faces of both endpoints, no duplicates left)
+		if (FaceRefs.size() > CompactFaceRefsSize * 2)
+		{
+			CompactIncidence();
+		}
 
-			// Add v1 to neighbor's list and vice versa
-			adjacency[neighbor].insert(v1);
-			adjacency[v1].insert(neighbor);
+		const uint32 NewStart = static_cast<uint32>(FaceRefs.size());
+		for (uint32 Vertex : { Kept, Removed })
+		{
+			for (uint32 Ref = 0; Ref < FaceCount[Vertex]; ++Ref)
+			{
+				const uint32 Face = FaceRefs[FaceStart[Vertex] + Ref];
+				if (IsFaceAlive(Face))
+				{
+					FaceRefs.push_back(Face);
+				}
+			}
 		}
+		FaceStart[Kept] = NewStart;
+		FaceCount[Kept] = static_cast<uint32>(FaceRefs.size()) - NewStart;
+		FaceCount[Removed] = 0;
 
-		// Remove v2 from v1's adjacency and clear v2's adjacency
-		adjacency[v1].erase(v2);
-		adjacency[v2].clear();
+		// Re-evaluate the edges around the merged vertex
+		PushCandidates(Kept);
+		return true;
+	}
+
+	/**
+	 * @brief Rewrites the incidence arrays keeping only live faces so appended ranges do not grow without bound.
+	 */
+	void FQuadricSimplifier::CompactIncidence()
+	{
+		TArray<uint32> Compacted;
+		Compacted.reserve(static_cast<size_t>(NumAliveFaces) * 3);
 
-		// Add new edges to queue (v1's updated neighborhood)
-		for (int neighbor : adjacency[v1])
+		const uint32 NumVertices = static_cast<uint32>(Positions.size());
+		for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
 		{
-			if (!vertices[neighbor].bIsActive) continue;
-			// Only add edges that are actually valid
-			if (adjacency[neighbor].count(v1) > 0)
+			const uint32 NewStart = static_cast<uint32>(Compacted.size());
+			for (uint32 Ref = 0; Ref < FaceCount[Vertex]; ++Ref)
 			{
-				addEdgeToQueue(v1, neighbor);
+				const uint32 Face = FaceRefs[FaceStart[Vertex] + Ref];
+				if (IsFaceAlive(Face))
+				{
+					Compacted.push_back(Face);
+				}
 			}
+			FaceStart[Vertex] = NewStart;
+			FaceCount[Vertex] = static_cast<uint32>(Compacted.size()) - NewStart;
+		}
+
+		FaceRefs = std::move(Compacted);
+		CompactFaceRefsSize = std::max<size_t>(FaceRefs.size(), 64);
+	}
+
+	void FQuadricSimplifier::SimplifyToFaceCount(uint32 InTargetFaceCount)
+	{
+		while (NumAliveFaces > InTargetFaceCount && !Heap.empty())
+		{
+			const FCollapseCandidate Candidate = Heap.top();
+			Heap.pop();
+			TryCollapse(Candidate);
 		}
 	}
 
-	// 5. Build simplified mesh
-	FStaticMesh* simplifiedMesh = new FStaticMesh();
-	std::unordered_map<int, int> oldToNewIndex;
+	FStaticMesh* FQuadricSimplifier::BuildMesh(const FStaticMesh& InOriginalMesh) const
+	{
+		FStaticMesh* SimplifiedMesh = new FStaticMesh();
+
+		// Copy material info from original mesh
+		SimplifiedMesh->MaterialInfo = InOriginalMesh.MaterialInfo;
+
+		// Keep only wedges still referenced by a live face, in their original order
+		TArray<uint32> OldToNewIndex(Wedges.size(), INVALID_INDEX);
+		const uint32 NumFaces = static_cast<uint32>(FaceAlive.size());
+		for (uint32 Face = 0; Face < NumFaces; ++Face)
+		{
+			if (!IsFaceAlive(Face)) continue;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				OldToNewIndex[CornerWedges[Face * 3 + Corner]] = 0;
+			}
+		}
+
+		for (size_t Wedge = 0; Wedge < Wedges.size(); ++Wedge)
+		{
+			if (OldToNewIndex[Wedge] == INVALID_INDEX) continue;
+			OldToNewIndex[Wedge] = static_cast<uint32>(SimplifiedMesh->Vertices.size());
+			SimplifiedMesh->Vertices.push_back(Wedges[Wedge]);
+		}
+
+		// One section per source section that still has faces, in the source order
+		SimplifiedMesh->Indices.reserve(static_cast<size_t>(NumAliveFaces) * 3);
+		for (uint32 Section = 0; Section < SectionSlots.size(); ++Section)
+		{
+			const uint32 StartIndex = static_cast<uint32>(SimplifiedMesh->Indices.size());
+			for (uint32 Face = 0; Face < NumFaces; ++Face)
+			{
+				if (!IsFaceAlive(Face) || FaceSections[Face] != Section) continue;
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					SimplifiedMesh->Indices.push_back(OldToNewIndex[CornerWedges[Face * 3 + Corner]]);
+				}
+			}
+
+			const uint32 IndexCount = static_cast<uint32>(SimplifiedMesh->Indices.size()) - StartIndex;
+			if (IndexCount > 0)
+			{
+				FMeshSection MeshSection;
+				MeshSection.StartIndex = StartIndex;
+				MeshSection.IndexCount = IndexCount;
+				MeshSection.MaterialSlot = SectionSlots[Section];
+				SimplifiedMesh->Sections.push_back(MeshSection);
+			}
+		}
 
-	// Copy material info from original mesh
-	simplifiedMesh->MaterialInfo = InOriginalMesh->MaterialInfo;
+		return SimplifiedMesh;
+	}
+}
 
-	// Add active vertices
-	int newVertexIndex = 0;
-	for (int i = 0; i < vertices.size(); ++i)
+FStaticMesh* UMeshSimplifier::Simplify(const FStaticMesh* InOriginalMesh, float InTargetRatio)
+{
+	if (!InOriginalMesh || InTargetRatio <= 0.0f || InTargetRatio >= 1.0f)
 	{
-		if (vertices[i].bIsActive)
+		return nullptr;
+	}
+
+	const uint32 TargetFaceCount = static_cast<uint32>(InOriginalMesh->Indices.size() / 3 * InTargetRatio);
+
+	FQuadricSimplifier Simplifier(*InOriginalMesh);
+	Simplifier.SimplifyToFaceCount(TargetFaceCount);
+	return Simplifier.BuildMesh(*InOriginalMesh);
+}
+
+TArray<FStaticMesh*> UMeshSimplifier::SimplifyChain(const FStaticMesh* InOriginalMesh, const TArray<float>& InTargetRatios)
+{
+	TArray<FStaticMesh*> Result(InTargetRatios.size(), nullptr);
+	if (!InOriginalMesh)
+	{
+		return Result;
+	}
+
+	// Visit the requested ratios from the most detailed to the coarsest
+	TArray<size_t> Order;
+	for (size_t Index = 0; Index < InTargetRatios.size(); ++Index)
+	{
+		if (InTargetRatios[Index] > 0.0f && InTargetRatios[Index] < 1.0f)
 		{
-			FNormalVertex newVertex;
-			newVertex.Position = vertices[i].Position;
-			newVertex.Normal = vertices[i].Normal;
-			newVertex.Color = vertices[i].Color;
-			newVertex.TexCoord = vertices[i].TexCoord; // CRITICAL: Copy UV coordinates
+			Order.push_back(Index);
+		}
+	}
+	if (Order.empty())
+	{
+		return Result;
+	}
+	std::sort(Order.begin(), Order.end(), [&InTargetRatios](size_t A, size_t B) { return InTargetRatios[A] > InTargetRatios[B]; });
+
+	const size_t NumOriginalFaces = InOriginalMesh->Indices.size() / 3;
+	FQuadricSimplifier Simplifier(*InOriginalMesh);
+	for (size_t Index : Order)
+	{
+		Simplifier.SimplifyToFaceCount(static_cast<uint32>(NumOriginalFaces * InTargetRatios[Index]));
+		Result[Index] = Simplifier.BuildMesh(*InOriginalMesh);
+	}
+	return Result;
+}
+
+FProgressiveMesh* UMeshSimplifier::BuildProgressiveMesh(const FStaticMesh* InOriginalMesh)
+{
+	if (!InOriginalMesh || InOriginalMesh->Indices.size() < 3)
+	{
+		return nullptr;
+	}
+
+	FQuadricSimplifier Simplifier(*InOriginalMesh, true);
+	Simplifier.SimplifyToFaceCount(0);
+
+	const TArray<FWedgeCollapse>& WedgeCollapses = Simplifier.GetWedgeCollapses();
+	const TArray<uint32>& FaceRemovedAt = Simplifier.GetFaceRemovedAt();
+	const TArray<uint32>& FaceSections = Simplifier.GetFaceSections();
+	const TArray<uint32>& SectionSlots = Simplifier.GetSectionSlots();
+	const uint32 NumVertices = static_cast<uint32>(InOriginalMesh->Vertices.size());
+	const uint32 NumCollapses = static_cast<uint32>(Simplifier.GetFaceCounts().size()) - 1;
+
+	FProgressiveMesh* Progressive = new FProgressiveMesh();
+	Progressive->FaceCounts = Simplifier.GetFaceCounts();
+
+	// Vertex order: never-removed vertices first (in source order), then the removed ones from the last collapse to the first
+	TArray<uint32> OldToNew(NumVertices, INVALID_INDEX);
+	Progressive->VertexCounts.assign(NumCollapses + 1, NumVertices);
+	for (uint32 Index = 0; Index < WedgeCollapses.size(); ++Index)
+	{
+		OldToNew[WedgeCollapses[Index].Removed] = NumVertices - 1 - Index;
+		Progressive->VertexCounts[WedgeCollapses[Index].Step + 1] = NumVertices - 1 - Index;
+	}
+	for (uint32 Step = 1; Step <= NumCollapses; ++Step)
+	{
+		Progressive->VertexCounts[Step] = std::min(Progressive->VertexCounts[Step], Progressive->VertexCounts[Step - 1]);
+	}
 
-			simplifiedMesh->Vertices.push_back(newVertex);
-			oldToNewIndex[i] = newVertexIndex++;
+	uint32 NextIndex = 0;
+	for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		if (OldToNew[Vertex] == INVALID_INDEX)
+		{
+			OldToNew[Vertex] = NextIndex++;
 		}
 	}
 
-	// Add active faces
-	for (const auto& face : faces)
+	Progressive->Vertices.resize(NumVertices);
+	Progressive->CollapseTarget.assign(NumVertices, INVALID_INDEX);
+	for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		Progressive->Vertices[OldToNew[Vertex]] = InOriginalMesh->Vertices[Vertex];
+	}
+	for (const FWedgeCollapse& Collapse : WedgeCollapses)
 	{
-		if (!face.bIsActive) continue;
+		Progressive->CollapseTarget[OldToNew[Collapse.Removed]] = OldToNew[Collapse.Kept];
+	}
 
-		// Make sure all vertices are mapped
-		if (oldToNewIndex.find(face.V[0]) != oldToNewIndex.end() &&
-			oldToNewIndex.find(face.V[1]) != oldToNewIndex.end() &&
-			oldToNewIndex.find(face.V[2]) != oldToNewIndex.end())
+	// Face order: by section, then faces that survive every collapse, then by removing collapse from the last to the first
+	const uint32 NumFaces = static_cast<uint32>(FaceRemovedAt.size());
+	TArray<uint32> Faces;
+	Faces.reserve(Progressive->FaceCounts[0]);
+	for (uint32 Face = 0; Face < NumFaces; ++Face)
+	{
+		if (Simplifier.IsFaceAlive(Face) || FaceRemovedAt[Face] != INVALID_INDEX)
 		{
-			simplifiedMesh->Indices.push_back(oldToNewIndex[face.V[0]]);
-			simplifiedMesh->Indices.push_back(oldToNewIndex[face.V[1]]);
-			simplifiedMesh->Indices.push_back(oldToNewIndex[face.V[2]]);
+			Faces.push_back(Face);
 		}
 	}
+	std::stable_sort(Faces.begin(), Faces.end(), [&FaceRemovedAt, &FaceSections](uint32 A, uint32 B)
+		{
+			if (FaceSections[A] != FaceSections[B]) return FaceSections[A] < FaceSections[B];
+			// Never removed (INVALID_INDEX) sorts first
+			return FaceRemovedAt[A] > FaceRemovedAt[B];
+		});
 
-	// Create mesh sections based on original mesh
-	if (!simplifiedMesh->Indices.empty())
+	Progressive->Indices.reserve(Faces.size() * 3);
+	Progressive->FaceRemovedAt.reserve(Faces.size());
+	for (size_t Index = 0; Index < Faces.size(); ++Index)
 	{
-		if (!InOriginalMesh->Sections.empty())
+		const uint32 Face = Faces[Index];
+		if (Index == 0 || FaceSections[Face] != FaceSections[Faces[Index - 1]])
 		{
-			// Copy original sections structure (simplified mesh uses all indices in one section)
-			for (const auto& originalSection : InOriginalMesh->Sections)
-			{
-				FMeshSection section;
-				section.MaterialSlot = originalSection.MaterialSlot;
-				section.StartIndex = 0; // Simplified mesh has all indices together
-				section.IndexCount = simplifiedMesh->Indices.size();
-				simplifiedMesh->Sections.push_back(section);
-				break; // Use only the first section for now
-			}
+			FMeshSection MeshSection;
+			MeshSection.StartIndex = static_cast<uint32>(Index * 3);
+			MeshSection.IndexCount = 0;
+			MeshSection.MaterialSlot = SectionSlots[FaceSections[Face]];
+			Progressive->Sections.push_back(MeshSection);
 		}
-		else
+		Progressive->Sections.back().IndexCount += 3;
+
+		for (int32 Corner = 0; Corner < 3; ++Corner)
 		{
-			// Fallback: create default section
-			FMeshSection section;
-			section.MaterialSlot = 0;
-			section.StartIndex = 0;
-			section.IndexCount = simplifiedMesh->Indices.size();
-			simplifiedMesh->Sections.push_back(section);
+			Progressive->Indices.push_back(OldToNew[InOriginalMesh->Indices[Face * 3 + Corner]]);
 		}
+		Progressive->FaceRemovedAt.push_back(FaceRemovedAt[Face]);
 	}
 
-	return simplifiedMesh;
+	return Progressive;
+}
+
+uint32 FProgressiveMesh::GetNumCollapses(uint32 InTriangleBudget) const
+{
+	// FaceCounts never increases: find the first state that fits the budget
+	const auto It = std::lower_bound(FaceCounts.begin(), FaceCounts.end(), InTriangleBudget, std::greater<uint32>());
+	return It == FaceCounts.end() ? static_cast<uint32>(FaceCounts.size()) - 1 : static_cast<uint32>(It - FaceCounts.begin());
+}
+
+uint32 FProgressiveMesh::GetNumVertices(uint32 InTriangleBudget) const
+{
+	return FaceCounts.empty() ? 0 : VertexCounts[GetNumCollapses(InTriangleBudget)];
+}
+
+uint32 FProgressiveMesh::BuildIndices(uint32 InTriangleBudget, TArray<uint32>& OutIndices, TArray<FMeshSection>* OutSections) const
+{
+	OutIndices.clear();
+	if (OutSections)
+	{
+		OutSections->clear();
+	}
+	if (FaceCounts.empty())
+	{
+		return 0;
+	}
+
+	const uint32 NumApplied = GetNumCollapses(InTriangleBudget);
+	const uint32 NumKeptVertices = VertexCounts[NumApplied];
+	OutIndices.reserve(static_cast<size_t>(FaceCounts[NumApplied]) * 3);
+
+	for (const FMeshSection& Section : Sections)
+	{
+		// Faces removed by collapse k are alive while fewer than k + 1 collapses are applied
+		const uint32 FirstFace = Section.StartIndex / 3;
+		const auto SectionBegin = FaceRemovedAt.begin() + FirstFace;
+		const auto SectionEnd = SectionBegin + Section.IndexCount / 3;
+		const auto AliveEnd = std::partition_point(SectionBegin, SectionEnd, [NumApplied](uint32 RemovedAt) { return RemovedAt >= NumApplied; });
+		const uint32 NumAlive = static_cast<uint32>(AliveEnd - SectionBegin);
+		if (NumAlive == 0) continue;
+
+		if (OutSections)
+		{
+			FMeshSection OutSection;
+			OutSection.StartIndex = static_cast<uint32>(OutIndices.size());
+			OutSection.IndexCount = NumAlive * 3;
+			OutSection.MaterialSlot = Section.MaterialSlot;
+			OutSections->push_back(OutSection);
+		}
+
+		for (uint32 Index = Section.StartIndex; Index < Section.StartIndex + NumAlive * 3; ++Index)
+		{
+			uint32 Vertex = Indices[Index];
+			while (Vertex >= NumKeptVertices)
+			{
+				Vertex = CollapseTarget[Vertex];
+			}
+			OutIndices.push_back(Vertex);
+		}
+	}
+	return static_cast<uint32>(OutIndices.size() / 3);
 }
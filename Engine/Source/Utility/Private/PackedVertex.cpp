@@ -0,0 +1,299 @@
+#include "pch.h"
+#include "Utility/Public/PackedVertex.h"
+#include <bit>
+
+namespace
+{
+	constexpr float MaxQuantizedPosition = 65535.0f;
+	constexpr float MaxOctahedral = 32767.0f;
+
+	// InValue 이상인 가장 작은 2의 거듭제곱 (0 이하이면 1)
+	float CeilPowerOfTwo(float InValue)
+	{
+		if (!(InValue > 0.0f) || !std::isfinite(InValue))
+		{
+			return 1.0f;
+		}
+		int32 Exponent = 0;
+		const float Mantissa = std::frexp(InValue, &Exponent);
+		return Mantissa == 0.5f ? InValue : std::ldexp(1.0f, Exponent);
+	}
+
+	void ComputeAxisQuantization(float InMin, float InMax, float& OutOrigin, float& OutScale)
+	{
+		// 원점을 간격 배수로 내리면 범위가 최대 한 칸 늘어나므로 65534칸 기준으로 간격을 정한다
+		OutScale = CeilPowerOfTwo((InMax - InMin) / (MaxQuantizedPosition - 1.0f));
+		OutOrigin = std::floor(InMin / OutScale) * OutScale;
+	}
+
+	uint16 QuantizePosition(float InValue, float InOrigin, float InScale)
+	{
+		const float Quantized = std::round((InValue - InOrigin) / InScale);
+		return static_cast<uint16>(std::clamp(Quantized, 0.0f, MaxQuantizedPosition));
+	}
+
+	// 접힌 면의 경계에서 복원된 -0을 다시 인코딩해도 같은 코드가 나오도록 0의 부호도 따른다
+	float SignNotZero(float InValue)
+	{
+		return std::signbit(InValue) ? -1.0f : 1.0f;
+	}
+
+	int16 QuantizeSnorm16(float InValue)
+	{
+		return static_cast<int16>(std::round(std::clamp(InValue, -1.0f, 1.0f) * MaxOctahedral));
+	}
+}
+
+void FPackedVertexStream::Pack(const TArray<FNormalVertex>& InVertices)
+{
+	ComputePositionQuantization(InVertices.data(), InVertices.size(), PositionOrigin, PositionScale);
+
+	Vertices.resize(InVertices.size());
+	Colors.clear();
+	if (HasVertexColors(InVertices.data(), InVertices.size()))
+	{
+		Colors.resize(InVertices.size());
+	}
+
+	PackVertices(InVertices.data(), InVertices.size(), PositionOrigin, PositionScale, Vertices.data(),
+		Colors.empty() ? nullptr : Colors.data());
+}
+
+void FPackedVertexStream::Unpack(TArray<FNormalVertex>& OutVertices) const
+{
+	OutVertices.resize(Vertices.size());
+	UnpackVertices(Vertices.data(), Colors.empty() ? nullptr : Colors.data(), Vertices.size(), PositionOrigin, PositionScale,
+		OutVertices.data());
+}
+
+void FPackedVertexStream::UnpackPositions(TArray<FVector>& OutPositions) const
+{
+	OutPositions.resize(Vertices.size());
+	for (size_t Index = 0; Index < Vertices.size(); ++Index)
+	{
+		OutPositions[Index] = GetPosition(static_cast<uint32>(Index));
+	}
+}
+
+FVector FPackedVertexStream::GetPosition(uint32 InIndex) const
+{
+	const FPackedNormalVertex& Vertex = Vertices[InIndex];
+	return FVector(PositionOrigin.X + Vertex.Position[0] * PositionScale.X,
+		PositionOrigin.Y + Vertex.Position[1] * PositionScale.Y,
+		PositionOrigin.Z + Vertex.Position[2] * PositionScale.Z);
+}
+
+size_t FPackedVertexStream::GetNumBytes() const
+{
+	return sizeof(FPackedNormalVertex) * Vertices.size() + sizeof(uint32) * Colors.size();
+}
+
+void FPackedVertexStream::Quantize(TArray<FNormalVertex>& InOutVertices)
+{
+	FPackedVertexStream Stream;
+	Stream.Pack(InOutVertices);
+	Stream.Unpack(InOutVertices);
+}
+
+void FPackedVertexStream::ComputePositionQuantization(const FNormalVertex* InVertices, size_t InNumVertices, FVector& OutOrigin,
+	FVector& OutScale)
+{
+	if (InNumVertices == 0)
+	{
+		OutOrigin = FVector(0.0f, 0.0f, 0.0f);
+		OutScale = FVector(1.0f, 1.0f, 1.0f);
+		return;
+	}
+
+	FVector Min = InVertices[0].Position;
+	FVector Max = InVertices[0].Position;
+	for (size_t Index = 1; Index < InNumVertices; ++Index)
+	{
+		const FVector& Position = InVertices[Index].Position;
+		Min.X = std::min(Min.X, Position.X); Max.X = std::max(Max.X, Position.X);
+		Min.Y = std::min(Min.Y, Position.Y); Max.Y = std::max(Max.Y, Position.Y);
+		Min.Z = std::min(Min.Z, Position.Z); Max.Z = std::max(Max.Z, Position.Z);
+	}
+
+	ComputeAxisQuantization(Min.X, Max.X, OutOrigin.X, OutScale.X);
+	ComputeAxisQuantization(Min.Y, Max.Y, OutOrigin.Y, OutScale.Y);
+	ComputeAxisQuantization(Min.Z, Max.Z, OutOrigin.Z, OutScale.Z);
+}
+
+bool FPackedVertexStream::HasVertexColors(const FNormalVertex* InVertices, size_t InNumVertices)
+{
+	for (size_t Index = 0; Index < InNumVertices; ++Index)
+	{
+		const FVector4& Color = InVertices[Index].Color;
+		if (Color.X != 1.0f || Color.Y != 1.0f || Color.Z != 1.0f || Color.W != 1.0f)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FPackedVertexStream::CanPackTexCoords(const FNormalVertex* InVertices, size_t InNumVertices)
+{
+	for (size_t Index = 0; Index < InNumVertices; ++Index)
+	{
+		const FVector2& TexCoord = InVertices[Index].TexCoord;
+		if (!(std::abs(TexCoord.X) <= MaxPackedTexCoord && std::abs(TexCoord.Y) <= MaxPackedTexCoord))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FPackedVertexStream::PackVertices(const FNormalVertex* InVertices, size_t InNumVertices, const FVector& InOrigin,
+	const FVector& InScale, FPackedNormalVertex* OutVertices, uint32* OutColors)
+{
+	for (size_t Index = 0; Index < InNumVertices; ++Index)
+	{
+		const FNormalVertex& Source = InVertices[Index];
+		FPackedNormalVertex& Packed = OutVertices[Index];
+		Packed.Position[0] = QuantizePosition(Source.Position.X, InOrigin.X, InScale.X);
+		Packed.Position[1] = QuantizePosition(Source.Position.Y, InOrigin.Y, InScale.Y);
+		Packed.Position[2] = QuantizePosition(Source.Position.Z, InOrigin.Z, InScale.Z);
+		Packed.Padding = 0;
+		EncodeOctahedral(Source.Normal, Packed.Normal);
+		Packed.TexCoord[0] = FloatToHalf(Source.TexCoord.X);
+		Packed.TexCoord[1] = FloatToHalf(Source.TexCoord.Y);
+
+		if (OutColors)
+		{
+			OutColors[Index] = PackColor(Source.Color);
+		}
+	}
+}
+
+void FPackedVertexStream::UnpackVertices(const FPackedNormalVertex* InVertices, const uint32* InColors, size_t InNumVertices,
+	const FVector& InOrigin, const FVector& InScale, FNormalVertex* OutVertices)
+{
+	const FVector4 White(1.0f, 1.0f, 1.0f, 1.0f);
+	for (size_t Index = 0; Index < InNumVertices; ++Index)
+	{
+		const FPackedNormalVertex& Packed = InVertices[Index];
+		FNormalVertex& Vertex = OutVertices[Index];
+		Vertex.Position = FVector(InOrigin.X + Packed.Position[0] * InScale.X,
+			InOrigin.Y + Packed.Position[1] * InScale.Y,
+			InOrigin.Z + Packed.Position[2] * InScale.Z);
+		Vertex.Normal = DecodeOctahedral(Packed.Normal);
+		Vertex.Color = InColors ? UnpackColor(InColors[Index]) : White;
+		Vertex.TexCoord = FVector2(HalfToFloat(Packed.TexCoord[0]), HalfToFloat(Packed.TexCoord[1]));
+	}
+}
+
+void FPackedVertexStream::EncodeOctahedral(const FVector& InNormal, int16 OutEncoded[2])
+{
+	// 단위 팔면체(|x| + |y| + |z| = 1)에 투영한 뒤 아래쪽 반구는 바깥 삼각형으로 접는다 (Cigolle et al. 2014)
+	const float L1Norm = std::abs(InNormal.X) + std::abs(InNormal.Y) + std::abs(InNormal.Z);
+	if (L1Norm <= 0.0f)
+	{
+		OutEncoded[0] = 0;
+		OutEncoded[1] = 0;
+		return;
+	}
+
+	float U = InNormal.X / L1Norm;
+	float V = InNormal.Y / L1Norm;
+	if (InNormal.Z < 0.0f)
+	{
+		const float FoldedU = (1.0f - std::abs(V)) * SignNotZero(U);
+		const float FoldedV = (1.0f - std::abs(U)) * SignNotZero(V);
+		U = FoldedU;
+		V = FoldedV;
+	}
+
+	OutEncoded[0] = QuantizeSnorm16(U);
+	OutEncoded[1] = QuantizeSnorm16(V);
+}
+
+FVector FPackedVertexStream::DecodeOctahedral(const int16 InEncoded[2])
+{
+	float X = std::max(InEncoded[0] / MaxOctahedral, -1.0f);
+	float Y = std::max(InEncoded[1] / MaxOctahedral, -1.0f);
+	const float Z = 1.0f - std::abs(X) - std::abs(Y);
+	if (Z < 0.0f)
+	{
+		const float UnfoldedX = (1.0f - std::abs(Y)) * SignNotZero(X);
+		const float UnfoldedY = (1.0f - std::abs(X)) * SignNotZero(Y);
+		X = UnfoldedX;
+		Y = UnfoldedY;
+	}
+
+	const float InvLength = 1.0f / std::sqrt(X * X + Y * Y + Z * Z);
+	return FVector(X * InvLength, Y * InvLength, Z * InvLength);
+}
+
+uint16 FPackedVertexStream::FloatToHalf(float InValue)
+{
+	// 반올림을 정수 덧셈으로 처리하고, 비정규 half는 float 덧셈의 반올림을 빌린다
+	constexpr uint32 FloatInfinity = 255u << 23;
+	constexpr uint32 HalfOverflow = (127u + 16u) << 23;
+	constexpr uint32 HalfMinNormal = 113u << 23;
+	const float DenormMagic = std::bit_cast<float>(((127u - 15u) + (23u - 10u) + 1u) << 23);
+
+	uint32 Bits = std::bit_cast<uint32>(InValue);
+	const uint32 Sign = Bits & 0x80000000u;
+	Bits ^= Sign;
+
+	uint32 Half;
+	if (Bits >= HalfOverflow)
+	{
+		Half = Bits > FloatInfinity ? 0x7E00u : 0x7C00u;
+	}
+	else if (Bits < HalfMinNormal)
+	{
+		const float Denormal = std::bit_cast<float>(Bits) + DenormMagic;
+		Half = std::bit_cast<uint32>(Denormal) - std::bit_cast<uint32>(DenormMagic);
+	}
+	else
+	{
+		const uint32 MantissaOdd = (Bits >> 13) & 1u;
+		Bits += (static_cast<uint32>(15 - 127) << 23) + 0xFFFu;
+		Bits += MantissaOdd;
+		Half = Bits >> 13;
+	}
+
+	return static_cast<uint16>(Half | (Sign >> 16));
+}
+
+float FPackedVertexStream::HalfToFloat(uint16 InValue)
+{
+	constexpr uint32 ShiftedExponent = 0x7C00u << 13;
+	uint32 Bits = (InValue & 0x7FFFu) << 13;
+	const uint32 Exponent = Bits & ShiftedExponent;
+	Bits += (127u - 15u) << 23;
+
+	if (Exponent == ShiftedExponent)
+	{
+		// 무한대/NaN
+		Bits += (128u - 16u) << 23;
+	}
+	else if (Exponent == 0)
+	{
+		// 0/비정규 수는 정규화
+		Bits += 1u << 23;
+		Bits = std::bit_cast<uint32>(std::bit_cast<float>(Bits) - std::bit_cast<float>(113u << 23));
+	}
+
+	return std::bit_cast<float>(Bits | (static_cast<uint32>(InValue & 0x8000u) << 16));
+}
+
+uint32 FPackedVertexStream::PackColor(const FVector4& InColor)
+{
+	auto ToUnorm8 = [](float InValue)
+		{
+			return static_cast<uint32>(std::round(std::clamp(InValue, 0.0f, 1.0f) * 255.0f));
+		};
+	return ToUnorm8(InColor.X) | (ToUnorm8(InColor.Y) << 8) | (ToUnorm8(InColor.Z) << 16) | (ToUnorm8(InColor.W) << 24);
+}
+
+FVector4 FPackedVertexStream::UnpackColor(uint32 InColor)
+{
+	constexpr float InvMax = 1.0f / 255.0f;
+	return FVector4((InColor & 0xFF) * InvMax, ((InColor >> 8) & 0xFF) * InvMax, ((InColor >> 16) & 0xFF) * InvMax,
+		((InColor >> 24) & 0xFF) * InvMax);
+}
@@ -0,0 +1,47 @@
+#include "pch.h"
+#include "Utility/Public/PlatformSIMD.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+	bool DetectAVX2()
+	{
+#ifdef _MSC_VER
+		int32 Info[4];
+		__cpuid(Info, 0);
+		if (Info[0] < 7)
+		{
+			return false;
+		}
+
+		__cpuid(Info, 1);
+		const bool bFMA = (Info[2] & (1 << 12)) != 0;
+		const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+		const bool bAVX = (Info[2] & (1 << 28)) != 0;
+		if (!bFMA || !bOSXSave || !bAVX)
+		{
+			return false;
+		}
+
+		// OS가 컨텍스트 전환 시 XMM/YMM 상태를 저장하는지
+		if ((_xgetbv(0) & 0x6) != 0x6)
+		{
+			return false;
+		}
+
+		__cpuidex(Info, 7, 0);
+		return (Info[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+	}
+}
+
+bool FPlatformSIMD::HasAVX2()
+{
+	static const bool bHasAVX2 = DetectAVX2();
+	return bHasAVX2;
+}
@@ -1,10 +1,30 @@
 #include "pch.h"
 #include "Utility/Public/SceneBVH.h"
 #include "Utility/Public/ScopeCycleCounter.h"
+#include "Utility/Public/TaskScheduler.h"
+
+// 백그라운드 재빌드 중 발생한 변경 기록 (완료 시 새 트리에 같은 순서로 재적용)
+// 슬롯 할당이 결정적이므로 같은 순서로 재생하면 프리미티브 인덱스도 같아진다
+struct FSceneBVH::FPendingRebuild
+{
+	enum class EOp : uint8 { Insert, Remove, Refit };
+	struct FOp
+	{
+		EOp Type;
+		int64 PrimIdx;
+		UPrimitiveComponent* Primitive;
+		FAABB Bounds;
+	};
+
+	FSceneBVH Result;
+	FTaskGroup Group;
+	TArray<FOp> Ops;
+};
 
 // FSceneBVH: 씬의 PrimitiveComponent 분할을 위한 SAH(binned) 기반 BVH
-// - Build: 입력 프리미티브로 트리를 구성
+// - Build: 입력 프리미티브로 트리를 구성 (Parallel 모드는 작업 분할 + 병렬 리덕션)
 // - Refit: 트리 토폴로지는 유지한 채 AABB만 갱신 (전체/Dirty 전파 지원)
+// - Insert/Remove: 전체 재빌드 없이 국소 갱신 (SAH 최적 형제 탐색 + 회전), 품질이 떨어지면 백그라운드 재빌드
 // - QueryRay: Ray-AABB 테스트로 후보 프리미티브만 수집
 
 void FSceneBVH::Clear()
@@ -18,15 +38,31 @@ void FSceneBVH::Clear()
 	PrimToLeaf.clear();
 	PrimIndexMap.clear();
 
+	RootIndex = -1;
+	NumLivePrimitives = 0;
+	FreeNodes.clear();
+	FreePrimSlots.clear();
+	FreeIndexSlots.clear();
+	SAHCostSum = 0.0;
+	BuildSAHCost = 0.0f;
+	// 진행 중인 재빌드 결과는 버림 (작업은 자신의 스냅샷만 건드리므로 그대로 끝나도 안전)
+	PendingRebuild.reset();
+
+	WideNodes4.clear();
+	WideNodes8.clear();
+	WideSlotOfNode.clear();
+	bWideLayoutDirty = true;
+
 	PrimMinX.clear(); PrimMinY.clear(); PrimMinZ.clear();
 	PrimMaxX.clear(); PrimMaxY.clear(); PrimMaxZ.clear();
 	PrimCentX.clear(); PrimCentY.clear(); PrimCentZ.clear();
+	PrimSphereRadiusSq.clear();
 
 	NodeMinX.clear(); NodeMinY.clear(); NodeMinZ.clear();
 	NodeMaxX.clear(); NodeMaxY.clear(); NodeMaxZ.clear();
 }
 
-void FSceneBVH::Build(const TArray<UPrimitiveComponent*>& InPrimitives)
+void FSceneBVH::Build(const TArray<UPrimitiveComponent*>& InPrimitives, EBVHBuildMode InMode, FTaskScheduler* InScheduler)
 {
 	// 초기화 + 입력 보관
 	Clear();
@@ -55,6 +91,7 @@ void FSceneBVH::Build(const TArray<UPrimitiveComponent*>& InPrimitives)
 	EnsurePrimSoASize();
 
 	// 포인터 → 인덱스 매핑 생성 + 초기 PrimBounds 설정 (fill SoA)
+	// GetWorldAABB는 부모 트랜스폼을 지연 갱신하므로 병렬 모드에서도 수집은 직렬로 수행
 	PrimIndexMap.reserve(NumPrimitives);
 	for (size_t I = 0; I < NumPrimitives; ++I)
 	{
@@ -64,11 +101,7 @@ void FSceneBVH::Build(const TArray<UPrimitiveComponent*>& InPrimitives)
 		if (!Primitives[I])
 		{
 			// Use zero bounds for invalid primitive
-			PrimBounds[I] = FAABB(FVector::ZeroVector(), FVector::ZeroVector());
-			PrimMinX[I] = PrimMinY[I] = PrimMinZ[I] = 0.0f;
-			PrimMaxX[I] = PrimMaxY[I] = PrimMaxZ[I] = 0.0f;
-			PrimCentX[I] = PrimCentY[I] = PrimCentZ[I] = 0.0f;
-			PrimSphereRadiusSq[I] = 0.0f;
+			SetPrimBounds(static_cast<int64>(I), FVector::ZeroVector(), FVector::ZeroVector());
 			continue;
 		}
 
@@ -85,31 +118,121 @@ void FSceneBVH::Build(const TArray<UPrimitiveComponent*>& InPrimitives)
 			MinW = FVector::ZeroVector();
 			MaxW = FVector::ZeroVector();
 		}
-		PrimBounds[I] = FAABB(MinW, MaxW);
+		SetPrimBounds(static_cast<int64>(I), MinW, MaxW);
+	}
+
+	NumLivePrimitives = static_cast<int64>(NumPrimitives);
+	BuildTree(InMode, InScheduler);
+}
+
+void FSceneBVH::BuildFromBounds(const TArray<FAABB>& InBounds, EBVHBuildMode InMode, FTaskScheduler* InScheduler)
+{
+	Clear();
+	if (InBounds.empty()) return;
+
+	const size_t NumPrimitives = InBounds.size();
+	Primitives.assign(NumPrimitives, nullptr);
+	Indices.resize(NumPrimitives);
+	PrimBounds.resize(NumPrimitives);
+	PrimToLeaf.assign(NumPrimitives, -1);
+	EnsurePrimSoASize();
+
+	for (size_t I = 0; I < NumPrimitives; ++I)
+	{
+		Indices[I] = static_cast<int64>(I);
+		SetPrimBounds(static_cast<int64>(I), InBounds[I].Min, InBounds[I].Max);
+	}
+
+	NumLivePrimitives = static_cast<int64>(NumPrimitives);
+	BuildTree(InMode, InScheduler);
+}
+
+void FSceneBVH::SetPrimBounds(int64 PrimIdx, const FVector& MinW, const FVector& MaxW)
+{
+	PrimBounds[PrimIdx] = FAABB(MinW, MaxW);
+
+	// write SoA
+	PrimMinX[PrimIdx] = MinW.X; PrimMinY[PrimIdx] = MinW.Y; PrimMinZ[PrimIdx] = MinW.Z;
+	PrimMaxX[PrimIdx] = MaxW.X; PrimMaxY[PrimIdx] = MaxW.Y; PrimMaxZ[PrimIdx] = MaxW.Z;
+	PrimCentX[PrimIdx] = (MinW.X + MaxW.X) * 0.5f;
+	PrimCentY[PrimIdx] = (MinW.Y + MaxW.Y) * 0.5f;
+	PrimCentZ[PrimIdx] = (MinW.Z + MaxW.Z) * 0.5f;
+	// compute radius^2 using (Max - Cent) vector (no sqrt)
+	const float ex = PrimMaxX[PrimIdx] - PrimCentX[PrimIdx];
+	const float ey = PrimMaxY[PrimIdx] - PrimCentY[PrimIdx];
+	const float ez = PrimMaxZ[PrimIdx] - PrimCentZ[PrimIdx];
+	PrimSphereRadiusSq[PrimIdx] = ex * ex + ey * ey + ez * ez;
+}
+
+void FSceneBVH::BuildTree(EBVHBuildMode InMode, FTaskScheduler* InScheduler)
+{
+	const int64 NumPrimitives = static_cast<int64>(Indices.size());
+
+	// 리프는 최소 1개의 프리미티브를 가지므로 노드 수는 2N-1을 넘지 않는다.
+	// 미리 할당해 두면 병렬 빌드에서도 노드 인덱스만 원자적으로 받아가면 된다.
+	const int64 MaxNodes = NumPrimitives * 2 - 1;
+	Nodes.assign(MaxNodes, FNode{});
+	Parent.assign(MaxNodes, -1);
 
-		// write SoA
-		PrimMinX[I] = MinW.X; PrimMinY[I] = MinW.Y; PrimMinZ[I] = MinW.Z;
-		PrimMaxX[I] = MaxW.X; PrimMaxY[I] = MaxW.Y; PrimMaxZ[I] = MaxW.Z;
-		PrimCentX[I] = (MinW.X + MaxW.X) * 0.5f;
-		PrimCentY[I] = (MinW.Y + MaxW.Y) * 0.5f;
-		PrimCentZ[I] = (MinW.Z + MaxW.Z) * 0.5f;
-		// compute radius^2 using (Max - Cent) vector (no sqrt)
+	FBuildContext Context;
+	if (InMode == EBVHBuildMode::Parallel)
+	{
+		FTaskScheduler& Scheduler = InScheduler ? *InScheduler : FTaskScheduler::Get();
+		// 워커가 없거나 규모가 작으면 작업 분할 오버헤드만 생김
+		if (Scheduler.GetNumWorkers() > 0 && NumPrimitives >= ParallelSubtreeThreshold)
 		{
-			const float ex = PrimMaxX[I] - PrimCentX[I];
-			const float ey = PrimMaxY[I] - PrimCentY[I];
-			const float ez = PrimMaxZ[I] - PrimCentZ[I];
-			PrimSphereRadiusSq[I] = ex * ex + ey * ey + ez * ez;
+			Context.Scheduler = &Scheduler;
 		}
 	}
 
-	// 노드/부모 캐시 예약 후 재귀 빌드 시작
-	Nodes.reserve(NumPrimitives * 2);
-	Parent.reserve(NumPrimitives * 2);
+	BuildRecursive(Context, Indices.data(), NumPrimitives);
 
-	BuildRecursive(Indices.data(), static_cast<int64>(NumPrimitives));
+	const int64 NumNodes = Context.NextNodeIndex.load(std::memory_order_acquire);
+	Nodes.resize(NumNodes);
+	Parent.resize(NumNodes);
+	RootIndex = 0;
 
 	// synchronize Node SoA for traversal hot-path
 	BuildNodeSoA();
+
+	RecomputeSAHCostSum();
+	BuildSAHCost = ComputeSAHCost();
+
+	bWideLayoutDirty = true;
+	UpdateWideLayout();
+}
+
+void FSceneBVH::SetTraversalLayout(EBVHLayout InLayout)
+{
+	if (Layout == InLayout)
+	{
+		return;
+	}
+
+	Layout = InLayout;
+	WideNodes4.clear();
+	WideNodes8.clear();
+	WideSlotOfNode.clear();
+	bWideLayoutDirty = true;
+	UpdateWideLayout();
+}
+
+void FSceneBVH::UpdateWideLayout()
+{
+	if (!bWideLayoutDirty || Layout == EBVHLayout::Binary)
+	{
+		return;
+	}
+
+	if (Layout == EBVHLayout::Wide8)
+	{
+		FWideBVH::Collapse<8>(Nodes, RootIndex, WideNodes8, &WideSlotOfNode);
+	}
+	else
+	{
+		FWideBVH::Collapse<4>(Nodes, RootIndex, WideNodes4, &WideSlotOfNode);
+	}
+	bWideLayoutDirty = false;
 }
 
 static inline void ExpandMinMax(FVector& MIn, FVector& Mx, const FAABB& A)
@@ -127,16 +250,82 @@ float FSceneBVH::SurfaceArea(const FAABB& B)
 	return 2.0f * (Ex * Ey + Ey * Ez + Ez * Ex);
 }
 
+// 내부 노드 = 순회 비용 1, 리프 = 프리미티브당 교차 비용 1
+double FSceneBVH::NodeSAHTerm(const FNode& InNode)
+{
+	const double Area = SurfaceArea(InNode.Bounds);
+	return InNode.IsLeaf() ? Area * static_cast<double>(InNode.Count) : Area;
+}
+
+void FSceneBVH::RecomputeSAHCostSum()
+{
+	// 빌드 직후에는 해제된 노드가 없으므로 전체 순회로 충분
+	SAHCostSum = 0.0;
+	for (const FNode& N : Nodes)
+	{
+		SAHCostSum += NodeSAHTerm(N);
+	}
+}
+
+float FSceneBVH::ComputeSAHCost() const
+{
+	if (RootIndex < 0) return 0.0f;
+
+	const float RootArea = SurfaceArea(Nodes[RootIndex].Bounds);
+	if (RootArea <= 0.0f) return 0.0f;
+
+	return static_cast<float>(SAHCostSum / RootArea);
+}
+
+float FSceneBVH::GetSAHDegradation() const
+{
+	if (BuildSAHCost <= 0.0f) return 1.0f;
+	return ComputeSAHCost() / BuildSAHCost;
+}
+
+void FSceneBVH::SetNodeBounds(int64 NodeIndex, const FAABB& InBounds)
+{
+	FNode& NodeRef = Nodes[NodeIndex];
+	SAHCostSum -= NodeSAHTerm(NodeRef);
+	NodeRef.Bounds = InBounds;
+	SAHCostSum += NodeSAHTerm(NodeRef);
+
+	NodeMinX[NodeIndex] = InBounds.Min.X; NodeMinY[NodeIndex] = InBounds.Min.Y; NodeMinZ[NodeIndex] = InBounds.Min.Z;
+	NodeMaxX[NodeIndex] = InBounds.Max.X; NodeMaxY[NodeIndex] = InBounds.Max.Y; NodeMaxZ[NodeIndex] = InBounds.Max.Z;
+
+	// 리핏은 토폴로지를 바꾸지 않으므로 wide 슬롯 바운드만 따라 갱신
+	if (!bWideLayoutDirty && NodeIndex < static_cast<int64>(WideSlotOfNode.size()))
+	{
+		const int32 Slot = WideSlotOfNode[NodeIndex];
+		if (Slot >= 0)
+		{
+			if (Layout == EBVHLayout::Wide8)
+				FWideBVH::SetSlotBounds(WideNodes8[Slot / 8], Slot % 8, InBounds);
+			else if (Layout == EBVHLayout::Wide4)
+				FWideBVH::SetSlotBounds(WideNodes4[Slot / 4], Slot % 4, InBounds);
+		}
+	}
+}
+
 // Reworked BuildRecursive using helpers
-int64 FSceneBVH::BuildRecursive(int64* IndexPtr, int64 Count)
+// Context.Scheduler가 있으면 큰 노드는 리덕션을 병렬로, 큰 서브트리는 별도 작업으로 빌드한다.
+// 분할 결정은 직렬 빌드와 동일하므로 트리 품질(SAH 비용)도 같다.
+int64 FSceneBVH::BuildRecursive(FBuildContext& Context, int64* IndexPtr, int64 Count)
 {
-	const int64 NodeIndex = static_cast<int64>(Nodes.size());
-	Nodes.emplace_back();
-	Parent.push_back(-1);
+	const int64 NodeIndex = Context.NextNodeIndex.fetch_add(1, std::memory_order_relaxed);
+	const bool bParallelReduce = Context.Scheduler && Count >= ParallelReduceThreshold;
 
-	// Compute union bounds
+	// Compute union bounds (병렬 모드에서는 centroid 바운드까지 한 번에)
 	FVector BMin, BMax;
-	ComputeBoundsForRange(IndexPtr, Count, BMin, BMax);
+	FVector CMin, CMax;
+	if (bParallelReduce)
+	{
+		ComputeBoundsForRangeParallel(*Context.Scheduler, IndexPtr, Count, BMin, BMax, CMin, CMax);
+	}
+	else
+	{
+		ComputeBoundsForRange(IndexPtr, Count, BMin, BMax);
+	}
 
 	// Leaf condition
 	constexpr int32 LeafMax = 4;
@@ -147,24 +336,27 @@ int64 FSceneBVH::BuildRecursive(int64* IndexPtr, int64 Count)
 	}
 
 	// centroid bounds
-	FVector CMin, CMax;
-	ComputeCentroidBoundsForRange(IndexPtr, Count, CMin, CMax);
+	if (!bParallelReduce)
+	{
+		ComputeCentroidBoundsForRange(IndexPtr, Count, CMin, CMax);
+	}
 	const FVector CExt = CMax - CMin;
 	const bool bDegenerate = (CExt.X <= 1e-6f) && (CExt.Y <= 1e-6f) && (CExt.Z <= 1e-6f);
 
 	// attempt binned SAH split
-	int64 BestAxis = -1;
-	int32 BestSplitBin = -1;
+	int BestAxis = -1;
+	int BestSplitBin = -1;
 	float BestCost = std::numeric_limits<float>::infinity();
 
 	if (!bDegenerate)
 	{
-		FindBestSplit(IndexPtr, Count, CMin, CMax, reinterpret_cast<int&>(BestAxis), BestSplitBin, BestCost);
+		FindBestSplit(IndexPtr, Count, CMin, CMax, BestAxis, BestSplitBin, BestCost, bParallelReduce ? Context.Scheduler : nullptr);
 	}
 
-	// fallback to median if split not found
+	int64 LeftCount = 0;
 	if (BestAxis < 0 || BestSplitBin < 0)
 	{
+		// fallback to median if split not found
 		const FVector Ext = BMax - BMin;
 		int64 Axis = 0;
 		if (Ext.Y > Ext.X) Axis = 1;
@@ -180,54 +372,54 @@ int64 FSceneBVH::BuildRecursive(int64* IndexPtr, int64 Count)
 				: (A.Min.Z + A.Max.Z) * 0.5f;
 			};
 
-		int64 LeftCountMedian = 0;
 		for (int64 I = 0; I < Count; ++I)
 		{
 			if (GetCenter(IndexPtr[I]) < Mid)
-				std::swap(IndexPtr[I], IndexPtr[LeftCountMedian++]);
+				std::swap(IndexPtr[I], IndexPtr[LeftCount++]);
 		}
-		if (LeftCountMedian == 0 || LeftCountMedian == Count)
-			LeftCountMedian = Count / 2;
-
-		const int64 L = BuildRecursive(IndexPtr, LeftCountMedian);
-		const int64 R = BuildRecursive(IndexPtr + LeftCountMedian, Count - LeftCountMedian);
-
-		Parent[L] = NodeIndex;
-		Parent[R] = NodeIndex;
-
-		FNode& NodeRef = Nodes[NodeIndex];
-		NodeRef.Left = L;
-		NodeRef.Right = R;
-		NodeRef.Start = 0;
-		NodeRef.Count = 0;
-		NodeRef.Bounds = FAABB(BMin, BMax);
-		return NodeIndex;
 	}
+	else
+	{
+		// convert BestSplitBin into SplitPos and partition
+		const float AxisCMin = (BestAxis == 0 ? CMin.X : (BestAxis == 1 ? CMin.Y : CMin.Z));
+		const float AxisExt = (BestAxis == 0 ? CExt.X : (BestAxis == 1 ? CExt.Y : CExt.Z));
+		const float BinSize = AxisExt / static_cast<float>(SplitBinCount);
+		const float SplitPos = AxisCMin + BinSize * static_cast<float>(BestSplitBin + 1);
 
-	// convert BestSplitBin into SplitPos and partition (same as before)
-	const float AxisCMin = (BestAxis == 0 ? CMin.X : (BestAxis == 1 ? CMin.Y : CMin.Z));
-	const float AxisExt = (BestAxis == 0 ? CExt.X : (BestAxis == 1 ? CExt.Y : CExt.Z));
-	const float BinSize = AxisExt / static_cast<float>(32); // BinCount
-	const float SplitPos = AxisCMin + BinSize * static_cast<float>(BestSplitBin + 1);
-
-	auto GetCenterAxis = [&](int64 Idx)->float {
-		const FAABB& A = PrimBounds[Idx];
-		return BestAxis == 0 ? (A.Min.X + A.Max.X) * 0.5f
-			: BestAxis == 1 ? (A.Min.Y + A.Max.Y) * 0.5f
-			: (A.Min.Z + A.Max.Z) * 0.5f;
-		};
+		auto GetCenterAxis = [&](int64 Idx)->float {
+			const FAABB& A = PrimBounds[Idx];
+			return BestAxis == 0 ? (A.Min.X + A.Max.X) * 0.5f
+				: BestAxis == 1 ? (A.Min.Y + A.Max.Y) * 0.5f
+				: (A.Min.Z + A.Max.Z) * 0.5f;
+			};
 
-	int64 LeftCount = 0;
-	for (int64 I = 0; I < Count; ++I)
-	{
-		if (GetCenterAxis(IndexPtr[I]) < SplitPos)
-			std::swap(IndexPtr[I], IndexPtr[LeftCount++]);
+		for (int64 I = 0; I < Count; ++I)
+		{
+			if (GetCenterAxis(IndexPtr[I]) < SplitPos)
+				std::swap(IndexPtr[I], IndexPtr[LeftCount++]);
+		}
 	}
 	if (LeftCount == 0 || LeftCount == Count)
 		LeftCount = Count / 2;
 
-	const int64 L = BuildRecursive(IndexPtr, LeftCount);
-	const int64 R = BuildRecursive(IndexPtr + LeftCount, Count - LeftCount);
+	// 두 서브트리는 서로 겹치지 않는 인덱스 구간/노드를 쓰므로 독립적으로 빌드 가능
+	int64 L = -1;
+	int64 R = -1;
+	if (Context.Scheduler && Count >= ParallelSubtreeThreshold)
+	{
+		FTaskGroup Group;
+		Context.Scheduler->Dispatch(Group, [this, &Context, IndexPtr, LeftCount, &L]()
+			{
+				L = BuildRecursive(Context, IndexPtr, LeftCount);
+			});
+		R = BuildRecursive(Context, IndexPtr + LeftCount, Count - LeftCount);
+		Context.Scheduler->Wait(Group);
+	}
+	else
+	{
+		L = BuildRecursive(Context, IndexPtr, LeftCount);
+		R = BuildRecursive(Context, IndexPtr + LeftCount, Count - LeftCount);
+	}
 
 	Parent[L] = NodeIndex;
 	Parent[R] = NodeIndex;
@@ -267,13 +459,14 @@ void FSceneBVH::QueryRay(const FRay& Ray, TArray<UPrimitiveComponent*>& OutCandi
 	Cached.InvDir[1] = (fabsf(Ray.Direction.Y) > 1e-8f) ? 1.0f / Ray.Direction.Y : std::numeric_limits<float>::infinity();
 	Cached.InvDir[2] = (fabsf(Ray.Direction.Z) > 1e-8f) ? 1.0f / Ray.Direction.Z : std::numeric_limits<float>::infinity();
 
-	int64 Stack[128];
-	int64 StackPtr = 0;
-	Stack[StackPtr++] = 0;
+	if (RootIndex < 0) return;
 
-	while (StackPtr > 0)
+	TTraversalStack<int64, 128> Stack;
+	Stack.Push(RootIndex);
+
+	while (!Stack.IsEmpty())
 	{
-		const int64 NodeIdx = Stack[--StackPtr];
+		const int64 NodeIdx = Stack.Pop();
 		const FNode& NodeRef = Nodes[NodeIdx];
 		if (!RayIntersectsAABB(Cached, NodeRef.Bounds)) continue;
 
@@ -287,8 +480,8 @@ void FSceneBVH::QueryRay(const FRay& Ray, TArray<UPrimitiveComponent*>& OutCandi
 		}
 		else
 		{
-			if (NodeRef.Left >= 0) Stack[StackPtr++] = NodeRef.Left;
-			if (NodeRef.Right >= 0) Stack[StackPtr++] = NodeRef.Right;
+			if (NodeRef.Left >= 0) Stack.Push(NodeRef.Left);
+			if (NodeRef.Right >= 0) Stack.Push(NodeRef.Right);
 		}
 	}
 }
@@ -296,7 +489,10 @@ void FSceneBVH::QueryRay(const FRay& Ray, TArray<UPrimitiveComponent*>& OutCandi
 void FSceneBVH::Refit()
 {
 	// 모든 프리미티브의 월드 AABB를 갱신하고 루트부터 보텀업으로 결합
-	if (Primitives.empty() || Nodes.empty()) return;
+	if (Primitives.empty() || RootIndex < 0) return;
+
+	// 재빌드 스냅샷과 전체 바운드가 어긋나므로 진행 중인 재빌드는 버림
+	PendingRebuild.reset();
 
 	EnsurePrimSoASize();
 
@@ -317,32 +513,36 @@ void FSceneBVH::Refit()
 			MinW = FVector::ZeroVector();
 			MaxW = FVector::ZeroVector();
 		}
-		PrimBounds[I] = FAABB(MinW, MaxW);
+		SetPrimBounds(static_cast<int64>(I), MinW, MaxW);
+	}
+	RefitNode(RootIndex);
+}
+
+void FSceneBVH::RefitFromBounds(const TArray<FAABB>& InBounds)
+{
+	if (Primitives.empty() || RootIndex < 0) return;
+
+	PendingRebuild.reset();
+
+	EnsurePrimSoASize();
 
-		// update SoA
-		PrimMinX[I] = MinW.X; PrimMinY[I] = MinW.Y; PrimMinZ[I] = MinW.Z;
-		PrimMaxX[I] = MaxW.X; PrimMaxY[I] = MaxW.Y; PrimMaxZ[I] = MaxW.Z;
-		PrimCentX[I] = (MinW.X + MaxW.X) * 0.5f;
-		PrimCentY[I] = (MinW.Y + MaxW.Y) * 0.5f;
-		PrimCentZ[I] = (MinW.Z + MaxW.Z) * 0.5f;
-		// update radius^2
+	const size_t Count = std::min(Primitives.size(), InBounds.size());
+	for (size_t I = 0; I < Count; ++I)
+	{
+		// 제거된 슬롯은 건너뜀
+		if (PrimToLeaf[I] < 0)
 		{
-			const float ex = PrimMaxX[I] - PrimCentX[I];
-			const float ey = PrimMaxY[I] - PrimCentY[I];
-			const float ez = PrimMaxZ[I] - PrimCentZ[I];
-			PrimSphereRadiusSq[I] = ex * ex + ey * ey + ez * ez;
+			continue;
 		}
+		SetPrimBounds(static_cast<int64>(I), InBounds[I].Min, InBounds[I].Max);
 	}
-	RefitNode(0);
-
-	// sync Node SoA after refit
-	BuildNodeSoA();
+	RefitNode(RootIndex);
 }
 
 void FSceneBVH::RefitDirtyByPrims(const TArray<UPrimitiveComponent*>& DirtyPrims)
 {
 	// 포인터 집합을 인덱스 집합으로 변환하여 부분 리핏
-	if (DirtyPrims.empty() || Primitives.empty() || Nodes.empty()) return;
+	if (DirtyPrims.empty() || Primitives.empty() || RootIndex < 0) return;
 
 	TArray<int64> DirtyIndices;
 	DirtyIndices.reserve(DirtyPrims.size());
@@ -359,7 +559,7 @@ void FSceneBVH::RefitDirtyByPrims(const TArray<UPrimitiveComponent*>& DirtyPrims
 void FSceneBVH::RefitDirty(const TArray<int64>& DirtyPrimIndices)
 {
 	// Dirty 프리미티브만 바운드 갱신 후, 해당 리프와 조상만 재계산
-	if (DirtyPrimIndices.empty() || Primitives.empty() || Nodes.empty()) return;
+	if (DirtyPrimIndices.empty() || Primitives.empty() || RootIndex < 0) return;
 
 	EnsurePrimSoASize();
 
@@ -379,20 +579,11 @@ void FSceneBVH::RefitDirty(const TArray<int64>& DirtyPrimIndices)
 			MinW = FVector::ZeroVector();
 			MaxW = FVector::ZeroVector();
 		}
-		PrimBounds[PrimIdx] = FAABB(MinW, MaxW);
+		SetPrimBounds(PrimIdx, MinW, MaxW);
 
-		// update SoA
-		PrimMinX[PrimIdx] = MinW.X; PrimMinY[PrimIdx] = MinW.Y; PrimMinZ[PrimIdx] = MinW.Z;
-		PrimMaxX[PrimIdx] = MaxW.X; PrimMaxY[PrimIdx] = MaxW.Y; PrimMaxZ[PrimIdx] = MaxW.Z;
-		PrimCentX[PrimIdx] = (MinW.X + MaxW.X) * 0.5f;
-		PrimCentY[PrimIdx] = (MinW.Y + MaxW.Y) * 0.5f;
-		PrimCentZ[PrimIdx] = (MinW.Z + MaxW.Z) * 0.5f;
-		// update radius^2
+		if (PendingRebuild)
 		{
-			const float ex = PrimMaxX[PrimIdx] - PrimCentX[PrimIdx];
-			const float ey = PrimMaxY[PrimIdx] - PrimCentY[PrimIdx];
-			const float ez = PrimMaxZ[PrimIdx] - PrimCentZ[PrimIdx];
-			PrimSphereRadiusSq[PrimIdx] = ex * ex + ey * ey + ez * ez;
+			PendingRebuild->Ops.push_back({ FPendingRebuild::EOp::Refit, PrimIdx, Primitives[PrimIdx], PrimBounds[PrimIdx] });
 		}
 	}
 
@@ -429,11 +620,16 @@ void FSceneBVH::RefitDirty(const TArray<int64>& DirtyPrimIndices)
 	std::sort(DirtyNodes.begin(), DirtyNodes.end());
 	DirtyNodes.erase(std::unique(DirtyNodes.begin(), DirtyNodes.end()), DirtyNodes.end());
 
+	// 자식이 부모보다 먼저 갱신되도록 깊은 노드부터 처리
+	// (증분 삽입/회전 이후에는 노드 인덱스 순서가 트리 순서와 일치하지 않음)
+	TArray<std::pair<int32, int64>> DepthOrdered;
+	DepthOrdered.reserve(DirtyNodes.size());
 	for (int64 NodeIdx : DirtyNodes)
-		RefitInternalBounds(NodeIdx);
+		DepthOrdered.emplace_back(GetNodeDepth(NodeIdx), NodeIdx);
+	std::sort(DepthOrdered.begin(), DepthOrdered.end(), [](const auto& A, const auto& B) { return A.first > B.first; });
 
-	// synchronize Node SoA for traversal
-	BuildNodeSoA();
+	for (const auto& Entry : DepthOrdered)
+		RefitInternalBounds(Entry.second);
 }
 
 void FSceneBVH::RefitLeafBounds(int64 LeafNodeIndex)
@@ -456,7 +652,7 @@ void FSceneBVH::RefitLeafBounds(int64 LeafNodeIndex)
 		BMin.X = std::min(BMin.X, A.Min.X); BMin.Y = std::min(BMin.Y, A.Min.Y); BMin.Z = std::min(BMin.Z, A.Min.Z);
 		BMax.X = std::max(BMax.X, A.Max.X); BMax.Y = std::max(BMax.Y, A.Max.Y); BMax.Z = std::max(BMax.Z, A.Max.Z);
 	}
-	NodeRef.Bounds = FAABB(BMin, BMax);
+	SetNodeBounds(LeafNodeIndex, FAABB(BMin, BMax));
 }
 
 void FSceneBVH::RefitInternalBounds(int64 NodeIndex)
@@ -475,7 +671,7 @@ void FSceneBVH::RefitInternalBounds(int64 NodeIndex)
 	FVector BMax(std::max(L.Max.X, R.Max.X),
 		std::max(L.Max.Y, R.Max.Y),
 		std::max(L.Max.Z, R.Max.Z));
-	NodeRef.Bounds = FAABB(BMin, BMax);
+	SetNodeBounds(NodeIndex, FAABB(BMin, BMax));
 }
 
 void FSceneBVH::RefitNode(int64 NodeIndex)
@@ -492,6 +688,491 @@ void FSceneBVH::RefitNode(int64 NodeIndex)
 	RefitInternalBounds(NodeIndex);
 }
 
+// --- 증분 갱신 ---
+
+int64 FSceneBVH::AllocateNode()
+{
+	if (!FreeNodes.empty())
+	{
+		const int64 NodeIndex = FreeNodes.back();
+		FreeNodes.pop_back();
+		return NodeIndex;
+	}
+
+	Nodes.push_back(FNode{});
+	Parent.push_back(-1);
+	EnsureNodeSoASize();
+	return static_cast<int64>(Nodes.size()) - 1;
+}
+
+void FSceneBVH::FreeNode(int64 NodeIndex)
+{
+	SAHCostSum -= NodeSAHTerm(Nodes[NodeIndex]);
+	Nodes[NodeIndex] = FNode{};
+	Parent[NodeIndex] = -1;
+	FreeNodes.push_back(NodeIndex);
+}
+
+int32 FSceneBVH::GetNodeDepth(int64 NodeIndex) const
+{
+	int32 Depth = 0;
+	for (int64 N = Parent[NodeIndex]; N >= 0; N = Parent[N])
+	{
+		++Depth;
+	}
+	return Depth;
+}
+
+void FSceneBVH::ReplaceChild(int64 ParentIndex, int64 OldChild, int64 NewChild)
+{
+	if (ParentIndex < 0)
+	{
+		RootIndex = NewChild;
+	}
+	else if (Nodes[ParentIndex].Left == OldChild)
+	{
+		Nodes[ParentIndex].Left = NewChild;
+	}
+	else
+	{
+		Nodes[ParentIndex].Right = NewChild;
+	}
+	Parent[NewChild] = ParentIndex;
+}
+
+int64 FSceneBVH::Insert(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive)
+	{
+		return -1;
+	}
+
+	FVector MinW{}, MaxW{};
+	InPrimitive->GetWorldAABB(MinW, MaxW);
+	return Insert(InPrimitive, FAABB(MinW, MaxW));
+}
+
+int64 FSceneBVH::Insert(UPrimitiveComponent* InPrimitive, const FAABB& InBounds)
+{
+	// 이미 들어 있으면 빼고 새 위치에 다시 삽입 (반환된 슬롯을 바로 재사용하므로 인덱스는 유지됨)
+	if (InPrimitive)
+	{
+		auto It = PrimIndexMap.find(InPrimitive);
+		if (It != PrimIndexMap.end())
+		{
+			RemoveByIndex(It->second);
+		}
+	}
+
+	bWideLayoutDirty = true;
+
+	// 1) 프리미티브 슬롯 (제거된 슬롯 우선 재사용)
+	int64 PrimIdx;
+	if (!FreePrimSlots.empty())
+	{
+		PrimIdx = FreePrimSlots.back();
+		FreePrimSlots.pop_back();
+	}
+	else
+	{
+		PrimIdx = static_cast<int64>(Primitives.size());
+		Primitives.push_back(nullptr);
+		PrimBounds.emplace_back();
+		PrimToLeaf.push_back(-1);
+		EnsurePrimSoASize();
+	}
+
+	Primitives[PrimIdx] = InPrimitive;
+	if (InPrimitive)
+	{
+		PrimIndexMap[InPrimitive] = PrimIdx;
+	}
+	SetPrimBounds(PrimIdx, InBounds.Min, InBounds.Max);
+	++NumLivePrimitives;
+
+	if (PendingRebuild)
+	{
+		PendingRebuild->Ops.push_back({ FPendingRebuild::EOp::Insert, PrimIdx, InPrimitive, InBounds });
+	}
+
+	// 2) 프리미티브 1개짜리 리프 생성
+	int64 IndexSlot;
+	if (!FreeIndexSlots.empty())
+	{
+		IndexSlot = FreeIndexSlots.back();
+		FreeIndexSlots.pop_back();
+	}
+	else
+	{
+		IndexSlot = static_cast<int64>(Indices.size());
+		Indices.push_back(-1);
+	}
+	Indices[IndexSlot] = PrimIdx;
+
+	const int64 LeafIndex = AllocateNode();
+	Nodes[LeafIndex].Start = IndexSlot;
+	Nodes[LeafIndex].Count = 1;
+	SetNodeBounds(LeafIndex, InBounds);
+	PrimToLeaf[PrimIdx] = LeafIndex;
+
+	// 3) 트리에 연결
+	InsertLeaf(LeafIndex);
+
+	// 회전으로도 균형이 맞지 않는 입력(일직선 배치 등)이면 트래버설 스택이 넘치기 전에 재구성
+	if (GetNodeDepth(LeafIndex) > MaxIncrementalDepth)
+	{
+		RebuildTopology(EBVHBuildMode::Parallel, nullptr);
+	}
+	return PrimIdx;
+}
+
+void FSceneBVH::InsertLeaf(int64 LeafIndex)
+{
+	if (RootIndex < 0)
+	{
+		RootIndex = LeafIndex;
+		Parent[LeafIndex] = -1;
+		return;
+	}
+
+	const FAABB LeafBounds = Nodes[LeafIndex].Bounds;
+	const int64 Sibling = FindBestSibling(LeafBounds);
+	const int64 OldParent = Parent[Sibling];
+
+	// 형제와 새 리프를 자식으로 갖는 부모 노드를 형제 자리에 끼워 넣는다
+	const int64 NewParent = AllocateNode();
+	Nodes[NewParent].Left = Sibling;
+	Nodes[NewParent].Right = LeafIndex;
+	ReplaceChild(OldParent, Sibling, NewParent);
+	Parent[Sibling] = NewParent;
+	Parent[LeafIndex] = NewParent;
+	RefitInternalBounds(NewParent);
+
+	RefitAncestors(OldParent);
+}
+
+// Branch-and-bound 탐색: 비용 = 형제와 합친 새 부모 면적 + 조상들이 늘어나는 면적의 합
+// 자식 방향으로 내려갈 때의 하한(상속 비용 + 리프 면적)이 현재 최선보다 크면 가지친다
+int64 FSceneBVH::FindBestSibling(const FAABB& InLeafBounds) const
+{
+	auto UnionArea = [](const FAABB& A, const FAABB& B)
+		{
+			FVector Mn = A.Min;
+			FVector Mx = A.Max;
+			ExpandMinMax(Mn, Mx, B);
+			return SurfaceArea(FAABB(Mn, Mx));
+		};
+
+	const float LeafArea = SurfaceArea(InLeafBounds);
+
+	int64 BestSibling = RootIndex;
+	float BestCost = UnionArea(Nodes[RootIndex].Bounds, InLeafBounds);
+
+	using FCandidate = std::pair<float, int64>; // (상속 비용, 노드)
+	TPriorityQueue<FCandidate, TArray<FCandidate>, std::greater<FCandidate>> Queue;
+	Queue.push({ 0.0f, RootIndex });
+
+	while (!Queue.empty())
+	{
+		const auto [InheritedCost, NodeIndex] = Queue.top();
+		Queue.pop();
+		if (InheritedCost + LeafArea >= BestCost)
+		{
+			break;
+		}
+
+		const FNode& NodeRef = Nodes[NodeIndex];
+		const float DirectCost = UnionArea(NodeRef.Bounds, InLeafBounds);
+		const float Cost = InheritedCost + DirectCost;
+		if (Cost < BestCost)
+		{
+			BestCost = Cost;
+			BestSibling = NodeIndex;
+		}
+
+		if (!NodeRef.IsLeaf())
+		{
+			const float ChildInherited = InheritedCost + DirectCost - SurfaceArea(NodeRef.Bounds);
+			if (ChildInherited + LeafArea < BestCost)
+			{
+				Queue.push({ ChildInherited, NodeRef.Left });
+				Queue.push({ ChildInherited, NodeRef.Right });
+			}
+		}
+	}
+	return BestSibling;
+}
+
+void FSceneBVH::RefitAncestors(int64 NodeIndex)
+{
+	while (NodeIndex >= 0)
+	{
+		RefitInternalBounds(NodeIndex);
+		RotateNode(NodeIndex);
+		NodeIndex = Parent[NodeIndex];
+	}
+}
+
+// 노드 A의 자식 B, C에 대해 B <-> C의 자식, C <-> B의 자식 교환을 검사
+// A의 바운드는 그대로이고 자식을 내준 쪽 내부 노드의 면적만 바뀌므로 그 차이로 이득을 계산
+void FSceneBVH::RotateNode(int64 NodeIndex)
+{
+	const FNode& A = Nodes[NodeIndex];
+	if (A.IsLeaf())
+	{
+		return;
+	}
+
+	auto UnionArea = [this](int64 X, int64 Y)
+		{
+			FVector Mn = Nodes[X].Bounds.Min;
+			FVector Mx = Nodes[X].Bounds.Max;
+			ExpandMinMax(Mn, Mx, Nodes[Y].Bounds);
+			return SurfaceArea(FAABB(Mn, Mx));
+		};
+
+	const int64 B = A.Left;
+	const int64 C = A.Right;
+
+	float BestGain = 0.0f;
+	int64 BestChild = -1;       // A에서 내려보낼 자식
+	int64 BestGrandChild = -1;  // 끌어올릴 손자
+
+	// B를 C의 자식과 교환: C의 면적이 바뀜
+	if (!Nodes[C].IsLeaf())
+	{
+		const float AreaC = SurfaceArea(Nodes[C].Bounds);
+		const int64 F = Nodes[C].Left;
+		const int64 G = Nodes[C].Right;
+
+		const float GainBF = AreaC - UnionArea(B, G);
+		if (GainBF > BestGain) { BestGain = GainBF; BestChild = B; BestGrandChild = F; }
+		const float GainBG = AreaC - UnionArea(B, F);
+		if (GainBG > BestGain) { BestGain = GainBG; BestChild = B; BestGrandChild = G; }
+	}
+
+	// C를 B의 자식과 교환: B의 면적이 바뀜
+	if (!Nodes[B].IsLeaf())
+	{
+		const float AreaB = SurfaceArea(Nodes[B].Bounds);
+		const int64 D = Nodes[B].Left;
+		const int64 E = Nodes[B].Right;
+
+		const float GainCD = AreaB - UnionArea(C, E);
+		if (GainCD > BestGain) { BestGain = GainCD; BestChild = C; BestGrandChild = D; }
+		const float GainCE = AreaB - UnionArea(C, D);
+		if (GainCE > BestGain) { BestGain = GainCE; BestChild = C; BestGrandChild = E; }
+	}
+
+	if (BestChild < 0)
+	{
+		return;
+	}
+
+	const int64 Other = (BestChild == B) ? C : B;
+	ReplaceChild(NodeIndex, BestChild, BestGrandChild);
+	ReplaceChild(Other, BestGrandChild, BestChild);
+	RefitInternalBounds(Other);
+}
+
+bool FSceneBVH::Remove(UPrimitiveComponent* InPrimitive)
+{
+	auto It = PrimIndexMap.find(InPrimitive);
+	if (It == PrimIndexMap.end())
+	{
+		return false;
+	}
+	return RemoveByIndex(It->second);
+}
+
+bool FSceneBVH::RemoveByIndex(int64 PrimIdx)
+{
+	if (PrimIdx < 0 || PrimIdx >= static_cast<int64>(PrimToLeaf.size()))
+	{
+		return false;
+	}
+
+	const int64 LeafIndex = PrimToLeaf[PrimIdx];
+	if (LeafIndex < 0)
+	{
+		return false;
+	}
+
+	if (PendingRebuild)
+	{
+		PendingRebuild->Ops.push_back({ FPendingRebuild::EOp::Remove, PrimIdx, Primitives[PrimIdx], FAABB() });
+	}
+	bWideLayoutDirty = true;
+
+	// 1) 리프 구간에서 마지막 원소와 맞바꿔 제거
+	FNode& Leaf = Nodes[LeafIndex];
+	for (int64 I = 0; I < Leaf.Count; ++I)
+	{
+		if (Indices[Leaf.Start + I] == PrimIdx)
+		{
+			std::swap(Indices[Leaf.Start + I], Indices[Leaf.Start + Leaf.Count - 1]);
+			break;
+		}
+	}
+	SAHCostSum -= NodeSAHTerm(Leaf);
+	--Leaf.Count;
+	SAHCostSum += NodeSAHTerm(Leaf);
+
+	// 2) 프리미티브 슬롯 반환
+	if (Primitives[PrimIdx])
+	{
+		PrimIndexMap.erase(Primitives[PrimIdx]);
+	}
+	Primitives[PrimIdx] = nullptr;
+	PrimToLeaf[PrimIdx] = -1;
+	FreePrimSlots.push_back(PrimIdx);
+	--NumLivePrimitives;
+
+	// 3) 리프가 남아 있으면 바운드만 줄이고, 비었으면 접는다
+	if (Nodes[LeafIndex].Count > 0)
+	{
+		RefitLeafBounds(LeafIndex);
+		RefitAncestors(Parent[LeafIndex]);
+	}
+	else
+	{
+		RemoveLeaf(LeafIndex);
+	}
+	return true;
+}
+
+void FSceneBVH::RemoveLeaf(int64 LeafIndex)
+{
+	FreeIndexSlots.push_back(Nodes[LeafIndex].Start);
+
+	const int64 ParentIndex = Parent[LeafIndex];
+	if (ParentIndex < 0)
+	{
+		// 마지막 리프
+		FreeNode(LeafIndex);
+		RootIndex = -1;
+		return;
+	}
+
+	// 형제가 부모 자리를 대신한다
+	const int64 Sibling = (Nodes[ParentIndex].Left == LeafIndex) ? Nodes[ParentIndex].Right : Nodes[ParentIndex].Left;
+	const int64 GrandParent = Parent[ParentIndex];
+	ReplaceChild(GrandParent, ParentIndex, Sibling);
+
+	FreeNode(LeafIndex);
+	FreeNode(ParentIndex);
+
+	RefitAncestors(GrandParent);
+}
+
+void FSceneBVH::RebuildTopology(EBVHBuildMode InMode, FTaskScheduler* InScheduler)
+{
+	// 슬롯 번호는 그대로 두고 리프에 속한(살아 있는) 프리미티브만 모은다
+	Indices.clear();
+	Indices.reserve(NumLivePrimitives);
+	for (int64 I = 0; I < static_cast<int64>(PrimToLeaf.size()); ++I)
+	{
+		if (PrimToLeaf[I] >= 0)
+		{
+			Indices.push_back(I);
+		}
+	}
+	std::fill(PrimToLeaf.begin(), PrimToLeaf.end(), -1);
+
+	FreeNodes.clear();
+	FreeIndexSlots.clear();
+
+	if (Indices.empty())
+	{
+		Nodes.clear();
+		Parent.clear();
+		WideNodes4.clear();
+		WideNodes8.clear();
+		WideSlotOfNode.clear();
+		RootIndex = -1;
+		SAHCostSum = 0.0;
+		BuildSAHCost = 0.0f;
+		return;
+	}
+
+	BuildTree(InMode, InScheduler);
+}
+
+void FSceneBVH::StartAsyncRebuild(FTaskScheduler& InScheduler)
+{
+	if (PendingRebuild || RootIndex < 0)
+	{
+		return;
+	}
+
+	// 메인 스레드에서 바운드/슬롯 상태만 복사 (컴포넌트는 워커에서 건드리지 않음)
+	TSharedPtr<FPendingRebuild> Pending = std::make_shared<FPendingRebuild>();
+	FSceneBVH& Result = Pending->Result;
+	Result.Primitives = Primitives;
+	Result.PrimBounds = PrimBounds;
+	Result.PrimToLeaf = PrimToLeaf;
+	Result.FreePrimSlots = FreePrimSlots;
+	Result.NumLivePrimitives = NumLivePrimitives;
+	Result.Layout = Layout;
+	Result.PrimMinX = PrimMinX; Result.PrimMinY = PrimMinY; Result.PrimMinZ = PrimMinZ;
+	Result.PrimMaxX = PrimMaxX; Result.PrimMaxY = PrimMaxY; Result.PrimMaxZ = PrimMaxZ;
+	Result.PrimCentX = PrimCentX; Result.PrimCentY = PrimCentY; Result.PrimCentZ = PrimCentZ;
+	Result.PrimSphereRadiusSq = PrimSphereRadiusSq;
+	PendingRebuild = Pending;
+
+	// 작업이 공유 포인터를 잡고 있으므로 그 사이 Clear()로 버려져도 안전
+	InScheduler.Dispatch(Pending->Group, [Pending]()
+		{
+			FSceneBVH& Tree = Pending->Result;
+			Tree.PrimIndexMap.reserve(Tree.NumLivePrimitives);
+			for (int64 I = 0; I < static_cast<int64>(Tree.Primitives.size()); ++I)
+			{
+				if (Tree.Primitives[I] && Tree.PrimToLeaf[I] >= 0)
+				{
+					Tree.PrimIndexMap[Tree.Primitives[I]] = I;
+				}
+			}
+			// 이미 워커 위이므로 하위 작업 분할 없이 직렬 빌드
+			Tree.RebuildTopology(EBVHBuildMode::Serial, nullptr);
+		});
+}
+
+bool FSceneBVH::TryFinishAsyncRebuild()
+{
+	if (!PendingRebuild || !PendingRebuild->Group.IsDone())
+	{
+		return false;
+	}
+
+	TSharedPtr<FPendingRebuild> Finished = std::move(PendingRebuild);
+	FSceneBVH& Result = Finished->Result;
+
+	// 빌드하는 동안 쌓인 변경을 같은 순서로 재적용
+	for (const FPendingRebuild::FOp& Op : Finished->Ops)
+	{
+		switch (Op.Type)
+		{
+		case FPendingRebuild::EOp::Insert:
+			Result.Insert(Op.Primitive, Op.Bounds);
+			break;
+		case FPendingRebuild::EOp::Remove:
+			Result.RemoveByIndex(Op.PrimIdx);
+			break;
+		case FPendingRebuild::EOp::Refit:
+			if (Op.PrimIdx < static_cast<int64>(Result.PrimToLeaf.size()) && Result.PrimToLeaf[Op.PrimIdx] >= 0)
+			{
+				Result.SetPrimBounds(Op.PrimIdx, Op.Bounds.Min, Op.Bounds.Max);
+				Result.RefitLeafBounds(Result.PrimToLeaf[Op.PrimIdx]);
+				Result.RefitAncestors(Result.Parent[Result.PrimToLeaf[Op.PrimIdx]]);
+			}
+			break;
+		}
+	}
+
+	*this = std::move(Result);
+	return true;
+}
+
 // --- New helper: ensure SoA arrays match PrimBounds size ---
 void FSceneBVH::EnsurePrimSoASize() const
 {
@@ -592,122 +1273,221 @@ void FSceneBVH::MakeLeafNode(int64 NodeIndex, const FVector& BMin, const FVector
 	}
 }
 
-// Helper: FindBestSplit using binned SAH (refactored from TryAxis)
-void FSceneBVH::FindBestSplit(const int64* IndexPtr, int64 Count, const FVector& CentMin, const FVector& CentMax,
+void FSceneBVH::FSplitBins::Reset()
+{
+	const FVector PosInf(std::numeric_limits<float>::infinity(),
+		std::numeric_limits<float>::infinity(),
+		std::numeric_limits<float>::infinity());
+	const FVector NegInf(-std::numeric_limits<float>::infinity(),
+		-std::numeric_limits<float>::infinity(),
+		-std::numeric_limits<float>::infinity());
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		for (int32 b = 0; b < SplitBinCount; ++b)
+		{
+			Counts[Axis][b] = 0;
+			BinMin[Axis][b] = PosInf;
+			BinMax[Axis][b] = NegInf;
+		}
+	}
+}
+
+void FSceneBVH::FSplitBins::Merge(const FSplitBins& Other)
+{
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		for (int32 b = 0; b < SplitBinCount; ++b)
+		{
+			Counts[Axis][b] += Other.Counts[Axis][b];
+			ExpandMinMax(BinMin[Axis][b], BinMax[Axis][b], FAABB(Other.BinMin[Axis][b], Other.BinMax[Axis][b]));
+		}
+	}
+}
+
+// 병렬 리덕션: 고정 개수의 청크로 나누어 부분 바운드를 구한 뒤 합친다.
+// min/max는 순서에 무관하므로 직렬 ComputeBoundsForRange/ComputeCentroidBoundsForRange와 결과가 같다.
+void FSceneBVH::ComputeBoundsForRangeParallel(FTaskScheduler& Scheduler, const int64* IndexPtr, int64 Count,
+	FVector& OutMin, FVector& OutMax, FVector& OutCentMin, FVector& OutCentMax) const
+{
+	struct FPartialBounds { FVector Min, Max, CentMin, CentMax; };
+
+	const int64 NumChunks = static_cast<int64>(Scheduler.GetConcurrency()) * 4;
+	const int64 ChunkSize = (Count + NumChunks - 1) / NumChunks;
+	TArray<FPartialBounds> Partials(NumChunks);
+
+	Scheduler.ParallelFor(NumChunks, 1, [&](int64 Begin, int64 End)
+		{
+			for (int64 Chunk = Begin; Chunk < End; ++Chunk)
+			{
+				const int64 First = std::min(Count, Chunk * ChunkSize);
+				const int64 Num = std::min(Count, First + ChunkSize) - First;
+				FPartialBounds& P = Partials[Chunk];
+				ComputeBoundsForRange(IndexPtr + First, Num, P.Min, P.Max);
+				ComputeCentroidBoundsForRange(IndexPtr + First, Num, P.CentMin, P.CentMax);
+			}
+		});
+
+	ComputeBoundsForRange(IndexPtr, 0, OutMin, OutMax);
+	ComputeCentroidBoundsForRange(IndexPtr, 0, OutCentMin, OutCentMax);
+	for (const FPartialBounds& P : Partials)
+	{
+		ExpandMinMax(OutMin, OutMax, FAABB(P.Min, P.Max));
+		ExpandMinMax(OutCentMin, OutCentMax, FAABB(P.CentMin, P.CentMax));
+	}
+}
+
+// 3축의 빈을 한 번의 순회로 채운다 (centroid 폭이 0인 축은 건너뜀)
+void FSceneBVH::AccumulateSplitBins(const int64* IndexPtr, int64 Count, const FVector& CentMin, const FVector& CentMax, FSplitBins& InOutBins) const
+{
+	const float AxisMin[3] = { CentMin.X, CentMin.Y, CentMin.Z };
+	const float AxisExt[3] = { CentMax.X - CentMin.X, CentMax.Y - CentMin.Y, CentMax.Z - CentMin.Z };
+	const bool bAxisValid[3] = { AxisExt[0] > 1e-6f, AxisExt[1] > 1e-6f, AxisExt[2] > 1e-6f };
+	const float InvExt[3] = {
+		bAxisValid[0] ? 1.0f / AxisExt[0] : 0.0f,
+		bAxisValid[1] ? 1.0f / AxisExt[1] : 0.0f,
+		bAxisValid[2] ? 1.0f / AxisExt[2] : 0.0f };
+
+	for (int64 I = 0; I < Count; ++I)
+	{
+		const int64 PrimIdx = IndexPtr[I];
+		const float C[3] = { PrimCentX[PrimIdx], PrimCentY[PrimIdx], PrimCentZ[PrimIdx] };
+		const FAABB& PB = PrimBounds[PrimIdx];
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (!bAxisValid[Axis]) continue;
+
+			int32 BinId = static_cast<int32>(((C[Axis] - AxisMin[Axis]) * InvExt[Axis]) * SplitBinCount);
+			if (BinId < 0) BinId = 0;
+			if (BinId >= SplitBinCount) BinId = SplitBinCount - 1;
+
+			++InOutBins.Counts[Axis][BinId];
+			ExpandMinMax(InOutBins.BinMin[Axis][BinId], InOutBins.BinMax[Axis][BinId], PB);
+		}
+	}
+}
+
+void FSceneBVH::EvaluateSplitBins(const FSplitBins& Bins, const FVector& CentMin, const FVector& CentMax,
 	int& OutBestAxis, int& OutBestSplitBin, float& OutBestCost) const
 {
-	constexpr int32 BinCount = 32;
 	OutBestAxis = -1;
 	OutBestSplitBin = -1;
 	OutBestCost = std::numeric_limits<float>::infinity();
 
 	const FVector CExt = CentMax - CentMin;
-	auto TryAxisFn = [&](int Axis)
-		{
-			const float Ext = (Axis == 0 ? CExt.X : (Axis == 1 ? CExt.Y : CExt.Z));
-			if (Ext <= 1e-6f) return;
+	for (int Axis = 0; Axis < 3; ++Axis)
+	{
+		const float Ext = (Axis == 0 ? CExt.X : (Axis == 1 ? CExt.Y : CExt.Z));
+		if (Ext <= 1e-6f) continue;
 
-			int32 Counts[BinCount] = { 0 };
-			FVector BinMin[BinCount];
-			FVector BinMax[BinCount];
-			for (int32 b = 0; b < BinCount; ++b)
+		const int32* Counts = Bins.Counts[Axis];
+		const FVector* BinMin = Bins.BinMin[Axis];
+		const FVector* BinMax = Bins.BinMax[Axis];
+
+		// prefix/suffix
+		int32 LeftCount[SplitBinCount] = { 0 };
+		FAABB LeftBox[SplitBinCount];
+		for (int32 b = 0; b < SplitBinCount; ++b)
+		{
+			if (b == 0)
 			{
-				BinMin[b] = FVector(std::numeric_limits<float>::infinity(),
-					std::numeric_limits<float>::infinity(),
-					std::numeric_limits<float>::infinity());
-				BinMax[b] = FVector(-std::numeric_limits<float>::infinity(),
-					-std::numeric_limits<float>::infinity(),
-					-std::numeric_limits<float>::infinity());
+				LeftCount[b] = Counts[b];
+				LeftBox[b] = FAABB(BinMin[b], BinMax[b]);
 			}
-
-			const float InvExt = 1.0f / Ext;
-			for (int64 I = 0; I < Count; ++I)
+			else
 			{
-				const int64 PrimIdx = IndexPtr[I];
-				const FAABB& A = PrimBounds[PrimIdx];
-				const FVector C{ (A.Min.X + A.Max.X) * 0.5f, (A.Min.Y + A.Max.Y) * 0.5f, (A.Min.Z + A.Max.Z) * 0.5f };
-				const float CAxis = (Axis == 0 ? C.X : (Axis == 1 ? C.Y : C.Z));
-				int32 BinId = static_cast<int32>(((CAxis - (Axis == 0 ? CentMin.X : (Axis == 1 ? CentMin.Y : CentMin.Z))) * InvExt) * BinCount);
-				if (BinId < 0) BinId = 0;
-				if (BinId >= BinCount) BinId = BinCount - 1;
-
-				++Counts[BinId];
-				const FAABB& PB = PrimBounds[PrimIdx];
-				BinMin[BinId].X = std::min(BinMin[BinId].X, PB.Min.X);
-				BinMin[BinId].Y = std::min(BinMin[BinId].Y, PB.Min.Y);
-				BinMin[BinId].Z = std::min(BinMin[BinId].Z, PB.Min.Z);
-				BinMax[BinId].X = std::max(BinMax[BinId].X, PB.Max.X);
-				BinMax[BinId].Y = std::max(BinMax[BinId].Y, PB.Max.Y);
-				BinMax[BinId].Z = std::max(BinMax[BinId].Z, PB.Max.Z);
+				LeftCount[b] = LeftCount[b - 1] + Counts[b];
+				FVector LMn = LeftBox[b - 1].Min;
+				FVector LMx = LeftBox[b - 1].Max;
+				ExpandMinMax(LMn, LMx, FAABB(BinMin[b], BinMax[b]));
+				LeftBox[b] = FAABB(LMn, LMx);
 			}
+		}
 
-			// prefix/suffix
-			int32 LeftCount[BinCount] = { 0 };
-			FAABB LeftBox[BinCount];
-			for (int32 b = 0; b < BinCount; ++b)
+		int32 RightCount[SplitBinCount] = { 0 };
+		FAABB RightBox[SplitBinCount];
+		for (int32 b = SplitBinCount - 1; b >= 0; --b)
+		{
+			if (b == SplitBinCount - 1)
 			{
-				if (b == 0)
-				{
-					LeftCount[b] = Counts[b];
-					LeftBox[b] = FAABB(BinMin[b], BinMax[b]);
-				}
-				else
-				{
-					LeftCount[b] = LeftCount[b - 1] + Counts[b];
-					FVector LMn = LeftBox[b - 1].Min;
-					FVector LMx = LeftBox[b - 1].Max;
-					FAABB Add(BinMin[b], BinMax[b]);
-					ExpandMinMax(LMn, LMx, Add);
-					LeftBox[b] = FAABB(LMn, LMx);
-				}
+				RightCount[b] = Counts[b];
+				RightBox[b] = FAABB(BinMin[b], BinMax[b]);
 			}
-
-			int32 RightCount[BinCount] = { 0 };
-			FAABB RightBox[BinCount];
-			for (int32 b = BinCount - 1; b >= 0; --b)
+			else
 			{
-				if (b == BinCount - 1)
-				{
-					RightCount[b] = Counts[b];
-					RightBox[b] = FAABB(BinMin[b], BinMax[b]);
-				}
-				else
-				{
-					RightCount[b] = RightCount[b + 1] + Counts[b];
-					FVector RMn = RightBox[b + 1].Min;
-					FVector RMx = RightBox[b + 1].Max;
-					FAABB Add(BinMin[b], BinMax[b]);
-					ExpandMinMax(RMn, RMx, Add);
-					RightBox[b] = FAABB(RMn, RMx);
-				}
+				RightCount[b] = RightCount[b + 1] + Counts[b];
+				FVector RMn = RightBox[b + 1].Min;
+				FVector RMx = RightBox[b + 1].Max;
+				ExpandMinMax(RMn, RMx, FAABB(BinMin[b], BinMax[b]));
+				RightBox[b] = FAABB(RMn, RMx);
 			}
+		}
 
-			for (int32 s = 0; s < BinCount - 1; ++s)
+		for (int32 s = 0; s < SplitBinCount - 1; ++s)
+		{
+			const int32 NL = LeftCount[s];
+			const int32 NR = RightCount[s + 1];
+			if (NL == 0 || NR == 0) continue;
+
+			const float SAL = SurfaceArea(LeftBox[s]);
+			const float SAR = SurfaceArea(RightBox[s + 1]);
+			const float Cost = SAL * NL + SAR * NR;
+
+			if (Cost < OutBestCost)
 			{
-				const int32 NL = LeftCount[s];
-				const int32 NR = RightCount[s + 1];
-				if (NL == 0 || NR == 0) continue;
+				OutBestCost = Cost;
+				OutBestAxis = Axis;
+				OutBestSplitBin = s;
+			}
+		}
+	}
+}
 
-				const float SAL = SurfaceArea(LeftBox[s]);
-				const float SAR = SurfaceArea(RightBox[s + 1]);
-				const float Cost = SAL * NL + SAR * NR;
+// Helper: FindBestSplit using binned SAH
+// Scheduler가 있으면 청크별 빈을 병렬로 채운 뒤 병합 (카운트 합/바운드 min-max라 직렬과 결과 동일)
+void FSceneBVH::FindBestSplit(const int64* IndexPtr, int64 Count, const FVector& CentMin, const FVector& CentMax,
+	int& OutBestAxis, int& OutBestSplitBin, float& OutBestCost, FTaskScheduler* Scheduler) const
+{
+	OutBestAxis = -1;
+	OutBestSplitBin = -1;
+	OutBestCost = std::numeric_limits<float>::infinity();
 
-				if (Cost < OutBestCost)
+	if ((CentMax.X - CentMin.X) <= 1e-6f && (CentMax.Y - CentMin.Y) <= 1e-6f && (CentMax.Z - CentMin.Z) <= 1e-6f)
+	{
+		return;
+	}
+
+	FSplitBins Bins;
+	Bins.Reset();
+
+	if (Scheduler)
+	{
+		const int64 NumChunks = static_cast<int64>(Scheduler->GetConcurrency()) * 4;
+		const int64 ChunkSize = (Count + NumChunks - 1) / NumChunks;
+		TArray<FSplitBins> Partials(NumChunks);
+
+		Scheduler->ParallelFor(NumChunks, 1, [&](int64 Begin, int64 End)
+			{
+				for (int64 Chunk = Begin; Chunk < End; ++Chunk)
 				{
-					OutBestCost = Cost;
-					OutBestAxis = Axis;
-					OutBestSplitBin = s;
+					const int64 First = std::min(Count, Chunk * ChunkSize);
+					const int64 Num = std::min(Count, First + ChunkSize) - First;
+					Partials[Chunk].Reset();
+					AccumulateSplitBins(IndexPtr + First, Num, CentMin, CentMax, Partials[Chunk]);
 				}
-			}
-		};
+			});
 
-	// try axes
-	if (!((CentMax.X - CentMin.X) <= 1e-6f && (CentMax.Y - CentMin.Y) <= 1e-6f && (CentMax.Z - CentMin.Z) <= 1e-6f))
+		for (const FSplitBins& Partial : Partials)
+		{
+			Bins.Merge(Partial);
+		}
+	}
+	else
 	{
-		TryAxisFn(0);
-		TryAxisFn(1);
-		TryAxisFn(2);
+		AccumulateSplitBins(IndexPtr, Count, CentMin, CentMax, Bins);
 	}
+
+	EvaluateSplitBins(Bins, CentMin, CentMax, OutBestAxis, OutBestSplitBin, OutBestCost);
 }
 
 // Internal ray-AABB slab test that returns TMin/TMax
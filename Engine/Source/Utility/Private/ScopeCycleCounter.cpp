@@ -61,42 +61,49 @@ char GStat_Picking_Tag = 0;
 
 TStatId GetPickingStatId()
 {
-	return TStatId(&GStat_Picking_Tag, FName("Picking"));
+	return TStatId(&GStat_Picking_Tag, NAME_LITERAL("Picking"));
 }
 
 char GStat_PickPrimitive_Tag = 0;
 
 TStatId GetPickPrimitiveStatId()
 {
-	return TStatId(&GStat_PickPrimitive_Tag, FName("PickPrimitive"));
+	return TStatId(&GStat_PickPrimitive_Tag, NAME_LITERAL("PickPrimitive"));
 }
 
 char GStat_SceneBVHTraverse_Tag = 0;
 
 TStatId GetSceneBVHTraverseStatId()
 {
-	return TStatId(&GStat_SceneBVHTraverse_Tag, FName("SceneBVHTraverse"));
+	return TStatId(&GStat_SceneBVHTraverse_Tag, NAME_LITERAL("SceneBVHTraverse"));
 }
 
 char GStat_StaticMeshBVHTraverse_Tag = 0;
 
 TStatId GetStaticMeshBVHTraverseStatId()
 {
-	return TStatId(&GStat_StaticMeshBVHTraverse_Tag, FName("StaticMeshBVHTraverse"));
+	return TStatId(&GStat_StaticMeshBVHTraverse_Tag, NAME_LITERAL("StaticMeshBVHTraverse"));
 }
 
 char GStat_Culling_Tag = 0;
 
 TStatId GetCullingStatId()
 {
-	return TStatId(&GStat_Culling_Tag, FName("Culling"));
+	return TStatId(&GStat_Culling_Tag, NAME_LITERAL("Culling"));
+}
+
+char GStat_FrustumCulling_Tag = 0;
+
+TStatId GetFrustumCullingStatId()
+{
+	return TStatId(&GStat_FrustumCulling_Tag, NAME_LITERAL("FrustumCulling"));
 }
 
 char GStat_VisitTriangle_Tag = 0;
 
 TStatId GetVisitTriangleStatId()
 {
-	return TStatId(&GStat_VisitTriangle_Tag, FName("VisitTriangle"));
+	return TStatId(&GStat_VisitTriangle_Tag, NAME_LITERAL("VisitTriangle"));
 }
 
 /*---------------------------------*/
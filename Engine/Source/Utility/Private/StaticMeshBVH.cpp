@@ -1,11 +1,14 @@
 #include "pch.h"
 #include "Utility/Public/StaticMeshBVH.h"
 #include "Utility/Public/ScopeCycleCounter.h"
+#include <fstream>
 
 // ======= FStaticMeshBVH =======
 void FStaticMeshBVH::Clear()
 {
 	Nodes.clear();
+	WideNodes4.clear();
+	WideNodes8.clear();
 	TriRefs.clear();
 	TriBounds.clear();
 	Vtx = nullptr;
@@ -360,6 +363,28 @@ void FStaticMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<u
 	int32 idx = 0;
 	for (int32 i = 0; i < NumTris; ++i) NewRefs[idx++] = { Temp[i] };
 	TriRefs.swap(NewRefs);
+
+	BuildWideNodes();
+}
+
+void FStaticMeshBVH::SetTraversalLayout(EBVHLayout InLayout)
+{
+	if (Layout == InLayout) return;
+	Layout = InLayout;
+	BuildWideNodes();
+}
+
+void FStaticMeshBVH::BuildWideNodes()
+{
+	WideNodes4.clear();
+	WideNodes8.clear();
+	if (Nodes.empty()) return;
+
+	// 루트는 항상 0번 (BuildRecursive가 전위 순서로 노드를 추가)
+	if (Layout == EBVHLayout::Wide8)
+		FWideBVH::Collapse<8>(Nodes, 0, WideNodes8);
+	else if (Layout == EBVHLayout::Wide4)
+		FWideBVH::Collapse<4>(Nodes, 0, WideNodes4);
 }
 
 bool FStaticMeshBVH::RayIntersectsAABB(const FRayCached& Ray, const FAABB& Box, float& OutTMin, float& OutTMax)
@@ -393,3 +418,320 @@ void FStaticMeshBVH::EnsureTriSoASize() const
 		TriRadiusSq.resize(N);
 	}
 }
+
+template<int32 PacketSize>
+void FStaticMeshBVH::TraversePacket(TRayPacket<PacketSize>& Packet, int32* OutTriIndex) const
+{
+	// 스택 원소: 노드, 이 노드와 교차한 레인 마스크, 그 레인들의 최소 진입 거리
+	struct FEntry { int32 Index; uint32 Mask; float TMin; };
+	FEntry Stack[256];
+	int32 SP = 0;
+
+	alignas(16) float LNear[PacketSize];
+	alignas(16) float RNear[PacketSize];
+
+	const uint32 RootMask = Packet.IntersectAABB(Nodes[0].Bounds, Packet.ValidMask, LNear);
+	if (RootMask == 0) return;
+	Stack[SP++] = { 0, RootMask, TRayPacket<PacketSize>::GetMinTNear(LNear, RootMask) };
+
+	while (SP > 0)
+	{
+		const FEntry Entry = Stack[--SP];
+		// push 이후 다른 리프에서 레인들의 TMax가 줄었을 수 있다
+		if (Entry.TMin > Packet.GetMaxTMax(Entry.Mask)) continue;
+
+		const FNode& N = Nodes[Entry.Index];
+		if (N.IsLeaf())
+		{
+			for (int32 i = 0; i < N.Count; ++i)
+			{
+				const int32 Tri = TriRefs[N.Start + i].Index;
+				const float V0[3] = { TriV0X[Tri], TriV0Y[Tri], TriV0Z[Tri] };
+				const float E1[3] = { TriE1X[Tri], TriE1Y[Tri], TriE1Z[Tri] };
+				const float E2[3] = { TriE2X[Tri], TriE2Y[Tri], TriE2Z[Tri] };
+				Packet.IntersectTriangle(V0, E1, E2, Tri, Entry.Mask, OutTriIndex);
+			}
+			continue;
+		}
+
+		const uint32 LMask = (N.Left >= 0) ? Packet.IntersectAABB(Nodes[N.Left].Bounds, Entry.Mask, LNear) : 0;
+		const uint32 RMask = (N.Right >= 0) ? Packet.IntersectAABB(Nodes[N.Right].Bounds, Entry.Mask, RNear) : 0;
+		const float LTMin = TRayPacket<PacketSize>::GetMinTNear(LNear, LMask);
+		const float RTMin = TRayPacket<PacketSize>::GetMinTNear(RNear, RMask);
+
+		// 먼 쪽 먼저 push -> 패킷이 가까운 쪽을 먼저 방문
+		if (LMask && RMask)
+		{
+			if (LTMin < RTMin) { Stack[SP++] = { N.Right, RMask, RTMin }; Stack[SP++] = { N.Left, LMask, LTMin }; }
+			else { Stack[SP++] = { N.Left, LMask, LTMin }; Stack[SP++] = { N.Right, RMask, RTMin }; }
+		}
+		else if (LMask) { Stack[SP++] = { N.Left, LMask, LTMin }; }
+		else if (RMask) { Stack[SP++] = { N.Right, RMask, RTMin }; }
+	}
+}
+
+template<int32 PacketSize>
+void FStaticMeshBVH::IntersectRays(const FRay* ModelRays, int32 NumRays, FMeshRayHit* OutHits,
+	const float* InMinT, const float* InMaxT) const
+{
+#ifdef ENABLE_BVH_STATS
+	FScopeCycleCounter Counter(GetStaticMeshBVHTraverseStatId());
+#endif
+
+	for (int32 i = 0; i < NumRays; ++i)
+	{
+		OutHits[i] = FMeshRayHit{};
+	}
+	if (Nodes.empty()) return;
+
+	TRayPacket<PacketSize> Packet;
+	alignas(16) int32 TriIndex[PacketSize];
+	for (int32 Base = 0; Base < NumRays; Base += PacketSize)
+	{
+		const int32 Count = std::min(PacketSize, NumRays - Base);
+		Packet.Load(ModelRays + Base, Count, InMinT ? InMinT + Base : nullptr, InMaxT ? InMaxT + Base : nullptr);
+		std::fill(TriIndex, TriIndex + PacketSize, -1);
+
+		TraversePacket(Packet, TriIndex);
+
+		for (int32 Lane = 0; Lane < Count; ++Lane)
+		{
+			if (TriIndex[Lane] >= 0)
+			{
+				OutHits[Base + Lane] = { Packet.TMax[Lane], TriIndex[Lane] };
+			}
+		}
+	}
+}
+
+void FStaticMeshBVH::IntersectRays(const TArray<FRay>& ModelRays, TArray<FMeshRayHit>& OutHits) const
+{
+	OutHits.resize(ModelRays.size());
+	IntersectRays<DefaultRayPacketSize>(ModelRays.data(), static_cast<int32>(ModelRays.size()), OutHits.data());
+}
+
+template void FStaticMeshBVH::IntersectRays<4>(const FRay*, int32, FMeshRayHit*, const float*, const float*) const;
+template void FStaticMeshBVH::IntersectRays<8>(const FRay*, int32, FMeshRayHit*, const float*, const float*) const;
+template void FStaticMeshBVH::IntersectRays<16>(const FRay*, int32, FMeshRayHit*, const float*, const float*) const;
+
+namespace
+{
+	constexpr uint32 BVHCacheMagic = 0x43485642; // "BVHC"
+
+	struct FBVHCacheHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 SourceHash;
+		int64 SourceTime;
+		int32 NumTris;
+		int32 NumNodes;
+		float BuildMilliseconds;	// 로그에 로드 시간과 함께 보여줄 원래 빌드 시간
+		uint32 Reserved;
+	};
+
+	// FAABB는 가상 함수를 가지므로 노드는 디스크 전용 POD 레코드로 평탄화
+	struct FBVHCacheNode
+	{
+		float Min[3];
+		float Max[3];
+		int32 Left;
+		int32 Right;
+		int32 Start;
+		int32 Count;
+	};
+
+	// 저장 순서대로 나열된 삼각형 SoA 배열 수 (V0/E1/E2 9개 + 중심 3개 + 반지름 1개)
+	constexpr int32 NumTriSoAArrays = 13;
+
+	size_t GetCacheFileSize(int32 NumNodes, int32 NumTris)
+	{
+		return sizeof(FBVHCacheHeader)
+			+ sizeof(FBVHCacheNode) * static_cast<size_t>(NumNodes)
+			+ sizeof(int32) * static_cast<size_t>(NumTris)
+			+ sizeof(float) * static_cast<size_t>(NumTris) * NumTriSoAArrays;
+	}
+}
+
+uint64 FStaticMeshBVH::ComputeSourceHash(const TArray<FNormalVertex>& Vertices, const TArray<uint32>* Indices)
+{
+	// FNV-1a를 바이트 대신 32비트 워드 단위로 적용
+	uint64 Hash = 14695981039346656037ull;
+	auto Mix = [&Hash](uint32 Word)
+		{
+			Hash ^= Word;
+			Hash *= 1099511628211ull;
+		};
+
+	Mix(static_cast<uint32>(Vertices.size()));
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		Mix(std::bit_cast<uint32>(Vertex.Position.X));
+		Mix(std::bit_cast<uint32>(Vertex.Position.Y));
+		Mix(std::bit_cast<uint32>(Vertex.Position.Z));
+	}
+
+	Mix(Indices ? static_cast<uint32>(Indices->size()) : 0u);
+	if (Indices)
+	{
+		for (const uint32 Index : *Indices)
+		{
+			Mix(Index);
+		}
+	}
+	return Hash;
+}
+
+bool FStaticMeshBVH::SaveToBuffer(TArray<uint8>& OutBuffer, uint64 InSourceHash, int64 InSourceTime, float InBuildMilliseconds) const
+{
+	if (Nodes.empty()) return false;
+
+	const int32 NumNodes = static_cast<int32>(Nodes.size());
+	OutBuffer.resize(GetCacheFileSize(NumNodes, NumTris));
+	uint8* Cursor = OutBuffer.data();
+	auto Write = [&Cursor](const void* InData, size_t InBytes)
+		{
+			if (InBytes == 0) return;
+			memcpy(Cursor, InData, InBytes);
+			Cursor += InBytes;
+		};
+
+	const FBVHCacheHeader Header{ BVHCacheMagic, CacheVersion, InSourceHash, InSourceTime, NumTris, NumNodes, InBuildMilliseconds, 0 };
+	Write(&Header, sizeof(Header));
+
+	for (const FNode& Node : Nodes)
+	{
+		const FBVHCacheNode Record{
+			{ Node.Bounds.Min.X, Node.Bounds.Min.Y, Node.Bounds.Min.Z },
+			{ Node.Bounds.Max.X, Node.Bounds.Max.Y, Node.Bounds.Max.Z },
+			Node.Left, Node.Right, Node.Start, Node.Count };
+		Write(&Record, sizeof(Record));
+	}
+
+	static_assert(sizeof(FTriRef) == sizeof(int32), "TriRefs are stored as raw int32");
+	Write(TriRefs.data(), sizeof(int32) * NumTris);
+
+	const TArray<float>* SoA[NumTriSoAArrays] = {
+		&TriV0X, &TriV0Y, &TriV0Z, &TriE1X, &TriE1Y, &TriE1Z, &TriE2X, &TriE2Y, &TriE2Z,
+		&TriCentX, &TriCentY, &TriCentZ, &TriRadiusSq };
+	for (const TArray<float>* Array : SoA)
+	{
+		Write(Array->data(), sizeof(float) * NumTris);
+	}
+	return true;
+}
+
+bool FStaticMeshBVH::SaveToFile(const std::filesystem::path& InPath, uint64 InSourceHash, int64 InSourceTime, float InBuildMilliseconds) const
+{
+	TArray<uint8> Buffer;
+	if (!SaveToBuffer(Buffer, InSourceHash, InSourceTime, InBuildMilliseconds)) return false;
+
+	// 쓰다 실패한 파일이 다음 실행에서 읽히지 않도록 임시 파일에 쓴 뒤 교체
+	std::filesystem::path TempPath = InPath;
+	TempPath += ".tmp";
+	{
+		std::ofstream Stream(TempPath, std::ios::binary | std::ios::trunc);
+		if (!Stream) return false;
+		Stream.write(reinterpret_cast<const char*>(Buffer.data()), static_cast<std::streamsize>(Buffer.size()));
+		if (!Stream) return false;
+	}
+
+	std::error_code Error;
+	std::filesystem::rename(TempPath, InPath, Error);
+	if (Error)
+	{
+		std::filesystem::remove(TempPath, Error);
+		return false;
+	}
+	return true;
+}
+
+bool FStaticMeshBVH::LoadFromFile(const std::filesystem::path& InPath, uint64 InSourceHash, int64 InSourceTime, float* OutBuildMilliseconds)
+{
+	std::ifstream Stream(InPath, std::ios::binary | std::ios::ate);
+	if (!Stream) return false;
+
+	const std::streamsize FileSize = Stream.tellg();
+	if (FileSize < static_cast<std::streamsize>(sizeof(FBVHCacheHeader))) return false;
+
+	// 파일 전체를 한 번에 읽고 배열로 복사
+	TArray<uint8> Buffer(static_cast<size_t>(FileSize));
+	Stream.seekg(0);
+	if (!Stream.read(reinterpret_cast<char*>(Buffer.data()), FileSize)) return false;
+
+	return LoadFromBuffer(Buffer.data(), Buffer.size(), InSourceHash, InSourceTime, OutBuildMilliseconds);
+}
+
+bool FStaticMeshBVH::LoadFromBuffer(const uint8* InData, size_t InSize, uint64 InSourceHash, int64 InSourceTime, float* OutBuildMilliseconds)
+{
+	if (!InData || InSize < sizeof(FBVHCacheHeader)) return false;
+
+	FBVHCacheHeader Header;
+	memcpy(&Header, InData, sizeof(Header));
+	if (Header.Magic != BVHCacheMagic || Header.Version != CacheVersion) return false;
+	if (Header.SourceHash != InSourceHash || Header.SourceTime != InSourceTime) return false;
+	if (Header.NumNodes <= 0 || Header.NumTris < 0) return false;
+	if (GetCacheFileSize(Header.NumNodes, Header.NumTris) != InSize) return false;
+
+	Clear();
+	NumTris = Header.NumTris;
+
+	const uint8* Cursor = InData + sizeof(Header);
+	auto Read = [&Cursor](void* OutData, size_t InBytes)
+		{
+			if (InBytes == 0) return;
+			memcpy(OutData, Cursor, InBytes);
+			Cursor += InBytes;
+		};
+
+	Nodes.resize(Header.NumNodes);
+	for (FNode& Node : Nodes)
+	{
+		FBVHCacheNode Record;
+		Read(&Record, sizeof(Record));
+		Node.Bounds = FAABB(FVector(Record.Min[0], Record.Min[1], Record.Min[2]), FVector(Record.Max[0], Record.Max[1], Record.Max[2]));
+		Node.Left = Record.Left;
+		Node.Right = Record.Right;
+		Node.Start = Record.Start;
+		Node.Count = Record.Count;
+	}
+
+	TriRefs.resize(NumTris);
+	Read(TriRefs.data(), sizeof(int32) * NumTris);
+
+	EnsureTriSoASize();
+	TArray<float>* SoA[NumTriSoAArrays] = {
+		&TriV0X, &TriV0Y, &TriV0Z, &TriE1X, &TriE1Y, &TriE1Z, &TriE2X, &TriE2Y, &TriE2Z,
+		&TriCentX, &TriCentY, &TriCentZ, &TriRadiusSq };
+	for (TArray<float>* Array : SoA)
+	{
+		Read(Array->data(), sizeof(float) * NumTris);
+	}
+
+	// 해시가 맞아도 잘린/손상된 인덱스로 트래버설이 범위를 벗어나지 않도록 한 번 훑는다
+	bool bValid = true;
+	for (const FNode& Node : Nodes)
+	{
+		if (Node.IsLeaf())
+			bValid &= Node.Start >= 0 && Node.Start + Node.Count <= NumTris;
+		else
+			bValid &= Node.Left > 0 && Node.Left < Header.NumNodes && Node.Right > 0 && Node.Right < Header.NumNodes;
+	}
+	for (const FTriRef& Ref : TriRefs)
+	{
+		bValid &= Ref.Index >= 0 && Ref.Index < NumTris;
+	}
+	if (!bValid)
+	{
+		Clear();
+		return false;
+	}
+
+	if (OutBuildMilliseconds)
+	{
+		*OutBuildMilliseconds = Header.BuildMilliseconds;
+	}
+
+	BuildWideNodes();
+	return true;
+}
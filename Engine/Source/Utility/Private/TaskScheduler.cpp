@@ -0,0 +1,205 @@
+#include "pch.h"
+#include "Utility/Public/TaskScheduler.h"
+
+namespace
+{
+	// 현재 스레드가 어떤 스케줄러의 몇 번 워커인지 (워커가 아니면 nullptr)
+	thread_local const FTaskScheduler* TLSOwnerScheduler = nullptr;
+	thread_local uint32 TLSWorkerIndex = 0;
+
+	// 잠들기 전에 작업을 다시 찾아보는 횟수
+	constexpr int32 SpinCountBeforeSleep = 64;
+}
+
+FTaskScheduler::FTaskScheduler(uint32 InNumWorkers)
+	: NumWorkers(InNumWorkers)
+{
+	Queues.reserve(NumWorkers + 1);
+	for (uint32 i = 0; i < NumWorkers + 1; ++i)
+	{
+		Queues.push_back(std::make_unique<FTaskQueue>());
+	}
+
+	Workers.reserve(NumWorkers);
+	for (uint32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.emplace_back(&FTaskScheduler::WorkerMain, this, i);
+	}
+}
+
+FTaskScheduler::~FTaskScheduler()
+{
+	{
+		std::lock_guard<std::mutex> Lock(WakeMutex);
+		bStopping.store(true, std::memory_order_release);
+	}
+	WakeCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+}
+
+FTaskScheduler& FTaskScheduler::Get()
+{
+	static FTaskScheduler Instance(std::max(1u, std::thread::hardware_concurrency()) - 1u);
+	return Instance;
+}
+
+uint32 FTaskScheduler::GetCurrentQueueIndex() const
+{
+	return TLSOwnerScheduler == this ? TLSWorkerIndex : NumWorkers;
+}
+
+void FTaskScheduler::Dispatch(FTaskGroup& InGroup, FTask InTask)
+{
+	InGroup.PendingCount.fetch_add(1, std::memory_order_relaxed);
+
+	// 워커가 없으면 호출 스레드에서 바로 실행
+	if (NumWorkers == 0)
+	{
+		InTask();
+		InGroup.PendingCount.fetch_sub(1, std::memory_order_release);
+		return;
+	}
+
+	FTaskQueue& Queue = *Queues[GetCurrentQueueIndex()];
+	{
+		std::lock_guard<std::mutex> Lock(Queue.Mutex);
+		Queue.Tasks.push_back({ std::move(InTask), &InGroup });
+	}
+	QueuedCount.fetch_add(1, std::memory_order_release);
+
+	// 대기 조건 검사와 알림 사이의 경쟁을 막기 위해 WakeMutex를 한 번 거친다
+	{
+		std::lock_guard<std::mutex> Lock(WakeMutex);
+	}
+	WakeCondition.notify_one();
+}
+
+void FTaskScheduler::Wait(FTaskGroup& InGroup)
+{
+	const uint32 QueueIndex = GetCurrentQueueIndex();
+	while (!InGroup.IsDone())
+	{
+		// 대기만 하지 않고 남은 작업을 돕는다
+		if (!TryExecuteOne(QueueIndex))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FTaskScheduler::ParallelFor(int64 InCount, int64 InMinBatch, const TFunction<void(int64, int64)>& Body)
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+
+	InMinBatch = std::max<int64>(1, InMinBatch);
+	const int64 MaxBatches = static_cast<int64>(GetConcurrency()) * 4;
+	const int64 NumBatches = std::min(MaxBatches, (InCount + InMinBatch - 1) / InMinBatch);
+	if (NumBatches <= 1 || NumWorkers == 0)
+	{
+		Body(0, InCount);
+		return;
+	}
+
+	const int64 BatchSize = (InCount + NumBatches - 1) / NumBatches;
+	FTaskGroup Group;
+	for (int64 Begin = BatchSize; Begin < InCount; Begin += BatchSize)
+	{
+		const int64 End = std::min(InCount, Begin + BatchSize);
+		Dispatch(Group, [&Body, Begin, End]() { Body(Begin, End); });
+	}
+
+	// 첫 구간은 호출 스레드가 직접 처리
+	Body(0, std::min(InCount, BatchSize));
+	Wait(Group);
+}
+
+bool FTaskScheduler::TryPopLocal(uint32 InQueueIndex, FQueuedTask& OutTask)
+{
+	FTaskQueue& Queue = *Queues[InQueueIndex];
+	std::lock_guard<std::mutex> Lock(Queue.Mutex);
+	if (Queue.Tasks.empty())
+	{
+		return false;
+	}
+
+	OutTask = std::move(Queue.Tasks.back());
+	Queue.Tasks.pop_back();
+	return true;
+}
+
+bool FTaskScheduler::TrySteal(uint32 InThiefIndex, FQueuedTask& OutTask)
+{
+	const uint32 NumQueues = static_cast<uint32>(Queues.size());
+	for (uint32 Offset = 1; Offset < NumQueues; ++Offset)
+	{
+		FTaskQueue& Victim = *Queues[(InThiefIndex + Offset) % NumQueues];
+		std::lock_guard<std::mutex> Lock(Victim.Mutex);
+		if (!Victim.Tasks.empty())
+		{
+			OutTask = std::move(Victim.Tasks.front());
+			Victim.Tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FTaskScheduler::TryExecuteOne(uint32 InQueueIndex)
+{
+	if (QueuedCount.load(std::memory_order_acquire) <= 0)
+	{
+		return false;
+	}
+
+	FQueuedTask Task;
+	if (!TryPopLocal(InQueueIndex, Task) && !TrySteal(InQueueIndex, Task))
+	{
+		return false;
+	}
+	QueuedCount.fetch_sub(1, std::memory_order_relaxed);
+
+	Task.Task();
+	Task.Group->PendingCount.fetch_sub(1, std::memory_order_release);
+	return true;
+}
+
+void FTaskScheduler::WorkerMain(uint32 InQueueIndex)
+{
+	TLSOwnerScheduler = this;
+	TLSWorkerIndex = InQueueIndex;
+
+	int32 IdleSpins = 0;
+	while (!bStopping.load(std::memory_order_acquire))
+	{
+		if (TryExecuteOne(InQueueIndex))
+		{
+			IdleSpins = 0;
+			continue;
+		}
+
+		if (++IdleSpins < SpinCountBeforeSleep)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		IdleSpins = 0;
+		std::unique_lock<std::mutex> Lock(WakeMutex);
+		WakeCondition.wait(Lock, [this]()
+			{
+				return bStopping.load(std::memory_order_acquire) || QueuedCount.load(std::memory_order_acquire) > 0;
+			});
+	}
+
+	TLSOwnerScheduler = nullptr;
+}
@@ -0,0 +1,63 @@
+#include "pch.h"
+#include "Utility/Public/WideBVH.h"
+#include "Utility/Public/PlatformSIMD.h"
+
+namespace
+{
+	SIMD_TARGET_AVX2 uint32 IntersectNode8AVX2(const TWideBVHNode<8>& Node, const FWideRay& Ray, float ClampedMaxT, float* OutTMin)
+	{
+		const __m256 OX = _mm256_set1_ps(Ray.Origin[0]);
+		const __m256 OY = _mm256_set1_ps(Ray.Origin[1]);
+		const __m256 OZ = _mm256_set1_ps(Ray.Origin[2]);
+		const __m256 IX = _mm256_set1_ps(Ray.InvDir[0]);
+		const __m256 IY = _mm256_set1_ps(Ray.InvDir[1]);
+		const __m256 IZ = _mm256_set1_ps(Ray.InvDir[2]);
+
+		// 전역 정렬 operator new는 헤더 뒤 주소를 돌려주므로 노드는 16바이트 정렬만 보장된다 (비정렬 로드 사용)
+		const __m256 T0X = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(Node.MinX), OX), IX);
+		const __m256 T1X = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(Node.MaxX), OX), IX);
+		const __m256 T0Y = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(Node.MinY), OY), IY);
+		const __m256 T1Y = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(Node.MaxY), OY), IY);
+		const __m256 T0Z = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(Node.MinZ), OZ), IZ);
+		const __m256 T1Z = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(Node.MaxZ), OZ), IZ);
+
+		__m256 TNear = _mm256_max_ps(_mm256_min_ps(T0X, T1X), _mm256_setzero_ps());
+		TNear = _mm256_max_ps(_mm256_min_ps(T0Y, T1Y), TNear);
+		TNear = _mm256_max_ps(_mm256_min_ps(T0Z, T1Z), TNear);
+		__m256 TFar = _mm256_min_ps(_mm256_max_ps(T0X, T1X), _mm256_set1_ps(ClampedMaxT));
+		TFar = _mm256_min_ps(_mm256_max_ps(T0Y, T1Y), TFar);
+		TFar = _mm256_min_ps(_mm256_max_ps(T0Z, T1Z), TFar);
+
+		_mm256_storeu_ps(OutTMin, TNear);
+		return static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(TNear, TFar, _CMP_LE_OQ)));
+	}
+
+	// 8-wide 노드의 절반을 4-wide 노드처럼 읽기 위한 뷰
+	TWideBVHNode<4> GetHalf(const TWideBVHNode<8>& Node, int32 Offset)
+	{
+		TWideBVHNode<4> Half;
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			Half.MinX[Lane] = Node.MinX[Offset + Lane]; Half.MinY[Lane] = Node.MinY[Offset + Lane]; Half.MinZ[Lane] = Node.MinZ[Offset + Lane];
+			Half.MaxX[Lane] = Node.MaxX[Offset + Lane]; Half.MaxY[Lane] = Node.MaxY[Offset + Lane]; Half.MaxZ[Lane] = Node.MaxZ[Offset + Lane];
+		}
+		return Half;
+	}
+}
+
+EBVHLayout FWideBVH::GetPreferredLayout()
+{
+	return FPlatformSIMD::HasAVX2() ? EBVHLayout::Wide8 : EBVHLayout::Wide4;
+}
+
+uint32 FWideBVH::IntersectNode(const TWideBVHNode<8>& Node, const FWideRay& Ray, float MaxT, float* OutTMin)
+{
+	if (FPlatformSIMD::HasAVX2())
+	{
+		return IntersectNode8AVX2(Node, Ray, ClampMaxT(MaxT), OutTMin);
+	}
+
+	const uint32 LowMask = IntersectNode(GetHalf(Node, 0), Ray, MaxT, OutTMin);
+	const uint32 HighMask = IntersectNode(GetHalf(Node, 4), Ray, MaxT, OutTMin + 4);
+	return LowMask | (HighMask << 4);
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include <filesystem>
+#include "Core/Public/MappedFile.h"
+#include "Physics/Public/AABB.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Utility/Public/PackedVertex.h"
+
+class FStaticMeshBVH;
+
+/**
+ * @brief 쿠킹된 스태틱 메시 컨테이너 (.meshbin)
+ * 원본과 모든 LOD의 정점/인덱스/섹션, 재질, AABB, (선택) BVH를 버전이 붙은 파일 하나에 담는다
+ *
+ * 레이아웃: 헤더 → LOD 표 → 재질 표 → 문자열 → [LOD별 정점 · (색) · 인덱스 · 섹션 블롭] → BVH 블롭
+ * 모든 블롭은 파일 시작 기준 64바이트 정렬이고 헤더/표에는 오프셋만 있으므로,
+ * 로드는 파일을 매핑하고 범위를 검사한 뒤 오프셋을 포인터로 바꾸는 것으로 끝난다 (정점/인덱스 복사 없음)
+ * 정점은 기본적으로 FNormalVertex 그대로 저장한다
+ * 양자화를 켜면 LOD마다 자기 AABB로 양자화한 FPackedNormalVertex(16바이트)로 저장하고 색은 흰색이 아닐 때만 따로 저장한다
+ * 단 UV가 half 범위(FPackedVertexStream::MaxPackedTexCoord)를 벗어나는 LOD는 양자화를 켜도 FNormalVertex로 저장한다
+ * 원본 .obj의 수정 시각과 크기가 헤더와 다르거나 버전이 다르면 열기에 실패하고 호출 측이 다시 쿠킹한다
+ */
+class FCookedMeshFile
+{
+public:
+	// 2: 쿠킹 전에 FMeshOptimizer로 삼각형/정점 순서를 재배치 (이전 버전은 다시 쿠킹)
+	// 3: 정점을 FPackedNormalVertex로 양자화해 저장
+	// 4: 양자화를 선택 사항으로 바꾸고 LOD마다 정점 형식을 기록
+	static constexpr uint32 Version = 4;
+	static constexpr size_t BlobAlignment = 64;
+
+	/**
+	 * @brief 컨테이너를 임시 파일에 쓴 뒤 교체한다
+	 * @param InLODs [0]이 원본, 이후 LOD 순서. 재질은 [0]의 것을 저장
+	 *               양자화해 저장하는 LOD의 로드 결과를 같게 하려면 미리 FPackedVertexStream::Quantize를 거친다
+	 * @param InBVH 원본 메시의 BVH (nullptr이면 생략)
+	 * @param InSourcePath 원본 .obj 경로 (수정 시각과 크기를 헤더에 기록)
+	 * @param bInQuantizeVertices UV가 half 범위 안인 LOD의 정점을 FPackedNormalVertex로 저장 (설정 값은 헤더에 기록)
+	 */
+	static bool Save(const std::filesystem::path& InPath, const TArray<const FStaticMesh*>& InLODs, const FStaticMeshBVH* InBVH,
+		const std::filesystem::path& InSourcePath, bool bInQuantizeVertices, float InBVHBuildMilliseconds = 0.0f);
+
+	// 원본 파일의 수정 시각/크기 (헤더 비교용)
+	static int64 GetSourceTime(const std::filesystem::path& InSourcePath);
+	static uint64 GetSourceSize(const std::filesystem::path& InSourcePath);
+
+	FCookedMeshFile() = default;
+	FCookedMeshFile(const FCookedMeshFile&) = delete;
+	FCookedMeshFile& operator=(const FCookedMeshFile&) = delete;
+
+	/**
+	 * @brief 파일을 매핑하고 헤더, 모든 블롭 범위, 인덱스가 정점 수 안에 있는지 검사한다 (실패하면 호출 측이 원본에서 다시 쿠킹)
+	 * @param InSourcePath 비어 있지 않으면 원본의 수정 시각/크기가 헤더와 같을 때만 성공
+	 */
+	bool Open(const std::filesystem::path& InPath, const std::filesystem::path& InSourcePath = {});
+	void Close();
+	bool IsOpen() const { return Header != nullptr; }
+
+	// 매핑된 메모리를 그대로 가리키는 뷰 (파일을 닫으면 무효)
+	int32 GetNumLODs() const;
+	uint32 GetNumVertices(int32 InLODIndex) const;
+	uint32 GetNumIndices(int32 InLODIndex) const;
+	uint32 GetNumSections(int32 InLODIndex) const;
+	bool IsVertexQuantized(int32 InLODIndex) const;
+	const FNormalVertex* GetVertices(int32 InLODIndex) const;			// 양자화된 LOD면 nullptr
+	const FPackedNormalVertex* GetPackedVertices(int32 InLODIndex) const;	// 양자화되지 않은 LOD면 nullptr
+	const uint32* GetVertexColors(int32 InLODIndex) const;	// 양자화된 LOD에 색이 없으면 nullptr
+	FVector GetPositionOrigin(int32 InLODIndex) const;
+	FVector GetPositionScale(int32 InLODIndex) const;
+	const uint32* GetIndices(int32 InLODIndex) const;
+	const FMeshSection* GetSections(int32 InLODIndex) const;
+
+	FAABB GetBounds() const;
+	uint64 GetSourceHash() const;
+	bool HasBVH() const;
+	// 쿠킹할 때 양자화 설정이 켜져 있었는지 (설정이 바뀌면 호출 측이 다시 쿠킹)
+	bool WasQuantizationEnabled() const;
+
+	// BVH 블롭으로 BVH를 복원 (원본 해시/시각 검증 포함)
+	bool LoadBVH(FStaticMeshBVH& OutBVH, float* OutBuildMilliseconds = nullptr) const;
+
+	/**
+	 * @brief LOD 하나를 엔진이 소유하는 FStaticMesh로 만든다 (정점은 복원, 인덱스/섹션은 memcpy 한 번, 재질 정보 포함)
+	 * @return 호출 측이 소유. 범위 밖 LOD면 nullptr
+	 */
+	FStaticMesh* CreateStaticMesh(int32 InLODIndex) const;
+
+private:
+	struct FHeader;
+	struct FLODEntry;
+	struct FMaterialEntry;
+
+	FString GetString(uint32 InOffset, uint32 InLength) const;
+
+	FMappedFile File;
+	const FHeader* Header = nullptr;
+	const FLODEntry* LODEntries = nullptr;
+	const FMaterialEntry* MaterialEntries = nullptr;
+};
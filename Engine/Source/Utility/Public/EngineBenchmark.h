@@ -0,0 +1,73 @@
+#pragma once
+
+/**
+ * @brief 윈도우/GPU 없이 실행 가능한 성능 측정 모음
+ * 콘솔의 BENCH <이름> 명령어로 실행하며, 결과는 UE_LOG로 출력된다
+ */
+class FEngineBenchmark
+{
+public:
+	// 이름으로 벤치마크 실행 (알 수 없는 이름이면 false)
+	static bool Run(const FString& InName);
+	static void PrintUsage();
+
+	// FSceneBVH 빌드 시간: 10k/100k/1M 합성 AABB × 스레드 수별 (직렬 빌드와 SAH 비용 비교 포함)
+	static void RunSceneBVHBuild();
+
+	// FSceneBVH 증분 갱신: 100k 씬에 100개 삽입/제거 시 연산당 시간과 SAH 품질 변화 (전체 빌드와 비교)
+	static void RunSceneBVHInsertRemove();
+
+	// 레이 처리량: 합성 씬(100k AABB)/메시(200k 삼각형)에서 2진/4-wide/8-wide 레이아웃별 초당 레이 수
+	static void RunBVHRayThroughput();
+
+	// 배치 레이 질의: 단일 레이 API 반복 대비 4/8/16개 패킷 트래버설 (합성 씬 + Data/의 메시, 256x256 카메라 레이)
+	static void RunBVHRayPackets();
+
+	// 옥트리 갱신: 100k 오브젝트가 매 프레임 조금씩 움직일 때 Update/제거 후 재삽입/재구축의 프레임당 시간
+	static void RunOctreeUpdate();
+
+	// 옥트리 구축/해제/질의: 100k 오브젝트의 Initialize+삽입, Clear, 가시 비율이 다른 프러스텀 3개의 QueryFrustum 시간
+	static void RunOctreeQuery();
+
+	// 씬 컬링: 100k 정적 + 10k 동적 프리미티브, 뷰 4개를 기존 직렬 질의 / FSceneCuller 1스레드·병렬·뷰 동시 실행으로 비교
+	static void RunSceneCulling();
+
+	// 소프트웨어 오클루전: 벽 오클루더 16개를 480x272 버퍼에 래스터화(+피라미드)하는 시간과 100k AABB 가림 검사 시간
+	static void RunSoftwareOcclusion();
+
+	// OBJ 파싱 처리량: 합성 격자 OBJ(v/vt/vn + 사각형 면)를 getline 경로 / 메모리 매핑 토크나이저 / 구간 병렬 파싱으로 읽은 MB/s (결과 동일성 확인 포함)
+	static void RunObjParse();
+
+	// 메시 단순화: 합성 토러스(50만 삼각형)와 Data/의 메시를 50%/25%로 줄이는 시간, 초당 입력 삼각형 수, 원본 대비 하우스도르프 거리
+	static void RunMeshSimplify();
+
+	// LOD 체인: LOD마다 Simplify를 따로 돌릴 때와 SimplifyChain 한 번(2/4단계)의 시간, 프로그레시브 메시 생성 시간과 예산별 인덱스 버퍼 생성 처리량
+	static void RunLODChain();
+
+	// 메시 로드: 텍스트 OBJ 임포트 / 이전 캐시(.objbin + LOD .objbin + .bvhbin) / 쿠킹된 .meshbin(복사, 매핑 뷰)의 로드 시간과 파일 크기 (합성 토러스 + Data/)
+	static void RunMeshLoad();
+
+	// .objbin 왕복: 100만 정점 합성 FObjInfo를 원소별(이전 경로) / 일괄 + ifstream / 일괄 + 버퍼 / 일괄 + 메모리 매핑으로 쓰고 읽는 시간 (파일 형식 동일성 확인 포함)
+	static void RunObjBinRoundTrip();
+
+	// 메시 최적화: 합성 토러스(원래 순서/섞은 순서/LOD)와 Data/ 메시의 ACMR/ATVR/오버페치를 삼각형 재배치 → 오버드로 정렬 → 정점 재배치 단계별로 측정
+	static void RunMeshOptimize();
+
+	// 정점 양자화: 합성 토러스(흰색/색 있음)와 Data/ 메시의 FNormalVertex 대비 FPackedNormalVertex 메모리, 위치/노멀/UV 최대 오차, 팩/언팩 시간
+	static void RunVertexPack();
+
+	// 변환 계층: 액터마다 수백 개 노드가 붙은 씬에서 세터마다 즉시 재귀 갱신(이전 방식) 대비 프레임당 일괄 갱신(직렬/병렬), 다중 선택 드래그, 재부모화 후 재정렬 시간
+	static void RunTransformHierarchy();
+
+	// 수학 커널: 이전 방식(수평 덧셈 내적, 축별 회전 곱, 일반 역행렬, 모서리 8개) 대비 SIMD 행렬 곱/TRS 합성/아핀 역행렬/AABB·점 일괄 변환과 피킹 레이 준비, BVH 리핏 시간
+	static void RunMathKernels();
+
+	// 월드 AABB 표: 액터 단위로 움직이는 프리미티브 10만 개의 AABB를 읽는 곳마다 지연 캐시를 거칠 때(이전 방식) 대비 프레임당 일괄 계산 후 표를 읽을 때 (전체/일부 이동, 정지)
+	static void RunPrimitiveBounds();
+
+	// FName 이름 표: 이전 방식(소문자 복사 + 전역 맵 + 읽기/쓰기 잠금) 대비 샤드 표의 새 이름 등록, 대소문자 섞인 조회, 리터럴 생성 처리량 (1/8 스레드)
+	static void RunNameTable();
+
+	// 오브젝트 순회: PIE 주기로 오브젝트를 다시 만든 20만 개 세션에서 이전 방식(파괴된 자리가 남는 배열 전체 + Cast) 대비 클래스 리스트로 메시 컴포넌트(1%)/전체 컴포넌트를 모으는 시간과 슬롯 수
+	static void RunObjectIteration();
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include "Component/Mesh/Public/StaticMesh.h"
+
+/**
+ * @brief 정점 캐시/정점 페치 효율 측정값
+ * ACMR: 삼각형당 정점 셰이더 실행 수 (0.5에 가까울수록 좋음, 최악 3)
+ * ATVR: 참조된 정점 하나당 실행 수 (1이 최적)
+ * Overfetch: 정점 버퍼에서 읽은 바이트 / 정점 버퍼 크기 (1이 최적)
+ */
+struct FVertexCacheStatistics
+{
+	uint32 NumTriangles = 0;
+	uint32 NumVertices = 0;		// 인덱스가 참조하는 서로 다른 정점 수
+	uint32 NumTransformed = 0;	// 캐시 미스로 셰이더가 실행된 횟수
+	float ACMR = 0.0f;
+	float ATVR = 0.0f;
+	float Overfetch = 0.0f;
+};
+
+/**
+ * @brief 임포트/LOD 생성 직후 메시를 GPU 친화적인 순서로 바꾸는 최적화 단계
+ *
+ * 1. 섹션마다 Tipsify(Sander et al. 2007)로 삼각형을 정점 후처리 캐시 순서로 재배치
+ * 2. 캐시 순서를 거의 해치지 않는 범위(ACMR 증가 OverdrawThreshold배 이하)에서 삼각형을 클러스터로 나누고
+ *    바깥을 향하는 클러스터가 먼저 그려지도록 정렬 (시점 무관 오버드로 감소)
+ * 3. 정점을 인덱스 버퍼에서 처음 쓰이는 순서로 재배치해 정점 페치 지역성 확보 (참조되지 않는 정점은 제거)
+ *
+ * 섹션 범위와 재질 슬롯은 그대로 유지되고 삼각형의 감김 방향도 바뀌지 않는다
+ */
+class FMeshOptimizer
+{
+public:
+	// 캐시 시뮬레이션과 Tipsify가 가정하는 FIFO 정점 캐시 크기
+	static constexpr uint32 DefaultCacheSize = 16;
+
+	// 클러스터를 나눌 때 허용하는 ACMR 증가 비율 (1이면 오버드로 정렬을 하지 않음)
+	static constexpr float DefaultOverdrawThreshold = 1.05f;
+
+	/**
+	 * @brief 세 단계를 모두 적용한다
+	 * @param OutBefore, OutAfter 적용 전후의 측정값 (nullptr이면 측정하지 않음)
+	 */
+	static void OptimizeStaticMesh(FStaticMesh& InOutMesh, float InOverdrawThreshold = DefaultOverdrawThreshold,
+		FVertexCacheStatistics* OutBefore = nullptr, FVertexCacheStatistics* OutAfter = nullptr);
+
+	// 인덱스 범위 [InStartIndex, InStartIndex + InIndexCount) 안의 삼각형 순서만 바꾼다
+	static void OptimizeVertexCache(TArray<uint32>& InOutIndices, uint32 InNumVertices, uint32 InStartIndex, uint32 InIndexCount,
+		uint32 InCacheSize = DefaultCacheSize);
+
+	// OptimizeVertexCache를 거친 범위를 클러스터 단위로 정렬한다
+	static void OptimizeOverdraw(const TArray<FNormalVertex>& InVertices, TArray<uint32>& InOutIndices, uint32 InStartIndex,
+		uint32 InIndexCount, float InThreshold = DefaultOverdrawThreshold, uint32 InCacheSize = DefaultCacheSize);
+
+	// 정점을 처음 쓰이는 순서로 재배치하고 인덱스를 고친다
+	static void OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices);
+
+	// FIFO 정점 캐시와 64바이트 캐시 라인 페치를 시뮬레이션해 측정
+	static FVertexCacheStatistics AnalyzeVertexCache(const TArray<uint32>& InIndices, uint32 InNumVertices, uint32 InVertexSize,
+		uint32 InCacheSize = DefaultCacheSize);
+};
@@ -1,48 +1,73 @@
 #pragma once
 #include "Core/Public/Object.h"
-#include "Global/Matrix.h"
-#include "Global/Vector.h"
+#include "Global/CoreTypes.h"
+#include "Component/Mesh/Public/StaticMesh.h"
 
-struct FStaticMesh;
+/**
+ * @brief Progressive mesh recorded from one half-edge collapse run (continuous LOD).
+ *
+ * Vertices are ordered so that vertices removed later sit at lower indices than vertices removed earlier,
+ * and within every section the faces are ordered so that the faces alive after k collapses form a prefix of it.
+ * Any triangle budget is then served by walking CollapseTarget for the vertices of those prefixes;
+ * every vertex the result references lies below GetNumVertices(budget), so one vertex buffer serves all budgets.
+ */
+struct FProgressiveMesh
+{
+	TArray<FNormalVertex> Vertices;
+
+	// Original faces (3 indices each), grouped by section and ordered by the collapse that removes them (last removed first)
+	TArray<uint32> Indices;
+
+	// Collapse that removes each face of Indices (0xFFFFFFFF for faces that are never removed)
+	TArray<uint32> FaceRemovedAt;
+
+	// Ranges of Indices per material section of the source mesh
+	TArray<FMeshSection> Sections;
+
+	// Vertex that absorbed each removed vertex (always a lower index). Unused for vertices never removed.
+	TArray<uint32> CollapseTarget;
+
+	// Live faces and leading vertices referenced after k collapses (k = 0 .. number of collapses)
+	TArray<uint32> FaceCounts;
+	TArray<uint32> VertexCounts;
+
+	uint32 GetMaxTriangleCount() const { return FaceCounts.empty() ? 0 : FaceCounts.front(); }
+	uint32 GetMinTriangleCount() const { return FaceCounts.empty() ? 0 : FaceCounts.back(); }
+
+	// Number of leading vertices referenced by the mesh at the given budget
+	uint32 GetNumVertices(uint32 InTriangleBudget) const;
+
+	/**
+	 * @brief Writes the index buffer of the most detailed state that fits the budget.
+	 * @param OutSections Optional ranges of OutIndices per material section (empty sections are dropped)
+	 * @return Number of triangles written (GetMinTriangleCount() if the budget is below it).
+	 */
+	uint32 BuildIndices(uint32 InTriangleBudget, TArray<uint32>& OutIndices, TArray<FMeshSection>* OutSections = nullptr) const;
 
+private:
+	uint32 GetNumCollapses(uint32 InTriangleBudget) const;
+};
+
+/**
+ * @brief Quadric Error Metrics (QEM) edge-collapse mesh simplifier.
+ *
+ * Connectivity is kept in a compact vertex -> face incidence list (CSR arrays) and collapse
+ * candidates live in a min-heap whose entries carry the endpoint versions they were computed
+ * with, so stale entries are skipped lazily instead of being searched for. Each collapse only
+ * touches the one-ring of the merged edge (O(valence log n)).
+ *
+ * The error of a collapse combines the position quadric with per-wedge attribute quadrics over
+ * position, normal and texture coordinates, so normals and UVs are preserved along with the shape.
+ * Open borders, UV/normal seams and material boundaries are kept by weighted constraint planes;
+ * collapses that would cross or close a seam are rejected, and every output keeps one section per
+ * material section of the source. Non-manifold vertices are locked, the link condition is enforced
+ * and collapses that would flip a face are rejected.
+ */
 UCLASS()
 class UMeshSimplifier : public UObject
 {
 	GENERATED_BODY()
 
-public:
-	// Internal struct to hold vertex data during simplification
-	struct FSimplifyVertex
-	{
-		FVector Position;
-		FVector Normal;
-		FVector4 Color;
-		FVector2 TexCoord;
-		FMatrix Quadric;
-		bool bIsActive = true;
-	};
-
-	// Internal struct to hold face data
-	struct FSimplifyFace
-	{
-		int V[3];	// Indices into the vertex array
-		bool bIsActive = true;
-	};
-
-	// Internal struct for an edge collapse candidate
-	struct FCollapseCandidate
-	{
-		int V1;
-		int V2;
-		float Cost;
-		FVector OptimalPosition;
-
-		bool operator>(const FCollapseCandidate& Other) const
-		{
-			return Cost > Other.Cost;
-		}
-	};
-
 public:
 	/**
 	 * @brief Simplifies a static mesh using the Quadric Error Metrics (QEM) algorithm.
@@ -51,4 +76,19 @@ public:
 	 * @return A new, simplified FStaticMesh. The caller is responsible for managing the memory of the returned object.
 	 */
 	static FStaticMesh* Simplify(const FStaticMesh* InOriginalMesh, float InTargetRatio);
+
+	/**
+	 * @brief Builds a whole LOD chain from a single simplification run.
+	 * Quadrics and the collapse queue are set up once; a snapshot is taken each time the run reaches the next ratio.
+	 * @param InTargetRatios Target ratios in (0, 1), e.g. { 0.5, 0.25, 0.125 }. Any order is accepted.
+	 * @return One mesh per ratio in the same order (nullptr for an invalid ratio). The caller owns the meshes.
+	 */
+	static TArray<FStaticMesh*> SimplifyChain(const FStaticMesh* InOriginalMesh, const TArray<float>& InTargetRatios);
+
+	/**
+	 * @brief Records the full collapse sequence of the mesh for continuous LOD.
+	 * Uses half-edge collapses (a vertex moves onto its neighbour) so that all levels share the original vertices.
+	 * @return The progressive mesh, or nullptr for an empty input. The caller owns the result.
+	 */
+	static FProgressiveMesh* BuildProgressiveMesh(const FStaticMesh* InOriginalMesh);
 };
@@ -0,0 +1,82 @@
+#pragma once
+#include "Global/CoreTypes.h"
+
+/**
+ * @brief FNormalVertex(48바이트)를 16바이트로 줄인 정점
+ * 위치: 메시 AABB 기준 축마다 16비트 (PositionOrigin + Position * PositionScale)
+ * 노멀: 팔면체 인코딩 2 x snorm16
+ * UV: half float 2개
+ * 색은 흰색이 아닌 정점이 있을 때만 별도 RGBA8 스트림에 둔다
+ */
+struct FPackedNormalVertex
+{
+	uint16 Position[3];
+	uint16 Padding;
+	int16 Normal[2];
+	uint16 TexCoord[2];
+};
+
+static_assert(sizeof(FPackedNormalVertex) == 16, "FPackedNormalVertex is stored as-is in cooked meshes");
+
+/**
+ * @brief 양자화된 정점 스트림과 양자화/복원 함수
+ *
+ * 위치 격자 간격은 2의 거듭제곱이고 원점도 그 배수라서 복원값이 float로 정확히 표현된다
+ * 그래서 한 번 양자화한 정점을 다시 양자화해도 값이 바뀌지 않는다 (Quantize → 쿠킹 → 로드 결과가 비트 단위로 같음)
+ * 대신 정밀도는 AABB 크기의 1/65535보다 최대 두 배 거칠다
+ */
+class FPackedVertexStream
+{
+public:
+	FVector PositionOrigin = FVector(0.0f, 0.0f, 0.0f);
+	FVector PositionScale = FVector(1.0f, 1.0f, 1.0f);
+	TArray<FPackedNormalVertex> Vertices;
+
+	// 비어 있으면 모든 정점이 흰색
+	TArray<uint32> Colors;
+
+	void Pack(const TArray<FNormalVertex>& InVertices);
+	void Unpack(TArray<FNormalVertex>& OutVertices) const;
+
+	// 피킹, BVH 빌드처럼 위치만 필요한 CPU 사용처용
+	void UnpackPositions(TArray<FVector>& OutPositions) const;
+	FVector GetPosition(uint32 InIndex) const;
+
+	size_t GetNumBytes() const;
+
+	// 양자화 후 바로 복원해 GPU/CPU 데이터를 쿠킹된 메시에서 읽을 값과 같게 만든다
+	static void Quantize(TArray<FNormalVertex>& InOutVertices);
+
+	// 정점 범위의 AABB로 위치 격자를 정한다 (정점이 없으면 원점 0, 간격 1)
+	static void ComputePositionQuantization(const FNormalVertex* InVertices, size_t InNumVertices, FVector& OutOrigin, FVector& OutScale);
+
+	// 흰색(1, 1, 1, 1)이 아닌 색이 있으면 true
+	static bool HasVertexColors(const FNormalVertex* InVertices, size_t InNumVertices);
+
+	// half로 저장할 UV의 최대 절댓값 (4~8 구간에서도 간격이 1/256이라 일반적인 텍스처 해상도에서 티가 나지 않음)
+	static constexpr float MaxPackedTexCoord = 8.0f;
+
+	// 모든 UV가 [-MaxPackedTexCoord, MaxPackedTexCoord] 안에 있어 half로 저장해도 되면 true (NaN이 있으면 false)
+	static bool CanPackTexCoords(const FNormalVertex* InVertices, size_t InNumVertices);
+
+	/**
+	 * @brief 매핑된 블롭처럼 배열이 아닌 메모리에서 바로 쓰는 일괄 변환
+	 * @param OutColors nullptr이면 색을 버린다
+	 * @param InColors nullptr이면 흰색으로 채운다
+	 */
+	static void PackVertices(const FNormalVertex* InVertices, size_t InNumVertices, const FVector& InOrigin, const FVector& InScale,
+		FPackedNormalVertex* OutVertices, uint32* OutColors);
+	static void UnpackVertices(const FPackedNormalVertex* InVertices, const uint32* InColors, size_t InNumVertices,
+		const FVector& InOrigin, const FVector& InScale, FNormalVertex* OutVertices);
+
+	static void EncodeOctahedral(const FVector& InNormal, int16 OutEncoded[2]);
+	static FVector DecodeOctahedral(const int16 InEncoded[2]);
+
+	// IEEE 754 binary16 (가장 가까운 짝수로 반올림, 범위를 넘으면 무한대)
+	static uint16 FloatToHalf(float InValue);
+	static float HalfToFloat(uint16 InValue);
+
+	// R8G8B8A8_UNORM (R이 최하위 바이트)
+	static uint32 PackColor(const FVector4& InColor);
+	static FVector4 UnpackColor(uint32 InColor);
+};
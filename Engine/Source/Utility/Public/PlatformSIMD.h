@@ -0,0 +1,19 @@
+#pragma once
+
+/**
+ * @brief 실행 중인 CPU의 SIMD 지원 여부 (최초 호출 시 한 번 검사 후 캐시)
+ * 프로젝트는 SSE4.1까지만 가정하고 빌드하므로 AVX2 경로는 이 검사로 런타임 분기한다
+ */
+class FPlatformSIMD
+{
+public:
+	// AVX2 + FMA3 지원 및 OS의 YMM 상태 저장 여부
+	static bool HasAVX2();
+};
+
+// MSVC는 /arch 없이도 AVX 인트린식을 쓸 수 있지만, GCC/Clang은 함수 단위로 타깃을 지정해야 한다
+#if defined(__GNUC__) && !defined(__AVX2__)
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define SIMD_TARGET_AVX2
+#endif
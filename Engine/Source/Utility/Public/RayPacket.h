@@ -0,0 +1,181 @@
+#pragma once
+#include <bit>
+#include "Physics/Public/AABB.h"
+
+/**
+ * @brief 레이 여러 개를 레인별 SoA로 묶은 패킷 (SSE 4레인 그룹 단위로 처리)
+ * 패킷 하나가 트래버설 스택 하나를 공유하고, 노드/삼각형은 활성 레인 마스크에 대해 한 번에 검사한다
+ * - TMin/TMax: 레인별 유효 구간. 더 가까운 히트를 찾으면 TMax가 줄어들어 이후 가지치기에 쓰인다
+ */
+template<int32 PacketSize>
+struct alignas(16) TRayPacket
+{
+	static_assert(PacketSize == 4 || PacketSize == 8 || PacketSize == 16, "Ray packets support 4, 8 or 16 rays");
+	static constexpr int32 NumGroups = PacketSize / 4;
+
+	// 삼각형 테스트에서 평행으로 간주하는 행렬식 크기
+	static constexpr float ParallelEpsilon = 1e-8f;
+
+	float OriginX[PacketSize], OriginY[PacketSize], OriginZ[PacketSize];
+	float DirX[PacketSize], DirY[PacketSize], DirZ[PacketSize];
+	float InvDirX[PacketSize], InvDirY[PacketSize], InvDirZ[PacketSize];
+	float TMin[PacketSize];
+	float TMax[PacketSize];
+	uint32 ValidMask = 0;
+
+	// InRays[0..InCount)로 채운다. InCount < PacketSize면 남는 레인은 비활성
+	// InMinT/InMaxT: 레이별 구간 (nullptr이면 0 / +inf)
+	void Load(const FRay* InRays, int32 InCount, const float* InMinT = nullptr, const float* InMaxT = nullptr)
+	{
+		InCount = std::min(InCount, PacketSize);
+		ValidMask = (1u << InCount) - 1u;
+
+		for (int32 Lane = 0; Lane < PacketSize; ++Lane)
+		{
+			// 빈 레인은 첫 레이를 복제해 두어 SIMD 연산에 NaN이 섞이지 않게 한다 (마스크로 결과는 버림)
+			const FRay& Ray = InRays[Lane < InCount ? Lane : 0];
+			OriginX[Lane] = Ray.Origin.X; OriginY[Lane] = Ray.Origin.Y; OriginZ[Lane] = Ray.Origin.Z;
+			DirX[Lane] = Ray.Direction.X; DirY[Lane] = Ray.Direction.Y; DirZ[Lane] = Ray.Direction.Z;
+			InvDirX[Lane] = SafeInverse(Ray.Direction.X);
+			InvDirY[Lane] = SafeInverse(Ray.Direction.Y);
+			InvDirZ[Lane] = SafeInverse(Ray.Direction.Z);
+			TMin[Lane] = (InMinT && Lane < InCount) ? InMinT[Lane] : 0.0f;
+			TMax[Lane] = (InMaxT && Lane < InCount) ? InMaxT[Lane] : std::numeric_limits<float>::infinity();
+		}
+	}
+
+	/**
+	 * @brief 박스와 LaneMask 레인들의 slab 테스트 (단일 레이 버전과 같이 진입 거리는 0 이상, 탈출 거리는 TMax 이하)
+	 * 반환: 히트한 레인 마스크, OutTNear: 레인별 진입 거리
+	 */
+	uint32 IntersectAABB(const FAABB& Box, uint32 LaneMask, float* OutTNear) const
+	{
+		const __m128 MinX = _mm_set1_ps(Box.Min.X), MinY = _mm_set1_ps(Box.Min.Y), MinZ = _mm_set1_ps(Box.Min.Z);
+		const __m128 MaxX = _mm_set1_ps(Box.Max.X), MaxY = _mm_set1_ps(Box.Max.Y), MaxZ = _mm_set1_ps(Box.Max.Z);
+		const __m128 FloatMax = _mm_set1_ps(std::numeric_limits<float>::max());
+
+		uint32 HitMask = 0;
+		for (int32 Group = 0; Group < NumGroups; ++Group)
+		{
+			if (((LaneMask >> (Group * 4)) & 0xFu) == 0) continue;
+			const int32 L = Group * 4;
+
+			const __m128 OX = _mm_load_ps(OriginX + L), OY = _mm_load_ps(OriginY + L), OZ = _mm_load_ps(OriginZ + L);
+			const __m128 IX = _mm_load_ps(InvDirX + L), IY = _mm_load_ps(InvDirY + L), IZ = _mm_load_ps(InvDirZ + L);
+
+			const __m128 T0X = _mm_mul_ps(_mm_sub_ps(MinX, OX), IX);
+			const __m128 T1X = _mm_mul_ps(_mm_sub_ps(MaxX, OX), IX);
+			const __m128 T0Y = _mm_mul_ps(_mm_sub_ps(MinY, OY), IY);
+			const __m128 T1Y = _mm_mul_ps(_mm_sub_ps(MaxY, OY), IY);
+			const __m128 T0Z = _mm_mul_ps(_mm_sub_ps(MinZ, OZ), IZ);
+			const __m128 T1Z = _mm_mul_ps(_mm_sub_ps(MaxZ, OZ), IZ);
+
+			__m128 TNear = _mm_max_ps(_mm_min_ps(T0X, T1X), _mm_setzero_ps());
+			TNear = _mm_max_ps(_mm_min_ps(T0Y, T1Y), TNear);
+			TNear = _mm_max_ps(_mm_min_ps(T0Z, T1Z), TNear);
+			__m128 TFar = _mm_min_ps(_mm_max_ps(T0X, T1X), _mm_min_ps(_mm_load_ps(TMax + L), FloatMax));
+			TFar = _mm_min_ps(_mm_max_ps(T0Y, T1Y), TFar);
+			TFar = _mm_min_ps(_mm_max_ps(T0Z, T1Z), TFar);
+
+			_mm_store_ps(OutTNear + L, TNear);
+			HitMask |= static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(TNear, TFar))) << L;
+		}
+		return HitMask & LaneMask;
+	}
+
+	/**
+	 * @brief 삼각형 (V0, E1 = V1 - V0, E2 = V2 - V0) 과 Moller-Trumbore (양면)
+	 * TMin < T < TMax인 히트가 있는 레인은 TMax와 InOutTriIndex[레인]을 갱신한다. 반환: 갱신된 레인 마스크
+	 */
+	uint32 IntersectTriangle(const float* V0, const float* E1, const float* E2, int32 TriIndex, uint32 LaneMask, int32* InOutTriIndex)
+	{
+		const __m128 V0X = _mm_set1_ps(V0[0]), V0Y = _mm_set1_ps(V0[1]), V0Z = _mm_set1_ps(V0[2]);
+		const __m128 E1X = _mm_set1_ps(E1[0]), E1Y = _mm_set1_ps(E1[1]), E1Z = _mm_set1_ps(E1[2]);
+		const __m128 E2X = _mm_set1_ps(E2[0]), E2Y = _mm_set1_ps(E2[1]), E2Z = _mm_set1_ps(E2[2]);
+		const __m128 Zero = _mm_setzero_ps();
+		const __m128 One = _mm_set1_ps(1.0f);
+		const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		const __m128 Index = _mm_castsi128_ps(_mm_set1_epi32(TriIndex));
+
+		uint32 HitMask = 0;
+		for (int32 Group = 0; Group < NumGroups; ++Group)
+		{
+			const uint32 GroupMask = (LaneMask >> (Group * 4)) & 0xFu;
+			if (GroupMask == 0) continue;
+			const int32 L = Group * 4;
+
+			const __m128 DX = _mm_load_ps(DirX + L), DY = _mm_load_ps(DirY + L), DZ = _mm_load_ps(DirZ + L);
+
+			// P = D x E2, Det = E1 . P
+			const __m128 PX = _mm_sub_ps(_mm_mul_ps(DY, E2Z), _mm_mul_ps(DZ, E2Y));
+			const __m128 PY = _mm_sub_ps(_mm_mul_ps(DZ, E2X), _mm_mul_ps(DX, E2Z));
+			const __m128 PZ = _mm_sub_ps(_mm_mul_ps(DX, E2Y), _mm_mul_ps(DY, E2X));
+			const __m128 Det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E1X, PX), _mm_mul_ps(E1Y, PY)), _mm_mul_ps(E1Z, PZ));
+			const __m128 InvDet = _mm_div_ps(One, Det);
+
+			// S = O - V0, U = (S . P) / Det
+			const __m128 SX = _mm_sub_ps(_mm_load_ps(OriginX + L), V0X);
+			const __m128 SY = _mm_sub_ps(_mm_load_ps(OriginY + L), V0Y);
+			const __m128 SZ = _mm_sub_ps(_mm_load_ps(OriginZ + L), V0Z);
+			const __m128 U = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(SX, PX), _mm_mul_ps(SY, PY)), _mm_mul_ps(SZ, PZ)), InvDet);
+
+			// Q = S x E1, V = (D . Q) / Det, T = (E2 . Q) / Det
+			const __m128 QX = _mm_sub_ps(_mm_mul_ps(SY, E1Z), _mm_mul_ps(SZ, E1Y));
+			const __m128 QY = _mm_sub_ps(_mm_mul_ps(SZ, E1X), _mm_mul_ps(SX, E1Z));
+			const __m128 QZ = _mm_sub_ps(_mm_mul_ps(SX, E1Y), _mm_mul_ps(SY, E1X));
+			const __m128 V = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, QX), _mm_mul_ps(DY, QY)), _mm_mul_ps(DZ, QZ)), InvDet);
+			const __m128 T = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(E2X, QX), _mm_mul_ps(E2Y, QY)), _mm_mul_ps(E2Z, QZ)), InvDet);
+
+			const __m128 CurrentTMax = _mm_load_ps(TMax + L);
+			__m128 Accept = _mm_cmpge_ps(_mm_and_ps(Det, AbsMask), _mm_set1_ps(ParallelEpsilon));
+			Accept = _mm_and_ps(Accept, _mm_and_ps(_mm_cmpge_ps(U, Zero), _mm_cmple_ps(U, One)));
+			Accept = _mm_and_ps(Accept, _mm_and_ps(_mm_cmpge_ps(V, Zero), _mm_cmple_ps(_mm_add_ps(U, V), One)));
+			Accept = _mm_and_ps(Accept, _mm_and_ps(_mm_cmpgt_ps(T, _mm_load_ps(TMin + L)), _mm_cmplt_ps(T, CurrentTMax)));
+
+			const uint32 GroupHits = static_cast<uint32>(_mm_movemask_ps(Accept)) & GroupMask;
+			if (GroupHits == 0) continue;
+
+			// 마스크 밖 레인은 원래 값을 유지
+			const __m128 LaneSelect = _mm_castsi128_ps(_mm_cmpgt_epi32(
+				_mm_and_si128(_mm_set1_epi32(static_cast<int32>(GroupHits)), _mm_setr_epi32(1, 2, 4, 8)), _mm_setzero_si128()));
+			_mm_store_ps(TMax + L, _mm_blendv_ps(CurrentTMax, T, LaneSelect));
+			__m128 OldIndex = _mm_loadu_ps(reinterpret_cast<const float*>(InOutTriIndex + L));
+			_mm_storeu_ps(reinterpret_cast<float*>(InOutTriIndex + L), _mm_blendv_ps(OldIndex, Index, LaneSelect));
+
+			HitMask |= GroupHits << L;
+		}
+		return HitMask;
+	}
+
+	// LaneMask 레인 중 가장 큰 TMax (노드 진입 거리가 이보다 크면 어떤 레인도 더 가까운 히트를 얻을 수 없다)
+	float GetMaxTMax(uint32 LaneMask) const
+	{
+		float Result = -std::numeric_limits<float>::infinity();
+		while (LaneMask)
+		{
+			const int32 Lane = std::countr_zero(LaneMask);
+			LaneMask &= LaneMask - 1;
+			Result = std::max(Result, TMax[Lane]);
+		}
+		return Result;
+	}
+
+	// LaneMask 레인 중 가장 작은 InTNear (자식 방문 순서 결정용)
+	static float GetMinTNear(const float* InTNear, uint32 LaneMask)
+	{
+		float Result = std::numeric_limits<float>::infinity();
+		while (LaneMask)
+		{
+			const int32 Lane = std::countr_zero(LaneMask);
+			LaneMask &= LaneMask - 1;
+			Result = std::min(Result, InTNear[Lane]);
+		}
+		return Result;
+	}
+
+private:
+	static float SafeInverse(float InValue)
+	{
+		return (fabsf(InValue) > 1e-8f) ? 1.0f / InValue : std::numeric_limits<float>::infinity();
+	}
+};
@@ -1,15 +1,68 @@
 #pragma once
 #include <vector>
+#include <atomic>
 #include "Global/Types.h"
 #include "Physics/Public/AABB.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Utility/Public/ScopeCycleCounter.h"
+#include "Utility/Public/WideBVH.h"
+#include "Utility/Public/RayPacket.h"
+
+class FTaskScheduler;
+
+enum class EBVHBuildMode : uint8
+{
+	Serial,		// 호출 스레드에서 재귀 빌드
+	Parallel,	// 상위 레벨 바운드/비닝 병렬 리덕션 + 하위 서브트리 작업 분할
+};
 
 class FSceneBVH
 {
 public:
 	// 인풋: 씬의 Primitive 포인터 목록 (월드 AABB는 UPrimitiveComponent에서 가져옴)
-	void Build(const TArray<UPrimitiveComponent*>& InPrimitives);
+	// InScheduler: Parallel 모드에서 사용할 스케줄러 (nullptr이면 전역 스케줄러)
+	void Build(const TArray<UPrimitiveComponent*>& InPrimitives,
+		EBVHBuildMode InMode = EBVHBuildMode::Parallel, FTaskScheduler* InScheduler = nullptr);
+
+	// 컴포넌트 없이 AABB 목록만으로 빌드 (헤드리스 벤치마크용, Primitives는 nullptr로 채워짐)
+	void BuildFromBounds(const TArray<FAABB>& InBounds,
+		EBVHBuildMode InMode = EBVHBuildMode::Parallel, FTaskScheduler* InScheduler = nullptr);
+
+	// 트리 품질 지표: 루트 표면적으로 정규화한 SAH 비용 (낮을수록 좋음)
+	// 노드 바운드가 바뀔 때마다 누적 합을 갱신하므로 O(1)
+	float ComputeSAHCost() const;
+
+	// 마지막 전체 빌드 대비 SAH 비용 비율 (1.0 = 빌드 직후 품질)
+	float GetSAHDegradation() const;
+	bool ShouldRebuild(float InMaxDegradation = DefaultMaxSAHDegradation) const { return GetSAHDegradation() > InMaxDegradation; }
+	static constexpr float DefaultMaxSAHDegradation = 1.5f;
+
+	// 증분 삽입: SAH 비용이 가장 적게 늘어나는 형제 노드 옆에 리프를 붙이고 조상을 따라 회전
+	// 이미 들어 있는 프리미티브면 새 바운드로 다시 삽입. 반환: 프리미티브 인덱스 (실패 시 -1)
+	int64 Insert(UPrimitiveComponent* InPrimitive);
+	int64 Insert(UPrimitiveComponent* InPrimitive, const FAABB& InBounds);
+
+	// 증분 제거: 리프에서 빼고, 빈 리프는 부모와 함께 접어 형제를 끌어올림
+	// 컴포넌트를 역참조하지 않으므로 이미 삭제된 포인터로 호출해도 안전
+	bool Remove(UPrimitiveComponent* InPrimitive);
+	bool RemoveByIndex(int64 PrimIdx);
+
+	bool Contains(UPrimitiveComponent* InPrimitive) const { return PrimIndexMap.find(InPrimitive) != PrimIndexMap.end(); }
+
+	// 백그라운드 재빌드: 현재 바운드 스냅샷으로 새 트리를 워커에서 빌드
+	// 빌드 중의 Insert/Remove/RefitDirty는 기록해 두었다가 완료 시 새 트리에 재적용한 뒤 교체한다
+	// InScheduler는 메인 스레드가 Wait하지 않는 전용 스케줄러여야 한다 (Wait는 대기 중 큐의 작업을 대신 실행하므로
+	// 전역 스케줄러에 넣으면 컬링/ParallelFor를 기다리던 메인 스레드가 직렬 재빌드 전체를 떠맡을 수 있음)
+	void StartAsyncRebuild(FTaskScheduler& InScheduler);
+	bool IsRebuildPending() const { return PendingRebuild != nullptr; }
+	// 메인 스레드에서 매 프레임 호출. 교체가 일어났으면 true
+	bool TryFinishAsyncRebuild();
+
+	// 트래버설 레이아웃 (기본: CPU에 맞는 wide 레이아웃). 빌드 후 2진 트리를 접어 wide 노드를 만든다
+	void SetTraversalLayout(EBVHLayout InLayout);
+	EBVHLayout GetTraversalLayout() const { return Layout; }
+	// 증분 삽입/제거로 토폴로지가 바뀌면 wide 노드가 무효화되어 2진 트래버설로 대체된다. 피킹 직전 호출해 다시 접는다
+	void UpdateWideLayout();
 
 	// Ray와 교차 가능한 후보 프리미티브를 outCandidates에 추가 (교차 '가능성'만 필터)
 	void QueryRay(const FRay& Ray, TArray<UPrimitiveComponent*>& OutCandidates) const;
@@ -17,6 +70,9 @@ public:
 	// 전체 리핏 (바텀업)
 	void Refit();
 
+	// 전체 리핏 (프리미티브 인덱스 순서의 AABB를 일괄 계산해 넘기는 경우, 크기가 모자라면 남는 프리미티브는 그대로)
+	void RefitFromBounds(const TArray<FAABB>& InBounds);
+
 	// Dirty-only 리핏 (프리미티브 인덱스 집합)
 	void RefitDirty(const TArray<int64>& DirtyPrimIndices);
 
@@ -40,32 +96,18 @@ public:
 #endif
 
 		OutHit = nullptr;
-		if (Nodes.empty()) return false;
+		if (RootIndex < 0) return false;
 
 		FRayCached Cached{ { Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z }, { 0,0,0 } };
 		Cached.InvDir[0] = (fabsf(Ray.Direction.X) > 1e-8f) ? 1.0f / Ray.Direction.X : std::numeric_limits<float>::infinity();
 		Cached.InvDir[1] = (fabsf(Ray.Direction.Y) > 1e-8f) ? 1.0f / Ray.Direction.Y : std::numeric_limits<float>::infinity();
 		Cached.InvDir[2] = (fabsf(Ray.Direction.Z) > 1e-8f) ? 1.0f / Ray.Direction.Z : std::numeric_limits<float>::infinity();
 
-		struct FEntry { int64 Index; float TMin; };
-		FEntry Stack[256];
-		int32 SP = 0;
-
-		float RootTMin, RootTMax;
-		if (!RayIntersectsAABB(Cached, Nodes[0].Bounds, RootTMin, RootTMax)) return false;
-		Stack[SP++] = { 0, RootTMin };
-
-		while (SP > 0)
-		{
-			const FEntry Entry = Stack[--SP];
-			if (Entry.TMin > InOutBestDist) continue;
-
-			const FNode& N = Nodes[Entry.Index];
-			if (N.IsLeaf())
+		auto VisitLeaf = [&](int64 Start, int64 Count)
 			{
-				for (int64 i = 0; i < N.Count; ++i)
+				for (int64 i = 0; i < Count; ++i)
 				{
-					const int64 PrimIdx = Indices[N.Start + i];
+					const int64 PrimIdx = Indices[Start + i];
 
 					float PTMin, PTMax;
 					if (!RayIntersectsAABB(Cached, PrimBounds[PrimIdx], PTMin, PTMax)) continue;
@@ -80,6 +122,39 @@ public:
 						OutHit = Prim;
 					}
 				}
+			};
+
+		// wide 레이아웃: 노드당 자식 4/8개를 한 번의 SIMD slab 테스트로 검사
+		if (Layout != EBVHLayout::Binary && !bWideLayoutDirty)
+		{
+			const FWideRay WideRay{ { Cached.Origin[0], Cached.Origin[1], Cached.Origin[2] },
+				{ Cached.InvDir[0], Cached.InvDir[1], Cached.InvDir[2] } };
+			auto VisitWideLeaf = [&](int32 Start, int32 Count, float) { VisitLeaf(Start, Count); };
+
+			if (Layout == EBVHLayout::Wide8)
+				FWideBVH::TraverseFrontToBack(WideNodes8, WideRay, InOutBestDist, VisitWideLeaf);
+			else
+				FWideBVH::TraverseFrontToBack(WideNodes4, WideRay, InOutBestDist, VisitWideLeaf);
+			return OutHit != nullptr;
+		}
+
+		// 증분 삽입으로 깊어진 트리에서도 서브트리를 버리지 않도록 넘치면 힙으로 옮겨 가는 스택 사용
+		struct FEntry { int64 Index; float TMin; };
+		TTraversalStack<FEntry, 256> Stack;
+
+		float RootTMin, RootTMax;
+		if (!RayIntersectsAABB(Cached, Nodes[RootIndex].Bounds, RootTMin, RootTMax)) return false;
+		Stack.Push({ RootIndex, RootTMin });
+
+		while (!Stack.IsEmpty())
+		{
+			const FEntry Entry = Stack.Pop();
+			if (Entry.TMin > InOutBestDist) continue;
+
+			const FNode& N = Nodes[Entry.Index];
+			if (N.IsLeaf())
+			{
+				VisitLeaf(N.Start, N.Count);
 			}
 			else
 			{
@@ -90,17 +165,114 @@ public:
 				if (bHitL & bHitR)
 				{
 					// 먼 쪽 먼저 push -> 가까운 쪽이 다음에 먼저 팝됨
-					if (LTMin < RTMin) { Stack[SP++] = { N.Right, RTMin }; Stack[SP++] = { N.Left, LTMin }; }
-					else { Stack[SP++] = { N.Left, LTMin };  Stack[SP++] = { N.Right, RTMin }; }
+					if (LTMin < RTMin) { Stack.Push({ N.Right, RTMin }); Stack.Push({ N.Left, LTMin }); }
+					else { Stack.Push({ N.Left, LTMin });  Stack.Push({ N.Right, RTMin }); }
 				}
-				else if (bHitL) { Stack[SP++] = { N.Left,  LTMin }; }
-				else if (bHitR) { Stack[SP++] = { N.Right, RTMin }; }
+				else if (bHitL) { Stack.Push({ N.Left,  LTMin }); }
+				else if (bHitR) { Stack.Push({ N.Right, RTMin }); }
 			}
 		}
 		return OutHit != nullptr;
 	}
 
-	size_t GetPrimitiveCount() const { return Primitives.size(); }
+	static constexpr int32 DefaultRayPacketSize = 8;
+
+	// 레이 배열 배치 버전: PacketSize개(4/8/16)씩 묶어 트래버설 스택 하나를 공유하고, 노드/프리미티브 AABB는 레인 동시 검사
+	// - InOutBestDist/OutHits: 레이별 최근접 거리와 프리미티브 (InOutBestDist의 초기값이 컷오프)
+	// - PreciseTest: (Primitive, PrimIndex, RayIndex, PrimAABB_TMin, inOutHitDist) -> true/false, 단일 레이 버전과 같은 의미로 레이마다 호출
+	// - 반환: 히트한 레이 수
+	template<int32 PacketSize = DefaultRayPacketSize, typename TVisitor>
+	int32 TraverseRaysFirstHit(const FRay* Rays, int32 NumRays,
+		float* InOutBestDist,
+		UPrimitiveComponent** OutHits,
+		TVisitor&& PreciseTest) const
+	{
+#ifdef ENABLE_BVH_STATS
+		FScopeCycleCounter Counter(GetSceneBVHTraverseStatId());
+#endif
+
+		for (int32 i = 0; i < NumRays; ++i)
+		{
+			OutHits[i] = nullptr;
+		}
+		if (RootIndex < 0) return 0;
+
+		struct FEntry { int64 Index; uint32 Mask; float TMin; };
+		TTraversalStack<FEntry, 256> Stack;
+
+		TRayPacket<PacketSize> Packet;
+		alignas(16) float LNear[PacketSize];
+		alignas(16) float RNear[PacketSize];
+		int32 NumHits = 0;
+
+		for (int32 Base = 0; Base < NumRays; Base += PacketSize)
+		{
+			const int32 Count = std::min(PacketSize, NumRays - Base);
+			Packet.Load(Rays + Base, Count, nullptr, InOutBestDist + Base);
+			UPrimitiveComponent** PacketHits = OutHits + Base;
+
+			const uint32 RootMask = Packet.IntersectAABB(Nodes[RootIndex].Bounds, Packet.ValidMask, LNear);
+			if (RootMask != 0)
+			{
+				Stack.Push({ RootIndex, RootMask, TRayPacket<PacketSize>::GetMinTNear(LNear, RootMask) });
+			}
+
+			while (!Stack.IsEmpty())
+			{
+				const FEntry Entry = Stack.Pop();
+				if (Entry.TMin > Packet.GetMaxTMax(Entry.Mask)) continue;
+
+				const FNode& N = Nodes[Entry.Index];
+				if (N.IsLeaf())
+				{
+					for (int64 i = 0; i < N.Count; ++i)
+					{
+						const int64 PrimIdx = Indices[N.Start + i];
+						uint32 PrimMask = Packet.IntersectAABB(PrimBounds[PrimIdx], Entry.Mask, LNear);
+						while (PrimMask)
+						{
+							const int32 Lane = std::countr_zero(PrimMask);
+							PrimMask &= PrimMask - 1;
+
+							float HitDist = Packet.TMax[Lane];
+							if (PreciseTest(Primitives[PrimIdx], PrimIdx, Base + Lane, LNear[Lane], HitDist) && HitDist < Packet.TMax[Lane])
+							{
+								Packet.TMax[Lane] = HitDist;
+								PacketHits[Lane] = Primitives[PrimIdx];
+							}
+						}
+					}
+					continue;
+				}
+
+				const uint32 LMask = (N.Left >= 0) ? Packet.IntersectAABB(Nodes[N.Left].Bounds, Entry.Mask, LNear) : 0;
+				const uint32 RMask = (N.Right >= 0) ? Packet.IntersectAABB(Nodes[N.Right].Bounds, Entry.Mask, RNear) : 0;
+				const float LTMin = TRayPacket<PacketSize>::GetMinTNear(LNear, LMask);
+				const float RTMin = TRayPacket<PacketSize>::GetMinTNear(RNear, RMask);
+
+				// 먼 쪽 먼저 push -> 가까운 쪽이 다음에 먼저 팝됨
+				if (LMask && RMask)
+				{
+					if (LTMin < RTMin) { Stack.Push({ N.Right, RMask, RTMin }); Stack.Push({ N.Left, LMask, LTMin }); }
+					else { Stack.Push({ N.Left, LMask, LTMin }); Stack.Push({ N.Right, RMask, RTMin }); }
+				}
+				else if (LMask) { Stack.Push({ N.Left, LMask, LTMin }); }
+				else if (RMask) { Stack.Push({ N.Right, RMask, RTMin }); }
+			}
+
+			for (int32 Lane = 0; Lane < Count; ++Lane)
+			{
+				if (Packet.TMax[Lane] < InOutBestDist[Base + Lane])
+				{
+					InOutBestDist[Base + Lane] = Packet.TMax[Lane];
+					++NumHits;
+				}
+			}
+		}
+		return NumHits;
+	}
+
+	size_t GetPrimitiveCount() const { return static_cast<size_t>(NumLivePrimitives); }
 	bool GetPrimBounds(UPrimitiveComponent * Prim, FAABB & OutBounds) const;
 
 	bool GetPrimSphereByIndex(int64 PrimIdx, FVector& OutCenter, float& OutRadiusSq) const;
@@ -127,10 +299,71 @@ private:
 	TArray<int64> PrimToLeaf;                // 각 프리미티브가 속한 leaf 노드 인덱스
 	TMap<UPrimitiveComponent*, int64> PrimIndexMap; // 포인터→인덱스
 
+	// 증분 갱신 상태 (빌드 직후 루트는 0이지만 삽입/제거/회전으로 바뀔 수 있음)
+	int64 RootIndex = -1;
+	int64 NumLivePrimitives = 0;
+	TArray<int64> FreeNodes;                 // 재사용 가능한 노드 인덱스
+	TArray<int64> FreePrimSlots;             // 제거된 프리미티브 슬롯
+	TArray<int64> FreeIndexSlots;            // 접힌 리프가 쓰던 Indices 슬롯
+
+	// SAH 비용 누적 합 (내부 노드 = 면적, 리프 = 면적 * 개수) 과 마지막 빌드 시점의 정규화 비용
+	double SAHCostSum = 0.0;
+	float BuildSAHCost = 0.0f;
+
+	// 이 깊이를 넘는 삽입이 생기면 트래버설 스택 보호를 위해 즉시 재빌드
+	static constexpr int32 MaxIncrementalDepth = 96;
+
+	struct FPendingRebuild;
+	TSharedPtr<FPendingRebuild> PendingRebuild;
+
+	// wide 레이아웃 (활성 레이아웃만 채움)
+	EBVHLayout Layout = FWideBVH::GetPreferredLayout();
+	TArray<TWideBVHNode<4>> WideNodes4;
+	TArray<TWideBVHNode<8>> WideNodes8;
+	TArray<int32> WideSlotOfNode;            // 2진 노드 -> wide 슬롯 (리핏 시 바운드 동기화용)
+	bool bWideLayoutDirty = true;
+
 	// SAH 보조: AABB 표면적
 	static float SurfaceArea(const FAABB& B);
 
-	int64 BuildRecursive(int64* IndexPtr, int64 Count);
+	// 빌드 공통 경로: PrimBounds/SoA가 채워진 상태에서 Indices의 프리미티브로 트리 구성
+	void BuildTree(EBVHBuildMode InMode, FTaskScheduler* InScheduler);
+
+	// 살아 있는 프리미티브(리프에 속한 슬롯)만 모아 슬롯 번호를 유지한 채 트리 재구성
+	void RebuildTopology(EBVHBuildMode InMode, FTaskScheduler* InScheduler);
+
+	// 노드 바운드 기록 + SAH 누적 합/노드 SoA 동기화 (빌드 이후 모든 바운드 변경은 이 경로로)
+	void SetNodeBounds(int64 NodeIndex, const FAABB& InBounds);
+	static double NodeSAHTerm(const FNode& InNode);
+	void RecomputeSAHCostSum();
+
+	int64 AllocateNode();
+	void FreeNode(int64 NodeIndex);
+
+	// 증분 갱신 보조
+	void InsertLeaf(int64 LeafIndex);
+	int64 FindBestSibling(const FAABB& InLeafBounds) const;
+	void RemoveLeaf(int64 LeafIndex);
+	void ReplaceChild(int64 ParentIndex, int64 OldChild, int64 NewChild);
+	// NodeIndex부터 루트까지 바운드를 갱신하며 회전 적용
+	void RefitAncestors(int64 NodeIndex);
+	// 자식과 반대편 손자를 맞바꿔 SAH 비용이 줄어들면 적용
+	void RotateNode(int64 NodeIndex);
+	int32 GetNodeDepth(int64 NodeIndex) const;
+
+	// 빌드 중에만 유효한 상태 (병렬 빌드 시 노드 인덱스 할당에 사용)
+	struct FBuildContext
+	{
+		FTaskScheduler* Scheduler = nullptr;	// nullptr이면 직렬 빌드
+		std::atomic<int64> NextNodeIndex{ 0 };
+	};
+
+	// 이 개수 이상인 노드는 바운드 계산과 비닝을 ParallelFor로 처리
+	static constexpr int64 ParallelReduceThreshold = 32 * 1024;
+	// 이 개수 이상인 서브트리는 별도 작업으로 분리
+	static constexpr int64 ParallelSubtreeThreshold = 2 * 1024;
+
+	int64 BuildRecursive(FBuildContext& Context, int64* IndexPtr, int64 Count);
 
 	struct FRayCached
 	{
@@ -165,6 +398,9 @@ private:
 	// Ensure SoA arrays are sized to PrimBounds.size()
 	void EnsurePrimSoASize() const;
 
+	// PrimBounds[PrimIdx]와 SoA 미러(min/max/centroid/radius^2)를 함께 기록
+	void SetPrimBounds(int64 PrimIdx, const FVector& MinW, const FVector& MaxW);
+
 	// Hot-path primitive-index based AABB slab test (uses SoA arrays) - faster than materializing FAABB
 	bool RayIntersectsAABB_PrimIndex(const FRayCached& Ray, int64 PrimIdx, float& OutTMin, float& OutTMax) const;
 
@@ -177,9 +413,29 @@ private:
 	// Initialize a leaf node at NodeIndex using IndexPtr range
 	void MakeLeafNode(int64 NodeIndex, const FVector& BMin, const FVector& BMax, int64* IndexPtr, int64 Count);
 
+	// Binned SAH용 축별 빈 (3축을 한 번의 순회로 채움)
+	static constexpr int32 SplitBinCount = 32;
+	struct FSplitBins
+	{
+		int32 Counts[3][SplitBinCount];
+		FVector BinMin[3][SplitBinCount];
+		FVector BinMax[3][SplitBinCount];
+
+		void Reset();
+		void Merge(const FSplitBins& Other);
+	};
+
+	// 병렬 빌드용 리덕션 (결과는 직렬 버전과 비트 단위로 동일)
+	void ComputeBoundsForRangeParallel(FTaskScheduler& Scheduler, const int64* IndexPtr, int64 Count,
+		FVector& OutMin, FVector& OutMax, FVector& OutCentMin, FVector& OutCentMax) const;
+	void AccumulateSplitBins(const int64* IndexPtr, int64 Count, const FVector& CentMin, const FVector& CentMax, FSplitBins& InOutBins) const;
+	void EvaluateSplitBins(const FSplitBins& Bins, const FVector& CentMin, const FVector& CentMax, int& OutBestAxis, int& OutBestSplitBin, float& OutBestCost) const;
+
 	// Find best split using binned SAH, returns (BestAxis, BestSplitBin, BestCost).
 	// If no valid split found, BestAxis will be -1.
-	void FindBestSplit(const int64* IndexPtr, int64 Count, const FVector& CentMin, const FVector& CentMax, int& OutBestAxis, int& OutBestSplitBin, float& OutBestCost) const;
+	// Scheduler가 주어지면 비닝을 병렬로 수행
+	void FindBestSplit(const int64* IndexPtr, int64 Count, const FVector& CentMin, const FVector& CentMax, int& OutBestAxis, int& OutBestSplitBin, float& OutBestCost,
+		FTaskScheduler* Scheduler = nullptr) const;
 
 	// Internal AABB intersection that returns TMin/TMax if hit.
 	bool RayIntersectsAABBInternal(const FRayCached& Ray, const FAABB& Box, float& OutTMin, float& OutTMax) const;
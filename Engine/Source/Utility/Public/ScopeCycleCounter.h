@@ -38,6 +38,8 @@ extern char GStat_StaticMeshBVHTraverse_Tag;
 TStatId GetStaticMeshBVHTraverseStatId();
 extern char GStat_Culling_Tag;
 TStatId GetCullingStatId();
+extern char GStat_FrustumCulling_Tag;
+TStatId GetFrustumCullingStatId();
 extern char GStat_VisitTriangle_Tag;
 TStatId GetVisitTriangleStatId();
 
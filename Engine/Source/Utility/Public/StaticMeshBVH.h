@@ -1,7 +1,17 @@
 #pragma once
+#include <filesystem>
 #include <functional>
 #include "Physics/Public/AABB.h"
 #include "ScopeCycleCounter.h"
+#include "WideBVH.h"
+#include "RayPacket.h"
+
+// 배치 레이 질의 결과. T: 모델 공간 레이 파라미터 (미스면 +inf), TriIndex: 미스면 -1
+struct FMeshRayHit
+{
+	float T = std::numeric_limits<float>::infinity();
+	int32 TriIndex = -1;
+};
 
 // 정적 메시의 Triangle BVH
 class FStaticMeshBVH
@@ -21,6 +31,26 @@ public:
 		if (Nodes.empty()) return;
 
 		const FRayCached RC = CacheRay(ModelRay);
+		const float cutoff = CutoffT > 0.f ? CutoffT : std::numeric_limits<float>::infinity();
+
+		// wide 레이아웃: 자식 4/8개를 한 번에 검사 (컷오프는 고정이므로 방문 순서만 front-to-back)
+		if (Layout != EBVHLayout::Binary)
+		{
+			const FWideRay WideRay{ { RC.Origin[0], RC.Origin[1], RC.Origin[2] }, { RC.InvDir[0], RC.InvDir[1], RC.InvDir[2] } };
+			auto VisitLeaf = [&](int32 Start, int32 Count, float)
+				{
+					for (int32 i = 0; i < Count; ++i)
+					{
+						VisitTriangle(TriRefs[Start + i].Index);
+					}
+				};
+
+			if (Layout == EBVHLayout::Wide8)
+				FWideBVH::TraverseFrontToBack(WideNodes8, WideRay, cutoff, VisitLeaf);
+			else
+				FWideBVH::TraverseFrontToBack(WideNodes4, WideRay, cutoff, VisitLeaf);
+			return;
+		}
 
 		struct FEntry { int32 Index; float TMin; };
 		FEntry stack[256];
@@ -30,8 +60,6 @@ public:
 		if (!RayIntersectsAABB(RC, Nodes[0].Bounds, rootTMin, rootTMax)) return;
 		stack[sp++] = { 0, rootTMin };
 
-		const float cutoff = CutoffT > 0.f ? CutoffT : std::numeric_limits<float>::infinity();
-
 		while (sp > 0)
 		{
 			const FEntry e = stack[--sp];
@@ -64,9 +92,41 @@ public:
 		}
 	}
 
+	static constexpr int32 DefaultRayPacketSize = 8;
+
+	/**
+	 * @brief 레이 배열의 레이별 최근접 삼각형 (PacketSize: 4/8/16)
+	 * PacketSize개씩 묶어 2진 트리를 한 스택으로 함께 내려가고, 리프의 삼각형은 SoA(V0/E1/E2)로 레인 동시 검사
+	 * InMinT/InMaxT: 레이별 유효 구간 (nullptr이면 0 / +inf)
+	 */
+	template<int32 PacketSize = DefaultRayPacketSize>
+	void IntersectRays(const FRay* ModelRays, int32 NumRays, FMeshRayHit* OutHits,
+		const float* InMinT = nullptr, const float* InMaxT = nullptr) const;
+	void IntersectRays(const TArray<FRay>& ModelRays, TArray<FMeshRayHit>& OutHits) const;
+
 	bool IsBuilt() const { return !Nodes.empty(); }
 	void Clear();
 
+	/**
+	 * @brief 디스크 캐시 (.bvhbin): 노드/TriRefs/삼각형 SoA를 평탄한 바이너리로 저장하고 재빌드 없이 한 번의 읽기로 복원
+	 * InSourceHash: ComputeSourceHash로 구한 원본 메시 해시, InSourceTime: 원본 파일 수정 시각
+	 * 로드는 버전/해시/시각/크기 중 하나라도 다르면 실패한다 (호출 측은 Build 후 다시 저장)
+	 */
+	bool SaveToFile(const std::filesystem::path& InPath, uint64 InSourceHash, int64 InSourceTime, float InBuildMilliseconds) const;
+	bool LoadFromFile(const std::filesystem::path& InPath, uint64 InSourceHash, int64 InSourceTime, float* OutBuildMilliseconds = nullptr);
+
+	// 같은 레코드를 메모리 버퍼로 주고받는다 (다른 컨테이너 파일 안에 BVH를 넣을 때)
+	bool SaveToBuffer(TArray<uint8>& OutBuffer, uint64 InSourceHash, int64 InSourceTime, float InBuildMilliseconds) const;
+	bool LoadFromBuffer(const uint8* InData, size_t InSize, uint64 InSourceHash, int64 InSourceTime, float* OutBuildMilliseconds = nullptr);
+
+	// 정점 위치와 인덱스로 계산한 64비트 해시 (노멀/UV 변경은 BVH에 영향이 없으므로 제외)
+	static uint64 ComputeSourceHash(const TArray<FNormalVertex>& Vertices, const TArray<uint32>* Indices);
+	static constexpr uint32 CacheVersion = 1;
+
+	// 트래버설 레이아웃 (기본: CPU에 맞는 wide 레이아웃)
+	void SetTraversalLayout(EBVHLayout InLayout);
+	EBVHLayout GetTraversalLayout() const { return Layout; }
+
 	// cheap inline accessors
 	inline void GetTriV0E1E2(int32 TriIdx, FVector& OutV0, FVector& OutE1, FVector& OutE2) const
 	{
@@ -103,6 +163,12 @@ private:
 	const TArray<uint32>* Idx = nullptr;
 	int32 NumTris = 0;
 
+	// Build 말미에 2진 트리를 접어 만든 wide 노드 (활성 레이아웃만 채움)
+	EBVHLayout Layout = FWideBVH::GetPreferredLayout();
+	TArray<TWideBVHNode<4>> WideNodes4;
+	TArray<TWideBVHNode<8>> WideNodes8;
+	void BuildWideNodes();
+
 	// SAH 보조: AABB 표면적
 	static float SurfaceArea(const FAABB& B);
 
@@ -134,4 +200,8 @@ private:
 	mutable TArray<float> TriRadiusSq;
 
 	void EnsureTriSoASize() const;
+
+	// 패킷 하나의 트래버설 (OutTriIndex: 레인별 최근접 삼각형, 히트 거리는 Packet.TMax)
+	template<int32 PacketSize>
+	void TraversePacket(TRayPacket<PacketSize>& Packet, int32* OutTriIndex) const;
 };
@@ -0,0 +1,90 @@
+#pragma once
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class FTaskScheduler;
+
+/**
+ * @brief Dispatch된 작업들의 완료를 추적하는 그룹
+ * FTaskScheduler::Wait()에 넘겨 그룹 내 모든 작업이 끝날 때까지 대기한다
+ */
+class FTaskGroup
+{
+public:
+	FTaskGroup() = default;
+	FTaskGroup(const FTaskGroup&) = delete;
+	FTaskGroup& operator=(const FTaskGroup&) = delete;
+
+	bool IsDone() const { return PendingCount.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class FTaskScheduler;
+	std::atomic<int32> PendingCount{ 0 };
+};
+
+/**
+ * @brief Work-stealing 워커 스레드 풀
+ * - 워커는 자기 큐의 뒤쪽에서 작업을 꺼낸다 (LIFO, 방금 쪼갠 작업이 캐시에 남아 있음)
+ * - 자기 큐가 비면 다른 큐의 앞쪽에서 훔쳐온다 (FIFO, 오래된 = 큰 작업부터)
+ * - Wait()은 대기 중에도 작업을 직접 실행하므로 작업 안에서 다시 Dispatch/Wait 해도 교착되지 않는다
+ * - 워커가 아닌 스레드(메인 스레드 등)에서 Dispatch한 작업은 외부 큐에 쌓인다
+ */
+class FTaskScheduler
+{
+public:
+	using FTask = TFunction<void()>;
+
+	// InNumWorkers: 추가로 생성할 워커 수 (0이면 모든 작업을 호출 스레드에서 실행)
+	explicit FTaskScheduler(uint32 InNumWorkers);
+	~FTaskScheduler();
+
+	FTaskScheduler(const FTaskScheduler&) = delete;
+	FTaskScheduler& operator=(const FTaskScheduler&) = delete;
+
+	// 전역 스케줄러 (하드웨어 스레드 수 - 1 개의 워커)
+	static FTaskScheduler& Get();
+
+	uint32 GetNumWorkers() const { return NumWorkers; }
+	// Wait()로 참여하는 호출 스레드까지 포함한 동시 실행 수
+	uint32 GetConcurrency() const { return NumWorkers + 1; }
+
+	void Dispatch(FTaskGroup& InGroup, FTask InTask);
+	void Wait(FTaskGroup& InGroup);
+
+	// [0, InCount)를 InMinBatch 이상 크기의 구간으로 나누어 병렬 실행 후 완료까지 대기
+	// Body: (Begin, End) 구간 처리
+	void ParallelFor(int64 InCount, int64 InMinBatch, const TFunction<void(int64, int64)>& Body);
+
+private:
+	struct FQueuedTask
+	{
+		FTask Task;
+		FTaskGroup* Group = nullptr;
+	};
+
+	struct FTaskQueue
+	{
+		std::mutex Mutex;
+		TDeque<FQueuedTask> Tasks;
+	};
+
+	void WorkerMain(uint32 InQueueIndex);
+
+	uint32 GetCurrentQueueIndex() const;
+	bool TryPopLocal(uint32 InQueueIndex, FQueuedTask& OutTask);
+	bool TrySteal(uint32 InThiefIndex, FQueuedTask& OutTask);
+	bool TryExecuteOne(uint32 InQueueIndex);
+
+	uint32 NumWorkers = 0;
+
+	// [0, NumWorkers): 워커 전용 큐, [NumWorkers]: 외부 스레드 큐
+	TArray<TUniquePtr<FTaskQueue>> Queues;
+	TArray<std::thread> Workers;
+
+	std::atomic<int64> QueuedCount{ 0 };
+	std::atomic<bool> bStopping{ false };
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+};
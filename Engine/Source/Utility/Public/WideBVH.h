@@ -0,0 +1,319 @@
+#pragma once
+#include <bit>
+#include "Physics/Public/AABB.h"
+
+/**
+ * @brief BVH 트래버설에 사용할 노드 레이아웃
+ * Binary: 기존 2진 트리, Wide4: SSE로 자식 4개 동시 검사, Wide8: AVX2로 자식 8개 동시 검사
+ */
+enum class EBVHLayout : uint8
+{
+	Binary,
+	Wide4,
+	Wide8,
+};
+
+/**
+ * @brief 2진 BVH를 접어 만든 N-wide 노드 (자식 바운드를 축별 SoA로 보관)
+ * - Count > 0: 리프 슬롯 (Child = 프리미티브 구간 시작, Count = 개수)
+ * - Count == 0: 내부 슬롯 (Child = 자식 wide 노드 인덱스)
+ * - 빈 슬롯은 Min/Max를 모두 +inf로 두어 어떤 방향의 레이로도 교차하지 않게 한다
+ */
+template<int32 Width>
+struct alignas(32) TWideBVHNode
+{
+	static_assert(Width == 4 || Width == 8, "Wide BVH supports 4 or 8 children");
+
+	float MinX[Width];
+	float MinY[Width];
+	float MinZ[Width];
+	float MaxX[Width];
+	float MaxY[Width];
+	float MaxZ[Width];
+	int32 Child[Width];
+	int32 Count[Width];
+};
+
+/**
+ * @brief 고정 크기 배열로 시작해 넘치면 힙 배열로 옮겨 가는 트래버설 스택
+ * 증분 삽입으로 한쪽으로 깊어진 트리에서도 서브트리를 버리지 않는다 (보통은 힙 할당 없음)
+ */
+template<typename T, int32 InlineSize>
+class TTraversalStack
+{
+public:
+	TTraversalStack() = default;
+	TTraversalStack(const TTraversalStack&) = delete;
+	TTraversalStack& operator=(const TTraversalStack&) = delete;
+
+	bool IsEmpty() const { return Num == 0; }
+
+	void Push(const T& InEntry)
+	{
+		if (Num == Capacity)
+		{
+			Grow();
+		}
+		Data[Num++] = InEntry;
+	}
+
+	T Pop() { return Data[--Num]; }
+
+private:
+	void Grow()
+	{
+		const bool bIsInline = Data == Inline;
+		Heap.resize(static_cast<size_t>(Capacity) * 2);
+		if (bIsInline)
+		{
+			std::copy(Inline, Inline + Num, Heap.begin());
+		}
+		Data = Heap.data();
+		Capacity *= 2;
+	}
+
+	T Inline[InlineSize];
+	TArray<T> Heap;
+	T* Data = Inline;
+	int32 Num = 0;
+	int32 Capacity = InlineSize;
+};
+
+struct FWideRay
+{
+	float Origin[3];
+	float InvDir[3];
+};
+
+class FWideBVH
+{
+public:
+	// AVX2가 있으면 Wide8, 없으면 Wide4
+	static EBVHLayout GetPreferredLayout();
+
+	// 자식 슬롯 전체에 대한 slab 테스트. 반환: 히트한 레인 비트마스크, OutTMin: 레인별 진입 거리
+	static uint32 IntersectNode(const TWideBVHNode<4>& Node, const FWideRay& Ray, float MaxT, float* OutTMin)
+	{
+		const __m128 OX = _mm_set1_ps(Ray.Origin[0]);
+		const __m128 OY = _mm_set1_ps(Ray.Origin[1]);
+		const __m128 OZ = _mm_set1_ps(Ray.Origin[2]);
+		const __m128 IX = _mm_set1_ps(Ray.InvDir[0]);
+		const __m128 IY = _mm_set1_ps(Ray.InvDir[1]);
+		const __m128 IZ = _mm_set1_ps(Ray.InvDir[2]);
+
+		const __m128 T0X = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinX), OX), IX);
+		const __m128 T1X = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxX), OX), IX);
+		const __m128 T0Y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinY), OY), IY);
+		const __m128 T1Y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxY), OY), IY);
+		const __m128 T0Z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinZ), OZ), IZ);
+		const __m128 T1Z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxZ), OZ), IZ);
+
+		// 스칼라 버전과 같이 진입 거리는 0 이상, 탈출 거리는 float 최대값 이하로 자른다
+		__m128 TNear = _mm_max_ps(_mm_min_ps(T0X, T1X), _mm_setzero_ps());
+		TNear = _mm_max_ps(_mm_min_ps(T0Y, T1Y), TNear);
+		TNear = _mm_max_ps(_mm_min_ps(T0Z, T1Z), TNear);
+		__m128 TFar = _mm_min_ps(_mm_max_ps(T0X, T1X), _mm_set1_ps(ClampMaxT(MaxT)));
+		TFar = _mm_min_ps(_mm_max_ps(T0Y, T1Y), TFar);
+		TFar = _mm_min_ps(_mm_max_ps(T0Z, T1Z), TFar);
+
+		_mm_storeu_ps(OutTMin, TNear);
+		return static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(TNear, TFar)));
+	}
+
+	// AVX2 미지원 CPU에서는 4-wide 두 번으로 처리
+	static uint32 IntersectNode(const TWideBVHNode<8>& Node, const FWideRay& Ray, float MaxT, float* OutTMin);
+
+	// 슬롯 하나의 바운드 갱신 (리핏 시 2진 노드 -> wide 슬롯 매핑으로 호출)
+	template<int32 Width>
+	static void SetSlotBounds(TWideBVHNode<Width>& Node, int32 Lane, const FAABB& Bounds)
+	{
+		Node.MinX[Lane] = Bounds.Min.X; Node.MinY[Lane] = Bounds.Min.Y; Node.MinZ[Lane] = Bounds.Min.Z;
+		Node.MaxX[Lane] = Bounds.Max.X; Node.MaxY[Lane] = Bounds.Max.Y; Node.MaxZ[Lane] = Bounds.Max.Z;
+	}
+
+	/**
+	 * @brief 2진 BVH를 Width-wide 트리로 접는다
+	 * 각 wide 노드는 2진 자식 중 표면적이 가장 큰 내부 노드를 반복해서 펼쳐 최대 Width개의 슬롯을 채운다
+	 * TNode: Bounds, Left, Right, Start, Count, IsLeaf()를 가진 2진 노드
+	 * OutSlotOfBinaryNode: 2진 노드 -> (wide 노드 * Width + 레인), 슬롯이 없는 노드는 -1
+	 */
+	template<int32 Width, typename TNode>
+	static void Collapse(const TArray<TNode>& BinaryNodes, int64 BinaryRoot, TArray<TWideBVHNode<Width>>& OutNodes,
+		TArray<int32>* OutSlotOfBinaryNode = nullptr)
+	{
+		OutNodes.clear();
+		if (OutSlotOfBinaryNode)
+		{
+			OutSlotOfBinaryNode->assign(BinaryNodes.size(), -1);
+		}
+		if (BinaryRoot < 0)
+		{
+			return;
+		}
+
+		OutNodes.reserve(BinaryNodes.size() / (Width - 1) + 1);
+		OutNodes.push_back(MakeEmptyNode<Width>());
+
+		auto FillSlot = [&](int32 WideIndex, int32 Lane, int64 BinaryIndex)
+			{
+				const TNode& Source = BinaryNodes[BinaryIndex];
+				SetSlotBounds(OutNodes[WideIndex], Lane, Source.Bounds);
+				if (OutSlotOfBinaryNode)
+				{
+					(*OutSlotOfBinaryNode)[BinaryIndex] = WideIndex * Width + Lane;
+				}
+
+				if (Source.IsLeaf())
+				{
+					OutNodes[WideIndex].Child[Lane] = static_cast<int32>(Source.Start);
+					OutNodes[WideIndex].Count[Lane] = static_cast<int32>(Source.Count);
+					return -1;
+				}
+
+				const int32 NewIndex = static_cast<int32>(OutNodes.size());
+				OutNodes.push_back(MakeEmptyNode<Width>());
+				OutNodes[WideIndex].Child[Lane] = NewIndex;
+				OutNodes[WideIndex].Count[Lane] = 0;
+				return NewIndex;
+			};
+
+		// 루트가 리프면 슬롯 하나짜리 노드
+		if (BinaryNodes[BinaryRoot].IsLeaf())
+		{
+			FillSlot(0, 0, BinaryRoot);
+			return;
+		}
+
+		struct FPending { int64 BinaryIndex; int32 WideIndex; };
+		TArray<FPending> Pending;
+		Pending.push_back({ BinaryRoot, 0 });
+
+		while (!Pending.empty())
+		{
+			const FPending Current = Pending.back();
+			Pending.pop_back();
+
+			int64 Children[Width];
+			int32 NumChildren = 0;
+			Children[NumChildren++] = BinaryNodes[Current.BinaryIndex].Left;
+			Children[NumChildren++] = BinaryNodes[Current.BinaryIndex].Right;
+
+			while (NumChildren < Width)
+			{
+				int32 Expand = -1;
+				float ExpandArea = -1.0f;
+				for (int32 i = 0; i < NumChildren; ++i)
+				{
+					const TNode& Candidate = BinaryNodes[Children[i]];
+					if (Candidate.IsLeaf()) continue;
+
+					const float Area = SurfaceArea(Candidate.Bounds);
+					if (Area > ExpandArea)
+					{
+						ExpandArea = Area;
+						Expand = i;
+					}
+				}
+				if (Expand < 0) break;
+
+				const TNode& Expanded = BinaryNodes[Children[Expand]];
+				Children[Expand] = Expanded.Left;
+				Children[NumChildren++] = Expanded.Right;
+			}
+
+			for (int32 Lane = 0; Lane < NumChildren; ++Lane)
+			{
+				const int32 NewIndex = FillSlot(Current.WideIndex, Lane, Children[Lane]);
+				if (NewIndex >= 0)
+				{
+					Pending.push_back({ Children[Lane], NewIndex });
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief front-to-back 트래버설. 노드마다 자식 전체를 한 번에 검사하고 히트한 자식을 가까운 순으로 방문
+	 * InOutMaxT: 가지치기 거리. VisitLeaf 안에서 더 가까운 히트를 찾으면 호출 측이 줄인다 (같은 변수를 참조)
+	 * VisitLeaf: (Start, Count, TMin) -> void
+	 */
+	template<int32 Width, typename TLeafVisitor>
+	static void TraverseFrontToBack(const TArray<TWideBVHNode<Width>>& Nodes, const FWideRay& Ray, const float& InOutMaxT,
+		TLeafVisitor&& VisitLeaf)
+	{
+		if (Nodes.empty()) return;
+
+		// 리프 슬롯도 스택에 넣어 내부 노드와 같은 거리 순서로 방문한다
+		struct FEntry { int32 Index; int32 Count; float TMin; };
+		TTraversalStack<FEntry, InlineStackSize> Stack;
+		Stack.Push({ 0, 0, 0.0f });
+
+		alignas(32) float TMin[Width];
+		while (!Stack.IsEmpty())
+		{
+			const FEntry Entry = Stack.Pop();
+			if (Entry.TMin > InOutMaxT) continue;
+
+			if (Entry.Count > 0)
+			{
+				VisitLeaf(Entry.Index, Entry.Count, Entry.TMin);
+				continue;
+			}
+
+			const TWideBVHNode<Width>& Node = Nodes[Entry.Index];
+			uint32 HitMask = IntersectNode(Node, Ray, InOutMaxT, TMin);
+			if (HitMask == 0) continue;
+
+			// 히트한 레인을 TMin 내림차순으로 정렬 (먼 쪽을 먼저 push -> 가까운 쪽이 먼저 pop)
+			int32 Sorted[Width];
+			int32 NumHits = 0;
+			while (HitMask)
+			{
+				const int32 Lane = std::countr_zero(HitMask);
+				HitMask &= HitMask - 1;
+
+				int32 Insert = NumHits++;
+				while (Insert > 0 && TMin[Sorted[Insert - 1]] < TMin[Lane])
+				{
+					Sorted[Insert] = Sorted[Insert - 1];
+					--Insert;
+				}
+				Sorted[Insert] = Lane;
+			}
+
+			for (int32 i = 0; i < NumHits; ++i)
+			{
+				const int32 Lane = Sorted[i];
+				Stack.Push({ Node.Child[Lane], Node.Count[Lane], TMin[Lane] });
+			}
+		}
+	}
+
+private:
+	// 균형 잡힌 트리면 충분한 크기 (넘치면 TTraversalStack이 힙으로 옮김)
+	static constexpr int32 InlineStackSize = 256;
+
+	static float ClampMaxT(float MaxT) { return MaxT < std::numeric_limits<float>::max() ? MaxT : std::numeric_limits<float>::max(); }
+
+	static float SurfaceArea(const FAABB& B)
+	{
+		const float Ex = std::max(0.0f, B.Max.X - B.Min.X);
+		const float Ey = std::max(0.0f, B.Max.Y - B.Min.Y);
+		const float Ez = std::max(0.0f, B.Max.Z - B.Min.Z);
+		return 2.0f * (Ex * Ey + Ey * Ez + Ez * Ex);
+	}
+
+	template<int32 Width>
+	static TWideBVHNode<Width> MakeEmptyNode()
+	{
+		TWideBVHNode<Width> Node;
+		for (int32 Lane = 0; Lane < Width; ++Lane)
+		{
+			Node.MinX[Lane] = Node.MinY[Lane] = Node.MinZ[Lane] = std::numeric_limits<float>::infinity();
+			Node.MaxX[Lane] = Node.MaxY[Lane] = Node.MaxZ[Lane] = std::numeric_limits<float>::infinity();
+			Node.Child[Lane] = -1;
+			Node.Count[Lane] = -1;
+		}
+		return Node;
+	}
+};